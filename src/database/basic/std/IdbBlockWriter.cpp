@@ -0,0 +1,270 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+/**
+ * @project		iDB
+ * @file		IdbBlockWriter.cpp
+ * @date		18/10/2026
+ * @version		0.1
+ * @description
+
+
+        Buffered text file writer with section parallel formatting and block parallel gzip compression.
+ *
+ */
+
+#include "IdbBlockWriter.h"
+
+#include <algorithm>
+#include <iostream>
+
+#include "omp.h"
+#include "zlib.h"
+
+namespace idb {
+
+/// size of one output block, each block is one gzip member for the .gz file
+static constexpr size_t kBlockSize = 4 * 1024 * 1024;
+/// records formatted by one task in the parallel section
+static constexpr size_t kRecordChunkSize = 1024;
+
+IdbBlockWriter::~IdbBlockWriter()
+{
+  close();
+}
+
+bool IdbBlockWriter::open(const char* file, bool is_gzip)
+{
+  close();
+
+  _file = fopen(file, is_gzip ? "wb" : "w+");
+  if (_file == nullptr) {
+    return false;
+  }
+
+  _is_gzip = is_gzip;
+  _is_ok = true;
+  _buffer.clear();
+  _blocks.clear();
+  return true;
+}
+
+/**
+ * @brief flush all the buffered text and close the file.
+ *
+ * @return true if all the text is written.
+ */
+bool IdbBlockWriter::close()
+{
+  if (_file == nullptr) {
+    return true;
+  }
+
+  commitBuffer(true);
+  flushBlocks();
+
+  if (fclose(_file) != 0) {
+    _is_ok = false;
+  }
+  _file = nullptr;
+  return _is_ok;
+}
+
+/**
+ * @brief the chunk of the current thread in the parallel section, nullptr out of the section.
+ */
+std::string* IdbBlockWriter::currentChunk()
+{
+  return _thread_chunks.empty() ? nullptr : _thread_chunks[omp_get_thread_num()];
+}
+
+std::string& IdbBlockWriter::currentBuffer()
+{
+  std::string* chunk = currentChunk();
+  return chunk != nullptr ? *chunk : _buffer;
+}
+
+void IdbBlockWriter::write(const char* data, size_t size)
+{
+  currentBuffer().append(data, size);
+  if (currentChunk() == nullptr) {
+    commitBuffer(false);
+  }
+}
+
+/**
+ * @brief append the formatted text, the text is the same as vfprintf.
+ */
+void IdbBlockWriter::writeFormat(const char* format, va_list args)
+{
+  std::string& buffer = currentBuffer();
+
+  char local_data[1024];
+  va_list args_copy;
+  va_copy(args_copy, args);
+  int size = vsnprintf(local_data, sizeof(local_data), format, args_copy);
+  va_end(args_copy);
+
+  if (size < 0) {
+    return;
+  }
+  if (static_cast<size_t>(size) < sizeof(local_data)) {
+    buffer.append(local_data, size);
+  } else {
+    size_t old_size = buffer.size();
+    buffer.resize(old_size + size + 1);
+    vsnprintf(buffer.data() + old_size, size + 1, format, args);
+    buffer.resize(old_size + size);
+  }
+
+  if (currentChunk() == nullptr) {
+    commitBuffer(false);
+  }
+}
+
+/**
+ * @brief write the records [0, record_num) of a section, the records are split into chunks, the chunks are formatted
+ * by multiple threads and appended to the file in the record order. The write_record must write through this writer,
+ * and only read the design data.
+ *
+ * @param record_num
+ * @param write_record write the record of the index.
+ */
+void IdbBlockWriter::writeParallel(size_t record_num, const std::function<void(size_t)>& write_record)
+{
+  if (currentChunk() != nullptr) {
+    // nested section, write in the current chunk.
+    for (size_t index = 0; index < record_num; ++index) {
+      write_record(index);
+    }
+    return;
+  }
+
+  size_t chunk_num = (record_num + kRecordChunkSize - 1) / kRecordChunkSize;
+  // bound the memory by formatting a batch of chunks at a time
+  int thread_num = std::max(1, omp_get_max_threads());
+  size_t batch_chunk_num = thread_num * 4;
+
+  std::vector<std::string> chunks(std::min(chunk_num, batch_chunk_num));
+  // set the chunk of each thread before the record writing, so the writers of other files are not affected.
+  _thread_chunks.assign(thread_num, nullptr);
+  for (size_t batch_begin = 0; batch_begin < chunk_num; batch_begin += batch_chunk_num) {
+    size_t batch_end = std::min(chunk_num, batch_begin + batch_chunk_num);
+
+#pragma omp parallel for schedule(dynamic) num_threads(thread_num)
+    for (size_t chunk_index = batch_begin; chunk_index < batch_end; ++chunk_index) {
+      std::string& chunk = chunks[chunk_index - batch_begin];
+      chunk.clear();
+      _thread_chunks[omp_get_thread_num()] = &chunk;
+      size_t record_end = std::min(record_num, (chunk_index + 1) * kRecordChunkSize);
+      for (size_t index = chunk_index * kRecordChunkSize; index < record_end; ++index) {
+        write_record(index);
+      }
+    }
+
+    for (size_t chunk_index = batch_begin; chunk_index < batch_end; ++chunk_index) {
+      std::string& chunk = chunks[chunk_index - batch_begin];
+      _buffer.append(chunk);
+      commitBuffer(false);
+    }
+  }
+  _thread_chunks.clear();
+}
+
+/**
+ * @brief cut the buffer into the blocks of kBlockSize, so the blocks do not depend on how the text is written, the
+ * blocks are flushed when there are enough blocks for all the threads.
+ */
+void IdbBlockWriter::commitBuffer(bool is_force)
+{
+  size_t offset = 0;
+  while (_buffer.size() - offset >= kBlockSize) {
+    _blocks.emplace_back(_buffer, offset, kBlockSize);
+    offset += kBlockSize;
+  }
+  if (is_force && offset < _buffer.size()) {
+    _blocks.emplace_back(_buffer, offset);
+    offset = _buffer.size();
+  }
+
+  if (offset == 0) {
+    return;
+  }
+  _buffer.erase(0, offset);
+
+  if (!_is_gzip || _blocks.size() >= static_cast<size_t>(std::max(1, omp_get_max_threads()))) {
+    flushBlocks();
+  }
+}
+
+void IdbBlockWriter::flushBlocks()
+{
+  if (_blocks.empty()) {
+    return;
+  }
+
+  if (_is_gzip) {
+    std::vector<std::string> gzip_blocks(_blocks.size());
+    std::vector<char> is_compressed(_blocks.size(), 0);
+#pragma omp parallel for schedule(dynamic)
+    for (size_t i = 0; i < _blocks.size(); ++i) {
+      is_compressed[i] = compressBlock(_blocks[i], gzip_blocks[i]);
+    }
+
+    for (size_t i = 0; i < gzip_blocks.size(); ++i) {
+      if (!is_compressed[i] || fwrite(gzip_blocks[i].data(), 1, gzip_blocks[i].size(), _file) != gzip_blocks[i].size()) {
+        _is_ok = false;
+      }
+    }
+  } else {
+    for (auto& block : _blocks) {
+      if (fwrite(block.data(), 1, block.size(), _file) != block.size()) {
+        _is_ok = false;
+      }
+    }
+  }
+
+  if (!_is_ok) {
+    std::cout << "Write file block failed..." << std::endl;
+  }
+  _blocks.clear();
+}
+
+/**
+ * @brief compress the block to a complete gzip member.
+ */
+bool IdbBlockWriter::compressBlock(const std::string& block, std::string& gzip_block)
+{
+  z_stream stream{};
+  // 16 + MAX_WBITS for the gzip header and trailer
+  if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 16 + MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+    return false;
+  }
+
+  gzip_block.resize(deflateBound(&stream, block.size()));
+  stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(block.data()));
+  stream.avail_in = block.size();
+  stream.next_out = reinterpret_cast<Bytef*>(gzip_block.data());
+  stream.avail_out = gzip_block.size();
+
+  int result = deflate(&stream, Z_FINISH);
+  gzip_block.resize(stream.total_out);
+  deflateEnd(&stream);
+
+  return result == Z_STREAM_END;
+}
+
+}  // namespace idb
@@ -0,0 +1,80 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+#pragma once
+
+/**
+ * @project		iDB
+ * @file		IdbBlockWriter.h
+ * @date		18/10/2026
+ * @version		0.1
+ * @description
+
+
+        Buffered text file writer. The text is written in blocks, the records of a section can be formatted by
+        multiple threads into ordered chunks, so the output is the same as the serial writing. For the .gz file,
+        each block is compressed by a thread to an independent gzip member, the members are concatenated in order.
+ *
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace idb {
+
+class IdbBlockWriter
+{
+ public:
+  IdbBlockWriter() = default;
+  ~IdbBlockWriter();
+  IdbBlockWriter(const IdbBlockWriter&) = delete;
+  IdbBlockWriter& operator=(const IdbBlockWriter&) = delete;
+
+  // getter
+  bool is_open() const { return _file != nullptr; }
+  bool is_gzip() const { return _is_gzip; }
+
+  // operator
+  bool open(const char* file, bool is_gzip);
+  bool close();
+
+  void write(const char* data, size_t size);
+  void write(const std::string& data) { write(data.data(), data.size()); }
+  void writeFormat(const char* format, va_list args);
+  void writeParallel(size_t record_num, const std::function<void(size_t)>& write_record);
+
+ private:
+  FILE* _file = nullptr;
+  bool _is_gzip = false;
+  bool _is_ok = true;
+
+  std::string _buffer;
+  std::vector<std::string> _blocks;
+  /// the chunk of each thread in the parallel section, empty out of the section
+  std::vector<std::string*> _thread_chunks;
+
+  std::string* currentChunk();
+  std::string& currentBuffer();
+  void commitBuffer(bool is_force);
+  void flushBlocks();
+  bool compressBlock(const std::string& block, std::string& gzip_block);
+};
+
+}  // namespace idb
@@ -0,0 +1,134 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+#include <stdarg.h>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include "IdbBlockWriter.h"
+#include "gtest/gtest.h"
+#include "zlib.h"
+
+namespace idb {
+
+class IdbBlockWriterTest : public testing::Test
+{
+ protected:
+  /// the records are large enough for several blocks.
+  static constexpr size_t kRecordNum = 200000;
+
+  std::string filePath(const std::string& name) { return (std::filesystem::temp_directory_path() / name).string(); }
+
+  static void writeFormat(IdbBlockWriter& writer, const char* format, ...)
+  {
+    va_list args;
+    va_start(args, format);
+    writer.writeFormat(format, args);
+    va_end(args);
+  }
+
+  /**
+   * @brief the record like a component, the records of the odd index have a nested section.
+   */
+  static void writeRecord(IdbBlockWriter& writer, size_t index)
+  {
+    writeFormat(writer, "    - u%zu CELL_%zu + PLACED ( %zu %zu ) N", index, index % 97, index * 3, index * 7);
+    if (index % 2 == 1) {
+      writer.writeParallel(2, [&](size_t sub_index) { writeFormat(writer, " + PIN_%zu", sub_index); });
+    }
+    writer.write(" ;\n");
+  }
+
+  bool writeFile(const std::string& file, bool is_gzip, bool is_parallel)
+  {
+    IdbBlockWriter writer;
+    if (!writer.open(file.c_str(), is_gzip)) {
+      return false;
+    }
+
+    writer.write("COMPONENTS\n");
+    if (is_parallel) {
+      writer.writeParallel(kRecordNum, [&](size_t index) { writeRecord(writer, index); });
+    } else {
+      for (size_t index = 0; index < kRecordNum; ++index) {
+        writeRecord(writer, index);
+      }
+    }
+    writer.write("END COMPONENTS\n");
+    return writer.close();
+  }
+
+  static std::string readFile(const std::string& file)
+  {
+    std::ifstream in(file, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+  }
+
+  static std::string readGzipFile(const std::string& file)
+  {
+    std::string text;
+    gzFile gz_file = gzopen(file.c_str(), "rb");
+    if (gz_file == nullptr) {
+      return text;
+    }
+    char data[65536];
+    int size = 0;
+    while ((size = gzread(gz_file, data, sizeof(data))) > 0) {
+      text.append(data, size);
+    }
+    gzclose(gz_file);
+    return text;
+  }
+};
+
+TEST_F(IdbBlockWriterTest, parallel_match_serial)
+{
+  std::string serial_file = filePath("idb_block_writer_serial.def");
+  std::string parallel_file = filePath("idb_block_writer_parallel.def");
+  ASSERT_TRUE(writeFile(serial_file, false, false));
+  ASSERT_TRUE(writeFile(parallel_file, false, true));
+
+  std::string serial_text = readFile(serial_file);
+  EXPECT_GT(serial_text.size(), 2 * 4 * 1024 * 1024UL);
+  EXPECT_EQ(serial_text, readFile(parallel_file));
+
+  std::filesystem::remove(serial_file);
+  std::filesystem::remove(parallel_file);
+}
+
+TEST_F(IdbBlockWriterTest, gzip_parallel_match_serial)
+{
+  std::string plain_file = filePath("idb_block_writer_plain.def");
+  std::string serial_file = filePath("idb_block_writer_serial.def.gz");
+  std::string parallel_file = filePath("idb_block_writer_parallel.def.gz");
+  ASSERT_TRUE(writeFile(plain_file, false, false));
+  ASSERT_TRUE(writeFile(serial_file, true, false));
+  ASSERT_TRUE(writeFile(parallel_file, true, true));
+
+  std::string serial_gzip = readFile(serial_file);
+  EXPECT_EQ(serial_gzip, readFile(parallel_file));
+  // the concatenated gzip members are read as one stream.
+  EXPECT_EQ(readGzipFile(parallel_file), readFile(plain_file));
+
+  std::filesystem::remove(plain_file);
+  std::filesystem::remove(serial_file);
+  std::filesystem::remove(parallel_file);
+}
+
+}  // namespace idb
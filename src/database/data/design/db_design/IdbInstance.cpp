@@ -43,7 +43,6 @@ namespace idb {
 IdbInstance::IdbInstance()
 {
   //_property_map = IdbEnum::GetInstance()->get_instance_property();
-  _name = "";
   //   _master_name = "";
   _cell_master = nullptr;
   _pin_list = new IdbPins();
@@ -415,7 +414,18 @@ void IdbInstanceList::reset(bool delete_memory)
   std::vector<IdbInstance*>().swap(_instance_list);
 }
 
-IdbInstance* IdbInstanceList::find_instance(string name)
+IdbInstance* IdbInstanceList::find_instance(const string& name)
+{
+  // the name not interned is not the name of any instance.
+  auto name_id = ieda::NamePool::getInstance().find(name);
+  if (name_id.empty() && !name.empty()) {
+    return nullptr;
+  }
+
+  return find_instance(name_id);
+}
+
+IdbInstance* IdbInstanceList::find_instance(ieda::Name name)
 {
   auto instance = _instance_map.find(name);
   if (instance != _instance_map.end()) {
@@ -455,7 +465,7 @@ IdbInstance* IdbInstanceList::add_instance(IdbInstance* instance)
   }
   pInstance->set_id(_mutex_index++);
   _instance_list.emplace_back(pInstance);
-  _instance_map.insert(make_pair(instance->get_name(), pInstance));
+  _instance_map.insert(make_pair(pInstance->get_name_id(), pInstance));
 
   return pInstance;
 }
@@ -466,7 +476,7 @@ IdbInstance* IdbInstanceList::add_instance(string name)
   pInstance->set_id(_mutex_index++);
   pInstance->set_name(name);
   _instance_list.emplace_back(pInstance);
-  _instance_map.insert(make_pair(name, pInstance));
+  _instance_map.insert(make_pair(pInstance->get_name_id(), pInstance));
 
   return pInstance;
 }
@@ -480,13 +490,19 @@ IdbInstance* IdbInstanceList::add_instance(string name)
 bool IdbInstanceList::remove_instance(string name)
 {
   /// remove instance from instance list map
-  auto it_map = _instance_map.find(name);
+  auto name_id = ieda::NamePool::getInstance().find(name);
+  if (name_id.empty() && !name.empty()) {
+    return false;
+  }
+
+  auto it_map = _instance_map.find(name_id);
   if (it_map != _instance_map.end()) {
     it_map = _instance_map.erase(it_map);
   }
 
   /// remove instance from instance list
-  auto it = std::find_if(_instance_list.begin(), _instance_list.end(), [name](auto instance) { return name == instance->get_name(); });
+  auto it = std::find_if(_instance_list.begin(), _instance_list.end(),
+                         [name_id](auto instance) { return name_id == instance->get_name_id(); });
   if (it == _instance_list.end()) {
     return false;
   }
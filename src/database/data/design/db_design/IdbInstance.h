@@ -40,6 +40,7 @@
 #include <vector>
 
 #include "../IdbObject.h"
+#include "NamePool.hh"
 // #include "../../../basic/geometry/IdbGeometry.h"
 #include "../IdbEnum.h"
 #include "../IdbOrientTransform.h"
@@ -60,7 +61,8 @@ class IdbInstance : public IdbObject
   ~IdbInstance();
 
   // getter
-  std::string& get_name() { return _name; }
+  const std::string& get_name() const { return _name.str(); }
+  ieda::Name get_name_id() const { return _name; }
   // string get_master_name(){return _cell_master->get_name();}
   IdbCellMaster* get_cell_master() { return _cell_master; }
   IdbPins* get_pin_list() { return _pin_list; }
@@ -108,7 +110,7 @@ class IdbInstance : public IdbObject
   vector<IdbLayerShape*>& get_obs_box_list() { return _obs_box_list; }
 
   // setter
-  void set_name(string name) { _name = name; }
+  void set_name(const string& name) { _name = ieda::internName(name); }
   // void set_cell_master_name(string name){_master_name = name;}
   void set_cell_master(IdbCellMaster* cell_master);
   void set_pin_list();
@@ -146,7 +148,7 @@ class IdbInstance : public IdbObject
   void transformCoordinate(int32_t& coord_x, int32_t& coord_y);
 
  private:
-  std::string _name;
+  ieda::Name _name;  //!< The interned name, the same name is shared by the tools.
   // string _master_name;
   IdbCellMaster* _cell_master;
   IdbPins* _pin_list;
@@ -213,7 +215,8 @@ class IdbInstanceList
   uint64_t get_area_physics();
   uint64_t get_area_clock();
 
-  IdbInstance* find_instance(string name);
+  IdbInstance* find_instance(const string& name);
+  IdbInstance* find_instance(ieda::Name name);
   IdbInstance* find_instance(size_t index);
   vector<IdbInstance*> find_instance_by_master(string master_name);
   bool has_io_cell()
@@ -251,7 +254,7 @@ class IdbInstanceList
  private:
   uint64_t _mutex_index = 0;
   std::vector<IdbInstance*> _instance_list;
-  std::unordered_map<string, IdbInstance*> _instance_map;
+  std::unordered_map<ieda::Name, IdbInstance*, ieda::Name::Hash> _instance_map;
 };
 
 }  // namespace idb
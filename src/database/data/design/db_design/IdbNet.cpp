@@ -43,7 +43,6 @@ namespace idb {
 
 IdbNet::IdbNet()
 {
-  _net_name = "";
   _xtalk = 0;
   _connect_type = IdbConnectType::kNone;
   _source_type = IdbInstanceType::kNone;
@@ -236,15 +235,19 @@ IdbNetList::~IdbNetList()
   _net_list.clear();
 }
 
-IdbNet* IdbNetList::find_net(string name)
+IdbNet* IdbNetList::find_net(const string& name)
 {
-  //   for (IdbNet* net : _net_list) {
-  //     if (net->get_net_name() == name) {
-  //       return net;
-  //     }
-  //   }
+  // the name not interned is not the name of any net.
+  auto name_id = ieda::NamePool::getInstance().find(name);
+  if (name_id.empty() && !name.empty()) {
+    return nullptr;
+  }
+
+  return find_net(name_id);
+}
 
-  //   return nullptr;
+IdbNet* IdbNetList::find_net(ieda::Name name)
+{
   auto net_pair = _net_map.find(name);
   if (net_pair != _net_map.end()) {
     return net_pair->second;
@@ -270,7 +273,7 @@ IdbNet* IdbNetList::add_net(IdbNet* net)
   }
   pNet->set_id(_mutex_index++);
   _net_list.emplace_back(pNet);
-  _net_map.insert(make_pair(pNet->get_net_name(), pNet));
+  _net_map.insert(std::make_pair(pNet->get_net_name_id(), pNet));
 
   return pNet;
 }
@@ -281,7 +284,7 @@ IdbNet* IdbNetList::add_net(string name, IdbConnectType type)
   pNet->set_id(_mutex_index++);
   pNet->set_net_name(name);
   pNet->set_connect_type(type);
-  _net_map.insert(make_pair(name, pNet));
+  _net_map.insert(std::make_pair(pNet->get_net_name_id(), pNet));
   _net_list.emplace_back(pNet);
 
   return pNet;
@@ -296,13 +299,18 @@ IdbNet* IdbNetList::add_net(string name, IdbConnectType type)
 bool IdbNetList::remove_net(string name)
 {
   /// remove net from net map
-  auto it_map = _net_map.find(name);
+  auto name_id = ieda::NamePool::getInstance().find(name);
+  if (name_id.empty() && !name.empty()) {
+    return false;
+  }
+
+  auto it_map = _net_map.find(name_id);
   if (it_map != _net_map.end()) {
     it_map = _net_map.erase(it_map);
   }
 
   /// remove net from netlist
-  auto it = std::find_if(_net_list.begin(), _net_list.end(), [name](auto net) { return name == net->get_net_name(); });
+  auto it = std::find_if(_net_list.begin(), _net_list.end(), [name_id](auto net) { return name_id == net->get_net_name_id(); });
   if (it == _net_list.end()) {
     return false;
   }
@@ -69,6 +69,7 @@ END NETS
 #include "../../../basic/geometry/IdbGeometry.h"
 #include "../IdbObject.h"
 #include "IdbPins.h"
+#include "NamePool.hh"
 #include "IdbRegularWire.h"
 
 namespace idb {
@@ -83,7 +84,8 @@ class IdbNet : public IdbObject
   ~IdbNet();
 
   // getter
-  const string get_net_name() { return _net_name; }
+  const string& get_net_name() const { return _net_name.str(); }
+  ieda::Name get_net_name_id() const { return _net_name; }
   const IdbConnectType get_connect_type() { return _connect_type; }
   bool is_signal() { return _connect_type == IdbConnectType::kSignal ? true : false; }
   bool is_clock() { return _connect_type == IdbConnectType::kClock ? true : false; }
@@ -92,7 +94,7 @@ class IdbNet : public IdbObject
   bool is_ground() { return _connect_type == IdbConnectType::kGround ? true : false; }
   const IdbInstanceType get_source_type() { return _source_type; }
   const int32_t get_weight() { return _weight; }
-  const string get_original_net_name() const { return _original_net_name; }
+  const string& get_original_net_name() const { return _original_net_name.str(); }
   const int32_t get_xtalk() { return _xtalk; }
   const bool is_fix_bump() { return _fix_bump; }
   const double get_frequency() { return _frequency; }
@@ -151,17 +153,17 @@ class IdbNet : public IdbObject
   IdbPin* get_driving_pin();
 
   // setter
-  void set_net_name(string name)
+  void set_net_name(const string& name)
   {
     assert(!name.empty());
-    _net_name = name;
+    _net_name = ieda::internName(name);
   }
   void set_connect_type(IdbConnectType type) { _connect_type = type; }
   void set_connect_type(string type);
 
   void set_source_type(string type);
   void set_weight(int32_t weight) { _weight = weight; }
-  void set_original_net_name(string name) { _original_net_name = name; }
+  void set_original_net_name(const string& name) { _original_net_name = ieda::internName(name); }
   void set_xtalk(int32_t xtalk) { _xtalk = xtalk; }
   void set_fix_bump(bool fix_bump) { _fix_bump = fix_bump; }
   void set_frequency(double frequency) { _frequency = frequency; }
@@ -184,8 +186,8 @@ class IdbNet : public IdbObject
   uint64_t get_via_number();
 
  private:
-  std::string _net_name;
-  std::string _original_net_name;
+  ieda::Name _net_name;  //!< The interned name, the same name is shared by the tools.
+  ieda::Name _original_net_name;
 
   int32_t _weight;
   int32_t _xtalk;
@@ -307,7 +309,8 @@ class IdbNetList
     return number;
   }  
 
-  IdbNet* find_net(string name);
+  IdbNet* find_net(const string& name);
+  IdbNet* find_net(ieda::Name name);
   IdbNet* find_net(size_t index);
 
   // setter
@@ -325,7 +328,7 @@ class IdbNetList
  private:
   uint64_t _mutex_index = 0;
   std::vector<IdbNet*> _net_list;
-  std::unordered_map<string, IdbNet*> _net_map;
+  std::unordered_map<ieda::Name, IdbNet*, ieda::Name::Hash> _net_map;
 };
 
 class IdbCheckNode
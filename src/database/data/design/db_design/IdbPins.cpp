@@ -41,10 +41,8 @@ namespace idb {
 
 IdbPin::IdbPin()
 {
-  _pin_name = "";
   _io_term = nullptr;
   _b_new_term = false;
-  _net_name = "";
   _is_io_pin = false;
   _net = nullptr;
   _special_net = nullptr;
@@ -200,7 +198,7 @@ IdbLayerShape* IdbPin::get_bottom_routing_layer_shape()
   }
 
   if (bottom_layer == nullptr) {
-    std::cout << "[IdbPin Error] : can not find layer shape for this Pin = " << _pin_name << std::endl;
+    std::cout << "[IdbPin Error] : can not find layer shape for this Pin = " << _pin_name.str() << std::endl;
   }
 
   return bottom_layer;
@@ -526,7 +524,7 @@ uint IdbPins::get_connected_pin_num()
 IdbPin* IdbPins::find_pin(IdbPin* pin)
 {
   for (IdbPin* pin_iter : _pin_list) {
-    if (pin_iter->get_pin_name() == pin->get_pin_name() && pin->get_instance() == pin_iter->get_instance()) {
+    if (pin_iter->get_pin_name_id() == pin->get_pin_name_id() && pin->get_instance() == pin_iter->get_instance()) {
       return pin;
     }
   }
@@ -536,8 +534,13 @@ IdbPin* IdbPins::find_pin(IdbPin* pin)
 
 IdbPin* IdbPins::find_pin(string pin_name, std::string instance_name)
 {
+  auto pin_name_id = ieda::NamePool::getInstance().find(pin_name);
+  if (pin_name_id.empty() && !pin_name.empty()) {
+    return nullptr;
+  }
+
   for (IdbPin* pin : _pin_list) {
-    if (pin->get_pin_name() == pin_name) {
+    if (pin->get_pin_name_id() == pin_name_id) {
       if (instance_name == "") {
         return pin;
       } else {
@@ -41,6 +41,7 @@
 #include "../IdbObject.h"
 #include "../db_design/IdbTrackGrid.h"
 #include "../db_layout/IdbTerm.h"
+#include "NamePool.hh"
 
 namespace idb {
 
@@ -55,15 +56,16 @@ class IdbPin : public IdbObject
   ~IdbPin();
 
   // getter
-  const std::string get_pin_name() const { return _pin_name; }
+  const std::string& get_pin_name() const { return _pin_name.str(); }
+  ieda::Name get_pin_name_id() const { return _pin_name; }
   IdbTerm* get_term() { return _io_term; }
   const std::string get_term_name() const { return _io_term->get_name(); }
-  const std::string get_net_name() const { return _net_name; }
+  const std::string& get_net_name() const { return _net_name.str(); }
   bool is_io_pin() { return _is_io_pin; }
   bool is_primary_input();
   bool is_primary_output();
   bool is_flip_flop_clk();
-  bool is_Q_output() { return _pin_name.compare("Q") == 0 ? true : false; }
+  bool is_Q_output() { return _pin_name.str().compare("Q") == 0 ? true : false; }
   IdbNet* get_net() { return _net; }
   bool is_net_pin() { return _net == nullptr ? false : true; }
   IdbSpecialNet* get_special_net() { return _special_net; }
@@ -81,10 +83,10 @@ class IdbPin : public IdbObject
   bool is_multi_layer();
 
   // setter
-  void set_pin_name(std::string pin_name) { _pin_name = pin_name; }
+  void set_pin_name(const std::string& pin_name) { _pin_name = ieda::internName(pin_name); }
   IdbTerm* set_term(IdbTerm* term = nullptr);
   void set_as_io() { _is_io_pin = true; }
-  void set_net_name(std::string net_name) { _net_name = net_name; }
+  void set_net_name(const std::string& net_name) { _net_name = ieda::internName(net_name); }
   void set_net(IdbNet* net) { _net = net; }
   void set_special_net(IdbSpecialNet* net) { _special_net = net; }
   void set_instance(IdbInstance* instance) { _instance = instance; }
@@ -104,7 +106,7 @@ class IdbPin : public IdbObject
   {
     if (_net != nullptr) {
       _net = nullptr;
-      _net_name = "";
+      _net_name = ieda::Name();
     }
   }
 
@@ -114,8 +116,8 @@ class IdbPin : public IdbObject
   bool isIntersected(int x, int y, IdbLayer* layer);
 
  private:
-  std::string _pin_name;
-  std::string _net_name;
+  ieda::Name _pin_name;  //!< The interned pin name, the term name is shared by the pins of all the instances.
+  ieda::Name _net_name;
   IdbTerm* _io_term;
   IdbNet* _net;
   IdbSpecialNet* _special_net;
@@ -0,0 +1,106 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+#include <string>
+
+#include "IdbInstance.h"
+#include "IdbNet.h"
+#include "NamePool.hh"
+#include "gtest/gtest.h"
+
+namespace idb {
+
+TEST(IdbNameTest, find_instance)
+{
+  IdbInstanceList instance_list;
+  IdbInstance* inst = instance_list.add_instance("idb_name_test/u0");
+  IdbInstance* unnamed_inst = instance_list.add_instance();
+
+  EXPECT_EQ(instance_list.find_instance("idb_name_test/u0"), inst);
+  EXPECT_EQ(instance_list.find_instance(std::string("idb_name_test/u0")), inst);
+  EXPECT_EQ(instance_list.find_instance(inst->get_name_id()), inst);
+  EXPECT_EQ(instance_list.find_instance(""), unnamed_inst);
+
+  // the name never interned is not the name of any instance, and the lookup does not intern it.
+  EXPECT_EQ(instance_list.find_instance("idb_name_test/not_interned_u0"), nullptr);
+  EXPECT_TRUE(ieda::NamePool::getInstance().find("idb_name_test/not_interned_u0").empty());
+
+  // the name interned by other object is not the name of the instance.
+  ieda::internName("idb_name_test/other_u0");
+  EXPECT_EQ(instance_list.find_instance("idb_name_test/other_u0"), nullptr);
+}
+
+TEST(IdbNameTest, remove_instance)
+{
+  IdbInstanceList instance_list;
+  instance_list.add_instance("idb_name_test/u1");
+  instance_list.add_instance("idb_name_test/u2");
+  instance_list.add_instance();
+
+  EXPECT_FALSE(instance_list.remove_instance("idb_name_test/not_interned_u1"));
+  EXPECT_EQ(instance_list.get_num(), 3);
+
+  EXPECT_TRUE(instance_list.remove_instance("idb_name_test/u1"));
+  EXPECT_EQ(instance_list.find_instance("idb_name_test/u1"), nullptr);
+  EXPECT_FALSE(instance_list.remove_instance("idb_name_test/u1"));
+  EXPECT_EQ(instance_list.get_num(), 2);
+
+  EXPECT_TRUE(instance_list.remove_instance(""));
+  EXPECT_EQ(instance_list.find_instance(""), nullptr);
+  EXPECT_EQ(instance_list.get_num(), 1);
+  EXPECT_NE(instance_list.find_instance("idb_name_test/u2"), nullptr);
+}
+
+TEST(IdbNameTest, find_net)
+{
+  IdbNetList net_list;
+  IdbNet* net = net_list.add_net("idb_name_test/n0");
+  IdbNet* unnamed_net = net_list.add_net();
+
+  EXPECT_EQ(net_list.find_net("idb_name_test/n0"), net);
+  EXPECT_EQ(net_list.find_net(std::string("idb_name_test/n0")), net);
+  EXPECT_EQ(net_list.find_net(net->get_net_name_id()), net);
+  EXPECT_EQ(net_list.find_net(""), unnamed_net);
+
+  EXPECT_EQ(net_list.find_net("idb_name_test/not_interned_n0"), nullptr);
+  EXPECT_TRUE(ieda::NamePool::getInstance().find("idb_name_test/not_interned_n0").empty());
+
+  ieda::internName("idb_name_test/other_n0");
+  EXPECT_EQ(net_list.find_net("idb_name_test/other_n0"), nullptr);
+}
+
+TEST(IdbNameTest, remove_net)
+{
+  IdbNetList net_list;
+  net_list.add_net("idb_name_test/n1");
+  net_list.add_net("idb_name_test/n2");
+  net_list.add_net();
+
+  EXPECT_FALSE(net_list.remove_net("idb_name_test/not_interned_n1"));
+  EXPECT_EQ(net_list.get_num(), 3U);
+
+  EXPECT_TRUE(net_list.remove_net("idb_name_test/n1"));
+  EXPECT_EQ(net_list.find_net("idb_name_test/n1"), nullptr);
+  EXPECT_FALSE(net_list.remove_net("idb_name_test/n1"));
+  EXPECT_EQ(net_list.get_num(), 2U);
+
+  EXPECT_TRUE(net_list.remove_net(""));
+  EXPECT_EQ(net_list.find_net(""), nullptr);
+  EXPECT_EQ(net_list.get_num(), 1U);
+  EXPECT_NE(net_list.find_net("idb_name_test/n2"), nullptr);
+}
+
+}  // namespace idb
@@ -270,7 +270,11 @@ void IdbBuilder::saveVerilog(std::string verilog_file_name, std::set<std::string
   writer.writeModule();
 }
 
-bool IdbBuilder::saveGDSII(string file)
+/**
+ * @brief Save the design to the GDSII text file, the stream writer is opt-in, which encode the structs in parallel and
+ * reference the instances by SREF, so its output differ from the default writer.
+ */
+bool IdbBuilder::saveGDSII(string file, bool is_stream)
 {
   if (IdbDefServiceResult::kServiceFailed == _def_service->DefFileWriteInit(file.c_str())) {
     std::cout << "Create GDSII file failed..." << endl;
@@ -278,7 +282,7 @@ bool IdbBuilder::saveGDSII(string file)
   }
 
   std::shared_ptr<Def2GdsWrite> gds_write = std::make_shared<Def2GdsWrite>(_def_service);
-  return gds_write->writeDb(file.c_str());
+  return is_stream ? gds_write->writeDbStream(file.c_str()) : gds_write->writeDb(file.c_str());
 }
 
 bool IdbBuilder::saveJSON(string file, string options)
@@ -77,7 +77,7 @@ class IdbBuilder
   // Write def
   bool saveDef(string file, DefWriteType type = DefWriteType::kChip);
   void saveVerilog(std::string verilog_file_name, std::set<std::string>& exclude_cell_names, bool is_add_space_for_escape_name);
-  bool saveGDSII(string file);
+  bool saveGDSII(string file, bool is_stream = false);
   bool saveJSON(string file, string options);
 
   // Write layout
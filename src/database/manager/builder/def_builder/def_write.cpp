@@ -50,7 +50,6 @@ namespace idb {
 DefWrite::DefWrite(IdbDefService* def_service, DefWriteType type)
 {
   _def_service = def_service;
-  _file_write = nullptr;
   _type = type;
 }
 
@@ -69,16 +68,13 @@ bool DefWrite::initFile(const char* file)
   // Creating a compressed format handle
   if (ieda::Str::contain(file, ".gz")) {
     _font = SaveFormat::kGzip;
-    _file_write_gz = gzopen(file, "w");
-
-    if (_file_write_gz == nullptr) {
+    if (!_writer.open(file, true)) {
       std::cout << "Open gz file failed..." << std::endl;
       return false;
     }
   } else {
     _font = SaveFormat::kDef;
-    _file_write = fopen(file, "w+");
-    if (_file_write == nullptr) {
+    if (!_writer.open(file, false)) {
       std::cout << "Open def file failed..." << std::endl;
       return false;
     }
@@ -94,24 +90,12 @@ bool DefWrite::initFile(const char* file)
  */
 bool DefWrite::closeFile()
 {
-  bool result;
-  switch (_font) {
-    case SaveFormat::kGzip:
-      result = gzclose(_file_write_gz);
-      _file_write_gz = nullptr;
-      break;
-
-    case SaveFormat::kDef:
-    default:
-      result = fclose(_file_write);
-      _file_write = nullptr;
-      break;
-  }
-  return result;
+  return _writer.close();
 }
 
 /**
- * @brief Write formatted string data to the output file.
+ * @brief Write formatted string data to the output file, in a parallel section the data is written to the chunk of
+ * the current thread.
  * 
  * @param strdata Formatted string data.
  */
@@ -119,14 +103,7 @@ void DefWrite::writestr(const char* strdata, ...)
 {
   va_list args;
   va_start(args, strdata);
-  switch (_font) {
-    case SaveFormat::kDef:
-      vfprintf(_file_write, strdata, args);
-      break;
-    case SaveFormat::kGzip:
-      gzvprintf(_file_write_gz, strdata, args);
-      break;
-  }
+  _writer.writeFormat(strdata, args);
   va_end(args);
 }
 
@@ -350,7 +327,9 @@ int32_t DefWrite::write_via()
 
   writestr("VIAS %ld ;\n", via_list->get_num_via());
 
-  for (IdbVia* via : via_list->get_via_list()) {
+  auto& vias = via_list->get_via_list();
+  _writer.writeParallel(vias.size(), [&](size_t index) {
+    IdbVia* via = vias[index];
     IdbViaMaster* via_master = via->get_instance();
 
     if (via_master->is_generate()) {
@@ -372,7 +351,7 @@ int32_t DefWrite::write_via()
 
       writestr(" ;\n");
     }
-  }
+  });
 
   writestr("END VIAS\n \n");
 
@@ -420,7 +399,9 @@ int32_t DefWrite::write_component()
 
   writestr("COMPONENTS %d ;\n", instance_list->get_num());
 
-  for (IdbInstance* instance : instance_list->get_instance_list()) {
+  auto& instances = instance_list->get_instance_list();
+  _writer.writeParallel(instances.size(), [&](size_t index) {
+    IdbInstance* instance = instances[index];
     string type = instance->get_type() != IdbInstanceType::kNone
                       ? "+ SOURCE " + IdbEnum::GetInstance()->get_instance_property()->get_type_str(instance->get_type())
                       : "";
@@ -450,7 +431,7 @@ int32_t DefWrite::write_component()
     }
 
     writestr("      ;\n");
-  }
+  });
 
   writestr("END COMPONENTS\n \n");
 
@@ -719,7 +700,9 @@ int32_t DefWrite::write_special_net()
 
   writestr("SPECIALNETS %ld ;\n", special_net_list->get_num());
 
-  for (IdbSpecialNet* special_net : special_net_list->get_net_list()) {
+  auto& special_nets = special_net_list->get_net_list();
+  _writer.writeParallel(special_nets.size(), [&](size_t index) {
+    IdbSpecialNet* special_net = special_nets[index];
     writestr("- %s ", special_net->get_net_name().c_str());
 
     if (special_net->get_pin_string_list().size() > 0) {
@@ -746,7 +729,7 @@ int32_t DefWrite::write_special_net()
     }
 
     writestr(" ;\n");
-  }
+  });
 
   writestr("END SPECIALNETS\n \n");
 
@@ -771,7 +754,9 @@ int32_t DefWrite::write_net()
 
   writestr("NETS %ld ;\n", net_list->get_num());
 
-  for (IdbNet* net : net_list->get_net_list()) {
+  auto& nets = net_list->get_net_list();
+  _writer.writeParallel(nets.size(), [&](size_t index) {
+    IdbNet* net = nets[index];
     // std::string net_name = net->get_net_name();
     // std::string net_name_new = ieda::Str::addBackslash(net_name);
     writestr("- %s", net->get_net_name().c_str());
@@ -800,7 +785,7 @@ int32_t DefWrite::write_net()
     }
 
     writestr(" ;\n");
-  }
+  });
 
   writestr("END NETS\n \n");
 
@@ -37,7 +37,7 @@
 #include <vector>
 
 #include "../def_service/def_service.h"
-#include "zlib.h"
+#include "IdbBlockWriter.h"
 
 namespace idb {
 
@@ -124,8 +124,7 @@ class DefWrite
   clock_t _start_time;
   clock_t _end_time;
 
-  FILE* _file_write;
-  gzFile _file_write_gz;
+  IdbBlockWriter _writer;
   DefWriteType _type;
 
   SaveFormat _font;
@@ -33,6 +33,9 @@
 
 #include "gds_write.h"
 
+#include <algorithm>
+#include <sstream>
+
 #include "../../../data/design/IdbDesign.h"
 #include "omp.h"
 
@@ -86,6 +89,11 @@ bool Def2GdsWrite::writeChip()
 
 void Def2GdsWrite::addStruct(GdsStruct* gds_struct)
 {
+  if (_is_stream) {
+    writeStreamStruct(gds_struct);
+    return;
+  }
+
   _gds.add_struct(gds_struct);
 
   if (_gds.is_full()) {
@@ -95,6 +103,10 @@ void Def2GdsWrite::addStruct(GdsStruct* gds_struct)
 
 void Def2GdsWrite::writeStruct()
 {
+  if (_is_stream) {
+    return;
+  }
+
   _writer.writeStruct();
 }
 
@@ -553,7 +565,11 @@ int32_t Def2GdsWrite::write_specialnet_wire_segment_via(GdsStruct* gds_struct, I
     return kDbFail;
   }
 
-  packVia(gds_struct, segment->get_via());
+  if (_is_stream) {
+    addViaSRef(gds_struct, segment->get_via());
+  } else {
+    packVia(gds_struct, segment->get_via());
+  }
 
   if (segment->get_point_list().size() >= _POINT_MAX_) {
     return write_specialnet_wire_segment_points(gds_struct, segment);
@@ -753,7 +769,11 @@ int32_t Def2GdsWrite::write_net_wire_segment_via(GdsStruct* gds_struct, IdbRegul
     return kDbFail;
   }
 
-  packVia(gds_struct, segment->get_via_list().at(_POINT_START_));
+  if (_is_stream) {
+    addViaSRef(gds_struct, segment->get_via_list().at(_POINT_START_));
+  } else {
+    packVia(gds_struct, segment->get_via_list().at(_POINT_START_));
+  }
 
   if (segment->get_point_number() >= _POINT_MAX_) {
     return write_net_wire_segment_points(gds_struct, segment);
@@ -855,4 +875,368 @@ int32_t Def2GdsWrite::write_fill()
   return kDbSuccess;
 }
 
+/**
+ * @brief write gds by stream, the structs of instances and nets are built and encoded into per-thread buffers, then the
+ * buffers are written to file in order, so the whole chip is never held in memory. Instances of the same cell master and
+ * orient share one struct, vias of the same master share one struct, they are referenced by SREF.
+ *
+ * @param file
+ * @return true
+ * @return false
+ */
+bool Def2GdsWrite::writeDbStream(const char* file)
+{
+  if (!openStreamFile(file)) {
+    return false;
+  }
+
+  _is_stream = true;
+
+  set_units();
+
+  std::ostringstream header_buffer;
+  GdsiiTextWriter header_writer(&_gds, &header_buffer);
+  header_writer.begin();
+  writeStreamBuffer(header_buffer.str());
+
+  write_version();
+  write_design();
+  write_die();
+
+  writeStreamTopStruct();
+
+  write_pin();
+  writeStreamComponent();
+  write_fill();
+  writeStreamSpecialNet();
+  writeStreamNet();
+  writeStreamVia();
+
+  std::ostringstream end_buffer;
+  GdsiiTextWriter end_writer(nullptr, &end_buffer);
+  end_writer.write_endlib();
+  writeStreamBuffer(end_buffer.str());
+
+  _is_stream = false;
+
+  return closeStreamFile();
+}
+
+bool Def2GdsWrite::openStreamFile(const char* file)
+{
+  string file_name = file;
+  _is_gzip = file_name.find(".gz") != string::npos;
+  if (_is_gzip) {
+    _file_write_gz = gzopen(file, "w");
+    if (_file_write_gz == nullptr) {
+      std::cout << "Open gz file failed..." << std::endl;
+      return false;
+    }
+  } else {
+    file_write = fopen(file, "w");
+    if (file_write == nullptr) {
+      std::cout << "Open gds file failed..." << std::endl;
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool Def2GdsWrite::closeStreamFile()
+{
+  bool result = true;
+  if (_is_gzip) {
+    result = gzclose(_file_write_gz) == Z_OK;
+    _file_write_gz = nullptr;
+  } else {
+    result = fclose(file_write) == 0;
+    file_write = nullptr;
+  }
+
+  return result;
+}
+
+void Def2GdsWrite::writeStreamBuffer(const string& buffer)
+{
+  if (buffer.empty()) {
+    return;
+  }
+
+  if (_is_gzip) {
+    gzwrite(_file_write_gz, buffer.data(), buffer.size());
+  } else {
+    fwrite(buffer.data(), 1, buffer.size(), file_write);
+  }
+}
+
+/**
+ * @brief encode one struct and write to file, the struct is deleted.
+ *
+ * @param gds_struct
+ */
+void Def2GdsWrite::writeStreamStruct(GdsStruct* gds_struct)
+{
+  std::ostringstream buffer;
+  GdsiiTextWriter encoder(nullptr, &buffer);
+  encoder.writeStruct(gds_struct);
+  writeStreamBuffer(buffer.str());
+
+  delete gds_struct;
+}
+
+/**
+ * @brief build the structs of obj list in parallel, each thread encode a continuous range of one batch into its own
+ * buffer, then the buffers are written in thread order, so the output order is the same as the obj list.
+ *
+ * @param obj_list
+ * @param build_struct return the struct of obj, or nullptr if no need to write.
+ */
+template <typename T, typename BuildStruct>
+void Def2GdsWrite::writeStreamStructList(const vector<T*>& obj_list, BuildStruct build_struct)
+{
+  int num_threads = omp_get_max_threads();
+  vector<std::ostringstream> thread_buffers(num_threads);
+
+  for (size_t batch_begin = 0; batch_begin < obj_list.size(); batch_begin += _stream_batch_size) {
+    size_t batch_end = std::min(obj_list.size(), batch_begin + _stream_batch_size);
+    size_t range_size = (batch_end - batch_begin + num_threads - 1) / num_threads;
+
+#pragma omp parallel for num_threads(num_threads) schedule(static, 1)
+    for (int thread_id = 0; thread_id < num_threads; ++thread_id) {
+      GdsiiTextWriter encoder(nullptr, &thread_buffers[thread_id]);
+
+      size_t range_begin = std::min(batch_end, batch_begin + thread_id * range_size);
+      size_t range_end = std::min(batch_end, range_begin + range_size);
+      for (size_t i = range_begin; i < range_end; ++i) {
+        GdsStruct* gds_struct = build_struct(obj_list[i]);
+        if (gds_struct != nullptr) {
+          encoder.writeStruct(gds_struct);
+          delete gds_struct;
+        }
+      }
+    }
+
+    for (auto& thread_buffer : thread_buffers) {
+      writeStreamBuffer(thread_buffer.str());
+      thread_buffer.str("");
+    }
+  }
+}
+
+/**
+ * @brief the top struct is written before the other structs, the SREF are added and encoded by batch.
+ *
+ */
+void Def2GdsWrite::writeStreamTopStruct()
+{
+  if (_top_struct == nullptr) {
+    return;
+  }
+
+  std::ostringstream buffer;
+  GdsiiTextWriter encoder(nullptr, &buffer);
+
+  encoder.writeStructBegin(_top_struct);
+  encoder.writeStructElements(_top_struct);
+
+  GdsStruct sref_struct;
+  auto add_sref = [&](const string& name, int32_t x, int32_t y) {
+    GdsSref sref;
+    sref.add_coord(x, y);
+    sref.sname = name;
+    sref_struct.add_element(sref);
+
+    if (sref_struct.get_element_list().size() >= _stream_batch_size) {
+      encoder.writeStructElements(&sref_struct);
+      sref_struct.clear_element_list();
+      writeStreamBuffer(buffer.str());
+      buffer.str("");
+    }
+  };
+
+  IdbDesign* design = _def_service->get_design();
+  IdbInstanceList* instance_list = design->get_instance_list();
+  if (instance_list != nullptr) {
+    for (IdbInstance* instance : instance_list->get_instance_list()) {
+      auto* coordinate = instance->get_coordinate();
+      add_sref(getCellStructName(instance), transDB2Unit(coordinate->get_x()), transDB2Unit(coordinate->get_y()));
+    }
+  }
+
+  IdbFillList* fill_list = design->get_fill_list();
+  if (fill_list != nullptr && fill_list->get_num_fill() > 0) {
+    add_sref("Fills", 0, 0);
+  }
+
+  IdbSpecialNetList* special_net_list = design->get_special_net_list();
+  if (special_net_list != nullptr) {
+    for (IdbSpecialNet* special_net : special_net_list->get_net_list()) {
+      add_sref(special_net->get_net_name(), 0, 0);
+    }
+  }
+
+  IdbNetList* net_list = design->get_net_list();
+  if (net_list != nullptr) {
+    for (IdbNet* net : net_list->get_net_list()) {
+      add_sref(net->get_net_name(), 0, 0);
+    }
+  }
+
+  encoder.writeStructElements(&sref_struct);
+  encoder.writeStructEnd();
+  writeStreamBuffer(buffer.str());
+
+  delete _top_struct;
+  _top_struct = nullptr;
+  _gds.set_top_struct(nullptr);
+}
+
+string Def2GdsWrite::getCellStructName(IdbInstance* instance)
+{
+  string orient = IdbEnum::GetInstance()->get_site_property()->get_orient_name(instance->get_orient());
+  return "Cell_" + instance->get_cell_master()->get_name() + "_" + orient;
+}
+
+/**
+ * @brief pack the instance shapes relative to the instance coordinate, which are the same for all the instances of one
+ * cell master and orient.
+ *
+ * @param gds_struct
+ * @param instance
+ * @return GdsStruct*
+ */
+GdsStruct* Def2GdsWrite::buildInstanceStruct(GdsStruct* gds_struct, IdbInstance* instance)
+{
+  /// instance boundingbox
+  packRect(gds_struct, instance->get_bounding_box(), 0);
+
+  /// pins
+  for (auto pin : instance->get_pin_list()->get_pin_list()) {
+    packPin(gds_struct, pin);
+  }
+
+  /// obs
+  for (auto obs_shape : instance->get_obs_box_list()) {
+    packLayerShape(gds_struct, obs_shape);
+  }
+
+  auto* coordinate = instance->get_coordinate();
+  gds_struct->translate(-transDB2Unit(coordinate->get_x()), -transDB2Unit(coordinate->get_y()));
+
+  return gds_struct;
+}
+
+/**
+ * @brief write one struct for each cell master and orient.
+ *
+ */
+void Def2GdsWrite::writeStreamComponent()
+{
+  IdbDesign* design = _def_service->get_design();
+  IdbInstanceList* instance_list = design->get_instance_list();
+  if (instance_list == nullptr || instance_list->get_num() == 0) {
+    std::cout << "Write COMPONENTS failed..." << std::endl;
+    return;
+  }
+
+  std::map<string, IdbInstance*> cell_instance_map;
+  for (IdbInstance* instance : instance_list->get_instance_list()) {
+    cell_instance_map.emplace(getCellStructName(instance), instance);
+  }
+
+  vector<IdbInstance*> cell_instance_list;
+  for (auto& [cell_name, instance] : cell_instance_map) {
+    cell_instance_list.push_back(instance);
+  }
+
+  writeStreamStructList(cell_instance_list, [this](IdbInstance* instance) {
+    return buildInstanceStruct(new GdsStruct(getCellStructName(instance)), instance);
+  });
+
+  std::cout << "Write COMPONENTS success. " << instance_list->get_num() << " instances, " << cell_instance_list.size()
+            << " cells." << std::endl;
+}
+
+GdsStruct* Def2GdsWrite::buildSpecialNetStruct(IdbSpecialNet* special_net)
+{
+  GdsStruct* gds_struct = new GdsStruct(special_net->get_net_name());
+
+  for (IdbSpecialWire* wire : special_net->get_wire_list()->get_wire_list()) {
+    write_specialnet_wire(gds_struct, wire);
+  }
+
+  return gds_struct;
+}
+
+void Def2GdsWrite::writeStreamSpecialNet()
+{
+  IdbSpecialNetList* special_net_list = _def_service->get_design()->get_special_net_list();
+  if (special_net_list == nullptr || special_net_list->get_num() == 0) {
+    std::cout << "No SPECIALNETS..." << std::endl;
+    return;
+  }
+
+  writeStreamStructList(special_net_list->get_net_list(),
+                        [this](IdbSpecialNet* special_net) { return buildSpecialNetStruct(special_net); });
+}
+
+GdsStruct* Def2GdsWrite::buildNetStruct(IdbNet* net)
+{
+  GdsStruct* gds_struct = new GdsStruct(net->get_net_name());
+
+  if (net->get_wire_list()->get_num() > 0) {
+    for (IdbRegularWire* wire : net->get_wire_list()->get_wire_list()) {
+      write_net_wire(gds_struct, wire);
+    }
+  }
+
+  return gds_struct;
+}
+
+void Def2GdsWrite::writeStreamNet()
+{
+  IdbNetList* net_list = _def_service->get_design()->get_net_list();
+  if (net_list == nullptr || net_list->get_num() == 0) {
+    std::cout << "No NET To Write..." << std::endl;
+    return;
+  }
+
+  writeStreamStructList(net_list->get_net_list(), [this](IdbNet* net) { return buildNetStruct(net); });
+
+  std::cout << "Write NETS success. " << net_list->get_num() << " / " << net_list->get_num() << std::endl;
+}
+
+/**
+ * @brief reference the via struct by SREF, the via master is recorded to write struct later.
+ *
+ * @param gds_struct
+ * @param via
+ */
+void Def2GdsWrite::addViaSRef(GdsStruct* gds_struct, IdbVia* via)
+{
+  {
+    std::lock_guard<std::mutex> lock(_via_mutex);
+    _stream_via_map.emplace(via->get_name(), via);
+  }
+
+  GdsSref sref;
+  sref.add_coord(transDB2Unit(via->get_coordinate()->get_x()), transDB2Unit(via->get_coordinate()->get_y()));
+  sref.sname = getViaStructName(via);
+  gds_struct->add_element(sref);
+}
+
+void Def2GdsWrite::writeStreamVia()
+{
+  for (auto& [via_name, via] : _stream_via_map) {
+    GdsStruct* gds_struct = new GdsStruct(getViaStructName(via));
+    packVia(gds_struct, via);
+    gds_struct->translate(-transDB2Unit(via->get_coordinate()->get_x()), -transDB2Unit(via->get_coordinate()->get_y()));
+
+    writeStreamStruct(gds_struct);
+  }
+
+  _stream_via_map.clear();
+}
+
 }  // namespace idb
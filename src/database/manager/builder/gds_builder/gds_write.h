@@ -33,11 +33,14 @@
 #include <time.h>
 
 #include <iostream>
+#include <map>
+#include <mutex>
 #include <string>
 #include <vector>
 
 #include "../def_service/def_service.h"
 #include "GTWriter.hpp"
+#include "zlib.h"
 
 namespace idb {
 
@@ -96,6 +99,9 @@ class Def2GdsWrite
   bool writeDb(const char* file);
   bool writeChip();
 
+  /// stream writer, encode structs into per-thread buffers and write to file in order, gzip if file name contains ".gz"
+  bool writeDbStream(const char* file);
+
  private:
   IdbDefService* _def_service;
   int32_t _index = 0;
@@ -106,9 +112,13 @@ class Def2GdsWrite
 
   GdsiiTextWriter _writer;
   GdsData _gds;
-  GdsStruct* _top_struct;
+  GdsStruct* _top_struct = nullptr;
   void addSRefDefault(string name)
   {
+    if (_is_stream) {
+      /// the SREF has been written with the top struct
+      return;
+    }
     GdsSref sref;
     sref.add_coord(0, 0);
     sref.sname = name;
@@ -118,6 +128,32 @@ class Def2GdsWrite
   void addStruct(GdsStruct* gds_struct);
   void writeStruct();
 
+  /// stream writer
+  bool _is_stream = false;
+  bool _is_gzip = false;
+  gzFile _file_write_gz = nullptr;
+  std::mutex _via_mutex;
+  std::map<string, IdbVia*> _stream_via_map;  //!< via name to one via instance, each via master write one struct.
+  static constexpr size_t _stream_batch_size = 100000;
+
+  bool openStreamFile(const char* file);
+  bool closeStreamFile();
+  void writeStreamBuffer(const string& buffer);
+  void writeStreamStruct(GdsStruct* gds_struct);
+  template <typename T, typename BuildStruct>
+  void writeStreamStructList(const vector<T*>& obj_list, BuildStruct build_struct);
+  void writeStreamTopStruct();
+  void writeStreamComponent();
+  void writeStreamSpecialNet();
+  void writeStreamNet();
+  void writeStreamVia();
+  string getCellStructName(IdbInstance* instance);
+  string getViaStructName(IdbVia* via) { return "VIA_" + via->get_name(); }
+  GdsStruct* buildInstanceStruct(GdsStruct* gds_struct, IdbInstance* instance);
+  GdsStruct* buildSpecialNetStruct(IdbSpecialNet* special_net);
+  GdsStruct* buildNetStruct(IdbNet* net);
+  void addViaSRef(GdsStruct* gds_struct, IdbVia* via);
+
   int32_t _unit_microns = -1;
   int32_t transDB2Unit(int32_t value)
   {
@@ -0,0 +1,226 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "builder.h"
+#include "gds_write.h"
+#include "gtest/gtest.h"
+#include "omp.h"
+#include "zlib.h"
+
+namespace idb {
+
+/// a small placed and routed design with 2 orients of 3 cell masters
+static const char* kTestDef = R"(VERSION 5.8 ;
+DIVIDERCHAR "/" ;
+BUSBITCHARS "[]" ;
+DESIGN gds_stream_test ;
+UNITS DISTANCE MICRONS 1000 ;
+DIEAREA ( 0 0 ) ( 40000 40000 ) ;
+ROW ROW_0 unithd 0 0 N DO 80 BY 1 STEP 460 0 ;
+ROW ROW_1 unithd 0 2720 FS DO 80 BY 1 STEP 460 0 ;
+COMPONENTS 6 ;
+- u0 sky130_fd_sc_hd__inv_1 + PLACED ( 1380 0 ) N ;
+- u1 sky130_fd_sc_hd__inv_1 + PLACED ( 4600 0 ) N ;
+- u2 sky130_fd_sc_hd__inv_1 + PLACED ( 1380 2720 ) FS ;
+- u3 sky130_fd_sc_hd__nand2_1 + PLACED ( 9200 0 ) N ;
+- u4 sky130_fd_sc_hd__nand2_1 + PLACED ( 9200 2720 ) FS ;
+- u5 sky130_fd_sc_hd__buf_1 + PLACED ( 13800 0 ) N ;
+END COMPONENTS
+PINS 1 ;
+- in + NET in + DIRECTION INPUT + USE SIGNAL
+  + LAYER met2 ( -140 -140 ) ( 140 140 )
+  + PLACED ( 1000 39860 ) N ;
+END PINS
+SPECIALNETS 1 ;
+- VPWR ( * VPWR ) + USE POWER
+  + ROUTED met1 480 + SHAPE FOLLOWPIN ( 0 2720 ) ( 40000 2720 )
+  NEW met2 480 + SHAPE STRIPE ( 20000 0 ) ( 20000 40000 )
+  NEW met1 0 + SHAPE STRIPE ( 20000 2720 ) M1M2_PR ;
+END SPECIALNETS
+NETS 3 ;
+- in ( PIN in ) ( u0 A ) + USE SIGNAL
+  + ROUTED met2 ( 1000 39860 ) ( 1000 20000 ) M1M2_PR
+  NEW met1 ( 1000 20000 ) ( 1610 * ) ;
+- n1 ( u0 Y ) ( u3 A ) + USE SIGNAL
+  + ROUTED met1 ( 1610 1530 ) ( 9430 * ) M1M2_PR
+  NEW met2 ( 9430 1530 ) ( * 3000 ) M1M2_PR ;
+- n2 ( u3 Y ) ( u5 A ) + USE SIGNAL ;
+END NETS
+END DESIGN
+)";
+
+class GdsWriteTest : public testing::Test
+{
+ protected:
+  void SetUp() override
+  {
+    std::string def_file = filePath("gds_stream_test.def");
+    std::ofstream(def_file) << kTestDef;
+
+    vector<string> lef_files = {std::string(IDB_TEST_LEF_DIR) + "/sky130_fd_sc_hd.tlef",
+                                std::string(IDB_TEST_LEF_DIR) + "/sky130_fd_sc_hd_merged.lef"};
+    _builder.buildLef(lef_files, true);
+    ASSERT_NE(_builder.buildDef(def_file), nullptr);
+    std::filesystem::remove(def_file);
+  }
+
+  std::string filePath(const std::string& name) { return (std::filesystem::temp_directory_path() / name).string(); }
+
+  /**
+   * @brief write the gds by stream with the thread num, return the text.
+   */
+  std::string writeStream(const std::string& name, int num_threads)
+  {
+    std::string file = filePath(name);
+    int max_threads = omp_get_max_threads();
+    omp_set_num_threads(num_threads);
+    Def2GdsWrite gds_write(_builder.get_def_service());
+    bool is_written = gds_write.writeDbStream(file.c_str());
+    omp_set_num_threads(max_threads);
+    EXPECT_TRUE(is_written);
+
+    std::string text = file.find(".gz") != std::string::npos ? readGzipFile(file) : readFile(file);
+    std::filesystem::remove(file);
+    return text;
+  }
+
+  static std::string readFile(const std::string& file)
+  {
+    std::ifstream in(file, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+  }
+
+  static std::string readGzipFile(const std::string& file)
+  {
+    std::string text;
+    gzFile gz_file = gzopen(file.c_str(), "rb");
+    if (gz_file == nullptr) {
+      return text;
+    }
+    char data[65536];
+    int size = 0;
+    while ((size = gzread(gz_file, data, sizeof(data))) > 0) {
+      text.append(data, size);
+    }
+    gzclose(gz_file);
+    return text;
+  }
+
+  /**
+   * @brief the timestamps of the lib and structs are the writing time, drop them to compare the output of two runs.
+   */
+  static std::string dropTimestamp(const std::string& text)
+  {
+    std::istringstream in(text);
+    std::string result;
+    std::string line;
+    while (std::getline(in, line)) {
+      if (line.rfind("BGNLIB ", 0) == 0 || line.rfind("BGNSTR ", 0) == 0) {
+        line = line.substr(0, 6);
+      }
+      result += line + "\n";
+    }
+    return result;
+  }
+
+  /**
+   * @brief the SNAME list of each struct.
+   */
+  static std::map<std::string, vector<string>> structSRefs(const std::string& text)
+  {
+    std::map<std::string, vector<string>> struct_srefs;
+    std::istringstream in(text);
+    std::string line;
+    std::string struct_name;
+    while (std::getline(in, line)) {
+      if (line.rfind("STRNAME ", 0) == 0) {
+        struct_name = line.substr(8);
+        EXPECT_EQ(struct_srefs.count(struct_name), 0U) << "duplicate struct " << struct_name;
+        struct_srefs[struct_name];
+      } else if (line.rfind("SNAME ", 0) == 0) {
+        struct_srefs[struct_name].push_back(line.substr(6));
+      }
+    }
+    return struct_srefs;
+  }
+
+  IdbBuilder _builder;
+};
+
+TEST_F(GdsWriteTest, stream_struct_list)
+{
+  auto struct_srefs = structSRefs(writeStream("gds_stream_test.gds", 1));
+
+  // one struct per cell master and orient
+  vector<string> cell_structs;
+  // one struct per via master
+  vector<string> via_structs;
+  for (auto& [struct_name, srefs] : struct_srefs) {
+    if (struct_name.rfind("Cell_", 0) == 0) {
+      cell_structs.push_back(struct_name);
+    } else if (struct_name.rfind("VIA_", 0) == 0) {
+      via_structs.push_back(struct_name);
+    }
+  }
+  EXPECT_EQ(cell_structs,
+            vector<string>({"Cell_sky130_fd_sc_hd__buf_1_N", "Cell_sky130_fd_sc_hd__inv_1_FS", "Cell_sky130_fd_sc_hd__inv_1_N",
+                            "Cell_sky130_fd_sc_hd__nand2_1_FS", "Cell_sky130_fd_sc_hd__nand2_1_N"}));
+  EXPECT_EQ(via_structs, vector<string>({"VIA_M1M2_PR"}));
+
+  // the top struct references each instance by its cell struct, then the special nets and nets
+  ASSERT_EQ(struct_srefs.count("DIEAREA"), 1U);
+  EXPECT_EQ(struct_srefs["DIEAREA"],
+            vector<string>({"Cell_sky130_fd_sc_hd__inv_1_N", "Cell_sky130_fd_sc_hd__inv_1_N", "Cell_sky130_fd_sc_hd__inv_1_FS",
+                            "Cell_sky130_fd_sc_hd__nand2_1_N", "Cell_sky130_fd_sc_hd__nand2_1_FS", "Cell_sky130_fd_sc_hd__buf_1_N", "VPWR",
+                            "in", "n1", "n2"}));
+
+  // the referenced structs are all written
+  for (auto& [struct_name, srefs] : struct_srefs) {
+    for (auto& sref : srefs) {
+      EXPECT_EQ(struct_srefs.count(sref), 1U) << struct_name << " references missing struct " << sref;
+    }
+  }
+  // the vias of the nets are referenced
+  EXPECT_EQ(struct_srefs["VPWR"], vector<string>({"VIA_M1M2_PR"}));
+  EXPECT_EQ(struct_srefs["in"], vector<string>({"VIA_M1M2_PR"}));
+  EXPECT_EQ(struct_srefs["n1"], vector<string>({"VIA_M1M2_PR", "VIA_M1M2_PR"}));
+}
+
+TEST_F(GdsWriteTest, stream_parallel_match_serial)
+{
+  std::string serial_text = dropTimestamp(writeStream("gds_stream_serial.gds", 1));
+  std::string parallel_text = dropTimestamp(writeStream("gds_stream_parallel.gds", 4));
+  EXPECT_FALSE(serial_text.empty());
+  EXPECT_EQ(serial_text, parallel_text);
+}
+
+TEST_F(GdsWriteTest, stream_gzip_match_plain)
+{
+  std::string plain_text = dropTimestamp(writeStream("gds_stream_plain.gds", 4));
+  std::string gzip_text = dropTimestamp(writeStream("gds_stream_gzip.gds.gz", 4));
+  EXPECT_FALSE(plain_text.empty());
+  EXPECT_EQ(plain_text, gzip_text);
+}
+
+}  // namespace idb
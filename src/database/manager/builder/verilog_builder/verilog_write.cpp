@@ -24,6 +24,7 @@
 #include "verilog_write.h"
 
 #include <cassert>
+#include <cstdarg>
 #include <map>
 #include <regex>
 
@@ -39,12 +40,24 @@ VerilogWriter::VerilogWriter(const char* file_name, std::set<std::string>& exclu
       _idb_design(idb_design),
       _is_add_space_for_escape_name(is_add_space_for_escape_name)
 {
-  _stream = std::fopen(file_name, "w");
+  _writer.open(file_name, ieda::Str::contain(file_name, ".gz"));
 }
 
 VerilogWriter::~VerilogWriter()
 {
-  std::fclose(_stream);
+  _writer.close();
+}
+
+/**
+ * @brief write the formatted string, in a parallel section the string is written to the chunk of the current thread.
+ *
+ */
+void VerilogWriter::writestr(const char* format, ...)
+{
+  va_list args;
+  va_start(args, format);
+  _writer.writeFormat(format, args);
+  va_end(args);
 }
 
 /**
@@ -53,26 +66,27 @@ VerilogWriter::~VerilogWriter()
  */
 void VerilogWriter::writeModule()
 {
-  if (!_stream) {
+  if (!_writer.is_open()) {
     LOG_INFO << "File" << _file_name << "NotWritable";
+    return;
   }
   LOG_INFO << "start write verilog file " << _file_name;
 
-  fprintf(_stream, "//Generate the verilog at %s\n", ieda::Time::getNowWallTime());
+  writestr("//Generate the verilog at %s\n", ieda::Time::getNowWallTime());
 
-  fprintf(_stream, "module %s (", _idb_design.get_design_name().c_str());
-  fprintf(_stream, "\n");
+  writestr("module %s (", _idb_design.get_design_name().c_str());
+  writestr("\n");
   writePorts();
-  fprintf(_stream, "\n");
+  writestr("\n");
   writePortDcls();
-  fprintf(_stream, "\n");
+  writestr("\n");
   writeWire();
-  fprintf(_stream, "\n");
+  writestr("\n");
   writeAssign();
-  fprintf(_stream, "\n");
+  writestr("\n");
   writeInstances();
-  fprintf(_stream, "\n");
-  fprintf(_stream, "endmodule\n");
+  writestr("\n");
+  writestr("endmodule\n");
 
   LOG_INFO << "finish write verilog file " << _file_name;
 }
@@ -105,10 +119,10 @@ void VerilogWriter::writePorts()
         || io_pin->get_term()->get_direction() == IdbConnectDirection::kOutput
         || io_pin->get_term()->get_direction() == IdbConnectDirection::kInOut) {
       if (!first) {
-        fprintf(_stream, ",\n");
+        writestr(",\n");
       }
 
-      fprintf(_stream, "%s", pin_name.c_str());
+      writestr("%s", pin_name.c_str());
       first = false;
     }
   }
@@ -127,16 +141,16 @@ void VerilogWriter::writePorts()
     }
 
     if (!first) {
-      fprintf(_stream, ",\n");
+      writestr(",\n");
     }
 
     bus_processed.insert(pin_bus_name);
 
-    fprintf(_stream, "%s", pin_bus_name.c_str());
+    writestr("%s", pin_bus_name.c_str());
     first = false;
   }
 
-  fprintf(_stream, "\n);\n");
+  writestr("\n);\n");
 }
 
 /**
@@ -167,11 +181,11 @@ void VerilogWriter::writePortDcls()
     IdbConnectDirection port_dir = io_pin->get_term()->get_direction();
 
     if (port_dir == IdbConnectDirection::kInput) {
-      fprintf(_stream, "input %s ;\n", pin_name.c_str());
+      writestr("input %s ;\n", pin_name.c_str());
     } else if (port_dir == IdbConnectDirection::kOutput) {
-      fprintf(_stream, "output %s ;\n", pin_name.c_str());
+      writestr("output %s ;\n", pin_name.c_str());
     } else if (port_dir == IdbConnectDirection::kInOut) {
-      fprintf(_stream, "inout %s ;\n", pin_name.c_str());
+      writestr("inout %s ;\n", pin_name.c_str());
     } else {
       continue;
     }
@@ -201,11 +215,11 @@ void VerilogWriter::writePortDcls()
     const char* bus_range = ieda::Str::printf("[%d:%d]", bus_left, bus_right);
 
     if (port_dir == IdbConnectDirection::kInput) {
-      fprintf(_stream, "input %s %s ;\n", bus_range, pin_bus_name.c_str());
+      writestr("input %s %s ;\n", bus_range, pin_bus_name.c_str());
     } else if (port_dir == IdbConnectDirection::kOutput) {
-      fprintf(_stream, "output %s %s ;\n", bus_range, pin_bus_name.c_str());
+      writestr("output %s %s ;\n", bus_range, pin_bus_name.c_str());
     } else if (port_dir == IdbConnectDirection::kInOut) {
-      fprintf(_stream, "inout %s %s ;\n", bus_range, pin_bus_name.c_str());
+      writestr("inout %s %s ;\n", bus_range, pin_bus_name.c_str());
     } else {
       continue;
     }
@@ -245,7 +259,7 @@ void VerilogWriter::writeWire()
 
     std::string new_net_name = replace_str(net_name, R"(\\)", "");
     std::string escape_net_name = escapeName(new_net_name);
-    fprintf(_stream, "wire %s ;\n", escape_net_name.c_str());
+    writestr("wire %s ;\n", escape_net_name.c_str());
   }
 
   std::set<std::string> bus_processed;
@@ -281,7 +295,7 @@ void VerilogWriter::writeWire()
 
     std::string escape_bus_net_name = escapeName(net_bus_name);
 
-    fprintf(_stream, "wire [%d:%d] %s ;\n", bus_left, bus_right, escape_bus_net_name.c_str());
+    writestr("wire [%d:%d] %s ;\n", bus_left, bus_right, escape_bus_net_name.c_str());
   }
 }
 
@@ -297,12 +311,12 @@ void VerilogWriter::writeAssign()
     for (const auto& io_pin : net->get_io_pins()->get_pin_list()) {
       // assign net=input_port;
       if (io_pin->get_term()->get_direction() == IdbConnectDirection::kInput && io_pin->get_pin_name() != net_name) {
-        fprintf(_stream, "assign %s = %s ;\n", net_name.c_str(), io_pin->get_pin_name().c_str());
+        writestr("assign %s = %s ;\n", net_name.c_str(), io_pin->get_pin_name().c_str());
       }
       // assign net=input_port;
       // assign output_port = input_port;
       if (io_pin->get_term()->get_direction() == IdbConnectDirection::kOutput && io_pin->get_pin_name() != net_name) {
-        fprintf(_stream, "assign %s = %s ;\n", io_pin->get_pin_name().c_str(), net_name.c_str());
+        writestr("assign %s = %s ;\n", io_pin->get_pin_name().c_str(), net_name.c_str());
       }
     }
   }
@@ -316,12 +330,17 @@ void VerilogWriter::writeInstances()
 {
   std::vector<IdbInstance*> instance_list = _idb_design.get_instance_list()->get_instance_list();
 
+  std::vector<IdbInstance*> write_instance_list;
+  write_instance_list.reserve(instance_list.size());
   for (const auto& instance : instance_list) {
     if (std::string inst_cell_name = instance->get_cell_master()->get_name(); _exclude_cell_names.contains(inst_cell_name)) {
       continue;
     }
-    writeInstance(instance);
+    write_instance_list.push_back(instance);
   }
+
+  // instances are formatted in parallel and written in the original order.
+  _writer.writeParallel(write_instance_list.size(), [&](size_t index) { writeInstance(write_instance_list[index]); });
 }
 
 /**
@@ -341,7 +360,7 @@ void VerilogWriter::writeInstance(IdbInstance* inst)
   std::string new_inst_name = replace_str(inst_name, R"(\\)", "");
   std::string inst_escape_name = escapeName(new_inst_name);
 
-  fprintf(_stream, "%s %s ( ", inst_cell_name.c_str(), inst_escape_name.c_str());
+  writestr("%s %s ( ", inst_cell_name.c_str(), inst_escape_name.c_str());
 
   bool first_pin = true;
   vector<IdbPin*> pin_list = inst->get_pin_list()->get_pin_list();
@@ -373,10 +392,10 @@ void VerilogWriter::writeInstance(IdbInstance* inst)
     pin_net_name = escapeName(pin_net_name);
 
     if (!first_pin) {
-      fprintf(_stream, ", ");
+      writestr(", ");
     }
 
-    fprintf(_stream, ".%s(%s )", pin_name.c_str(), pin_net_name.c_str());
+    writestr(".%s(%s )", pin_name.c_str(), pin_net_name.c_str());
     first_pin = false;
   }
 
@@ -433,15 +452,15 @@ void VerilogWriter::writeInstance(IdbInstance* inst)
     concate_str += " }";
 
     if (!first_pin) {
-      fprintf(_stream, ", ");
+      writestr(", ");
     }
 
-    fprintf(_stream, ".%s(%s )", pin_bus_name.c_str(), concate_str.c_str());
+    writestr(".%s(%s )", pin_bus_name.c_str(), concate_str.c_str());
 
     first_pin = false;
   }
 
-  fprintf(_stream, " );\n");
+  writestr(" );\n");
 }
 
 /**
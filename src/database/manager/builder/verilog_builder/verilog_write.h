@@ -29,6 +29,7 @@
 #include <string>
 #include <vector>
 
+#include "IdbBlockWriter.h"
 #include "IdbDesign.h"
 #include "IdbEnum.h"
 #include "def_service.h"
@@ -55,12 +56,13 @@ class VerilogWriter
   void writeAssign();
   void writeInstances();
   void writeInstance(IdbInstance* inst);
+  void writestr(const char* format, ...);
 
  private:
   const char* _file_name;
   std::set<std::string> _exclude_cell_names;
 
-  FILE* _stream;
+  IdbBlockWriter _writer;
   IdbDesign& _idb_design;
   bool _is_add_space_for_escape_name;
 };
@@ -27,11 +27,18 @@ GdsiiTextWriter::GdsiiTextWriter()
 GdsiiTextWriter::GdsiiTextWriter(GdsData* data, const std::string txt)
 {
   _data = data;
-  _stream = new std::ofstream(txt, std::ios::out);
-  if (_stream != nullptr && _stream->is_open()) {
-    _stream->close();
-    _stream = nullptr;
+  _file_stream = new std::ofstream(txt, std::ios::out);
+  if (_file_stream != nullptr && _file_stream->is_open()) {
+    _file_stream->close();
+    _file_stream = nullptr;
   }
+  _stream = _file_stream;
+}
+
+GdsiiTextWriter::GdsiiTextWriter(GdsData* data, std::ostream* stream)
+{
+  _data = data;
+  _stream = stream;
 }
 
 GdsiiTextWriter::~GdsiiTextWriter()
@@ -45,16 +52,17 @@ bool GdsiiTextWriter::init(std::string txt, GdsData* data)
     return false;
   }
 
-  if (_stream != nullptr) {
-    delete _stream;
+  if (_file_stream != nullptr) {
+    delete _file_stream;
   }
 
-  _stream = new std::ofstream(txt, std::ios::out);
-  if (_stream != nullptr && !_stream->is_open()) {
-    _stream->close();
-    _stream = nullptr;
+  _file_stream = new std::ofstream(txt, std::ios::out);
+  if (_file_stream != nullptr && !_file_stream->is_open()) {
+    _file_stream->close();
+    _file_stream = nullptr;
     return false;
   }
+  _stream = _file_stream;
 
   if (data != _data) {
     delete _data;
@@ -66,7 +74,9 @@ bool GdsiiTextWriter::init(std::string txt, GdsData* data)
 
 bool GdsiiTextWriter::close()
 {
-  _stream->close();
+  if (_file_stream != nullptr) {
+    _file_stream->close();
+  }
 
   return true;
 }
@@ -75,7 +85,9 @@ void GdsiiTextWriter::flush()
 {
   _stream->flush();
 
-  _data->clear_struct_list();
+  if (_data != nullptr) {
+    _data->clear_struct_list();
+  }
 }
 
 bool GdsiiTextWriter::begin()
@@ -216,13 +228,7 @@ void GdsiiTextWriter::write_units() const
 void GdsiiTextWriter::writeTopStruct()
 {
   GdsStruct* str = _data->get_top_struct();
-  write_bgnstr(str);
-  write_strname(str);
-  // write_strclass( str);
-  for (GdsElemBase* e : str->get_element_list()) {
-    write_struct_element(e);
-  }
-  write_endstr();
+  writeStruct(str);
 
   /// @brief clear
   flush();
@@ -232,19 +238,40 @@ void GdsiiTextWriter::writeStruct()
 {
   for (GdsStruct* str : _data->get_struct_list()) {
     // <structure>
-    write_bgnstr(str);
-    write_strname(str);
-    // write_strclass( str);
-    for (GdsElemBase* e : str->get_element_list()) {
-      write_struct_element(e);
-    }
-    write_endstr();
+    writeStruct(str);
   }
 
   /// @brief clear
   flush();
 }
 
+// write one structure without flush, used to encode struct to buffer.
+void GdsiiTextWriter::writeStruct(GdsStruct* str) const
+{
+  writeStructBegin(str);
+  writeStructElements(str);
+  writeStructEnd();
+}
+
+void GdsiiTextWriter::writeStructBegin(GdsStruct* str) const
+{
+  write_bgnstr(str);
+  write_strname(str);
+  // write_strclass( str);
+}
+
+void GdsiiTextWriter::writeStructElements(GdsStruct* str) const
+{
+  for (GdsElemBase* e : str->get_element_list()) {
+    write_struct_element(e);
+  }
+}
+
+void GdsiiTextWriter::writeStructEnd() const
+{
+  write_endstr();
+}
+
 void GdsiiTextWriter::write_endlib() const
 {
   (*_stream) << "ENDLIB" << std::endl;
@@ -16,6 +16,9 @@
 // ***************************************************************************************
 #pragma once
 
+#include <fstream>
+#include <ostream>
+
 #include "GdsAref.hpp"
 #include "GdsBoundary.hpp"
 #include "GdsBox.hpp"
@@ -35,6 +38,8 @@ class GdsiiTextWriter
   // constructor
   GdsiiTextWriter();
   GdsiiTextWriter(GdsData* data, const std::string txt = "");
+  // encode to the stream owned by caller, such as a string buffer.
+  GdsiiTextWriter(GdsData* data, std::ostream* stream);
   ~GdsiiTextWriter();
 
   // getter
@@ -47,6 +52,10 @@ class GdsiiTextWriter
   // setter
   void writeTopStruct();
   void writeStruct();
+  void writeStruct(GdsStruct*) const;
+  void writeStructBegin(GdsStruct*) const;
+  void writeStructElements(GdsStruct*) const;
+  void writeStructEnd() const;
   void write_endlib() const;
   // function
   //   bool write();
@@ -55,7 +64,8 @@ class GdsiiTextWriter
  private:
   // members
   GdsData* _data = nullptr;
-  std::ofstream* _stream = nullptr;
+  std::ostream* _stream = nullptr;
+  std::ofstream* _file_stream = nullptr;
 
   void flush();
 
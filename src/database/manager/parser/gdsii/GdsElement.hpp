@@ -72,6 +72,7 @@ class GdsElemBase
 
   // function
   void remove_property(int16_t);
+  void translate(int32_t dx, int32_t dy) { _xy.translate(dx, dy); }
   void reset_base();
   virtual void reset() = 0;
 
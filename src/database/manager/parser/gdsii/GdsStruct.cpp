@@ -58,6 +58,14 @@ void GdsStruct::clear_element_list()
   _element_list.clear();
 }
 
+// move all the elements by (dx, dy)
+void GdsStruct::translate(int32_t dx, int32_t dy)
+{
+  for (auto e : _element_list) {
+    e->translate(dx, dy);
+  }
+}
+
 void GdsStruct::add_element(const GdsElement& e)
 {
   auto cpy = new GdsElement();
@@ -66,6 +66,7 @@ class GdsStruct
   // function
   void clear();
   void clear_element_list();
+  void translate(int32_t dx, int32_t dy);
 
  private:
   // members
@@ -45,6 +45,13 @@ class GdsXY
 
   // function
   void clear() { _coords.clear(); }
+  void translate(int32_t dx, int32_t dy)
+  {
+    for (auto& coord : _coords) {
+      coord.x += dx;
+      coord.y += dy;
+    }
+  }
 
  private:
   std::vector<XYCoordinate> _coords;
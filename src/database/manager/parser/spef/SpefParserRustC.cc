@@ -19,4 +19,16 @@ bool SpefRustReader::read(std::string file_path) {
   return true;
 }
 
-}  // namespace ista
\ No newline at end of file
+/**
+ * @brief open spef file for stream read.
+ *
+ * @param file_path
+ * @return true
+ * @return false
+ */
+bool SpefRustStreamReader::open(std::string file_path) {
+  _rust_spef_stream = rust_spef_stream_open(file_path.c_str());
+  return _rust_spef_stream != nullptr;
+}
+
+}  // namespace ista
@@ -27,6 +27,14 @@ void rust_free_spef_net(void*);
 void rust_free_spef_conn(void*);
 void rust_free_spef_net_cap_res(void*);
 
+void* rust_spef_stream_open(const char* spef_path);
+void* rust_spef_stream_get_data(void* c_spef_stream);
+void* rust_spef_stream_next_chunk(void* c_spef_stream, uintptr_t max_net_num);
+bool rust_spef_stream_has_error(void* c_spef_stream);
+struct RustVec rust_spef_stream_chunk_nets(void* c_spef_chunk);
+void rust_free_spef_stream_chunk(void* c_spef_chunk);
+void rust_free_spef_stream(void* c_spef_stream);
+
 typedef struct RustSpefCoord
 {
   double _x;
@@ -131,4 +139,42 @@ class SpefRustReader
   RustSpefFile* _spef_file = nullptr;  //!< The converted spef file data.
 };
 
-}  // namespace ista
\ No newline at end of file
+/**
+ * @brief The spef stream reader, the header, name map and ports are read when
+ * open, the nets are read chunk by chunk with the name expanded.
+ *
+ */
+class SpefRustStreamReader
+{
+ public:
+  SpefRustStreamReader() = default;
+  ~SpefRustStreamReader()
+  {
+    if (_rust_spef_stream) {
+      rust_free_spef_stream(_rust_spef_stream);
+    }
+  }
+
+  SpefRustStreamReader(const SpefRustStreamReader&) = delete;
+  SpefRustStreamReader& operator=(const SpefRustStreamReader&) = delete;
+
+  bool open(std::string file_path);
+
+  /**
+   * @brief read the next chunk nets, return nullptr when reach the file end or
+   * the read failed, the chunk should be freed by freeChunk after all nets are
+   * used.
+   */
+  void* nextChunk(std::size_t max_net_num) { return rust_spef_stream_next_chunk(_rust_spef_stream, max_net_num); }
+  bool hasError() { return rust_spef_stream_has_error(_rust_spef_stream); }
+  static RustVec getChunkNets(void* chunk) { return rust_spef_stream_chunk_nets(chunk); }
+  static void freeChunk(void* chunk) { rust_free_spef_stream_chunk(chunk); }
+
+  char* getSpefCapUnit() { return rust_get_spef_cap_unit(rust_spef_stream_get_data(_rust_spef_stream)); }
+  char* getSpefResUnit() { return rust_get_spef_res_unit(rust_spef_stream_get_data(_rust_spef_stream)); }
+
+ private:
+  void* _rust_spef_stream = nullptr;  //!< The rust spef stream reader.
+};
+
+}  // namespace ista
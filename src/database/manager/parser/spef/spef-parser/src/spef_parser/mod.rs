@@ -7,6 +7,9 @@ use pest_derive::Parser;
 
 use std::fmt::Debug;
 use std::fs;
+use std::fs::File;
+use std::io::BufRead;
+use std::io::BufReader;
 
 use std::time::Instant;
 
@@ -383,39 +386,31 @@ fn process_cap_or_res_entry(
     }
 }
 
-pub fn parse_spef_file(spef_file_path: &str) -> spef_data::SpefExchange {
-    let start_time = Instant::now();
-
-    let unparsed_file = fs::read_to_string(spef_file_path).unwrap();
-    let spef_entries = SpefParser::parse(Rule::spef_file, &unparsed_file).unwrap();
-
-    let mut exchange_data = spef_data::SpefExchange::new(spef_file_path.to_string());
-
-    let mut current_net: spef_data::SpefNet = spef_data::SpefNet::new(0, "None".to_string(), 0.0);
-    let mut current_section: spef_data::SectionType = spef_data::SectionType::HEADER;
-
+/// process the pest pairs of a spef text, the header, name map, ports and nets are added to the exchange data.
+fn process_spef_text(
+    spef_text: &str,
+    exchange_data: &mut spef_data::SpefExchange,
+    current_net: &mut spef_data::SpefNet,
+    current_section: &mut spef_data::SectionType,
+) {
+    let spef_entries = SpefParser::parse(Rule::spef_file, spef_text).unwrap();
     let spef_file_pair = spef_entries.into_iter().next().unwrap();
 
     for entry in spef_file_pair.into_inner() {
-        // let entry_clone = entry.clone();
-        // println!("Rule:    {:?}", entry_clone.as_rule());
-        // println!("Span:    {:?}", entry_clone.as_span());
-        // println!("Text:    {}", entry_clone.as_str());
-
-        // let line_no = entry.line_col().0;
-        // println!("line no {}", line_no);
-
         match entry.as_rule() {
             Rule::section => {
                 // Section entries are not included in SpefParserData, it is used as a label for this function.
                 let parse_result = process_section_entry(entry);
                 match parse_result {
                     Ok(result) => {
-                        current_section = result.get_section_type().clone();
+                        *current_section = result.get_section_type().clone();
                         match current_section {
                             spef_data::SectionType::END => {
-                                exchange_data.add_net(current_net);
-                                current_net = spef_data::SpefNet::new(0, "None".to_string(), 0.0);
+                                let finished_net = std::mem::replace(
+                                    current_net,
+                                    spef_data::SpefNet::new(0, "None".to_string(), 0.0),
+                                );
+                                exchange_data.add_net(finished_net);
                             }
                             _ => (),
                         };
@@ -453,7 +448,7 @@ pub fn parse_spef_file(spef_file_path: &str) -> spef_data::SpefExchange {
             Rule::dnet_entry => {
                 // Config the current_net to record the net staring here.
                 // This part doesn't return anything, it edits the current net members.
-                let _ = process_dnet_entry(entry, &mut current_net);
+                let _ = process_dnet_entry(entry, current_net);
             }
             Rule::conn_entry => {
                 // Parse the connection entry and add it to the current_net.
@@ -469,7 +464,7 @@ pub fn parse_spef_file(spef_file_path: &str) -> spef_data::SpefExchange {
             Rule::cap_or_res_entry => {
                 // Parse the cap or res entry and add it to the current_net according to the current_section
                 // This part doesn't return anything, it adds caps or ress to current net.
-                let parse_result = process_cap_or_res_entry(entry, &current_section);
+                let parse_result = process_cap_or_res_entry(entry, current_section);
                 match parse_result {
                     Ok(result) => {
                         match current_section {
@@ -489,6 +484,19 @@ pub fn parse_spef_file(spef_file_path: &str) -> spef_data::SpefExchange {
             _ => panic!("unkonwn rule {}.", entry.as_str()),
         };
     }
+}
+
+pub fn parse_spef_file(spef_file_path: &str) -> spef_data::SpefExchange {
+    let start_time = Instant::now();
+
+    let unparsed_file = fs::read_to_string(spef_file_path).unwrap();
+
+    let mut exchange_data = spef_data::SpefExchange::new(spef_file_path.to_string());
+
+    let mut current_net: spef_data::SpefNet = spef_data::SpefNet::new(0, "None".to_string(), 0.0);
+    let mut current_section: spef_data::SectionType = spef_data::SectionType::HEADER;
+
+    process_spef_text(&unparsed_file, &mut exchange_data, &mut current_net, &mut current_section);
 
     let elapsed_us = measure_elapsed_time(start_time);
     println!("read spef file {} elapsed time: {} s", spef_file_path, elapsed_us);
@@ -496,6 +504,97 @@ pub fn parse_spef_file(spef_file_path: &str) -> spef_data::SpefExchange {
     exchange_data
 }
 
+/// Streaming spef reader, the header, name map and ports are parsed when open,
+/// the *D_NET sections are then read and parsed chunk by chunk, so that only
+/// the nets of the current chunk are hold in memory.
+pub struct SpefStreamReader {
+    reader: BufReader<File>,
+    pending_line: Option<String>,
+    exchange_data: spef_data::SpefExchange,
+    io_error: Option<std::io::Error>,
+}
+
+impl SpefStreamReader {
+    /// open the spef file and parse the part before the first *D_NET.
+    pub fn open(spef_file_path: &str) -> std::io::Result<SpefStreamReader> {
+        let file = File::open(spef_file_path)?;
+        let mut stream_reader = SpefStreamReader {
+            reader: BufReader::with_capacity(1 << 20, file),
+            pending_line: None,
+            exchange_data: spef_data::SpefExchange::new(spef_file_path.to_string()),
+            io_error: None,
+        };
+
+        let mut prefix_text = String::new();
+        while let Some(line) = stream_reader.read_line()? {
+            if line.trim_start().starts_with("*D_NET") {
+                stream_reader.pending_line = Some(line);
+                break;
+            }
+            prefix_text.push_str(&line);
+        }
+
+        if !prefix_text.trim().is_empty() {
+            let mut current_net = spef_data::SpefNet::new(0, "None".to_string(), 0.0);
+            let mut current_section = spef_data::SectionType::HEADER;
+            process_spef_text(&prefix_text, &mut stream_reader.exchange_data, &mut current_net, &mut current_section);
+        }
+
+        Ok(stream_reader)
+    }
+
+    pub fn get_exchange_data(&mut self) -> &mut spef_data::SpefExchange {
+        &mut self.exchange_data
+    }
+
+    /// record the io error of next_chunk, the error is not treated as the file end.
+    pub fn set_io_error(&mut self, err: std::io::Error) {
+        self.io_error = Some(err);
+    }
+
+    pub fn has_io_error(&self) -> bool {
+        self.io_error.is_some()
+    }
+
+    fn read_line(&mut self) -> std::io::Result<Option<String>> {
+        let mut line = String::new();
+        match self.reader.read_line(&mut line)? {
+            0 => Ok(None),
+            _ => Ok(Some(line)),
+        }
+    }
+
+    /// read at most max_net_num nets, return empty vec when reach the file end.
+    pub fn next_chunk(&mut self, max_net_num: usize) -> std::io::Result<Vec<spef_data::SpefNet>> {
+        let mut chunk_text = String::new();
+        let mut net_num = 0;
+        while net_num < max_net_num {
+            let line = match self.pending_line.take() {
+                Some(line) => line,
+                None => match self.read_line()? {
+                    Some(line) => line,
+                    None => break,
+                },
+            };
+
+            if line.trim_start().starts_with("*END") {
+                net_num += 1;
+            }
+            chunk_text.push_str(&line);
+        }
+
+        if chunk_text.trim().is_empty() {
+            return Ok(Vec::new());
+        }
+
+        let mut current_net = spef_data::SpefNet::new(0, "None".to_string(), 0.0);
+        let mut current_section = spef_data::SectionType::HEADER;
+        process_spef_text(&chunk_text, &mut self.exchange_data, &mut current_net, &mut current_section);
+
+        Ok(std::mem::take(&mut self.exchange_data.nets))
+    }
+}
+
 #[cfg(test)]
 mod tests {
 
@@ -551,6 +650,79 @@ mod tests {
         print_parse_result(parse_result);
     }
 
+    /// write the simple spef with the net copied net_num times to a unique temp file.
+    fn write_stream_test_spef(file_tag: &str, net_num: usize, tail_bytes: &[u8]) -> std::path::PathBuf {
+        let simple_spef = fs::read_to_string(concat!(env!("CARGO_MANIFEST_DIR"), "/example/simple.spef")).unwrap();
+        let dnet_pos = simple_spef.find("*D_NET").unwrap();
+        let (prefix_text, net_text) = simple_spef.split_at(dnet_pos);
+
+        let mut spef_bytes = prefix_text.as_bytes().to_vec();
+        for net_index in 1..=net_num {
+            let net_text = net_text.replacen("*D_NET *1 ", &format!("*D_NET *{} ", net_index), 1);
+            spef_bytes.extend_from_slice(net_text.as_bytes());
+            spef_bytes.push(b'\n');
+        }
+        spef_bytes.extend_from_slice(tail_bytes);
+
+        let spef_path = std::env::temp_dir().join(format!("spef_stream_{}_{}.spef", file_tag, std::process::id()));
+        fs::write(&spef_path, spef_bytes).unwrap();
+        spef_path
+    }
+
+    #[test]
+    fn test_stream_read_match_parse() {
+        let spef_path = write_stream_test_spef("match", 17, b"");
+        let spef_path_str = spef_path.to_str().unwrap();
+
+        let exchange_data = parse_spef_file(spef_path_str);
+
+        let mut stream_reader = SpefStreamReader::open(spef_path_str).unwrap();
+        let mut stream_nets = Vec::new();
+        loop {
+            let chunk_nets = stream_reader.next_chunk(3).unwrap();
+            if chunk_nets.is_empty() {
+                break;
+            }
+            assert!(chunk_nets.len() <= 3);
+            stream_nets.extend(chunk_nets);
+        }
+        fs::remove_file(&spef_path).unwrap();
+
+        assert_eq!(stream_reader.get_exchange_data().ports.len(), exchange_data.ports.len());
+        assert_eq!(stream_reader.get_exchange_data().index_to_name_map, exchange_data.index_to_name_map);
+        assert_eq!(stream_nets.len(), exchange_data.nets.len());
+        for (stream_net, net) in stream_nets.iter().zip(exchange_data.nets.iter()) {
+            assert_eq!(stream_net.name, net.name);
+            assert_eq!(stream_net.lcap, net.lcap);
+            assert_eq!(stream_net.connection.len(), net.connection.len());
+            assert_eq!(stream_net.caps.len(), net.caps.len());
+            assert_eq!(stream_net.ress.len(), net.ress.len());
+            for (stream_res, res) in stream_net.ress.iter().zip(net.ress.iter()) {
+                assert_eq!(stream_res.node1, res.node1);
+                assert_eq!(stream_res.node2, res.node2);
+                assert_eq!(stream_res.res_or_cap, res.res_or_cap);
+            }
+        }
+    }
+
+    #[test]
+    fn test_stream_read_error() {
+        // the invalid utf-8 line after the nets make the read fail, which should
+        // not be treated as the file end.
+        let spef_path = write_stream_test_spef("error", 4, b"*D_NET *2 \xff\xfe 0.1\n");
+        let spef_path_str = spef_path.to_str().unwrap();
+
+        let mut stream_reader = SpefStreamReader::open(spef_path_str).unwrap();
+        let mut read_result = stream_reader.next_chunk(2);
+        while let Ok(chunk_nets) = &read_result {
+            assert!(!chunk_nets.is_empty(), "the read error is treated as the file end");
+            read_result = stream_reader.next_chunk(2);
+        }
+        fs::remove_file(&spef_path).unwrap();
+
+        assert_eq!(read_result.unwrap_err().kind(), std::io::ErrorKind::InvalidData);
+    }
+
     #[test]
     fn test_parse1() {
         let input_str = r#"1 in1 0.243
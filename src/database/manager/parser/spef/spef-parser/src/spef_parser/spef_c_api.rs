@@ -2,9 +2,11 @@ use std::ffi::c_double;
 use std::ffi::c_void;
 use std::os::raw::c_char;
 
+use std::collections::HashMap;
 use std::ffi::CString;
 
 use crate::spef_parser::parse_spef_file;
+use crate::spef_parser::SpefStreamReader;
 use crate::spef_parser::spef_data;
 
 #[repr(C)]
@@ -253,62 +255,131 @@ pub extern "C" fn rust_expand_name(c_spef_data: *mut spef_data::SpefExchange, in
     }
 }
 
+/// expand the index name of the net, conns, caps and ress to the full name.
+fn expand_spef_net_name(spef_net: &mut spef_data::SpefNet, index_to_name_map: &HashMap<usize, String>) {
+    let expand_name = |name: &str| -> String {
+        let split_names = split_spef_index_str(name);
+        let index = split_names.0.parse::<usize>().unwrap();
+        let node1_map_name = index_to_name_map.get(&index).unwrap();
+        let remove_slash_name: String = node1_map_name.chars().filter(|&c| c != '\\').collect();
+        if !split_names.1.is_empty() {
+            let expand_node1_name = remove_slash_name + ":" + split_names.1;
+            return expand_node1_name;
+        }
+        remove_slash_name
+    };
+
+    let net_name = &spef_net.name;
+    let index = net_name[1..].parse::<usize>().unwrap();
+    let expand_net_name = index_to_name_map.get(&index).unwrap();
+    let remove_slash_net_name = expand_net_name.chars().filter(|&c| c != '\\').collect();
+    spef_net.name = remove_slash_net_name;
+
+    for spef_conn in &mut spef_net.connection {
+        let expand_conn_name = expand_name(&spef_conn.pin_port_name);
+        spef_conn.set_pin_port_name(expand_conn_name);
+    }
+
+    for spef_cap in &mut spef_net.caps {
+        spef_cap.node1 = expand_name(&spef_cap.node1);
+        if !spef_cap.node2.is_empty() {
+            spef_cap.node2 = expand_name(&spef_cap.node2);
+        }
+    }
+
+    for spef_res in &mut spef_net.ress {
+        spef_res.node1 = expand_name(&spef_res.node1);
+        if !spef_res.node2.is_empty() {
+            spef_res.node2 = expand_name(&spef_res.node2);
+        }
+    }
+}
+
 #[no_mangle]
 pub extern "C" fn rust_expand_all_name(c_spef_data: *mut spef_data::SpefExchange) {
     unsafe {
-        let expand_name = |name: &str, spef_data: &mut spef_data::SpefExchange| -> String {
-            let split_names = split_spef_index_str(name);
-            let index = split_names.0.parse::<usize>().unwrap();
-            let node1_map_name = spef_data.index_to_name_map.get(&index).unwrap();
-            let remove_slash_name: String = node1_map_name.chars().filter(|&c| c != '\\').collect();
-            if !split_names.1.is_empty() {
-                let expand_node1_name = remove_slash_name + ":" + split_names.1;
-                return expand_node1_name;
-            }
-            remove_slash_name
-        };
-
         if (*c_spef_data).index_to_name_map.is_empty() {
             return;
         }
 
-        for spef_net in &mut (*c_spef_data).nets {
-            let net_name = &spef_net.name;
-            let index = net_name[1..].parse::<usize>().unwrap();
-            let expand_net_name = (*c_spef_data).index_to_name_map.get(&index).unwrap();
-            let remove_slash_net_name = expand_net_name.chars().filter(|&c| c != '\\').collect();
-            spef_net.name = remove_slash_net_name;
-
-            for spef_conn in &mut spef_net.connection {
-                let conn_name = &spef_conn.pin_port_name;
-                let expand_conn_name = expand_name(conn_name, &mut (*c_spef_data));
-                spef_conn.set_pin_port_name(expand_conn_name);
-            }
+        let spef_data = &mut (*c_spef_data);
+        for spef_net in &mut spef_data.nets {
+            expand_spef_net_name(spef_net, &spef_data.index_to_name_map);
+        }
+    }
+}
 
-            for spef_cap in &mut spef_net.caps {
-                let node1_name = &spef_cap.node1;
-                let expand_node1_name = expand_name(node1_name, &mut (*c_spef_data));
-                spef_cap.node1 = expand_node1_name;
+#[no_mangle]
+pub extern "C" fn rust_spef_stream_open(spef_path: *const c_char) -> *mut c_void {
+    let c_str = unsafe { std::ffi::CStr::from_ptr(spef_path) };
+    let r_str = c_str.to_string_lossy().into_owned();
+    println!("rust stream read spef {}", r_str);
 
-                let node2_name = &spef_cap.node2;
-                if !node2_name.is_empty() {
-                    let expand_node2_name = expand_name(node2_name, &mut (*c_spef_data));
-                    spef_cap.node2 = expand_node2_name;
-                }
-            }
+    match SpefStreamReader::open(&r_str) {
+        Ok(stream_reader) => Box::into_raw(Box::new(stream_reader)) as *mut c_void,
+        Err(err) => {
+            println!("rust stream read spef {} failed: {}", r_str, err);
+            std::ptr::null_mut()
+        }
+    }
+}
 
-            for spef_res in &mut spef_net.ress {
-                let node1_name = &spef_res.node1;
-                let expand_node1_name = expand_name(node1_name, &mut (*c_spef_data));
-                spef_res.node1 = expand_node1_name;
+#[no_mangle]
+pub extern "C" fn rust_free_spef_stream(c_spef_stream: *mut SpefStreamReader) {
+    unsafe {
+        let _: Box<SpefStreamReader> = Box::from_raw(c_spef_stream);
+    }
+}
+
+/// get the exchange data of the stream, which hold the header, name map and ports.
+#[no_mangle]
+pub extern "C" fn rust_spef_stream_get_data(c_spef_stream: *mut SpefStreamReader) -> *mut c_void {
+    unsafe { (*c_spef_stream).get_exchange_data() as *mut spef_data::SpefExchange as *mut c_void }
+}
+
+/// read the next chunk nets with the name expanded, return null when reach the file end
+/// or the read failed, use rust_spef_stream_has_error to tell them apart.
+#[no_mangle]
+pub extern "C" fn rust_spef_stream_next_chunk(c_spef_stream: *mut SpefStreamReader, max_net_num: usize) -> *mut c_void {
+    unsafe {
+        let mut chunk_nets = match (*c_spef_stream).next_chunk(max_net_num) {
+            Ok(chunk_nets) => chunk_nets,
+            Err(err) => {
+                println!("rust stream read spef chunk failed: {}", err);
+                (*c_spef_stream).set_io_error(err);
+                return std::ptr::null_mut();
+            }
+        };
+        if chunk_nets.is_empty() {
+            return std::ptr::null_mut();
+        }
 
-                let node2_name = &spef_res.node2;
-                if !node2_name.is_empty() {
-                    let expand_node2_name = expand_name(node2_name, &mut (*c_spef_data));
-                    spef_res.node2 = expand_node2_name;
-                }
+        let index_to_name_map = &(*c_spef_stream).get_exchange_data().index_to_name_map;
+        if !index_to_name_map.is_empty() {
+            for spef_net in &mut chunk_nets {
+                expand_spef_net_name(spef_net, index_to_name_map);
             }
         }
+
+        Box::into_raw(Box::new(chunk_nets)) as *mut c_void
+    }
+}
+
+/// whether the stream read failed by io error.
+#[no_mangle]
+pub extern "C" fn rust_spef_stream_has_error(c_spef_stream: *mut SpefStreamReader) -> bool {
+    unsafe { (*c_spef_stream).has_io_error() }
+}
+
+#[no_mangle]
+pub extern "C" fn rust_spef_stream_chunk_nets(c_spef_chunk: *mut Vec<spef_data::SpefNet>) -> RustVec {
+    unsafe { rust_vec_to_c_array(&(*c_spef_chunk)) }
+}
+
+#[no_mangle]
+pub extern "C" fn rust_free_spef_stream_chunk(c_spef_chunk: *mut Vec<spef_data::SpefNet>) {
+    unsafe {
+        let _: Box<Vec<spef_data::SpefNet>> = Box::from_raw(c_spef_chunk);
     }
 }
 
@@ -0,0 +1,22 @@
+# Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+# file Copyright.txt or https://cmake.org/licensing for details.
+
+cmake_minimum_required(VERSION 3.5)
+
+file(MAKE_DIRECTORY
+  "/root/repo/src/database/manager/parser/verilog/verilog-rust/verilog-parser"
+  "/root/repo/src/database/manager/parser/verilog/verilog-rust/verilog-parser"
+  "/root/repo/src/database/manager/parser/verilog/verilog-rust/verilog-parser"
+  "/root/repo/src/database/manager/parser/verilog/verilog-rust/verilog-parser/tmp"
+  "/root/repo/src/database/manager/parser/verilog/verilog-rust/verilog-parser/src/verilog_parser-stamp"
+  "/root/repo/src/database/manager/parser/verilog/verilog-rust/verilog-parser/src"
+  "/root/repo/src/database/manager/parser/verilog/verilog-rust/verilog-parser/src/verilog_parser-stamp"
+)
+
+set(configSubDirs )
+foreach(subDir IN LISTS configSubDirs)
+    file(MAKE_DIRECTORY "/root/repo/src/database/manager/parser/verilog/verilog-rust/verilog-parser/src/verilog_parser-stamp/${subDir}")
+endforeach()
+if(cfgdir)
+  file(MAKE_DIRECTORY "/root/repo/src/database/manager/parser/verilog/verilog-rust/verilog-parser/src/verilog_parser-stamp${cfgdir}") # cfgdir has leading slash
+endif()
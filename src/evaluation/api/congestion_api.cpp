@@ -85,6 +85,17 @@ RUDYMapSummary CongestionAPI::rudyMap(CongestionNets nets, CongestionRegion regi
   return rudy_map_summary;
 }
 
+GridMap CongestionAPI::rudyGridMap(int32_t grid_size, std::string rudy_type, bool use_lut)
+{
+  EVAL_CONGESTION_INST->initIDB();
+  CongestionNets nets = EVAL_CONGESTION_INST->getCongestionNets();
+  CongestionRegion region = EVAL_CONGESTION_INST->getCongestionRegion();
+  GridMap rudy_map = EVAL_CONGESTION_INST->evalRUDYMap(nets, region, grid_size * EVAL_CONGESTION_INST->getRowHeight(), rudy_type, use_lut);
+  EVAL_CONGESTION_INST->destroyIDB();
+
+  return rudy_map;
+}
+
 OverflowSummary CongestionAPI::egrOverflow()
 {
   return egrOverflow(EVAL_CONGESTION_INST->getEGRDirPath());
@@ -134,6 +145,26 @@ UtilizationSummary CongestionAPI::rudyUtilization(std::string rudy_dir_path, boo
   return utilization_summary;
 }
 
+UtilizationSummary CongestionAPI::rudyUtilization(const CongestionNets& nets, const CongestionRegion& region, int32_t grid_size,
+                                                  bool use_lut)
+{
+  UtilizationSummary utilization_summary;
+
+  GridMap rudy_horizontal = EVAL_CONGESTION_INST->evalRUDYMap(nets, region, grid_size, "horizontal", use_lut);
+  GridMap rudy_vertical = EVAL_CONGESTION_INST->evalRUDYMap(nets, region, grid_size, "vertical", use_lut);
+  GridMap rudy_union = EVAL_CONGESTION_INST->evalRUDYMap(nets, region, grid_size, "union", use_lut);
+
+  utilization_summary.max_utilization_horizontal = EVAL_CONGESTION_INST->evalMaxUtilization(rudy_horizontal);
+  utilization_summary.max_utilization_vertical = EVAL_CONGESTION_INST->evalMaxUtilization(rudy_vertical);
+  utilization_summary.max_utilization_union = EVAL_CONGESTION_INST->evalMaxUtilization(rudy_union);
+
+  utilization_summary.weighted_average_utilization_horizontal = EVAL_CONGESTION_INST->evalAvgUtilization(rudy_horizontal);
+  utilization_summary.weighted_average_utilization_vertical = EVAL_CONGESTION_INST->evalAvgUtilization(rudy_vertical);
+  utilization_summary.weighted_average_utilization_union = EVAL_CONGESTION_INST->evalAvgUtilization(rudy_union);
+
+  return utilization_summary;
+}
+
 void CongestionAPI::evalNetInfo()
 {
   EVAL_CONGESTION_INST->initIDB();
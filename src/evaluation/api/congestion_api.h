@@ -8,6 +8,7 @@
 #pragma once
 
 #include "congestion_db.h"
+#include "map_db.h"
 
 namespace ieval {
 
@@ -30,6 +31,8 @@ class CongestionAPI
   OverflowSummary egrOverflow(std::string rt_dir_path);
   RUDYMapSummary rudyMap(CongestionNets congestion_nets, CongestionRegion region, int32_t grid_size);
   UtilizationSummary rudyUtilization(std::string rudy_dir_path, bool use_lut = false);
+  GridMap rudyGridMap(int32_t grid_size = 1, std::string rudy_type = "union", bool use_lut = false);
+  UtilizationSummary rudyUtilization(const CongestionNets& nets, const CongestionRegion& region, int32_t grid_size, bool use_lut = false);
 
   void evalNetInfo();
   int findPinNumber(std::string net_name);
@@ -89,6 +89,30 @@ NetMapSummary DensityAPI::netDensityMap(int32_t grid_size, bool neighbor)
   return net_map_summary;
 }
 
+GridMap DensityAPI::cellDensityGridMap(int32_t grid_size, std::string cell_type)
+{
+  EVAL_DENSITY_INST->initIDBRegion();
+  EVAL_DENSITY_INST->initIDBCells();
+  return EVAL_DENSITY_INST->evalCellDensityMap(EVAL_DENSITY_INST->getDensityCells(), EVAL_DENSITY_INST->getDensityRegion(),
+                                               grid_size * EVAL_DENSITY_INST->getRowHeight(), cell_type);
+}
+
+GridMap DensityAPI::pinDensityGridMap(int32_t grid_size, std::string pin_type, bool neighbor)
+{
+  EVAL_DENSITY_INST->initIDBRegion();
+  EVAL_DENSITY_INST->initIDBCells();
+  return EVAL_DENSITY_INST->evalPinDensityMap(EVAL_DENSITY_INST->getDensityPins(), EVAL_DENSITY_INST->getDensityRegion(),
+                                              grid_size * EVAL_DENSITY_INST->getRowHeight(), neighbor, pin_type);
+}
+
+GridMap DensityAPI::netDensityGridMap(int32_t grid_size, std::string net_type, bool neighbor)
+{
+  EVAL_DENSITY_INST->initIDBRegion();
+  EVAL_DENSITY_INST->initIDBNets();
+  return EVAL_DENSITY_INST->evalNetDensityMap(EVAL_DENSITY_INST->getDensityNets(), EVAL_DENSITY_INST->getDensityRegion(),
+                                              grid_size * EVAL_DENSITY_INST->getRowHeight(), neighbor, net_type);
+}
+
 CellMapSummary DensityAPI::cellDensityMap(DensityCells cells, DensityRegion region, int32_t grid_size)
 {
   CellMapSummary cell_map_summary;
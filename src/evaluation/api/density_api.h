@@ -8,6 +8,7 @@
 #pragma once
 
 #include "density_db.h"
+#include "map_db.h"
 
 #define DENSITY_API_INST (ieval::DensityAPI::getInst())
 
@@ -26,6 +27,11 @@ class DensityAPI
   NetMapSummary netDensityMap(int32_t grid_size = 1, bool neighbor = false);
 
   CellMapSummary cellDensityMap(DensityCells cells, DensityRegion region, int32_t grid_size);
+
+  // in-memory maps, type is "macro"/"stdcell"/"all" for cells and pins, "local"/"global"/"all" for nets
+  GridMap cellDensityGridMap(int32_t grid_size = 1, std::string cell_type = "all");
+  GridMap pinDensityGridMap(int32_t grid_size = 1, std::string pin_type = "all", bool neighbor = false);
+  GridMap netDensityGridMap(int32_t grid_size = 1, std::string net_type = "all", bool neighbor = false);
   PinMapSummary pinDensityMap(DensityPins pins, DensityRegion region, int32_t grid_size, bool neighbor);
   NetMapSummary netDensityMap(DensityNets nets, DensityRegion region, int32_t grid_size, bool neighbor);
 
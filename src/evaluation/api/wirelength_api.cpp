@@ -129,6 +129,11 @@ float WirelengthAPI::pathEGRWL(std::string guide_path, std::string net_name, std
   return EVAL_WIRELENGTH_INST->evalPathEGRWL(guide_path, net_name, load_name);
 }
 
+std::unordered_map<std::string, float> WirelengthAPI::allNetEGRWL(std::string guide_path)
+{
+  return EVAL_WIRELENGTH_INST->evalAllNetEGRWL(guide_path);
+}
+
 void WirelengthAPI::evalNetInfo()
 {
   EVAL_WIRELENGTH_INST->initIDB();
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <unordered_map>
+
 #include "wirelength_db.h"
 
 namespace ieval {
@@ -31,6 +33,7 @@ class WirelengthAPI
   float totalEGRWL(std::string guide_path);
   float netEGRWL(std::string guide_path, std::string net_name);
   float pathEGRWL(std::string guide_path, std::string net_name, std::string load_name);
+  std::unordered_map<std::string, float> allNetEGRWL(std::string guide_path);
 
   void evalNetInfo();
   int32_t findNetHPWL(std::string net_name);
@@ -0,0 +1,25 @@
+/*
+ * @FilePath: map_db.h
+ * @Description: in-memory grid map shared by congestion and density evaluation
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace ieval {
+
+// row-major grid values, row 0 is the bottom row of the region (the csv files are written top row first).
+struct GridMap
+{
+  int32_t rows = 0;
+  int32_t cols = 0;
+  std::vector<double> values;
+
+  bool empty() const { return values.empty(); }
+  double& at(int32_t row, int32_t col) { return values[static_cast<size_t>(row) * cols + col]; }
+  double at(int32_t row, int32_t col) const { return values[static_cast<size_t>(row) * cols + col]; }
+};
+
+}  // namespace ieval
@@ -17,6 +17,7 @@
 #include <stdexcept>
 
 #include "general_ops.h"
+#include "grid_map_ops.h"
 #include "init_egr.h"
 #include "init_idb.h"
 #include "wirelength_lut.h"
@@ -68,34 +69,34 @@ string CongestionEval::evalUnionEGR(string rt_dir_path)
   return evalEGR(rt_dir_path, "union", "egr_union_overflow.csv");
 }
 
-string CongestionEval::evalHoriRUDY(CongestionNets nets, CongestionRegion region, int32_t grid_size)
+string CongestionEval::evalHoriRUDY(const CongestionNets& nets, const CongestionRegion& region, int32_t grid_size)
 {
-  return evalRUDY(nets, region, grid_size, "horizontal", "rudy_horizontal.csv");
+  return evalRUDY(nets, region, grid_size, "horizontal", "rudy_horizontal.csv", false);
 }
 
-string CongestionEval::evalVertiRUDY(CongestionNets nets, CongestionRegion region, int32_t grid_size)
+string CongestionEval::evalVertiRUDY(const CongestionNets& nets, const CongestionRegion& region, int32_t grid_size)
 {
-  return evalRUDY(nets, region, grid_size, "vertical", "rudy_vertical.csv");
+  return evalRUDY(nets, region, grid_size, "vertical", "rudy_vertical.csv", false);
 }
 
-string CongestionEval::evalUnionRUDY(CongestionNets nets, CongestionRegion region, int32_t grid_size)
+string CongestionEval::evalUnionRUDY(const CongestionNets& nets, const CongestionRegion& region, int32_t grid_size)
 {
-  return evalRUDY(nets, region, grid_size, "union", "rudy_union.csv");
+  return evalRUDY(nets, region, grid_size, "union", "rudy_union.csv", false);
 }
 
-string CongestionEval::evalHoriLUTRUDY(CongestionNets nets, CongestionRegion region, int32_t grid_size)
+string CongestionEval::evalHoriLUTRUDY(const CongestionNets& nets, const CongestionRegion& region, int32_t grid_size)
 {
-  return evalLUTRUDY(nets, region, grid_size, "horizontal", "lut_rudy_horizontal.csv");
+  return evalRUDY(nets, region, grid_size, "horizontal", "lut_rudy_horizontal.csv", true);
 }
 
-string CongestionEval::evalVertiLUTRUDY(CongestionNets nets, CongestionRegion region, int32_t grid_size)
+string CongestionEval::evalVertiLUTRUDY(const CongestionNets& nets, const CongestionRegion& region, int32_t grid_size)
 {
-  return evalLUTRUDY(nets, region, grid_size, "vertical", "lut_rudy_vertical.csv");
+  return evalRUDY(nets, region, grid_size, "vertical", "lut_rudy_vertical.csv", true);
 }
 
-string CongestionEval::evalUnionLUTRUDY(CongestionNets nets, CongestionRegion region, int32_t grid_size)
+string CongestionEval::evalUnionLUTRUDY(const CongestionNets& nets, const CongestionRegion& region, int32_t grid_size)
 {
-  return evalLUTRUDY(nets, region, grid_size, "union", "lut_rudy_union.csv");
+  return evalRUDY(nets, region, grid_size, "union", "lut_rudy_union.csv", true);
 }
 
 int32_t CongestionEval::evalHoriTotalOverflow(string rt_dir_path)
@@ -231,124 +232,60 @@ string CongestionEval::evalEGR(string rt_dir_path, string egr_type, string outpu
         }
       }
     }
-    
-    std::ofstream out_file(out_file_path);
-    for (const auto& row : sum_matrix) {
-      for (size_t i = 0; i < row.size(); ++i) {
-        out_file << row[i];
-        if (i < row.size() - 1) {
-          out_file << ",";
+
+    if (_output_csv) {
+      std::ofstream out_file(out_file_path);
+      for (const auto& row : sum_matrix) {
+        for (size_t i = 0; i < row.size(); ++i) {
+          out_file << row[i];
+          if (i < row.size() - 1) {
+            out_file << ",";
+          }
         }
+        out_file << "\n";
       }
-      out_file << "\n";
+      out_file.close();
     }
-    out_file.close();
+    _map_cache.put(getMapCacheKey(out_file_path.string()), makeGridMap(sum_matrix));
   } else if (egr_type == "union") {
     dir_path = rt_dir_path + "/topology_generator/";
     std::string source_file = dir_path + "overflow_map_planar.csv";
-    std::filesystem::copy_file(source_file, out_file_path, std::filesystem::copy_options::overwrite_existing);
+    if (_output_csv) {
+      std::filesystem::copy_file(source_file, out_file_path, std::filesystem::copy_options::overwrite_existing);
+    }
+    _map_cache.put(getMapCacheKey(out_file_path.string()), readGridMapCSV(source_file));
   }
   return out_file_path.string();
 }
 
-string CongestionEval::evalRUDY(CongestionNets nets, CongestionRegion region, int32_t grid_size, string rudy_type, string output_filename)
+string CongestionEval::evalRUDY(const CongestionNets& nets, const CongestionRegion& region, int32_t grid_size, string rudy_type,
+                                string output_filename, bool use_lut)
 {
-  int32_t grid_cols = (region.ux - region.lx + grid_size - 1) / grid_size;
-  int32_t grid_rows = (region.uy - region.ly + grid_size - 1) / grid_size;
-
-  std::vector<std::vector<double>> density_grid(grid_rows, std::vector<double>(grid_cols, 0.0));
-
-  for (const auto& net : nets) {
-    int32_t start_row = grid_rows - 1;
-    int32_t end_row = 0;
-    int32_t start_col = grid_cols - 1;
-    int32_t end_col = 0;
-    int32_t net_lx = INT32_MAX;
-    int32_t net_ly = INT32_MAX;
-    int32_t net_ux = INT32_MIN;
-    int32_t net_uy = INT32_MIN;
-    for (const auto& pin : net.pins) {
-      start_row = std::min(start_row, (pin.ly - region.ly) / grid_size);
-      end_row = std::max(end_row, (pin.ly - region.ly) / grid_size);
-      start_col = std::min(start_col, (pin.lx - region.lx) / grid_size);
-      end_col = std::max(end_col, (pin.lx - region.lx) / grid_size);
-      net_lx = std::min(net_lx, pin.lx);
-      net_ly = std::min(net_ly, pin.ly);
-      net_ux = std::max(net_ux, pin.lx);
-      net_uy = std::max(net_uy, pin.ly);
-    }
-    double hor_rudy = 0.0;
-    if (net_uy == net_ly) {
-      hor_rudy = 1.0;
-    } else {
-      hor_rudy = 1.0 / static_cast<double>(net_uy - net_ly);
-    }
-    double ver_rudy = 0.0;
-    if (net_ux == net_lx) {
-      ver_rudy = 1.0;
-    } else {
-      ver_rudy = 1.0 / static_cast<double>(net_ux - net_lx);
-    }
-    for (int32_t row = start_row; row <= end_row; ++row) {
-      for (int32_t col = start_col; col <= end_col; ++col) {
-        int32_t grid_lx = region.lx + col * grid_size;
-        int32_t grid_ly = region.ly + row * grid_size;
-        int32_t grid_ux = std::min(region.lx + (col + 1) * grid_size, region.ux);
-        int32_t grid_uy = std::min(region.ly + (row + 1) * grid_size, region.uy);
-        int32_t grid_area = (grid_ux - grid_lx) * (grid_uy - grid_ly);
-
-        int32_t overlap_lx = std::max(net_lx, grid_lx);
-        int32_t overlap_ly = std::max(net_ly, grid_ly);
-        int32_t overlap_ux = std::min(net_ux, grid_ux);
-        int32_t overlap_uy = std::min(net_uy, grid_uy);
-
-        int32_t overlap_area = 0;
-        if (overlap_lx == overlap_ux) {
-          overlap_area = overlap_uy - overlap_ly;  // 假设线宽为1
-        } else if (overlap_ly == overlap_uy) {
-          overlap_area = overlap_ux - overlap_lx;
-        } else {
-          overlap_area = (overlap_ux - overlap_lx) * (overlap_uy - overlap_ly);
-        }
-
-        if (rudy_type == "horizontal") {
-          density_grid[row][col] += static_cast<double>(overlap_area) * hor_rudy / grid_area;
-        } else if (rudy_type == "vertical") {
-          density_grid[row][col] += static_cast<double>(overlap_area) * ver_rudy / grid_area;
-        } else {
-          density_grid[row][col] += static_cast<double>(overlap_area) * (hor_rudy + ver_rudy) / grid_area;
-        }
-      }
-    }
-  }
+  GridMap rudy_map = evalRUDYMap(nets, region, grid_size, rudy_type, use_lut);
 
   std::string output_path = createDirPath("RUDY_map") + "/" + output_filename;
-  std::ofstream csv_file(output_path);
-
-  for (size_t row_index = density_grid.size(); row_index-- > 0;) {
-    const auto& row = density_grid[row_index];
-    for (size_t i = 0; i < row.size(); ++i) {
-      csv_file << std::fixed << std::setprecision(6) << row[i];
-      if (i < row.size() - 1)
-        csv_file << ",";
-    }
-    csv_file << "\n";
+  if (_output_csv) {
+    writeGridMapCSV(rudy_map, output_path);
   }
-
-  csv_file.close();
+  _map_cache.put(getMapCacheKey(output_path), std::move(rudy_map));
 
   return getAbsoluteFilePath(output_path);
 }
 
-string CongestionEval::evalLUTRUDY(CongestionNets nets, CongestionRegion region, int32_t grid_size, string lutrudy_type,
-                                   string output_filename)
+GridMap CongestionEval::evalRUDYMap(const CongestionNets& nets, const CongestionRegion& region, int32_t grid_size, string rudy_type,
+                                    bool use_lut)
 {
-  int32_t grid_cols = (region.ux - region.lx + grid_size - 1) / grid_size;
-  int32_t grid_rows = (region.uy - region.ly + grid_size - 1) / grid_size;
+  bool add_horizontal = rudy_type != "vertical";
+  bool add_vertical = rudy_type != "horizontal";
 
-  std::vector<std::vector<double>> density_grid(grid_rows, std::vector<double>(grid_cols, 0.0));
+  GridMapBuilder empty_builder(region.lx, region.ly, region.ux, region.uy, grid_size);
+  int32_t grid_rows = empty_builder.get_rows();
+  int32_t grid_cols = empty_builder.get_cols();
 
-  for (const auto& net : nets) {
+  return buildGridMapParallel(empty_builder, nets, [&](GridMapBuilder& builder, const CongestionNet& net) {
+    if (net.pins.empty()) {
+      return;
+    }
     int32_t start_row = grid_rows - 1;
     int32_t end_row = 0;
     int32_t start_col = grid_cols - 1;
@@ -367,6 +304,18 @@ string CongestionEval::evalLUTRUDY(CongestionNets nets, CongestionRegion region,
       net_ux = std::max(net_ux, pin.lx);
       net_uy = std::max(net_uy, pin.ly);
     }
+
+    auto [hor_rudy, ver_rudy] = calcRUDYWeight(net, net_lx, net_ly, net_ux, net_uy, use_lut);
+    double weight = (add_horizontal ? hor_rudy : 0.0) + (add_vertical ? ver_rudy : 0.0);
+    builder.addOverlap(net_lx, net_ly, net_ux, net_uy, start_row, end_row, start_col, end_col, weight, OverlapMode::kWire);
+  });
+}
+
+std::pair<double, double> CongestionEval::calcRUDYWeight(const CongestionNet& net, int32_t net_lx, int32_t net_ly, int32_t net_ux,
+                                                         int32_t net_uy, bool use_lut)
+{
+  double lut_factor = 1.0;
+  if (use_lut) {
     // 计算引脚数目、纵横比、L-ness
     int pin_num = net.pins.size();
     int aspect_ratio = 1;
@@ -387,69 +336,22 @@ string CongestionEval::evalLUTRUDY(CongestionNets nets, CongestionRegion region,
     } else {
       l_ness = 0.5f;
     }
-
-    double hor_lutrudy = 0.0;
-    if (net_uy == net_ly) {
-      hor_lutrudy = 1.0;
-    } else {
-      hor_lutrudy = getLUT(pin_num, aspect_ratio, l_ness) / static_cast<double>(net_uy - net_ly);
-    }
-    double ver_lutrudy = 0.0;
-    if (net_ux == net_lx) {
-      ver_lutrudy = 1.0;
-    } else {
-      ver_lutrudy = getLUT(pin_num, aspect_ratio, l_ness) / static_cast<double>(net_ux - net_lx);
-    }
-
-    for (int32_t row = start_row; row <= end_row; ++row) {
-      for (int32_t col = start_col; col <= end_col; ++col) {
-        int32_t grid_lx = region.lx + col * grid_size;
-        int32_t grid_ly = region.ly + row * grid_size;
-        int32_t grid_ux = std::min(region.lx + (col + 1) * grid_size, region.ux);
-        int32_t grid_uy = std::min(region.ly + (row + 1) * grid_size, region.uy);
-        int32_t grid_area = (grid_ux - grid_lx) * (grid_uy - grid_ly);
-
-        int32_t overlap_lx = std::max(net_lx, grid_lx);
-        int32_t overlap_ly = std::max(net_ly, grid_ly);
-        int32_t overlap_ux = std::min(net_ux, grid_ux);
-        int32_t overlap_uy = std::min(net_uy, grid_uy);
-
-        int32_t overlap_area = 0;
-        if (overlap_lx == overlap_ux) {
-          overlap_area = overlap_uy - overlap_ly;  // 假设线宽为1
-        } else if (overlap_ly == overlap_uy) {
-          overlap_area = overlap_ux - overlap_lx;
-        } else {
-          overlap_area = (overlap_ux - overlap_lx) * (overlap_uy - overlap_ly);
-        }
-
-        if (lutrudy_type == "horizontal") {
-          density_grid[row][col] += static_cast<double>(overlap_area) * hor_lutrudy / grid_area;
-        } else if (lutrudy_type == "vertical") {
-          density_grid[row][col] += static_cast<double>(overlap_area) * ver_lutrudy / grid_area;
-        } else {
-          density_grid[row][col] += static_cast<double>(overlap_area) * (hor_lutrudy + ver_lutrudy) / grid_area;
-        }
-      }
-    }
+    lut_factor = getLUT(pin_num, aspect_ratio, l_ness);
   }
 
-  std::string output_path = createDirPath("RUDY_map") + "/" + output_filename;
-  std::ofstream csv_file(output_path);
-
-  for (size_t row_index = density_grid.size(); row_index-- > 0;) {
-    const auto& row = density_grid[row_index];
-    for (size_t i = 0; i < row.size(); ++i) {
-      csv_file << std::fixed << std::setprecision(6) << row[i];
-      if (i < row.size() - 1)
-        csv_file << ",";
-    }
-    csv_file << "\n";
+  double hor_rudy = 0.0;
+  if (net_uy == net_ly) {
+    hor_rudy = 1.0;
+  } else {
+    hor_rudy = lut_factor / static_cast<double>(net_uy - net_ly);
   }
-
-  csv_file.close();
-
-  return getAbsoluteFilePath(output_path);
+  double ver_rudy = 0.0;
+  if (net_ux == net_lx) {
+    ver_rudy = 1.0;
+  } else {
+    ver_rudy = lut_factor / static_cast<double>(net_ux - net_lx);
+  }
+  return {hor_rudy, ver_rudy};
 }
 
 float CongestionEval::calculateLness(std::vector<std::pair<int32_t, int32_t>> point_set, int32_t net_lx, int32_t net_ux, int32_t net_ly,
@@ -558,292 +460,100 @@ double CongestionEval::getLUT(int32_t pin_num, int32_t aspect_ratio, float l_nes
   return WIRELENGTH_LUT[ar_index][pin_index][l_index];
 }
 
-int32_t CongestionEval::evalTotalOverflow(string rt_dir_path, string overflow_type)
+string CongestionEval::getMapCacheKey(const string& file_path)
 {
-  int32_t total_overflow = 0;
-  std::string file_name;
-
-  if (overflow_type == "horizontal") {
-    file_name =  "egr_horizontal_overflow.csv";
-  } else if (overflow_type == "vertical") {
-    file_name =  "egr_vertical_overflow.csv";
-  } else if (overflow_type == "union") {
-    file_name =  "egr_union_overflow.csv";
-  } else {
-    return -1;
-  }
-  std::filesystem::path parent_path =  std::filesystem::path(rt_dir_path).parent_path();
-  std::filesystem::path file_path = parent_path / file_name;
-  std::string file_path_str = file_path.string();
-
-  std::ifstream file(file_path_str);
-  if (!file.is_open()) {
-    return -1;
-  }
-
-  std::string line;
-  while (std::getline(file, line)) {
-    std::istringstream iss(line);
-    std::string value;
-    while (std::getline(iss, value, ',')) {
-      total_overflow += std::stoi(value);
-    }
-  }
+  return std::filesystem::path(getAbsoluteFilePath(file_path)).lexically_normal().string();
+}
 
-  file.close();
-  return total_overflow;
+std::shared_ptr<const GridMap> CongestionEval::loadMap(const string& file_path)
+{
+  auto grid_map = _map_cache.get(getMapCacheKey(file_path));
+  return (grid_map == nullptr || grid_map->empty()) ? nullptr : grid_map;
 }
 
-int32_t CongestionEval::evalMaxOverflow(string rt_dir_path, string overflow_type)
+string CongestionEval::getEGRMapPath(string rt_dir_path, string overflow_type)
 {
-  int32_t max_overflow = -1;
   std::string file_name;
-
   if (overflow_type == "horizontal") {
-    file_name =  "egr_horizontal_overflow.csv";
+    file_name = "egr_horizontal_overflow.csv";
   } else if (overflow_type == "vertical") {
-    file_name =  "egr_vertical_overflow.csv";
+    file_name = "egr_vertical_overflow.csv";
   } else if (overflow_type == "union") {
-    file_name =  "egr_union_overflow.csv";
+    file_name = "egr_union_overflow.csv";
   } else {
-    return -1;
+    return "";
   }
-  std::filesystem::path parent_path =  std::filesystem::path(rt_dir_path).parent_path();
-  std::filesystem::path file_path = parent_path / file_name;
-  std::string file_path_str = file_path.string();
+  std::filesystem::path parent_path = std::filesystem::path(rt_dir_path).parent_path();
+  return (parent_path / file_name).string();
+}
 
-  std::ifstream file(file_path_str);
-  if (!file.is_open()) {
-    return -1;
+string CongestionEval::getRUDYMapPath(string rudy_dir_path, string utilization_type, bool use_lut)
+{
+  std::string file_name = use_lut ? "/lut_rudy_" : "/rudy_";
+  if (utilization_type == "horizontal" || utilization_type == "vertical" || utilization_type == "union") {
+    return rudy_dir_path + file_name + utilization_type + ".csv";
   }
+  return "";
+}
 
-  std::string line;
-  while (std::getline(file, line)) {
-    std::istringstream iss(line);
-    std::string value;
-    while (std::getline(iss, value, ',')) {
-      int32_t current_value = std::stoi(value);
-      max_overflow = std::max(max_overflow, current_value);
-    }
-  }
+int32_t CongestionEval::evalTotalOverflow(string rt_dir_path, string overflow_type)
+{
+  std::string file_path = getEGRMapPath(rt_dir_path, overflow_type);
+  auto overflow_map = file_path.empty() ? nullptr : loadMap(file_path);
+  return overflow_map == nullptr ? -1 : evalTotalOverflow(*overflow_map);
+}
 
-  file.close();
-  return max_overflow;
+int32_t CongestionEval::evalMaxOverflow(string rt_dir_path, string overflow_type)
+{
+  std::string file_path = getEGRMapPath(rt_dir_path, overflow_type);
+  auto overflow_map = file_path.empty() ? nullptr : loadMap(file_path);
+  return overflow_map == nullptr ? -1 : evalMaxOverflow(*overflow_map);
 }
 
 float CongestionEval::evalAvgOverflow(string rt_dir_path, string overflow_type)
 {
-  float avg_overflow = 0.0f;
-  std::string file_name;
-
-  if (overflow_type == "horizontal") {
-    file_name =  "egr_horizontal_overflow.csv";
-  } else if (overflow_type == "vertical") {
-    file_name =  "egr_vertical_overflow.csv";
-  } else if (overflow_type == "union") {
-    file_name =  "egr_union_overflow.csv";
-  } else {
-    return -1;
-  }
-  std::filesystem::path parent_path =  std::filesystem::path(rt_dir_path).parent_path();
-  std::filesystem::path file_path = parent_path / file_name;
-  std::string file_path_str = file_path.string();
-
-  std::ifstream file(file_path_str);
-  if (!file.is_open()) {
-    return -1;
-  }
-
-  std::vector<int32_t> values;
-
-  std::string line;
-  while (std::getline(file, line)) {
-    std::istringstream iss(line);
-    std::string value;
-    while (std::getline(iss, value, ',')) {
-      int32_t current_value = std::stoi(value);
-      values.push_back(current_value);
-    }
-  }
-
-  file.close();
-
-  std::sort(values.begin(), values.end(), std::greater<int32_t>());
-
-  size_t size = values.size();
-  size_t idx_0_5_percent = std::max(size_t(1), static_cast<size_t>(std::ceil(size * 0.005)));
-  size_t idx_1_percent = std::max(size_t(1), static_cast<size_t>(std::ceil(size * 0.01)));
-  size_t idx_2_percent = std::max(size_t(1), static_cast<size_t>(std::ceil(size * 0.02)));
-  size_t idx_5_percent = std::max(size_t(1), static_cast<size_t>(std::ceil(size * 0.05)));
-
-  float sum_05 = 0.0f;
-  float sum_1 = 0.0f;
-  float sum_2 = 0.0f;
-  float sum_5 = 0.0f;
-
-  float weight_05 = 0.4f;
-  float weight_1 = 0.3f;
-  float weight_2 = 0.2f;
-  float weight_5 = 0.1f;
-
-  // 0-0.5%
-  for (size_t i = 0; i < idx_0_5_percent; ++i) {
-    sum_05 += values[i];
-  }
-  sum_1 = sum_05;
-
-  // 0.5%-1%
-  for (size_t i = idx_0_5_percent; i < idx_1_percent; ++i) {
-    sum_1 += values[i];
-  }
-  sum_2 = sum_1;
-
-  // 1%-2%
-  for (size_t i = idx_1_percent; i < idx_2_percent; ++i) {
-    sum_2 += values[i];
-  }
-  sum_5 = sum_2;
-
-  // 2%-5%
-  for (size_t i = idx_2_percent; i < idx_5_percent; ++i) {
-    sum_5 += values[i];
-  }
-
-  avg_overflow = (sum_05 * weight_05 + sum_1 * weight_1 + sum_2 * weight_2 + sum_5 * weight_5) / 4.0;
-
-  return avg_overflow;
+  std::string file_path = getEGRMapPath(rt_dir_path, overflow_type);
+  auto overflow_map = file_path.empty() ? nullptr : loadMap(file_path);
+  return overflow_map == nullptr ? -1 : evalAvgOverflow(*overflow_map);
 }
 
-float CongestionEval::evalMaxUtilization(string map_path, string utilization_type, bool use_lut)
+float CongestionEval::evalMaxUtilization(string rudy_dir_path, string utilization_type, bool use_lut)
 {
-  float max_util = -1.0;
-  std::string file_path;
-  std::string file_name;
-
-  if (use_lut == true) {
-    file_name = "/lut_rudy_";
-  } else {
-    file_name = "/rudy_";
-  }
-
-  if (utilization_type == "horizontal") {
-    file_path = map_path + file_name + "horizontal.csv";
-  } else if (utilization_type == "vertical") {
-    file_path = map_path + file_name + "vertical.csv";
-  } else if (utilization_type == "union") {
-    file_path = map_path + file_name + "union.csv";
-  } else {
-    return -1.0;
-  }
-
-  std::ifstream file(file_path);
-  if (!file.is_open()) {
-    return -1.0;
-  }
-
-  std::string line;
-  while (std::getline(file, line)) {
-    std::istringstream iss(line);
-    std::string value;
-    while (std::getline(iss, value, ',')) {
-      float current_value = std::stof(value);
-      max_util = std::fmax(max_util, current_value);
-    }
-  }
-
-  file.close();
-  return max_util;
+  std::string file_path = getRUDYMapPath(rudy_dir_path, utilization_type, use_lut);
+  auto rudy_map = file_path.empty() ? nullptr : loadMap(file_path);
+  return rudy_map == nullptr ? -1.0 : evalMaxUtilization(*rudy_map);
 }
 
 float CongestionEval::evalAvgUtilization(string rudy_dir_path, string utilization_type, bool use_lut)
 {
-  float avg_util = 0.0f;
-  std::string file_path;
-  std::string file_name;
-
-  if (use_lut == true) {
-    file_name = "/lut_rudy_";
-  } else {
-    file_name = "/rudy_";
-  }
-
-  if (utilization_type == "horizontal") {
-    file_path = rudy_dir_path + file_name + "horizontal.csv";
-  } else if (utilization_type == "vertical") {
-    file_path = rudy_dir_path + file_name + "vertical.csv";
-  } else if (utilization_type == "union") {
-    file_path = rudy_dir_path + file_name + "union.csv";
-  } else {
-    return -1.0;
-  }
-
-  std::ifstream file(file_path);
-  if (!file.is_open()) {
-    return -1.0;
-  }
-
-  std::vector<float> values;
-
-  std::string line;
-  while (std::getline(file, line)) {
-    std::istringstream iss(line);
-    std::string value;
-    while (std::getline(iss, value, ',')) {
-      float current_value = std::stof(value);
-      values.push_back(current_value);
-    }
-  }
-
-  file.close();
-
-  std::sort(values.begin(), values.end(), std::greater<float>());
-
-  size_t size = values.size();
-  size_t idx_0_5_percent = std::max(size_t(1), static_cast<size_t>(std::ceil(size * 0.005)));
-  size_t idx_1_percent = std::max(size_t(1), static_cast<size_t>(std::ceil(size * 0.01)));
-  size_t idx_2_percent = std::max(size_t(1), static_cast<size_t>(std::ceil(size * 0.02)));
-  size_t idx_5_percent = std::max(size_t(1), static_cast<size_t>(std::ceil(size * 0.05)));
-  // size_t idx_0_5_percent = std::max(size_t(1), static_cast<size_t>(std::ceil(size * 0.1)));
-  // size_t idx_1_percent = std::max(size_t(1), static_cast<size_t>(std::ceil(size * 0.2)));
-  // size_t idx_2_percent = std::max(size_t(1), static_cast<size_t>(std::ceil(size * 0.3)));
-  // size_t idx_5_percent = std::max(size_t(1), static_cast<size_t>(std::ceil(size * 0.4)));
-
-  float sum_05 = 0.0f;
-  float sum_1 = 0.0f;
-  float sum_2 = 0.0f;
-  float sum_5 = 0.0f;
-
-  float weight_05 = 0.4f;
-  float weight_1 = 0.3f;
-  float weight_2 = 0.2f;
-  float weight_5 = 0.1f;
-
-  // 0-0.5%
-  for (size_t i = 0; i < idx_0_5_percent; ++i) {
-    sum_05 += values[i];
-  }
-  sum_1 = sum_05;
+  std::string file_path = getRUDYMapPath(rudy_dir_path, utilization_type, use_lut);
+  auto rudy_map = file_path.empty() ? nullptr : loadMap(file_path);
+  return rudy_map == nullptr ? -1.0 : evalAvgUtilization(*rudy_map);
+}
 
-  // 0.5%-1%
-  for (size_t i = idx_0_5_percent; i < idx_1_percent; ++i) {
-    sum_1 += values[i];
-  }
-  sum_2 = sum_1;
+int32_t CongestionEval::evalTotalOverflow(const GridMap& overflow_map)
+{
+  return static_cast<int32_t>(calcTotalGridValue(overflow_map));
+}
 
-  // 1%-2%
-  for (size_t i = idx_1_percent; i < idx_2_percent; ++i) {
-    sum_2 += values[i];
-  }
-  sum_5 = sum_2;
+int32_t CongestionEval::evalMaxOverflow(const GridMap& overflow_map)
+{
+  return static_cast<int32_t>(calcMaxGridValue(overflow_map));
+}
 
-  // 2%-5%
-  for (size_t i = idx_2_percent; i < idx_5_percent; ++i) {
-    sum_5 += values[i];
-  }
+float CongestionEval::evalAvgOverflow(const GridMap& overflow_map)
+{
+  return calcWeightedTopGridValue(overflow_map);
+}
 
-  avg_util = (sum_05 * weight_05 + sum_1 * weight_1 + sum_2 * weight_2 + sum_5 * weight_5) / 4.0;
+float CongestionEval::evalMaxUtilization(const GridMap& rudy_map)
+{
+  return calcMaxGridValue(rudy_map);
+}
 
-  return avg_util;
+float CongestionEval::evalAvgUtilization(const GridMap& rudy_map)
+{
+  return calcWeightedTopGridValue(rudy_map);
 }
 
 void CongestionEval::initEGR()
@@ -8,7 +8,9 @@
 #pragma once
 
 #include "congestion_db.h"
+#include "grid_map_ops.h"
 #include "map"
+#include "map_db.h"
 
 namespace ieval {
 
@@ -26,13 +28,13 @@ class CongestionEval
   string evalVertiEGR(string rt_dir_path);
   string evalUnionEGR(string rt_dir_path);
 
-  string evalHoriRUDY(CongestionNets nets, CongestionRegion region, int32_t grid_size);
-  string evalVertiRUDY(CongestionNets nets, CongestionRegion region, int32_t grid_size);
-  string evalUnionRUDY(CongestionNets nets, CongestionRegion region, int32_t grid_size);
+  string evalHoriRUDY(const CongestionNets& nets, const CongestionRegion& region, int32_t grid_size);
+  string evalVertiRUDY(const CongestionNets& nets, const CongestionRegion& region, int32_t grid_size);
+  string evalUnionRUDY(const CongestionNets& nets, const CongestionRegion& region, int32_t grid_size);
 
-  string evalHoriLUTRUDY(CongestionNets nets, CongestionRegion region, int32_t grid_size);
-  string evalVertiLUTRUDY(CongestionNets nets, CongestionRegion region, int32_t grid_size);
-  string evalUnionLUTRUDY(CongestionNets nets, CongestionRegion region, int32_t grid_size);
+  string evalHoriLUTRUDY(const CongestionNets& nets, const CongestionRegion& region, int32_t grid_size);
+  string evalVertiLUTRUDY(const CongestionNets& nets, const CongestionRegion& region, int32_t grid_size);
+  string evalUnionLUTRUDY(const CongestionNets& nets, const CongestionRegion& region, int32_t grid_size);
 
   int32_t evalHoriTotalOverflow(string rt_dir_path);
   int32_t evalVertiTotalOverflow(string rt_dir_path);
@@ -54,6 +56,20 @@ class CongestionEval
   float evalVertiAvgUtilization(string rudy_dir_path, bool use_lut = false);
   float evalUnionAvgUtilization(string rudy_dir_path, bool use_lut = false);
 
+  // in-memory maps and metrics, the csv files are not touched
+  GridMap evalRUDYMap(const CongestionNets& nets, const CongestionRegion& region, int32_t grid_size, string rudy_type, bool use_lut = false);
+  int32_t evalTotalOverflow(const GridMap& overflow_map);
+  int32_t evalMaxOverflow(const GridMap& overflow_map);
+  float evalAvgOverflow(const GridMap& overflow_map);
+  float evalMaxUtilization(const GridMap& rudy_map);
+  float evalAvgUtilization(const GridMap& rudy_map);
+
+  // the maps are always kept in memory, csv output can be turned off when only the metrics are needed
+  void set_output_csv(bool output_csv) { _output_csv = output_csv; }
+  bool is_output_csv() const { return _output_csv; }
+  void clearMapCache() { _map_cache.clear(); }
+  size_t mapCacheSize() const { return _map_cache.size(); }
+
   void initEGR();
   void destroyEGR();
   void initIDB();
@@ -78,9 +94,18 @@ class CongestionEval
   std::map<std::string, int> _name_aspect_ratio;
   std::map<std::string, float> _name_lness;
 
+  bool _output_csv = true;
+  GridMapCache _map_cache;  // map file path -> map, reloaded when the file is changed
+
   string evalEGR(string rt_dir_path, string egr_type, string output_filename);
-  string evalRUDY(CongestionNets nets, CongestionRegion region, int32_t grid_size, string rudy_type, string output_filename);
-  string evalLUTRUDY(CongestionNets nets, CongestionRegion region, int32_t grid_size, string lutrudy_type, string output_filename);
+  string evalRUDY(const CongestionNets& nets, const CongestionRegion& region, int32_t grid_size, string rudy_type, string output_filename,
+                  bool use_lut);
+  std::pair<double, double> calcRUDYWeight(const CongestionNet& net, int32_t net_lx, int32_t net_ly, int32_t net_ux, int32_t net_uy,
+                                           bool use_lut);
+  string getMapCacheKey(const string& file_path);
+  std::shared_ptr<const GridMap> loadMap(const string& file_path);
+  string getEGRMapPath(string rt_dir_path, string overflow_type);
+  string getRUDYMapPath(string rudy_dir_path, string utilization_type, bool use_lut);
   float calculateLness(std::vector<std::pair<int32_t, int32_t>> point_set, int32_t net_lx, int32_t net_ux, int32_t net_ly, int32_t net_uy);
   int32_t calcLowerLeftRP(std::vector<std::pair<int32_t, int32_t>> point_set, int32_t x_min, int32_t y_min);
   int32_t calcLowerRightRP(std::vector<std::pair<int32_t, int32_t>> point_set, int32_t x_max, int32_t y_min);
@@ -14,6 +14,7 @@
 #include <sstream>
 
 #include "general_ops.h"
+#include "grid_map_ops.h"
 #include "init_idb.h"
 
 namespace ieval {
@@ -112,55 +113,10 @@ std::string DensityEval::evalAllMargin(DensityCells cells, DensityRegion die, De
 std::string DensityEval::evalDensity(DensityCells cells, DensityRegion region, int32_t grid_size, std::string cell_type,
                                      std::string output_filename)
 {
-  int32_t grid_cols = (region.ux - region.lx + grid_size - 1) / grid_size;
-  int32_t grid_rows = (region.uy - region.ly + grid_size - 1) / grid_size;
-
-  std::vector<std::vector<double>> density_grid(grid_rows, std::vector<double>(grid_cols, 0.0));
-
-  for (const auto& cell : cells) {
-    if (cell_type != "all" && cell.type != cell_type) {
-      continue;
-    }
-
-    int32_t start_row = std::max(0, (cell.ly - region.ly) / grid_size);
-    int32_t end_row = std::min(grid_rows - 1, (cell.ly + cell.height - region.ly) / grid_size);
-    int32_t start_col = std::max(0, (cell.lx - region.lx) / grid_size);
-    int32_t end_col = std::min(grid_cols - 1, (cell.lx + cell.width - region.lx) / grid_size);
-
-    for (int32_t row = start_row; row <= end_row; ++row) {
-      for (int32_t col = start_col; col <= end_col; ++col) {
-        int32_t grid_lx = region.lx + col * grid_size;
-        int32_t grid_ly = region.ly + row * grid_size;
-        int32_t grid_ux = std::min(region.lx + (col + 1) * grid_size, region.ux);
-        int32_t grid_uy = std::min(region.ly + (row + 1) * grid_size, region.uy);
-
-        int32_t overlap_lx = std::max(cell.lx, grid_lx);
-        int32_t overlap_ly = std::max(cell.ly, grid_ly);
-        int32_t overlap_ux = std::min(cell.lx + cell.width, grid_ux);
-        int32_t overlap_uy = std::min(cell.ly + cell.height, grid_uy);
-
-        int32_t overlap_area = std::max(0, overlap_ux - overlap_lx) * std::max(0, overlap_uy - overlap_ly);
-        int32_t grid_area = (grid_ux - grid_lx) * (grid_uy - grid_ly);
-
-        density_grid[row][col] += static_cast<double>(overlap_area) / grid_area;
-      }
-    }
-  }
+  GridMap density_map = evalCellDensityMap(cells, region, grid_size, cell_type);
 
   std::string output_path = createDirPath("density_map") + "/" + output_filename;
-  std::ofstream csv_file(output_path);
-
-  for (size_t row_index = density_grid.size(); row_index-- > 0;) {
-    const auto& row = density_grid[row_index];
-    for (size_t i = 0; i < row.size(); ++i) {
-      csv_file << std::fixed << std::setprecision(6) << row[i];
-      if (i < row.size() - 1)
-        csv_file << ",";
-    }
-    csv_file << "\n";
-  }
-
-  csv_file.close();
+  writeGridMapCSV(density_map, output_path);
 
   return getAbsoluteFilePath(output_path);
 }
@@ -168,64 +124,23 @@ std::string DensityEval::evalDensity(DensityCells cells, DensityRegion region, i
 std::string DensityEval::evalPinDensity(DensityPins pins, DensityRegion region, int32_t grid_size, bool neighbor, std::string pin_type,
                                         std::string output_filename)
 {
-  int32_t grid_cols = (region.ux - region.lx + grid_size - 1) / grid_size;
-  int32_t grid_rows = (region.uy - region.ly + grid_size - 1) / grid_size;
-
-  std::vector<std::vector<int32_t>> pin_count(grid_rows, std::vector<int32_t>(grid_cols, 0));
-  std::vector<std::vector<double>> density_grid(grid_rows, std::vector<double>(grid_cols, 0.0));
-
-  for (const auto& pin : pins) {
-    if (pin_type != "all" && pin.type != pin_type) {
-      continue;
-    }
-
-    int32_t col = (pin.lx - region.lx) / grid_size;
-    int32_t row = (pin.ly - region.ly) / grid_size;
-
-    if (col >= 0 && col < grid_cols && row >= 0 && row < grid_rows) {
-      pin_count[row][col] += 1;
-    }
-  }
+  GridMap density_map = evalPinDensityMap(pins, region, grid_size, neighbor, pin_type);
 
+  std::string output_path;
   if (neighbor) {
-    const std::vector<std::vector<int>> kernel = {{1, 1, 1}, {1, 1, 1}, {1, 1, 1}};
-    std::vector<std::vector<int32_t>> padded_matrix(grid_rows + 2, std::vector<int32_t>(grid_cols + 2, 0));
-    for (int32_t row = 0; row < grid_rows; ++row) {
-      for (int32_t col = 0; col < grid_cols; ++col) {
-        padded_matrix[row + 1][col + 1] = pin_count[row][col];
-      }
-    }
-    std::vector<std::vector<int32_t>> neighbor_pin_count(grid_rows, std::vector<int32_t>(grid_cols, 0));
-    for (int32_t row = 0; row < grid_rows; ++row) {
-      for (int32_t col = 0; col < grid_cols; ++col) {
-        int32_t sum = 0;
-        for (int32_t ker_i = 0; ker_i < 3; ++ker_i) {
-          for (int32_t ker_j = 0; ker_j < 3; ++ker_j) {
-            sum += kernel[ker_i][ker_j] * padded_matrix[row + ker_i][col + ker_j];
-          }
-        }
-        neighbor_pin_count[row][col] = sum;
-      }
-    }
-    for (int32_t row = 0; row < grid_rows; ++row) {
-      for (int32_t col = 0; col < grid_cols; ++col) {
-        density_grid[row][col] = static_cast<double>(neighbor_pin_count[row][col]);
-      }
-    }
+    output_path = createDirPath("density_map") + "/" + "neighbor_" + output_filename;
   } else {
-    for (int32_t row = 0; row < grid_rows; ++row) {
-      for (int32_t col = 0; col < grid_cols; ++col) {
-        // int32_t grid_lx = region.lx + col * grid_size;
-        // int32_t grid_ly = region.ly + row * grid_size;
-        // int32_t grid_ux = std::min(region.lx + (col + 1) * grid_size, region.ux);
-        // int32_t grid_uy = std::min(region.ly + (row + 1) * grid_size, region.uy);
-
-        // double grid_area = static_cast<double>((grid_ux - grid_lx) * (grid_uy - grid_ly));
-        // density_grid[row][col] = static_cast<double>(pin_count[row][col]) / grid_area;
-        density_grid[row][col] = static_cast<double>(pin_count[row][col]);
-      }
-    }
+    output_path = createDirPath("density_map") + "/" + output_filename;
   }
+  writeGridMapCSV(density_map, output_path);
+
+  return getAbsoluteFilePath(output_path);
+}
+
+std::string DensityEval::evalNetDensity(DensityNets nets, DensityRegion region, int32_t grid_size, bool neighbor, std::string net_type,
+                                        std::string output_filename)
+{
+  GridMap density_map = evalNetDensityMap(nets, region, grid_size, neighbor, net_type);
 
   std::string output_path;
   if (neighbor) {
@@ -233,33 +148,62 @@ std::string DensityEval::evalPinDensity(DensityPins pins, DensityRegion region,
   } else {
     output_path = createDirPath("density_map") + "/" + output_filename;
   }
+  writeGridMapCSV(density_map, output_path);
 
-  std::ofstream csv_file(output_path);
+  return getAbsoluteFilePath(output_path);
+}
 
-  for (size_t row_index = density_grid.size(); row_index-- > 0;) {
-    const auto& row = density_grid[row_index];
-    for (size_t i = 0; i < row.size(); ++i) {
-      csv_file << std::fixed << std::setprecision(6) << row[i];
-      if (i < row.size() - 1)
-        csv_file << ",";
-    }
-    csv_file << "\n";
-  }
+GridMap DensityEval::evalCellDensityMap(const DensityCells& cells, const DensityRegion& region, int32_t grid_size, std::string cell_type)
+{
+  bool is_all_type = cell_type == "all";
+  GridMapBuilder empty_builder(region.lx, region.ly, region.ux, region.uy, grid_size);
 
-  csv_file.close();
+  return buildGridMapParallel(empty_builder, cells, [&](GridMapBuilder& builder, const DensityCell& cell) {
+    if (!is_all_type && cell.type != cell_type) {
+      return;
+    }
+    int32_t start_row = (cell.ly - region.ly) / grid_size;
+    int32_t end_row = (cell.ly + cell.height - region.ly) / grid_size;
+    int32_t start_col = (cell.lx - region.lx) / grid_size;
+    int32_t end_col = (cell.lx + cell.width - region.lx) / grid_size;
+    builder.addOverlap(cell.lx, cell.ly, cell.lx + cell.width, cell.ly + cell.height, start_row, end_row, start_col, end_col, 1.0,
+                       OverlapMode::kArea);
+  });
+}
+
+GridMap DensityEval::evalPinDensityMap(const DensityPins& pins, const DensityRegion& region, int32_t grid_size, bool neighbor,
+                                       std::string pin_type)
+{
+  bool is_all_type = pin_type == "all";
+  GridMapBuilder empty_builder(region.lx, region.ly, region.ux, region.uy, grid_size);
+  int32_t grid_rows = empty_builder.get_rows();
+  int32_t grid_cols = empty_builder.get_cols();
+
+  GridMap pin_count = buildGridMapParallel(empty_builder, pins, [&](GridMapBuilder& builder, const DensityPin& pin) {
+    if (!is_all_type && pin.type != pin_type) {
+      return;
+    }
+    int32_t col = (pin.lx - region.lx) / grid_size;
+    int32_t row = (pin.ly - region.ly) / grid_size;
+    if (col >= 0 && col < grid_cols && row >= 0 && row < grid_rows) {
+      builder.addValue(row, col, 1.0);
+    }
+  });
 
-  return getAbsoluteFilePath(output_path);
+  return neighbor ? sumNeighborGrids(pin_count) : pin_count;
 }
 
-std::string DensityEval::evalNetDensity(DensityNets nets, DensityRegion region, int32_t grid_size, bool neighbor, std::string net_type,
-                                        std::string output_filename)
+GridMap DensityEval::evalNetDensityMap(const DensityNets& nets, const DensityRegion& region, int32_t grid_size, bool neighbor,
+                                       std::string net_type)
 {
-  int32_t grid_cols = (region.ux - region.lx + grid_size - 1) / grid_size;
-  int32_t grid_rows = (region.uy - region.ly + grid_size - 1) / grid_size;
+  bool is_all_type = net_type == "all";
+  bool is_local_type = net_type == "local";
+  bool is_global_type = net_type == "global";
+  GridMapBuilder empty_builder(region.lx, region.ly, region.ux, region.uy, grid_size);
+  int32_t grid_rows = empty_builder.get_rows();
+  int32_t grid_cols = empty_builder.get_cols();
 
-  std::vector<std::vector<int>> net_count(grid_rows, std::vector<int>(grid_cols, 0));
-
-  for (const auto& net : nets) {
+  GridMap net_count = buildGridMapParallel(empty_builder, nets, [&](GridMapBuilder& builder, const DensityNet& net) {
     int32_t start_col = std::max(0, (net.lx - region.lx) / grid_size);
     int32_t end_col = std::min(grid_cols - 1, (net.ux - region.lx) / grid_size);
     int32_t start_row = std::max(0, (net.ly - region.ly) / grid_size);
@@ -267,79 +211,16 @@ std::string DensityEval::evalNetDensity(DensityNets nets, DensityRegion region,
 
     bool is_local = (start_col == end_col) && (start_row == end_row);
 
-    if (net_type == "all" || (net_type == "local" && is_local) || (net_type == "global" && !is_local)) {
-      if (is_local || net_type == "local") {
-        net_count[start_row][start_col]++;
+    if (is_all_type || (is_local_type && is_local) || (is_global_type && !is_local)) {
+      if (is_local || is_local_type) {
+        builder.addValue(start_row, start_col, 1.0);
       } else {
-        for (int32_t row = start_row; row <= end_row; ++row) {
-          for (int32_t col = start_col; col <= end_col; ++col) {
-            net_count[row][col]++;
-          }
-        }
+        builder.addRange(start_row, end_row, start_col, end_col, 1.0);
       }
     }
-  }
+  });
 
-  std::string output_path;
-  if (neighbor) {
-    const std::vector<std::vector<int>> kernel = {{1, 1, 1}, {1, 1, 1}, {1, 1, 1}};
-    std::vector<std::vector<int32_t>> padded_matrix(grid_rows + 2, std::vector<int32_t>(grid_cols + 2, 0));
-    for (int32_t row = 0; row < grid_rows; ++row) {
-      for (int32_t col = 0; col < grid_cols; ++col) {
-        padded_matrix[row + 1][col + 1] = net_count[row][col];
-      }
-    }
-    std::vector<std::vector<int32_t>> neighbor_net_count(grid_rows, std::vector<int32_t>(grid_cols, 0));
-    for (int32_t row = 0; row < grid_rows; ++row) {
-      for (int32_t col = 0; col < grid_cols; ++col) {
-        int32_t sum = 0;
-        for (int32_t ker_i = 0; ker_i < 3; ++ker_i) {
-          for (int32_t ker_j = 0; ker_j < 3; ++ker_j) {
-            sum += kernel[ker_i][ker_j] * padded_matrix[row + ker_i][col + ker_j];
-          }
-        }
-        neighbor_net_count[row][col] = sum;
-      }
-    }
-    output_path = createDirPath("density_map") + "/" + "neighbor_" + output_filename;
-    std::ofstream csv_file(output_path);
-    for (int32_t row = grid_rows - 1; row >= 0; --row) {
-      for (int32_t col = 0; col < grid_cols; ++col) {
-        double density = neighbor_net_count[row][col];
-        csv_file << std::fixed << std::setprecision(6) << density;
-        if (col < grid_cols - 1)
-          csv_file << ",";
-      }
-      csv_file << "\n";
-    }
-    csv_file.close();
-  }
-
-  else {
-    output_path = createDirPath("density_map") + "/" + output_filename;
-    std::ofstream csv_file(output_path);
-    for (int32_t row = grid_rows - 1; row >= 0; --row) {
-      for (int32_t col = 0; col < grid_cols; ++col) {
-        // int32_t grid_lx = region.lx + col * grid_size;
-        // int32_t grid_ly = region.ly + row * grid_size;
-        // int32_t grid_ux = std::min(region.lx + (col + 1) * grid_size, region.ux);
-        // int32_t grid_uy = std::min(region.ly + (row + 1) * grid_size, region.uy);
-
-        // double grid_area = static_cast<double>((grid_ux - grid_lx) * (grid_uy - grid_ly));
-
-        // double density = net_count[row][col] / grid_area;
-        double density = net_count[row][col];
-
-        csv_file << std::fixed << std::setprecision(6) << density;
-        if (col < grid_cols - 1)
-          csv_file << ",";
-      }
-      csv_file << "\n";
-    }
-    csv_file.close();
-  }
-
-  return getAbsoluteFilePath(output_path);
+  return neighbor ? sumNeighborGrids(net_count) : net_count;
 }
 
 std::string DensityEval::evalMargin(DensityCells cells, DensityRegion die, DensityRegion core, int32_t grid_size, std::string margin_type,
@@ -8,6 +8,8 @@
 #pragma once
 
 #include "density_db.h"
+#include "map_db.h"
+
 namespace ieval {
 
 struct MarginGrid
@@ -43,6 +45,11 @@ class DensityEval
   std::string evalVerticalMargin(DensityCells cells, DensityRegion die, DensityRegion core, int32_t grid_size);
   std::string evalAllMargin(DensityCells cells, DensityRegion die, DensityRegion core, int32_t grid_size);
 
+  // in-memory maps, row 0 is the bottom row of the region
+  GridMap evalCellDensityMap(const DensityCells& cells, const DensityRegion& region, int32_t grid_size, std::string cell_type);
+  GridMap evalPinDensityMap(const DensityPins& pins, const DensityRegion& region, int32_t grid_size, bool neighbor, std::string pin_type);
+  GridMap evalNetDensityMap(const DensityNets& nets, const DensityRegion& region, int32_t grid_size, bool neighbor, std::string net_type);
+
   void initIDB();
   void destroyIDB();
   void initIDBCells();
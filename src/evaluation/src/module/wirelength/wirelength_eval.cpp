@@ -370,6 +370,11 @@ float WirelengthEval::evalPathEGRWL(std::string guide_path, std::string net_name
   return EVAL_INIT_EGR_INST->parsePathEGRWL(guide_path, net_name, load_name);
 }
 
+std::unordered_map<std::string, float> WirelengthEval::evalAllNetEGRWL(std::string guide_path)
+{
+  return EVAL_INIT_EGR_INST->parseAllNetEGRWL(guide_path);
+}
+
 int32_t WirelengthEval::getDesignUnit()
 {
   return EVAL_INIT_IDB_INST->getDesignUnit();
@@ -429,10 +434,13 @@ void WirelengthEval::destroyFlute()
 void WirelengthEval::evalNetInfo()
 {
   auto name_pointset = getNamePointSet();
+  auto name_egr_wl = evalAllNetEGRWL(EVAL_INIT_EGR_INST->getEGRDirPath() + "/initial_router/route.guide");
+  int32_t design_unit = getDesignUnit();
   for (const auto& [net_name, point_set] : name_pointset) {
     _name_hpwl[net_name] = evalNetHPWL(point_set);
     _name_flute[net_name] = evalNetFLUTE(point_set);
-    _name_grwl[net_name] = evalNetEGRWL(EVAL_INIT_EGR_INST->getEGRDirPath() + "/initial_router/route.guide", net_name) * getDesignUnit();
+    auto iter = name_egr_wl.find(net_name);
+    _name_grwl[net_name] = (iter == name_egr_wl.end() ? 0 : iter->second) * design_unit;
   }
 }
 
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <map>
+#include <unordered_map>
 
 #include "wirelength_db.h"
 
@@ -45,6 +46,7 @@ class WirelengthEval
   float evalTotalEGRWL(std::string guide_path);
   float evalNetEGRWL(std::string guide_path, std::string net_name);
   float evalPathEGRWL(std::string guide_path, std::string net_name, std::string load_name);
+  std::unordered_map<std::string, float> evalAllNetEGRWL(std::string guide_path);
 
   int32_t getDesignUnit();
   std::map<std::string, std::vector<std::pair<int32_t, int32_t>>> getNamePointSet();
@@ -0,0 +1,453 @@
+/*
+ * @FilePath: egr_guide_store.cpp
+ * @Description: indexed store of the early global route guide
+ */
+
+#include "egr_guide_store.h"
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string_view>
+
+namespace ieval {
+
+static constexpr char kIndexMagic[8] = {'E', 'G', 'R', 'I', 'D', 'X', '0', '1'};
+
+namespace {
+
+void splitTokens(const std::string& line, std::vector<std::string_view>& tokens)
+{
+  tokens.clear();
+  size_t pos = 0;
+  while (pos < line.size()) {
+    while (pos < line.size() && std::isspace(static_cast<unsigned char>(line[pos]))) {
+      ++pos;
+    }
+    size_t begin = pos;
+    while (pos < line.size() && !std::isspace(static_cast<unsigned char>(line[pos]))) {
+      ++pos;
+    }
+    if (pos > begin) {
+      tokens.emplace_back(line.data() + begin, pos - begin);
+    }
+  }
+}
+
+template <typename T>
+T toNumber(std::string_view token)
+{
+  T value = 0;
+  std::from_chars(token.data(), token.data() + token.size(), value);
+  return value;
+}
+
+template <typename T>
+void writePod(std::ofstream& out, const T& value)
+{
+  out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void writeString(std::ofstream& out, const std::string& str)
+{
+  writePod(out, static_cast<uint32_t>(str.size()));
+  out.write(str.data(), str.size());
+}
+
+/**
+ * @brief read the index with every length checked against the bytes left in the file, so a corrupt index is rejected
+ * instead of read past its end.
+ */
+class IndexReader
+{
+ public:
+  IndexReader(std::ifstream& in, uint64_t file_size) : _in(in), _remaining(file_size) {}
+
+  template <typename T>
+  bool readPod(T& value)
+  {
+    return readBytes(reinterpret_cast<char*>(&value), sizeof(T));
+  }
+
+  bool readBytes(char* data, uint64_t size)
+  {
+    if (size > _remaining) {
+      return false;
+    }
+    _in.read(data, static_cast<std::streamsize>(size));
+    _remaining -= size;
+    return static_cast<bool>(_in);
+  }
+
+  bool readString(std::string& str)
+  {
+    uint32_t size = 0;
+    if (!readPod(size) || size > _remaining) {
+      return false;
+    }
+    str.resize(size);
+    return readBytes(str.data(), size);
+  }
+
+  // whether the rest of the file can hold num items of at least item_size bytes
+  bool canHold(uint64_t num, uint64_t item_size) const { return num <= _remaining / item_size; }
+  uint64_t get_remaining() const { return _remaining; }
+
+ private:
+  std::ifstream& _in;
+  uint64_t _remaining;
+};
+
+// the least bytes of the records in the index
+constexpr uint64_t kLayerRecordSize = sizeof(uint32_t) + sizeof(int8_t);
+constexpr uint64_t kNetRecordSize = sizeof(uint32_t) + sizeof(float) + 4 * sizeof(int32_t) + 2 * sizeof(uint32_t);
+constexpr uint64_t kPinRecordSize = 3 * sizeof(int32_t) + 2 * sizeof(double) + sizeof(uint8_t) + sizeof(uint32_t);
+
+bool getFileStamp(const std::string& file_path, uint64_t& file_size, int64_t& file_mtime)
+{
+  std::error_code ec;
+  file_size = std::filesystem::file_size(file_path, ec);
+  if (ec) {
+    return false;
+  }
+  file_mtime = std::filesystem::last_write_time(file_path, ec).time_since_epoch().count();
+  return !ec;
+}
+
+}  // namespace
+
+bool EGRGuideStore::load(const std::string& guide_path, bool persist_index)
+{
+  uint64_t guide_size = 0;
+  int64_t guide_mtime = 0;
+  if (!getFileStamp(guide_path, guide_size, guide_mtime)) {
+    std::cout << "Error: Can not open route guide " << guide_path << std::endl;
+    return false;
+  }
+  if (guide_path == _guide_path && guide_size == _guide_size && guide_mtime == _guide_mtime) {
+    return true;
+  }
+
+  clear();
+  std::string index_path = getIndexPath(guide_path);
+  if (std::filesystem::exists(index_path) && readIndex(index_path, guide_size, guide_mtime)) {
+    _guide_path = guide_path;
+    buildNetIndex();
+    return true;
+  }
+
+  clear();
+  if (!parseGuide(guide_path)) {
+    return false;
+  }
+  _guide_path = guide_path;
+  _guide_size = guide_size;
+  _guide_mtime = guide_mtime;
+  if (persist_index && !writeIndex(index_path)) {
+    std::cout << "Warning: Can not write route guide index " << index_path << std::endl;
+  }
+  return true;
+}
+
+void EGRGuideStore::clear()
+{
+  _guide_path.clear();
+  _guide_size = 0;
+  _guide_mtime = 0;
+  _layer_names.clear();
+  _layer_index.clear();
+  _layer_directions.clear();
+  _nets.clear();
+  _net_index.clear();
+}
+
+const EGRGuideNet* EGRGuideStore::findNet(const std::string& net_name) const
+{
+  auto iter = _net_index.find(net_name);
+  return iter == _net_index.end() ? nullptr : &_nets[iter->second];
+}
+
+float EGRGuideStore::calcTotalWirelength() const
+{
+  float total_wirelength = 0;
+  for (const auto& net : _nets) {
+    total_wirelength += net.wirelength;
+  }
+  return total_wirelength;
+}
+
+float EGRGuideStore::calcPathWirelength(const std::string& net_name, const std::string& load_name) const
+{
+  const EGRGuideNet* net = findNet(net_name);
+  if (net == nullptr || net->wires.empty()) {
+    std::cout << "Error: Reached end of wires without finding load pin." << std::endl;
+    return -1;
+  }
+
+  const EGRGuidePin* driven_pin = nullptr;
+  const EGRGuidePin* load_pin = nullptr;
+  for (const auto& pin : net->pins) {
+    if (pin.is_driven) {
+      driven_pin = &pin;
+    } else if (pin.name == load_name) {
+      load_pin = &pin;
+    }
+  }
+  if (driven_pin == nullptr || load_pin == nullptr) {
+    std::cout << "Error: Driven or load pin not found in net " << net_name << std::endl;
+    return -1;
+  }
+
+  // wires starting from the same gcell are taken from the last one in the guide, as the previous stack based walk did.
+  auto gcell_key = [](int32_t gx, int32_t gy) { return (static_cast<uint64_t>(static_cast<uint32_t>(gx)) << 32) | static_cast<uint32_t>(gy); };
+  std::unordered_map<uint64_t, std::vector<size_t>> start_wires;
+  for (size_t i = 0; i < net->wires.size(); ++i) {
+    start_wires[gcell_key(net->wires[i].gx1, net->wires[i].gy1)].push_back(i);
+  }
+
+  float path_egr_wl = 0;
+  int32_t current_x = driven_pin->gx;
+  int32_t current_y = driven_pin->gy;
+  for (size_t step = 0; step < net->wires.size(); ++step) {
+    auto iter = start_wires.find(gcell_key(current_x, current_y));
+    if (iter == start_wires.end() || iter->second.empty()) {
+      std::cout << "Error: Path interrupted. Unable to reach load pin." << std::endl;
+      return -1;
+    }
+    const EGRGuideWire& wire = net->wires[iter->second.back()];
+    iter->second.pop_back();
+
+    path_egr_wl += std::fabs(wire.rx1 - wire.rx2) + std::fabs(wire.ry1 - wire.ry2);
+    current_x = wire.gx2;
+    current_y = wire.gy2;
+    if (current_x == load_pin->gx && current_y == load_pin->gy) {
+      return path_egr_wl;
+    }
+  }
+
+  std::cout << "Error: Reached end of wires without finding load pin." << std::endl;
+  return -1;
+}
+
+bool EGRGuideStore::parseGuide(const std::string& guide_path)
+{
+  std::ifstream file(guide_path);
+  if (!file.is_open()) {
+    std::cout << "Error: Can not open route guide " << guide_path << std::endl;
+    return false;
+  }
+
+  std::string line;
+  for (int i = 0; i < 4; ++i) {
+    std::getline(file, line);
+  }
+
+  std::vector<std::string_view> tokens;
+  EGRGuideNet* current_net = nullptr;
+  while (std::getline(file, line)) {
+    splitTokens(line, tokens);
+    if (tokens.empty()) {
+      continue;
+    }
+
+    if (tokens[0] == "guide" && tokens.size() >= 2) {
+      std::string net_name(tokens[1]);
+      auto iter = _net_index.find(net_name);
+      if (iter == _net_index.end()) {
+        iter = _net_index.emplace(net_name, _nets.size()).first;
+        _nets.emplace_back();
+        _nets.back().name = net_name;
+      }
+      current_net = &_nets[iter->second];
+    } else if (tokens[0] == "pin" && tokens.size() >= 8 && current_net != nullptr) {
+      EGRGuidePin pin;
+      pin.gx = toNumber<int32_t>(tokens[1]);
+      pin.gy = toNumber<int32_t>(tokens[2]);
+      pin.rx = toNumber<double>(tokens[3]);
+      pin.ry = toNumber<double>(tokens[4]);
+      pin.layer_idx = getLayerIdx(std::string(tokens[5]));
+      pin.is_driven = tokens[6] == "driven";
+      pin.name = tokens[7];
+      current_net->pins.push_back(std::move(pin));
+    } else if (tokens[0] == "wire" && tokens.size() >= 10) {
+      EGRGuideWire wire;
+      wire.gx1 = toNumber<int32_t>(tokens[1]);
+      wire.gy1 = toNumber<int32_t>(tokens[2]);
+      wire.gx2 = toNumber<int32_t>(tokens[3]);
+      wire.gy2 = toNumber<int32_t>(tokens[4]);
+      wire.rx1 = toNumber<float>(tokens[5]);
+      wire.ry1 = toNumber<float>(tokens[6]);
+      wire.rx2 = toNumber<float>(tokens[7]);
+      wire.ry2 = toNumber<float>(tokens[8]);
+      std::string layer_name(tokens[9]);
+      wire.layer_idx = getLayerIdx(layer_name);
+
+      if (_layer_directions.find(layer_name) == _layer_directions.end()) {
+        if (wire.gx1 == wire.gx2) {
+          _layer_directions[layer_name] = LayerDirection::Vertical;
+        } else if (wire.gy1 == wire.gy2) {
+          _layer_directions[layer_name] = LayerDirection::Horizontal;
+        }
+      }
+      if (current_net == nullptr) {
+        continue;
+      }
+      current_net->wirelength += std::fabs(wire.rx1 - wire.rx2) + std::fabs(wire.ry1 - wire.ry2);
+      current_net->gcell_lx = std::min({current_net->gcell_lx, wire.gx1, wire.gx2});
+      current_net->gcell_ly = std::min({current_net->gcell_ly, wire.gy1, wire.gy2});
+      current_net->gcell_ux = std::max({current_net->gcell_ux, wire.gx1, wire.gx2});
+      current_net->gcell_uy = std::max({current_net->gcell_uy, wire.gy1, wire.gy2});
+      current_net->wires.push_back(wire);
+    }
+  }
+  return true;
+}
+
+bool EGRGuideStore::writeIndex(const std::string& index_path) const
+{
+  std::ofstream out(index_path, std::ios::binary);
+  if (!out.is_open()) {
+    return false;
+  }
+
+  out.write(kIndexMagic, sizeof(kIndexMagic));
+  writePod(out, _guide_size);
+  writePod(out, _guide_mtime);
+
+  writePod(out, static_cast<uint32_t>(_layer_names.size()));
+  for (const auto& layer_name : _layer_names) {
+    writeString(out, layer_name);
+    auto iter = _layer_directions.find(layer_name);
+    int8_t direction = iter == _layer_directions.end() ? -1 : static_cast<int8_t>(iter->second);
+    writePod(out, direction);
+  }
+
+  writePod(out, static_cast<uint64_t>(_nets.size()));
+  for (const auto& net : _nets) {
+    writeString(out, net.name);
+    writePod(out, net.wirelength);
+    writePod(out, net.gcell_lx);
+    writePod(out, net.gcell_ly);
+    writePod(out, net.gcell_ux);
+    writePod(out, net.gcell_uy);
+    writePod(out, static_cast<uint32_t>(net.pins.size()));
+    for (const auto& pin : net.pins) {
+      writePod(out, pin.gx);
+      writePod(out, pin.gy);
+      writePod(out, pin.rx);
+      writePod(out, pin.ry);
+      writePod(out, pin.layer_idx);
+      writePod(out, static_cast<uint8_t>(pin.is_driven));
+      writeString(out, pin.name);
+    }
+    writePod(out, static_cast<uint32_t>(net.wires.size()));
+    out.write(reinterpret_cast<const char*>(net.wires.data()), net.wires.size() * sizeof(EGRGuideWire));
+  }
+  return out.good();
+}
+
+bool EGRGuideStore::readIndex(const std::string& index_path, uint64_t guide_size, int64_t guide_mtime)
+{
+  std::error_code ec;
+  uint64_t index_size = std::filesystem::file_size(index_path, ec);
+  std::ifstream in(index_path, std::ios::binary);
+  if (ec || !in.is_open()) {
+    return false;
+  }
+  IndexReader reader(in, index_size);
+
+  // the stamp is checked before anything else is parsed
+  char magic[sizeof(kIndexMagic)];
+  if (!reader.readBytes(magic, sizeof(magic)) || std::memcmp(magic, kIndexMagic, sizeof(kIndexMagic)) != 0) {
+    return false;
+  }
+  if (!reader.readPod(_guide_size) || !reader.readPod(_guide_mtime) || _guide_size != guide_size || _guide_mtime != guide_mtime) {
+    return false;
+  }
+
+  uint32_t layer_num = 0;
+  if (!reader.readPod(layer_num) || !reader.canHold(layer_num, kLayerRecordSize)) {
+    return false;
+  }
+  for (uint32_t i = 0; i < layer_num; ++i) {
+    std::string layer_name;
+    int8_t direction = -1;
+    if (!reader.readString(layer_name) || !reader.readPod(direction) || direction > static_cast<int8_t>(LayerDirection::Vertical)) {
+      return false;
+    }
+    getLayerIdx(layer_name);
+    if (direction >= 0) {
+      _layer_directions[layer_name] = static_cast<LayerDirection>(direction);
+    }
+  }
+  auto is_valid_layer = [this](int32_t layer_idx) { return layer_idx >= 0 && layer_idx < static_cast<int32_t>(_layer_names.size()); };
+
+  uint64_t net_num = 0;
+  if (!reader.readPod(net_num) || !reader.canHold(net_num, kNetRecordSize)) {
+    return false;
+  }
+  _nets.reserve(net_num);
+  for (uint64_t i = 0; i < net_num; ++i) {
+    EGRGuideNet net;
+    uint32_t pin_num = 0;
+    if (!reader.readString(net.name) || !reader.readPod(net.wirelength) || !reader.readPod(net.gcell_lx) || !reader.readPod(net.gcell_ly)
+        || !reader.readPod(net.gcell_ux) || !reader.readPod(net.gcell_uy) || !reader.readPod(pin_num)
+        || !reader.canHold(pin_num, kPinRecordSize)) {
+      return false;
+    }
+    net.pins.reserve(pin_num);
+    for (uint32_t j = 0; j < pin_num; ++j) {
+      EGRGuidePin pin;
+      uint8_t is_driven = 0;
+      if (!reader.readPod(pin.gx) || !reader.readPod(pin.gy) || !reader.readPod(pin.rx) || !reader.readPod(pin.ry)
+          || !reader.readPod(pin.layer_idx) || !reader.readPod(is_driven) || !reader.readString(pin.name) || !is_valid_layer(pin.layer_idx)) {
+        return false;
+      }
+      pin.is_driven = is_driven != 0;
+      net.pins.push_back(std::move(pin));
+    }
+    uint32_t wire_num = 0;
+    if (!reader.readPod(wire_num) || !reader.canHold(wire_num, sizeof(EGRGuideWire))) {
+      return false;
+    }
+    net.wires.resize(wire_num);
+    if (!reader.readBytes(reinterpret_cast<char*>(net.wires.data()), wire_num * sizeof(EGRGuideWire))) {
+      return false;
+    }
+    for (const auto& wire : net.wires) {
+      if (!is_valid_layer(wire.layer_idx)) {
+        return false;
+      }
+    }
+    _nets.push_back(std::move(net));
+  }
+  return reader.get_remaining() == 0;
+}
+
+int32_t EGRGuideStore::getLayerIdx(const std::string& layer_name)
+{
+  auto iter = _layer_index.find(layer_name);
+  if (iter != _layer_index.end()) {
+    return iter->second;
+  }
+  int32_t layer_idx = static_cast<int32_t>(_layer_names.size());
+  _layer_names.push_back(layer_name);
+  _layer_index.emplace(layer_name, layer_idx);
+  return layer_idx;
+}
+
+void EGRGuideStore::buildNetIndex()
+{
+  _net_index.clear();
+  _net_index.reserve(_nets.size());
+  for (size_t i = 0; i < _nets.size(); ++i) {
+    _net_index.emplace(_nets[i].name, i);
+  }
+}
+
+}  // namespace ieval
@@ -0,0 +1,101 @@
+/*
+ * @FilePath: egr_guide_store.h
+ * @Description: indexed store of the early global route guide
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ieval {
+
+enum class LayerDirection
+{
+  Horizontal,
+  Vertical
+};
+
+struct EGRGuidePin
+{
+  int32_t gx;
+  int32_t gy;
+  double rx;
+  double ry;
+  int32_t layer_idx;
+  bool is_driven;
+  std::string name;
+};
+
+struct EGRGuideWire
+{
+  int32_t gx1;
+  int32_t gy1;
+  int32_t gx2;
+  int32_t gy2;
+  float rx1;
+  float ry1;
+  float rx2;
+  float ry2;
+  int32_t layer_idx;
+};
+
+struct EGRGuideNet
+{
+  std::string name;
+  std::vector<EGRGuidePin> pins;
+  std::vector<EGRGuideWire> wires;
+  float wirelength = 0;
+  // gcell span of the wires
+  int32_t gcell_lx = INT32_MAX;
+  int32_t gcell_ly = INT32_MAX;
+  int32_t gcell_ux = INT32_MIN;
+  int32_t gcell_uy = INT32_MIN;
+};
+
+/**
+ * @brief the route guide is parsed once, every net is indexed by name. The index can be persisted to a binary sidecar
+ * next to the guide file, it is reused as long as the size and the modification time of the guide are unchanged. A
+ * stale or corrupt index is ignored and the guide is parsed again.
+ */
+class EGRGuideStore
+{
+ public:
+  EGRGuideStore() = default;
+  ~EGRGuideStore() = default;
+
+  bool load(const std::string& guide_path, bool persist_index = false);
+  void clear();
+
+  const std::string& get_guide_path() const { return _guide_path; }
+  const std::vector<std::string>& get_layer_names() const { return _layer_names; }
+  const std::vector<EGRGuideNet>& get_nets() const { return _nets; }
+  const std::unordered_map<std::string, LayerDirection>& get_layer_directions() const { return _layer_directions; }
+
+  const EGRGuideNet* findNet(const std::string& net_name) const;
+  float calcTotalWirelength() const;
+  float calcPathWirelength(const std::string& net_name, const std::string& load_name) const;
+
+  static std::string getIndexPath(const std::string& guide_path) { return guide_path + ".idx"; }
+
+ private:
+  std::string _guide_path;
+  uint64_t _guide_size = 0;
+  int64_t _guide_mtime = 0;
+
+  std::vector<std::string> _layer_names;
+  std::unordered_map<std::string, int32_t> _layer_index;
+  std::unordered_map<std::string, LayerDirection> _layer_directions;
+  std::vector<EGRGuideNet> _nets;
+  std::unordered_map<std::string, size_t> _net_index;
+
+  bool parseGuide(const std::string& guide_path);
+  bool readIndex(const std::string& index_path, uint64_t guide_size, int64_t guide_mtime);
+  bool writeIndex(const std::string& index_path) const;
+  int32_t getLayerIdx(const std::string& layer_name);
+  void buildNetIndex();
+};
+
+}  // namespace ieval
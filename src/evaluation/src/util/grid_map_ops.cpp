@@ -0,0 +1,368 @@
+/*
+ * @FilePath: grid_map_ops.cpp
+ * @Description: parallel builder of the congestion/density grid maps
+ */
+
+#include "grid_map_ops.h"
+
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <sstream>
+
+namespace ieval {
+
+// upper bound of the grids held by the per-thread builders, keeps the memory of large maps reasonable.
+static constexpr size_t kMaxBuilderGrids = size_t(1) << 25;
+static constexpr size_t kMinItemsPerThread = 1024;
+
+GridMapBuilder::GridMapBuilder(int32_t region_lx, int32_t region_ly, int32_t region_ux, int32_t region_uy, int32_t grid_size)
+    : _region_lx(region_lx), _region_ly(region_ly), _region_ux(region_ux), _region_uy(region_uy), _grid_size(grid_size)
+{
+  _cols = std::max(0, (region_ux - region_lx + grid_size - 1) / grid_size);
+  _rows = std::max(0, (region_uy - region_ly + grid_size - 1) / grid_size);
+  _diff.assign(static_cast<size_t>(_rows + 1) * (_cols + 1), 0.0);
+  _direct.assign(static_cast<size_t>(_rows) * _cols, 0.0);
+}
+
+void GridMapBuilder::addValue(int32_t row, int32_t col, double value)
+{
+  _direct[static_cast<size_t>(row) * _cols + col] += value;
+}
+
+void GridMapBuilder::addRange(int32_t start_row, int32_t end_row, int32_t start_col, int32_t end_col, double value)
+{
+  _diff[diffIndex(start_row, start_col)] += value;
+  _diff[diffIndex(start_row, end_col + 1)] -= value;
+  _diff[diffIndex(end_row + 1, start_col)] -= value;
+  _diff[diffIndex(end_row + 1, end_col + 1)] += value;
+}
+
+void GridMapBuilder::addOverlap(int32_t lx, int32_t ly, int32_t ux, int32_t uy, int32_t start_row, int32_t end_row, int32_t start_col,
+                                int32_t end_col, double weight, OverlapMode mode)
+{
+  start_row = std::max(0, start_row);
+  end_row = std::min(_rows - 1, end_row);
+  start_col = std::max(0, start_col);
+  end_col = std::min(_cols - 1, end_col);
+  if (start_row > end_row || start_col > end_col) {
+    return;
+  }
+
+  // the fully covered rows and cols are contiguous
+  int32_t full_start_col = end_col + 1;
+  int32_t full_end_col = start_col - 1;
+  for (int32_t col = start_col; col <= end_col; ++col) {
+    if (lx <= gridLx(col) && ux >= gridUx(col)) {
+      full_start_col = std::min(full_start_col, col);
+      full_end_col = std::max(full_end_col, col);
+    }
+  }
+  int32_t full_start_row = end_row + 1;
+  int32_t full_end_row = start_row - 1;
+  for (int32_t row = start_row; row <= end_row; ++row) {
+    if (ly <= gridLy(row) && uy >= gridUy(row)) {
+      full_start_row = std::min(full_start_row, row);
+      full_end_row = std::max(full_end_row, row);
+    }
+  }
+
+  bool has_full = full_start_col <= full_end_col && full_start_row <= full_end_row;
+  if (has_full) {
+    addRange(full_start_row, full_end_row, full_start_col, full_end_col, weight);
+  }
+
+  auto add_boundary_grid = [&](int32_t row, int32_t col) {
+    int32_t grid_lx = gridLx(col);
+    int32_t grid_ly = gridLy(row);
+    int32_t grid_ux = gridUx(col);
+    int32_t grid_uy = gridUy(row);
+    double grid_area = static_cast<double>(grid_ux - grid_lx) * (grid_uy - grid_ly);
+
+    int64_t overlap_w = static_cast<int64_t>(std::min(ux, grid_ux)) - std::max(lx, grid_lx);
+    int64_t overlap_h = static_cast<int64_t>(std::min(uy, grid_uy)) - std::max(ly, grid_ly);
+    int64_t overlap_area = 0;
+    if (mode == OverlapMode::kWire) {
+      if (overlap_w == 0) {
+        overlap_area = overlap_h;
+      } else if (overlap_h == 0) {
+        overlap_area = overlap_w;
+      } else {
+        overlap_area = overlap_w * overlap_h;
+      }
+    } else {
+      overlap_area = std::max<int64_t>(0, overlap_w) * std::max<int64_t>(0, overlap_h);
+    }
+    _direct[static_cast<size_t>(row) * _cols + col] += static_cast<double>(overlap_area) * weight / grid_area;
+  };
+
+  for (int32_t row = start_row; row <= end_row; ++row) {
+    if (has_full && row >= full_start_row && row <= full_end_row) {
+      for (int32_t col = start_col; col < full_start_col; ++col) {
+        add_boundary_grid(row, col);
+      }
+      for (int32_t col = full_end_col + 1; col <= end_col; ++col) {
+        add_boundary_grid(row, col);
+      }
+    } else {
+      for (int32_t col = start_col; col <= end_col; ++col) {
+        add_boundary_grid(row, col);
+      }
+    }
+  }
+}
+
+void GridMapBuilder::merge(const GridMapBuilder& other)
+{
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < _diff.size(); ++i) {
+    _diff[i] += other._diff[i];
+  }
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < _direct.size(); ++i) {
+    _direct[i] += other._direct[i];
+  }
+}
+
+GridMap GridMapBuilder::build() const
+{
+  GridMap grid_map;
+  grid_map.rows = _rows;
+  grid_map.cols = _cols;
+  grid_map.values = _direct;
+
+  // prefix sum along the cols, then along the rows
+  std::vector<double> prefix(_diff);
+#pragma omp parallel for schedule(static)
+  for (int32_t row = 0; row <= _rows; ++row) {
+    for (int32_t col = 1; col <= _cols; ++col) {
+      prefix[diffIndex(row, col)] += prefix[diffIndex(row, col - 1)];
+    }
+  }
+  for (int32_t row = 1; row < _rows; ++row) {
+    for (int32_t col = 0; col < _cols; ++col) {
+      prefix[diffIndex(row, col)] += prefix[diffIndex(row - 1, col)];
+    }
+  }
+
+  for (int32_t row = 0; row < _rows; ++row) {
+    for (int32_t col = 0; col < _cols; ++col) {
+      grid_map.at(row, col) += prefix[diffIndex(row, col)];
+    }
+  }
+  return grid_map;
+}
+
+int32_t getGridMapThreadNum(size_t item_num, int32_t rows, int32_t cols)
+{
+  size_t grid_num = std::max<size_t>(1, static_cast<size_t>(rows + 1) * (cols + 1));
+  size_t thread_num = static_cast<size_t>(omp_get_max_threads());
+  thread_num = std::min(thread_num, std::max<size_t>(1, item_num / kMinItemsPerThread));
+  thread_num = std::min(thread_num, std::max<size_t>(1, kMaxBuilderGrids / grid_num));
+  return static_cast<int32_t>(thread_num);
+}
+
+GridMap sumNeighborGrids(const GridMap& grid_map)
+{
+  int32_t rows = grid_map.rows;
+  int32_t cols = grid_map.cols;
+
+  // summed-area table with one row/col of zero padding
+  std::vector<double> table(static_cast<size_t>(rows + 1) * (cols + 1), 0.0);
+  auto table_at = [&](int32_t row, int32_t col) -> double& { return table[static_cast<size_t>(row) * (cols + 1) + col]; };
+  for (int32_t row = 0; row < rows; ++row) {
+    for (int32_t col = 0; col < cols; ++col) {
+      table_at(row + 1, col + 1) = grid_map.at(row, col) + table_at(row, col + 1) + table_at(row + 1, col) - table_at(row, col);
+    }
+  }
+
+  GridMap neighbor_map;
+  neighbor_map.rows = rows;
+  neighbor_map.cols = cols;
+  neighbor_map.values.assign(grid_map.values.size(), 0.0);
+#pragma omp parallel for schedule(static)
+  for (int32_t row = 0; row < rows; ++row) {
+    int32_t row_lo = std::max(0, row - 1);
+    int32_t row_hi = std::min(rows, row + 2);
+    for (int32_t col = 0; col < cols; ++col) {
+      int32_t col_lo = std::max(0, col - 1);
+      int32_t col_hi = std::min(cols, col + 2);
+      neighbor_map.at(row, col) = table_at(row_hi, col_hi) - table_at(row_lo, col_hi) - table_at(row_hi, col_lo) + table_at(row_lo, col_lo);
+    }
+  }
+  return neighbor_map;
+}
+
+GridMap makeGridMap(const std::vector<std::vector<double>>& top_first_rows)
+{
+  GridMap grid_map;
+  grid_map.rows = static_cast<int32_t>(top_first_rows.size());
+  grid_map.cols = top_first_rows.empty() ? 0 : static_cast<int32_t>(top_first_rows.front().size());
+  grid_map.values.assign(static_cast<size_t>(grid_map.rows) * grid_map.cols, 0.0);
+  for (int32_t row = 0; row < grid_map.rows; ++row) {
+    const auto& line = top_first_rows[grid_map.rows - 1 - row];
+    for (int32_t col = 0; col < grid_map.cols && col < static_cast<int32_t>(line.size()); ++col) {
+      grid_map.at(row, col) = line[col];
+    }
+  }
+  return grid_map;
+}
+
+GridMap readGridMapCSV(const std::string& file_path)
+{
+  std::ifstream file(file_path);
+  if (!file.is_open()) {
+    return GridMap();
+  }
+
+  std::vector<std::vector<double>> top_first_rows;
+  std::string line;
+  while (std::getline(file, line)) {
+    std::istringstream iss(line);
+    std::string value;
+    std::vector<double> row_values;
+    while (std::getline(iss, value, ',')) {
+      row_values.push_back(std::stod(value));
+    }
+    top_first_rows.push_back(std::move(row_values));
+  }
+  file.close();
+
+  return makeGridMap(top_first_rows);
+}
+
+void writeGridMapCSV(const GridMap& grid_map, const std::string& file_path)
+{
+  std::ofstream csv_file(file_path);
+  csv_file << std::fixed << std::setprecision(6);
+  for (int32_t row = grid_map.rows - 1; row >= 0; --row) {
+    for (int32_t col = 0; col < grid_map.cols; ++col) {
+      csv_file << grid_map.at(row, col);
+      if (col < grid_map.cols - 1) {
+        csv_file << ",";
+      }
+    }
+    csv_file << "\n";
+  }
+  csv_file.close();
+}
+
+double calcMaxGridValue(const GridMap& grid_map)
+{
+  double max_value = -1.0;
+  for (double value : grid_map.values) {
+    max_value = std::max(max_value, value);
+  }
+  return max_value;
+}
+
+double calcTotalGridValue(const GridMap& grid_map)
+{
+  double total_value = 0.0;
+  for (double value : grid_map.values) {
+    total_value += value;
+  }
+  return total_value;
+}
+
+double calcWeightedTopGridValue(const GridMap& grid_map)
+{
+  if (grid_map.empty()) {
+    return 0.0;
+  }
+
+  size_t size = grid_map.values.size();
+  size_t idx_0_5_percent = std::max(size_t(1), static_cast<size_t>(std::ceil(size * 0.005)));
+  size_t idx_1_percent = std::max(size_t(1), static_cast<size_t>(std::ceil(size * 0.01)));
+  size_t idx_2_percent = std::max(size_t(1), static_cast<size_t>(std::ceil(size * 0.02)));
+  size_t idx_5_percent = std::max(size_t(1), static_cast<size_t>(std::ceil(size * 0.05)));
+
+  // only the top 5% grids are needed
+  std::vector<double> values(idx_5_percent);
+  std::partial_sort_copy(grid_map.values.begin(), grid_map.values.end(), values.begin(), values.end(), std::greater<double>());
+
+  double sum_05 = 0.0;
+  for (size_t i = 0; i < idx_0_5_percent; ++i) {
+    sum_05 += values[i];
+  }
+  double sum_1 = sum_05;
+  for (size_t i = idx_0_5_percent; i < idx_1_percent; ++i) {
+    sum_1 += values[i];
+  }
+  double sum_2 = sum_1;
+  for (size_t i = idx_1_percent; i < idx_2_percent; ++i) {
+    sum_2 += values[i];
+  }
+  double sum_5 = sum_2;
+  for (size_t i = idx_2_percent; i < idx_5_percent; ++i) {
+    sum_5 += values[i];
+  }
+
+  return (sum_05 * 0.4 + sum_1 * 0.3 + sum_2 * 0.2 + sum_5 * 0.1) / 4.0;
+}
+
+// the modification time of a missing file is the min time, so a map stored before its csv is written stays valid.
+static std::filesystem::file_time_type getFileMTime(const std::string& file_path)
+{
+  std::error_code error_code;
+  auto mtime = std::filesystem::last_write_time(file_path, error_code);
+  return error_code ? std::filesystem::file_time_type::min() : mtime;
+}
+
+void GridMapCache::put(const std::string& file_path, GridMap grid_map)
+{
+  auto mtime = getFileMTime(file_path);
+  std::lock_guard<std::mutex> lock(_mutex);
+  insert(file_path, mtime, std::make_shared<const GridMap>(std::move(grid_map)));
+}
+
+std::shared_ptr<const GridMap> GridMapCache::get(const std::string& file_path)
+{
+  auto mtime = getFileMTime(file_path);
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto iter = _entries.find(file_path);
+  if (iter != _entries.end() && iter->second.mtime == mtime) {
+    iter->second.last_use = ++_use_count;
+    return iter->second.grid_map;
+  }
+
+  // missing or stale, reload from the csv
+  auto grid_map = std::make_shared<const GridMap>(readGridMapCSV(file_path));
+  if (grid_map->empty()) {
+    if (iter != _entries.end()) {
+      _entries.erase(iter);
+    }
+    return nullptr;
+  }
+  insert(file_path, mtime, grid_map);
+  return grid_map;
+}
+
+void GridMapCache::clear()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _entries.clear();
+}
+
+size_t GridMapCache::size() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _entries.size();
+}
+
+void GridMapCache::insert(const std::string& file_path, std::filesystem::file_time_type mtime, std::shared_ptr<const GridMap> grid_map)
+{
+  auto& entry = _entries[file_path];
+  entry.mtime = mtime;
+  entry.grid_map = std::move(grid_map);
+  entry.last_use = ++_use_count;
+
+  while (_entries.size() > _max_size) {
+    auto lru_iter = std::min_element(_entries.begin(), _entries.end(),
+                                     [](const auto& lhs, const auto& rhs) { return lhs.second.last_use < rhs.second.last_use; });
+    _entries.erase(lru_iter);
+  }
+}
+
+}  // namespace ieval
@@ -0,0 +1,137 @@
+/*
+ * @FilePath: grid_map_ops.h
+ * @Description: parallel builder of the congestion/density grid maps
+ */
+
+#pragma once
+
+#include <omp.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "map_db.h"
+
+namespace ieval {
+
+enum class OverlapMode
+{
+  kArea,  // overlap area of the rectangle and the grid
+  kWire   // same as kArea, but a degenerate overlap counts its length (line width is 1)
+};
+
+/**
+ * @brief accumulate rectangles onto a grid map. The grids fully covered by a rectangle are added by a 2-D difference
+ * array, only the boundary grids are computed one by one, so the cost of a rectangle is its perimeter instead of its area.
+ */
+class GridMapBuilder
+{
+ public:
+  GridMapBuilder(int32_t region_lx, int32_t region_ly, int32_t region_ux, int32_t region_uy, int32_t grid_size);
+  ~GridMapBuilder() = default;
+
+  int32_t get_rows() const { return _rows; }
+  int32_t get_cols() const { return _cols; }
+
+  void addValue(int32_t row, int32_t col, double value);
+  void addRange(int32_t start_row, int32_t end_row, int32_t start_col, int32_t end_col, double value);
+  void addOverlap(int32_t lx, int32_t ly, int32_t ux, int32_t uy, int32_t start_row, int32_t end_row, int32_t start_col, int32_t end_col,
+                  double weight, OverlapMode mode);
+
+  void merge(const GridMapBuilder& other);
+  GridMap build() const;
+
+ private:
+  int32_t _region_lx;
+  int32_t _region_ly;
+  int32_t _region_ux;
+  int32_t _region_uy;
+  int32_t _grid_size;
+  int32_t _rows;
+  int32_t _cols;
+
+  std::vector<double> _diff;    // (rows + 1) * (cols + 1)
+  std::vector<double> _direct;  // rows * cols
+
+  int32_t gridLx(int32_t col) const { return _region_lx + col * _grid_size; }
+  int32_t gridLy(int32_t row) const { return _region_ly + row * _grid_size; }
+  int32_t gridUx(int32_t col) const { return std::min(_region_lx + (col + 1) * _grid_size, _region_ux); }
+  int32_t gridUy(int32_t row) const { return std::min(_region_ly + (row + 1) * _grid_size, _region_uy); }
+  size_t diffIndex(int32_t row, int32_t col) const { return static_cast<size_t>(row) * (_cols + 1) + col; }
+};
+
+int32_t getGridMapThreadNum(size_t item_num, int32_t rows, int32_t cols);
+
+/**
+ * @brief split the items into contiguous chunks, each thread accumulates its chunk into a private builder and the
+ * builders are merged in chunk order, so the result does not depend on the thread scheduling.
+ */
+template <typename T, typename Func>
+GridMap buildGridMapParallel(const GridMapBuilder& empty_builder, const std::vector<T>& items, Func&& add_item)
+{
+  int32_t thread_num = getGridMapThreadNum(items.size(), empty_builder.get_rows(), empty_builder.get_cols());
+  std::vector<GridMapBuilder> builders(thread_num, empty_builder);
+  size_t chunk_size = (items.size() + thread_num - 1) / thread_num;
+
+#pragma omp parallel for num_threads(thread_num) schedule(static, 1)
+  for (int32_t chunk = 0; chunk < thread_num; ++chunk) {
+    size_t begin = chunk * chunk_size;
+    size_t end = std::min(items.size(), begin + chunk_size);
+    for (size_t i = begin; i < end; ++i) {
+      add_item(builders[chunk], items[i]);
+    }
+  }
+
+  for (int32_t chunk = 1; chunk < thread_num; ++chunk) {
+    builders[0].merge(builders[chunk]);
+  }
+  return builders[0].build();
+}
+
+GridMap sumNeighborGrids(const GridMap& grid_map);
+GridMap makeGridMap(const std::vector<std::vector<double>>& top_first_rows);
+GridMap readGridMapCSV(const std::string& file_path);
+void writeGridMapCSV(const GridMap& grid_map, const std::string& file_path);
+
+double calcMaxGridValue(const GridMap& grid_map);
+double calcTotalGridValue(const GridMap& grid_map);
+double calcWeightedTopGridValue(const GridMap& grid_map);
+
+/**
+ * @brief thread-safe cache of the grid maps keyed by the csv path. An entry is valid only while the file keeps the
+ * modification time it had when the entry was stored, a map without file stays valid until the file appears. The least
+ * recently used entry is dropped when the cache is full.
+ */
+class GridMapCache
+{
+ public:
+  explicit GridMapCache(size_t max_size = 32) : _max_size(std::max<size_t>(1, max_size)) {}
+  ~GridMapCache() = default;
+
+  void put(const std::string& file_path, GridMap grid_map);
+  std::shared_ptr<const GridMap> get(const std::string& file_path);
+  void clear();
+  size_t size() const;
+
+ private:
+  struct Entry
+  {
+    std::filesystem::file_time_type mtime;
+    std::shared_ptr<const GridMap> grid_map;
+    uint64_t last_use = 0;
+  };
+
+  mutable std::mutex _mutex;
+  size_t _max_size;
+  uint64_t _use_count = 0;
+  std::map<std::string, Entry> _entries;
+
+  void insert(const std::string& file_path, std::filesystem::file_time_type mtime, std::shared_ptr<const GridMap> grid_map);
+};
+
+}  // namespace ieval
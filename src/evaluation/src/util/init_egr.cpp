@@ -8,14 +8,10 @@
 #include "init_egr.h"
 
 #include <any>
-#include <cmath>
 #include <fstream>
 #include <iostream>
 #include <map>
-#include <sstream>
-#include <stack>
 #include <string>
-#include <vector>
 
 #include "RTInterface.hpp"
 #include "idm.h"
@@ -57,221 +53,64 @@ void InitEGR::runEGR()
   rt_interface.initRT(config_map);
   rt_interface.runEGR();
   rt_interface.destroyRT();
+  _guide_store.clear();
 }
 
-float InitEGR::parseEGRWL(std::string guide_path)
-{
-  float egr_wl = 0;
-
-  std::ifstream file(guide_path);
-  std::string line;
-  std::map<std::string, float> net_lengths;
-  std::string current_net;
-
-  struct Wire
-  {
-    int gx1, gy1, gx2, gy2;
-    float rx1, ry1, rx2, ry2;
-    std::string layer;
-  };
-
-  for (int i = 0; i < 4; ++i) {
-    std::getline(file, line);
-  }
-
-  while (std::getline(file, line)) {
-    std::istringstream iss(line);
-    std::string type;
-    iss >> type;
 
-    if (type == "guide") {
-      iss >> current_net;
-      if (net_lengths.find(current_net) == net_lengths.end()) {
-        net_lengths[current_net] = 0.0;
-      }
-    } else if (type == "wire") {
-      Wire wire;
-      iss >> wire.gx1 >> wire.gy1 >> wire.gx2 >> wire.gy2 >> wire.rx1 >> wire.ry1 >> wire.rx2 >> wire.ry2 >> wire.layer;
-      float wire_length = fabs(wire.rx1 - wire.rx2) + fabs(wire.ry1 - wire.ry2);
-      net_lengths[current_net] += wire_length;
-    }
-  }
-
-  for (const auto& net : net_lengths) {
-    // std::cout << "Net " << net.first << " wire length: " << net.second << std::endl;
-    egr_wl += net.second;
+const EGRGuideStore* InitEGR::getGuideStore(const std::string& guide_path)
+{
+  if (!_guide_store.load(guide_path, _persist_guide_index)) {
+    return nullptr;
   }
+  return &_guide_store;
+}
 
-  // std::cout << "Total wire length for all nets: " << egr_wl << std::endl;
-  return egr_wl;
+float InitEGR::parseEGRWL(std::string guide_path)
+{
+  const EGRGuideStore* guide_store = getGuideStore(guide_path);
+  return guide_store == nullptr ? 0 : guide_store->calcTotalWirelength();
 }
 
 float InitEGR::parseNetEGRWL(std::string guide_path, std::string net_name)
 {
-  float net_egr_wl = 0;
-
-  std::ifstream file(guide_path);
-  std::string line;
-  std::string current_net;
-
-  struct Wire
-  {
-    int gx1, gy1, gx2, gy2;
-    float rx1, ry1, rx2, ry2;
-    std::string layer;
-  };
-
-  for (int i = 0; i < 4; ++i) {
-    std::getline(file, line);
-  }
-
-  while (std::getline(file, line)) {
-    std::istringstream iss(line);
-    std::string type;
-    iss >> type;
-
-    if (type == "guide") {
-      iss >> current_net;
-    } else if (type == "wire" && current_net == net_name) {
-      Wire wire;
-      iss >> wire.gx1 >> wire.gy1 >> wire.gx2 >> wire.gy2 >> wire.rx1 >> wire.ry1 >> wire.rx2 >> wire.ry2 >> wire.layer;
-      float wire_length = fabs(wire.rx1 - wire.rx2) + fabs(wire.ry1 - wire.ry2);
-      net_egr_wl += wire_length;
-    }
+  const EGRGuideStore* guide_store = getGuideStore(guide_path);
+  if (guide_store == nullptr) {
+    return 0;
   }
-  return net_egr_wl;
+  const EGRGuideNet* net = guide_store->findNet(net_name);
+  return net == nullptr ? 0 : net->wirelength;
 }
 
 float InitEGR::parsePathEGRWL(std::string guide_path, std::string net_name, std::string load_name)
 {
-  float path_egr_wl = 0;
-
-  std::ifstream file(guide_path);
-  std::string line;
-  std::string target_net = net_name;
-  bool is_target_net = false;
-  struct Pin
-  {
-    int gx, gy;
-    double rx, ry;
-    std::string layer;
-    std::string energy;
-    std::string name;
-  };
-  struct Wire
-  {
-    int gx1, gy1, gx2, gy2;
-    float rx1, ry1, rx2, ry2;
-    std::string layer;
-  };
-  Pin driven_pin;
-  Pin load_pin;
-  std::stack<Wire> wire_stack;
-
-  for (int i = 0; i < 4; ++i) {
-    std::getline(file, line);
+  const EGRGuideStore* guide_store = getGuideStore(guide_path);
+  if (guide_store == nullptr) {
+    return -1;
   }
+  return guide_store->calcPathWirelength(net_name, load_name);
+}
 
-  while (std::getline(file, line)) {
-    std::istringstream iss(line);
-    std::string type;
-    iss >> type;
-
-    if (type == "guide") {
-      std::string net_name;
-      iss >> net_name;
-      is_target_net = (net_name == target_net);
-    } else if (is_target_net) {
-      if (type == "pin") {
-        Pin pin;
-        iss >> pin.gx >> pin.gy >> pin.rx >> pin.ry >> pin.layer >> pin.energy >> pin.name;
-        if (pin.energy == "driven") {
-          driven_pin = pin;
-        } else if (pin.energy == "load" && pin.name == load_name) {
-          load_pin = pin;
-        }
-      } else if (type == "wire") {
-        Wire wire;
-        iss >> wire.gx1 >> wire.gy1 >> wire.gx2 >> wire.gy2 >> wire.rx1 >> wire.ry1 >> wire.rx2 >> wire.ry2 >> wire.layer;
-        wire_stack.push(wire);
-      }
-    }
+std::unordered_map<std::string, float> InitEGR::parseAllNetEGRWL(std::string guide_path)
+{
+  std::unordered_map<std::string, float> net_egr_wl;
+  const EGRGuideStore* guide_store = getGuideStore(guide_path);
+  if (guide_store == nullptr) {
+    return net_egr_wl;
   }
-
-  int current_x = driven_pin.gx, current_y = driven_pin.gy;
-  std::stack<Wire> temp_stack;
-
-  while (!wire_stack.empty()) {
-    bool wire_found = false;
-    while (!wire_stack.empty()) {
-      Wire wire = wire_stack.top();
-      wire_stack.pop();
-
-      if (wire.gx1 == current_x && wire.gy1 == current_y) {
-        path_egr_wl += std::fabs(wire.rx1 - wire.rx2) + std::fabs(wire.ry1 - wire.ry2);
-        current_x = wire.gx2;
-        current_y = wire.gy2;
-        wire_found = true;
-
-        if (current_x == load_pin.gx && current_y == load_pin.gy) {
-          return path_egr_wl;
-        }
-        break;
-      } else {
-        temp_stack.push(wire);
-      }
-    }
-
-    if (!wire_found) {
-      std::cout << "Error: Path interrupted. Unable to reach load pin." << std::endl;
-      return -1;
-    }
-
-    while (!temp_stack.empty()) {
-      wire_stack.push(temp_stack.top());
-      temp_stack.pop();
-    }
+  net_egr_wl.reserve(guide_store->get_nets().size());
+  for (const auto& net : guide_store->get_nets()) {
+    net_egr_wl[net.name] = net.wirelength;
   }
-
-  std::cout << "Error: Reached end of wires without finding load pin." << std::endl;
-  return -1;
+  return net_egr_wl;
 }
 
 std::unordered_map<std::string, LayerDirection> InitEGR::parseLayerDirection(std::string guide_path)
 {
-  std::ifstream file(guide_path);
-  std::string line;
-  std::unordered_map<std::string, LayerDirection> layer_directions;
-
-  struct Wire
-  {
-    int gx1, gy1, gx2, gy2;
-    float rx1, ry1, rx2, ry2;
-    std::string layer;
-  };
-
-  for (int i = 0; i < 4; ++i) {
-    std::getline(file, line);
-  }
-
-  while (std::getline(file, line)) {
-    std::istringstream iss(line);
-    std::string type;
-    iss >> type;
-
-    if (type == "wire") {
-      Wire wire;
-      iss >> wire.gx1 >> wire.gy1 >> wire.gx2 >> wire.gy2 >> wire.rx1 >> wire.ry1 >> wire.rx2 >> wire.ry2 >> wire.layer;
-      if (layer_directions.find(wire.layer) == layer_directions.end()) {
-        if (wire.gx1 == wire.gx2) {
-          layer_directions[wire.layer] = LayerDirection::Vertical;
-        } else if (wire.gy1 == wire.gy2) {
-          layer_directions[wire.layer] = LayerDirection::Horizontal;
-        }
-      }
-    }
+  const EGRGuideStore* guide_store = getGuideStore(guide_path);
+  if (guide_store == nullptr) {
+    return {};
   }
-  return layer_directions;
+  return guide_store->get_layer_directions();
 }
 
 }  // namespace ieval
\ No newline at end of file
@@ -10,13 +10,9 @@
 #include <string>
 #include <unordered_map>
 
-namespace ieval {
+#include "egr_guide_store.h"
 
-enum class LayerDirection
-{
-  Horizontal,
-  Vertical
-};
+namespace ieval {
 
 class InitEGR
 {
@@ -32,13 +28,20 @@ class InitEGR
   float parseEGRWL(std::string guide_path);
   float parseNetEGRWL(std::string guide_path, std::string net_name);
   float parsePathEGRWL(std::string guide_path, std::string net_name, std::string load_name);
+  std::unordered_map<std::string, float> parseAllNetEGRWL(std::string guide_path);
 
   std::unordered_map<std::string, LayerDirection> parseLayerDirection(std::string guide_path);
 
+  // the guide is indexed once per file, optionally persisted to a binary sidecar ("<guide>.idx")
+  void set_persist_guide_index(bool persist_guide_index) { _persist_guide_index = persist_guide_index; }
+  const EGRGuideStore* getGuideStore(const std::string& guide_path);
+
  private:
   static InitEGR* _init_egr;
 
   std::string _egr_dir_path;
+  bool _persist_guide_index = false;
+  EGRGuideStore _guide_store;
 };
 
 }  // namespace ieval
@@ -0,0 +1,138 @@
+/*
+ * @FilePath: egr_guide_store_test.cpp
+ * @Description: tests of the route guide store and its binary index
+ */
+
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "egr_guide_store.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+using namespace ieval;
+
+class EGRGuideStoreTest : public testing::Test
+{
+ public:
+  void SetUp() override
+  {
+    _guide_path = testing::TempDir() + "egr_guide_store_XXXXXX";
+    int fd = mkstemp(_guide_path.data());
+    ASSERT_NE(fd, -1);
+    close(fd);
+    writeGuide("1.5");
+  }
+  void TearDown() override
+  {
+    std::remove(_guide_path.c_str());
+    std::remove(EGRGuideStore::getIndexPath(_guide_path).c_str());
+  }
+
+ protected:
+  std::string _guide_path;
+
+  // the first 4 lines are the header of the guide
+  void writeGuide(const std::string& wire_end)
+  {
+    std::ofstream guide_file(_guide_path);
+    guide_file << "header\nheader\nheader\nheader\n"
+               << "guide net_a\n"
+               << "pin 0 0 0.5 0.5 M1 driven u1/Z\n"
+               << "pin 2 0 2.5 0.5 M1 load u2/A\n"
+               << "wire 0 0 1 0 0.5 0.5 " << wire_end << " 0.5 M2\n"
+               << "wire 1 0 2 0 1.5 0.5 2.5 0.5 M2\n"
+               << "guide net_b\n"
+               << "pin 3 3 3.5 3.5 M1 driven u3/Z\n"
+               << "wire 3 3 3 5 3.5 3.5 3.5 5.5 M3\n";
+  }
+
+  void expectGuide(const EGRGuideStore& store, float net_a_path_wl)
+  {
+    ASSERT_EQ(store.get_nets().size(), 2);
+    EXPECT_EQ(store.get_layer_names(), (std::vector<std::string>{"M1", "M2", "M3"}));
+    EXPECT_EQ(store.get_layer_directions().at("M2"), LayerDirection::Horizontal);
+    EXPECT_EQ(store.get_layer_directions().at("M3"), LayerDirection::Vertical);
+
+    const EGRGuideNet* net_a = store.findNet("net_a");
+    ASSERT_NE(net_a, nullptr);
+    ASSERT_EQ(net_a->pins.size(), 2);
+    EXPECT_EQ(net_a->pins[1].name, "u2/A");
+    EXPECT_TRUE(net_a->pins[0].is_driven);
+    EXPECT_EQ(net_a->wires.size(), 2);
+    EXPECT_EQ(net_a->gcell_ux, 2);
+    EXPECT_FLOAT_EQ(store.calcPathWirelength("net_a", "u2/A"), net_a_path_wl);
+    EXPECT_FLOAT_EQ(store.calcTotalWirelength(), net_a_path_wl + 2.0f);
+    EXPECT_EQ(store.findNet("net_c"), nullptr);
+  }
+};
+
+TEST_F(EGRGuideStoreTest, index_round_trip)
+{
+  EGRGuideStore store;
+  ASSERT_TRUE(store.load(_guide_path, true));
+  expectGuide(store, 2.0f);
+  ASSERT_TRUE(std::filesystem::exists(EGRGuideStore::getIndexPath(_guide_path)));
+
+  // rewrite the guide with the same size and mtime, the index is still taken, which prove it is read
+  auto guide_mtime = std::filesystem::last_write_time(_guide_path);
+  writeGuide("1.0");
+  std::filesystem::last_write_time(_guide_path, guide_mtime);
+
+  EGRGuideStore index_store;
+  ASSERT_TRUE(index_store.load(_guide_path));
+  expectGuide(index_store, 2.0f);
+
+  // the changed mtime make the index stale, the guide is parsed again
+  std::filesystem::last_write_time(_guide_path, guide_mtime + std::chrono::seconds(1));
+  EGRGuideStore stale_store;
+  ASSERT_TRUE(stale_store.load(_guide_path));
+  expectGuide(stale_store, 1.5f);
+}
+
+TEST_F(EGRGuideStoreTest, corrupt_index)
+{
+  {
+    EGRGuideStore store;
+    ASSERT_TRUE(store.load(_guide_path, true));
+  }
+  std::string index_path = EGRGuideStore::getIndexPath(_guide_path);
+  std::ifstream index_file(index_path, std::ios::binary);
+  std::string index_data((std::istreambuf_iterator<char>(index_file)), std::istreambuf_iterator<char>());
+  index_file.close();
+
+  auto load_with_index = [&](const std::string& data) {
+    std::ofstream out(index_path, std::ios::binary | std::ios::trunc);
+    out.write(data.data(), data.size());
+    out.close();
+    EGRGuideStore store;
+    ASSERT_TRUE(store.load(_guide_path));
+    expectGuide(store, 2.0f);
+  };
+
+  // every truncated index is rejected and the guide is parsed
+  for (size_t size = 0; size < index_data.size(); ++size) {
+    load_with_index(index_data.substr(0, size));
+  }
+  // trailing garbage
+  load_with_index(index_data + "garbage");
+  // huge lengths and counts, every 4 bytes after the stamp is set to 0xffffffff in turn
+  for (size_t pos = 24; pos + 4 <= index_data.size(); ++pos) {
+    std::string data = index_data;
+    data.replace(pos, 4, "\xff\xff\xff\xff");
+    EGRGuideStore store;
+    ASSERT_TRUE((std::ofstream(index_path, std::ios::binary | std::ios::trunc) << data).good());
+    ASSERT_TRUE(store.load(_guide_path));
+    EXPECT_EQ(store.get_nets().size(), 2);
+  }
+}
+
+}  // namespace
@@ -0,0 +1,227 @@
+/*
+ * @FilePath: grid_map_ops_test.cpp
+ * @Description: tests of the grid map builder, csv io and map cache
+ */
+
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "grid_map_ops.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+using namespace ieval;
+
+struct TestRect
+{
+  int32_t lx;
+  int32_t ly;
+  int32_t ux;
+  int32_t uy;
+  double weight;
+};
+
+constexpr int32_t kRegionLx = 10;
+constexpr int32_t kRegionLy = 20;
+constexpr int32_t kRegionUx = 1010;  // the last col is not a full grid
+constexpr int32_t kRegionUy = 745;   // the last row is not a full grid
+constexpr int32_t kGridSize = 30;
+
+std::vector<TestRect> makeRandomRects(size_t rect_num)
+{
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<int32_t> x_dist(kRegionLx, kRegionUx);
+  std::uniform_int_distribution<int32_t> y_dist(kRegionLy, kRegionUy);
+  std::uniform_real_distribution<double> weight_dist(0.1, 2.0);
+
+  std::vector<TestRect> rects;
+  for (size_t i = 0; i < rect_num; ++i) {
+    int32_t x1 = x_dist(gen);
+    int32_t x2 = x_dist(gen);
+    int32_t y1 = y_dist(gen);
+    int32_t y2 = y_dist(gen);
+    // some degenerate rects, which is a wire in kWire mode
+    if (i % 5 == 0) {
+      x2 = x1;
+    }
+    rects.push_back({std::min(x1, x2), std::min(y1, y2), std::max(x1, x2), std::max(y1, y2), weight_dist(gen)});
+  }
+  return rects;
+}
+
+void addRect(GridMapBuilder& builder, const TestRect& rect, OverlapMode mode)
+{
+  builder.addOverlap(rect.lx, rect.ly, rect.ux, rect.uy, (rect.ly - kRegionLy) / kGridSize, (rect.uy - kRegionLy) / kGridSize,
+                     (rect.lx - kRegionLx) / kGridSize, (rect.ux - kRegionLx) / kGridSize, rect.weight, mode);
+}
+
+// the overlap of every rect and every grid, one by one
+GridMap buildBruteForce(const std::vector<TestRect>& rects, OverlapMode mode)
+{
+  GridMap grid_map;
+  grid_map.cols = (kRegionUx - kRegionLx + kGridSize - 1) / kGridSize;
+  grid_map.rows = (kRegionUy - kRegionLy + kGridSize - 1) / kGridSize;
+  grid_map.values.assign(static_cast<size_t>(grid_map.rows) * grid_map.cols, 0.0);
+
+  for (const auto& rect : rects) {
+    int32_t start_row = std::max(0, (rect.ly - kRegionLy) / kGridSize);
+    int32_t end_row = std::min(grid_map.rows - 1, (rect.uy - kRegionLy) / kGridSize);
+    int32_t start_col = std::max(0, (rect.lx - kRegionLx) / kGridSize);
+    int32_t end_col = std::min(grid_map.cols - 1, (rect.ux - kRegionLx) / kGridSize);
+    for (int32_t row = start_row; row <= end_row; ++row) {
+      for (int32_t col = start_col; col <= end_col; ++col) {
+        int32_t grid_lx = kRegionLx + col * kGridSize;
+        int32_t grid_ly = kRegionLy + row * kGridSize;
+        int32_t grid_ux = std::min(grid_lx + kGridSize, kRegionUx);
+        int32_t grid_uy = std::min(grid_ly + kGridSize, kRegionUy);
+        int64_t overlap_w = static_cast<int64_t>(std::min(rect.ux, grid_ux)) - std::max(rect.lx, grid_lx);
+        int64_t overlap_h = static_cast<int64_t>(std::min(rect.uy, grid_uy)) - std::max(rect.ly, grid_ly);
+        int64_t overlap_area = std::max<int64_t>(0, overlap_w) * std::max<int64_t>(0, overlap_h);
+        if (mode == OverlapMode::kWire && (overlap_w == 0 || overlap_h == 0)) {
+          overlap_area = overlap_w == 0 ? overlap_h : overlap_w;
+        }
+        double grid_area = static_cast<double>(grid_ux - grid_lx) * (grid_uy - grid_ly);
+        grid_map.at(row, col) += overlap_area * rect.weight / grid_area;
+      }
+    }
+  }
+  return grid_map;
+}
+
+void expectMapNear(const GridMap& lhs, const GridMap& rhs, double tolerance)
+{
+  ASSERT_EQ(lhs.rows, rhs.rows);
+  ASSERT_EQ(lhs.cols, rhs.cols);
+  for (size_t i = 0; i < lhs.values.size(); ++i) {
+    EXPECT_NEAR(lhs.values[i], rhs.values[i], tolerance) << "grid " << i;
+  }
+}
+
+std::string makeTempCsvPath()
+{
+  std::string file_path = testing::TempDir() + "grid_map_ops_XXXXXX";
+  int fd = mkstemp(file_path.data());
+  if (fd != -1) {
+    close(fd);
+  }
+  return file_path;
+}
+
+TEST(GridMapOpsTest, builder_match_brute_force)
+{
+  auto rects = makeRandomRects(500);
+  for (auto mode : {OverlapMode::kArea, OverlapMode::kWire}) {
+    GridMapBuilder builder(kRegionLx, kRegionLy, kRegionUx, kRegionUy, kGridSize);
+    for (const auto& rect : rects) {
+      addRect(builder, rect, mode);
+    }
+    expectMapNear(builder.build(), buildBruteForce(rects, mode), 1e-9);
+  }
+}
+
+TEST(GridMapOpsTest, parallel_match_serial)
+{
+  // enough rects for several threads
+  auto rects = makeRandomRects(20000);
+  GridMapBuilder empty_builder(kRegionLx, kRegionLy, kRegionUx, kRegionUy, kGridSize);
+
+  GridMapBuilder serial_builder = empty_builder;
+  for (const auto& rect : rects) {
+    addRect(serial_builder, rect, OverlapMode::kArea);
+  }
+  GridMap parallel_map
+      = buildGridMapParallel(empty_builder, rects, [](GridMapBuilder& builder, const TestRect& rect) { addRect(builder, rect, OverlapMode::kArea); });
+
+  expectMapNear(parallel_map, serial_builder.build(), 1e-6);
+}
+
+TEST(GridMapOpsTest, sum_neighbor_grids)
+{
+  GridMap grid_map = makeGridMap({{1, 2, 3, 4}, {5, 6, 7, 8}, {9, 10, 11, 12}});
+  GridMap neighbor_map = sumNeighborGrids(grid_map);
+
+  for (int32_t row = 0; row < grid_map.rows; ++row) {
+    for (int32_t col = 0; col < grid_map.cols; ++col) {
+      double sum = 0.0;
+      for (int32_t i = std::max(0, row - 1); i <= std::min(grid_map.rows - 1, row + 1); ++i) {
+        for (int32_t j = std::max(0, col - 1); j <= std::min(grid_map.cols - 1, col + 1); ++j) {
+          sum += grid_map.at(i, j);
+        }
+      }
+      EXPECT_DOUBLE_EQ(neighbor_map.at(row, col), sum);
+    }
+  }
+}
+
+TEST(GridMapOpsTest, csv_round_trip)
+{
+  // the csv is written top row first, row 0 of the map is the bottom row
+  GridMap grid_map = makeGridMap({{1.5, 2.25}, {3.0, 4.125}, {0.0, 6.5}});
+  EXPECT_DOUBLE_EQ(grid_map.at(0, 0), 0.0);
+  EXPECT_DOUBLE_EQ(grid_map.at(2, 1), 2.25);
+
+  std::string file_path = makeTempCsvPath();
+  writeGridMapCSV(grid_map, file_path);
+  GridMap read_map = readGridMapCSV(file_path);
+  std::remove(file_path.c_str());
+
+  EXPECT_EQ(read_map.rows, grid_map.rows);
+  EXPECT_EQ(read_map.cols, grid_map.cols);
+  EXPECT_EQ(read_map.values, grid_map.values);
+  EXPECT_DOUBLE_EQ(calcTotalGridValue(read_map), 17.375);
+  EXPECT_DOUBLE_EQ(calcMaxGridValue(read_map), 6.5);
+  EXPECT_TRUE(readGridMapCSV(file_path).empty());
+}
+
+TEST(GridMapOpsTest, cache_reload_changed_file)
+{
+  std::string file_path = makeTempCsvPath();
+  writeGridMapCSV(makeGridMap({{1.0, 2.0}}), file_path);
+
+  GridMapCache map_cache;
+  auto grid_map = map_cache.get(file_path);
+  ASSERT_NE(grid_map, nullptr);
+  EXPECT_DOUBLE_EQ(calcTotalGridValue(*grid_map), 3.0);
+
+  // the map is put before the file is rewritten, the rewritten file make it stale
+  map_cache.put(file_path, makeGridMap({{5.0, 5.0}}));
+  EXPECT_DOUBLE_EQ(calcTotalGridValue(*map_cache.get(file_path)), 10.0);
+
+  writeGridMapCSV(makeGridMap({{7.0, 8.0}}), file_path);
+  std::filesystem::last_write_time(file_path, std::filesystem::last_write_time(file_path) + std::chrono::seconds(1));
+  EXPECT_DOUBLE_EQ(calcTotalGridValue(*map_cache.get(file_path)), 15.0);
+  // the old map is still valid for the holder
+  EXPECT_DOUBLE_EQ(calcTotalGridValue(*grid_map), 3.0);
+
+  std::remove(file_path.c_str());
+  EXPECT_EQ(map_cache.get(file_path), nullptr);
+  EXPECT_EQ(map_cache.size(), 0);
+}
+
+TEST(GridMapOpsTest, cache_bounded)
+{
+  GridMapCache map_cache(2);
+  map_cache.put("/not/exist/a.csv", makeGridMap({{1.0}}));
+  map_cache.put("/not/exist/b.csv", makeGridMap({{2.0}}));
+  // a is used later than b, so b is dropped
+  EXPECT_NE(map_cache.get("/not/exist/a.csv"), nullptr);
+  map_cache.put("/not/exist/c.csv", makeGridMap({{3.0}}));
+
+  EXPECT_EQ(map_cache.size(), 2);
+  EXPECT_NE(map_cache.get("/not/exist/a.csv"), nullptr);
+  EXPECT_EQ(map_cache.get("/not/exist/b.csv"), nullptr);
+  EXPECT_NE(map_cache.get("/not/exist/c.csv"), nullptr);
+
+  map_cache.clear();
+  EXPECT_EQ(map_cache.size(), 0);
+}
+
+}  // namespace
@@ -42,6 +42,7 @@
 #include "feature_ipl.h"
 #include "feature_irt.h"
 #include "feature_ito.h"
+#include "feature_table.h"
 
 namespace ieda_feature {
 
@@ -66,6 +67,9 @@ class FeatureBuilder
 
   bool buildRouteData(RouteAnalyseData* data);
 
+  /// columnar tables, the map table is skipped if grid_size <= 0
+  FeatureTableSet buildFeatureTables(int32_t grid_size);
+
  private:
   SummaryInfo buildSummaryInfo();
   SummaryLayout buildSummaryLayout();
@@ -74,6 +78,11 @@ class FeatureBuilder
   SummaryNets buildSummaryNets();
   SummaryLayers buildSummaryLayers();
   SummaryPins buildSummaryPins();
+
+  FeatureTable buildInstanceTable();
+  FeatureTable buildNetTable();
+  FeatureTable buildWireTable();
+  FeatureTable buildMapTable(int32_t grid_size);
 };
 
 }  // namespace ieda_feature
@@ -0,0 +1,261 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+/**
+ * @file		feature_builder_table.cpp
+ * @date		18/10/2026
+ * @version		0.1
+ * @description
+
+
+        build the columnar feature tables : instance, net, wire, map
+ *
+ */
+
+#include <algorithm>
+#include <climits>
+
+#include "IdbEnum.h"
+#include "IdbInstance.h"
+#include "IdbLayer.h"
+#include "IdbNet.h"
+#include "IdbPins.h"
+#include "IdbRegularWire.h"
+#include "IdbVias.h"
+#include "congestion_api.h"
+#include "density_api.h"
+#include "feature_builder.h"
+#include "idm.h"
+
+namespace ieda_feature {
+
+FeatureTableSet FeatureBuilder::buildFeatureTables(int32_t grid_size)
+{
+  FeatureTableSet table_set;
+  table_set.tables.push_back(buildInstanceTable());
+  table_set.tables.push_back(buildNetTable());
+  table_set.tables.push_back(buildWireTable());
+  if (grid_size > 0) {
+    table_set.tables.push_back(buildMapTable(grid_size));
+  }
+
+  return table_set;
+}
+
+FeatureTable FeatureBuilder::buildInstanceTable()
+{
+  auto& inst_list = dmInst->get_idb_design()->get_instance_list()->get_instance_list();
+  auto* enum_inst = IdbEnum::GetInstance();
+
+  FeatureTable table;
+  table.name = "instance";
+  auto& name = table.addColumn("name", FeatureColumnType::kString);
+  auto& master = table.addColumn("master", FeatureColumnType::kString);
+  auto& llx = table.addColumn("llx", FeatureColumnType::kInt32);
+  auto& lly = table.addColumn("lly", FeatureColumnType::kInt32);
+  auto& urx = table.addColumn("urx", FeatureColumnType::kInt32);
+  auto& ury = table.addColumn("ury", FeatureColumnType::kInt32);
+  auto& orient = table.addColumn("orient", FeatureColumnType::kString);
+  auto& status = table.addColumn("status", FeatureColumnType::kString);
+  auto& pin_num = table.addColumn("pin_num", FeatureColumnType::kInt32);
+  for (auto& column : table.columns) {
+    column.reserve(inst_list.size());
+  }
+
+  for (auto* inst : inst_list) {
+    auto* bbox = inst->get_bounding_box();
+    name.string_data.push_back(inst->get_name());
+    master.string_data.push_back(inst->get_cell_master() == nullptr ? "" : inst->get_cell_master()->get_name());
+    llx.int32_data.push_back(bbox->get_low_x());
+    lly.int32_data.push_back(bbox->get_low_y());
+    urx.int32_data.push_back(bbox->get_high_x());
+    ury.int32_data.push_back(bbox->get_high_y());
+    orient.string_data.push_back(enum_inst->get_site_property()->get_orient_name(inst->get_orient()));
+    status.string_data.push_back(enum_inst->get_instance_property()->get_status_str(inst->get_status()));
+    pin_num.int32_data.push_back(inst->get_pin_list()->get_pin_num());
+  }
+
+  return table;
+}
+
+FeatureTable FeatureBuilder::buildNetTable()
+{
+  auto& net_list = dmInst->get_idb_design()->get_net_list()->get_net_list();
+  auto* enum_inst = IdbEnum::GetInstance();
+
+  FeatureTable table;
+  table.name = "net";
+  auto& name = table.addColumn("name", FeatureColumnType::kString);
+  auto& type = table.addColumn("type", FeatureColumnType::kString);
+  auto& pin_num = table.addColumn("pin_num", FeatureColumnType::kInt32);
+  auto& llx = table.addColumn("llx", FeatureColumnType::kInt32);
+  auto& lly = table.addColumn("lly", FeatureColumnType::kInt32);
+  auto& urx = table.addColumn("urx", FeatureColumnType::kInt32);
+  auto& ury = table.addColumn("ury", FeatureColumnType::kInt32);
+  auto& hpwl = table.addColumn("hpwl", FeatureColumnType::kInt64);
+  auto& wire_len = table.addColumn("wire_len", FeatureColumnType::kInt64);
+  auto& via_num = table.addColumn("via_num", FeatureColumnType::kInt32);
+  for (auto& column : table.columns) {
+    column.reserve(net_list.size());
+  }
+
+  for (auto* net : net_list) {
+    /// pin bounding box
+    int32_t min_x = INT32_MAX;
+    int32_t min_y = INT32_MAX;
+    int32_t max_x = INT32_MIN;
+    int32_t max_y = INT32_MIN;
+    auto add_pins = [&](IdbPins* pins) {
+      for (auto* pin : pins->get_pin_list()) {
+        auto* coord = pin->get_average_coordinate();
+        min_x = std::min(min_x, coord->get_x());
+        min_y = std::min(min_y, coord->get_y());
+        max_x = std::max(max_x, coord->get_x());
+        max_y = std::max(max_y, coord->get_y());
+      }
+    };
+    add_pins(net->get_instance_pin_list());
+    add_pins(net->get_io_pins());
+    if (min_x > max_x) {
+      min_x = min_y = max_x = max_y = 0;
+    }
+
+    name.string_data.push_back(net->get_net_name());
+    type.string_data.push_back(enum_inst->get_connect_property()->get_type_name(net->get_connect_type()));
+    pin_num.int32_data.push_back(net->get_pin_number());
+    llx.int32_data.push_back(min_x);
+    lly.int32_data.push_back(min_y);
+    urx.int32_data.push_back(max_x);
+    ury.int32_data.push_back(max_y);
+    hpwl.int64_data.push_back(static_cast<int64_t>(max_x - min_x) + (max_y - min_y));
+    wire_len.int64_data.push_back(static_cast<int64_t>(net->wireLength()));
+    via_num.int32_data.push_back(static_cast<int32_t>(net->get_via_num()));
+  }
+
+  return table;
+}
+
+/**
+ * one row per routed shape, type : 0 wire, 1 via, 2 patch. A via is stored as a point on its cut layer, a patch as
+ * the absolute rectangle of its delta rect.
+ */
+FeatureTable FeatureBuilder::buildWireTable()
+{
+  auto& net_list = dmInst->get_idb_design()->get_net_list()->get_net_list();
+
+  FeatureTable table;
+  table.name = "wire";
+  auto& net_id = table.addColumn("net_id", FeatureColumnType::kInt32);
+  auto& type = table.addColumn("type", FeatureColumnType::kInt32);
+  auto& layer = table.addColumn("layer", FeatureColumnType::kInt32);
+  auto& x1 = table.addColumn("x1", FeatureColumnType::kInt32);
+  auto& y1 = table.addColumn("y1", FeatureColumnType::kInt32);
+  auto& x2 = table.addColumn("x2", FeatureColumnType::kInt32);
+  auto& y2 = table.addColumn("y2", FeatureColumnType::kInt32);
+
+  size_t row_num = 0;
+  for (auto* net : net_list) {
+    row_num += net->get_segment_num();
+  }
+  for (auto& column : table.columns) {
+    column.reserve(row_num);
+  }
+
+  auto add_row = [&](int32_t net_idx, int32_t shape_type, int32_t layer_order, int32_t px1, int32_t py1, int32_t px2, int32_t py2) {
+    net_id.int32_data.push_back(net_idx);
+    type.int32_data.push_back(shape_type);
+    layer.int32_data.push_back(layer_order);
+    x1.int32_data.push_back(px1);
+    y1.int32_data.push_back(py1);
+    x2.int32_data.push_back(px2);
+    y2.int32_data.push_back(py2);
+  };
+
+  for (size_t i = 0; i < net_list.size(); ++i) {
+    int32_t net_idx = static_cast<int32_t>(i);
+    for (auto* wire : net_list[i]->get_wire_list()->get_wire_list()) {
+      for (auto* segment : wire->get_segment_list()) {
+        if (segment->is_via()) {
+          for (auto* via : segment->get_via_list()) {
+            auto* coord = via->get_coordinate();
+            int32_t order = via->get_cut_layer_shape().get_layer()->get_order();
+            add_row(net_idx, 1, order, coord->get_x(), coord->get_y(), coord->get_x(), coord->get_y());
+          }
+        } else if (segment->is_rect()) {
+          auto* start = segment->get_point_start();
+          auto* rect = segment->get_delta_rect();
+          if (start == nullptr || rect == nullptr) {
+            continue;
+          }
+          add_row(net_idx, 2, segment->get_layer()->get_order(), start->get_x() + rect->get_low_x(), start->get_y() + rect->get_low_y(),
+                  start->get_x() + rect->get_high_x(), start->get_y() + rect->get_high_y());
+        } else if (segment->is_wire()) {
+          auto* start = segment->get_point_start();
+          auto* second = segment->get_point_second();
+          add_row(net_idx, 0, segment->get_layer()->get_order(), start->get_x(), start->get_y(), second->get_x(), second->get_y());
+        }
+      }
+    }
+  }
+
+  return table;
+}
+
+/**
+ * one row per grid, row 0 is the bottom row. All the maps share the grid of the first one, a map evaluated on another
+ * region is skipped.
+ */
+FeatureTable FeatureBuilder::buildMapTable(int32_t grid_size)
+{
+  std::vector<std::pair<std::string, ieval::GridMap>> maps;
+  maps.emplace_back("cell_density", DENSITY_API_INST->cellDensityGridMap(grid_size));
+  maps.emplace_back("pin_density", DENSITY_API_INST->pinDensityGridMap(grid_size));
+  maps.emplace_back("net_density", DENSITY_API_INST->netDensityGridMap(grid_size));
+  maps.emplace_back("rudy_horizontal", CONGESTION_API_INST->rudyGridMap(grid_size, "horizontal"));
+  maps.emplace_back("rudy_vertical", CONGESTION_API_INST->rudyGridMap(grid_size, "vertical"));
+  maps.emplace_back("rudy_union", CONGESTION_API_INST->rudyGridMap(grid_size, "union"));
+
+  FeatureTable table;
+  table.name = "map";
+  auto& row_column = table.addColumn("row", FeatureColumnType::kInt32);
+  auto& col_column = table.addColumn("col", FeatureColumnType::kInt32);
+
+  int32_t rows = maps.front().second.rows;
+  int32_t cols = maps.front().second.cols;
+  size_t grid_num = static_cast<size_t>(rows) * cols;
+  row_column.reserve(grid_num);
+  col_column.reserve(grid_num);
+  for (int32_t row = 0; row < rows; ++row) {
+    for (int32_t col = 0; col < cols; ++col) {
+      row_column.int32_data.push_back(row);
+      col_column.int32_data.push_back(col);
+    }
+  }
+
+  for (auto& [map_name, grid_map] : maps) {
+    if (grid_map.rows != rows || grid_map.cols != cols) {
+      std::cout << "Warning : map " << map_name << " is " << grid_map.rows << "x" << grid_map.cols << ", expected " << rows << "x" << cols
+                << ", skipped." << std::endl;
+      continue;
+    }
+    auto& column = table.addColumn(map_name, FeatureColumnType::kDouble);
+    column.double_data = std::move(grid_map.values);
+  }
+
+  return table;
+}
+
+}  // namespace ieda_feature
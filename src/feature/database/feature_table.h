@@ -0,0 +1,132 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+#pragma once
+/**
+ * @file		feature_table.h
+ * @date		18/10/2026
+ * @version		0.1
+ * @description
+
+
+        columnar feature table, every column holds one value per row
+ *
+ */
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace ieda_feature {
+
+enum class FeatureColumnType : uint8_t
+{
+  kInt32 = 0,
+  kInt64 = 1,
+  kDouble = 2,
+  kString = 3
+};
+
+struct FeatureColumn
+{
+  std::string name;
+  FeatureColumnType type = FeatureColumnType::kInt32;
+  /// only the vector matching the type is used
+  std::vector<int32_t> int32_data;
+  std::vector<int64_t> int64_data;
+  std::vector<double> double_data;
+  std::vector<std::string> string_data;
+
+  size_t size() const
+  {
+    switch (type) {
+      case FeatureColumnType::kInt32:
+        return int32_data.size();
+      case FeatureColumnType::kInt64:
+        return int64_data.size();
+      case FeatureColumnType::kDouble:
+        return double_data.size();
+      case FeatureColumnType::kString:
+        return string_data.size();
+    }
+    return 0;
+  }
+
+  void reserve(size_t row_num)
+  {
+    switch (type) {
+      case FeatureColumnType::kInt32:
+        int32_data.reserve(row_num);
+        break;
+      case FeatureColumnType::kInt64:
+        int64_data.reserve(row_num);
+        break;
+      case FeatureColumnType::kDouble:
+        double_data.reserve(row_num);
+        break;
+      case FeatureColumnType::kString:
+        string_data.reserve(row_num);
+        break;
+    }
+  }
+};
+
+struct FeatureTable
+{
+  std::string name;
+  /// deque keeps the references returned by addColumn valid while more columns are added
+  std::deque<FeatureColumn> columns;
+
+  FeatureColumn& addColumn(const std::string& column_name, FeatureColumnType type)
+  {
+    FeatureColumn column;
+    column.name = column_name;
+    column.type = type;
+    columns.push_back(std::move(column));
+    return columns.back();
+  }
+
+  FeatureColumn* findColumn(const std::string& column_name)
+  {
+    for (auto& column : columns) {
+      if (column.name == column_name) {
+        return &column;
+      }
+    }
+    return nullptr;
+  }
+
+  const FeatureColumn* findColumn(const std::string& column_name) const
+  {
+    for (auto& column : columns) {
+      if (column.name == column_name) {
+        return &column;
+      }
+    }
+    return nullptr;
+  }
+
+  size_t get_row_num() const { return columns.empty() ? 0 : columns.front().size(); }
+};
+
+/// the tables exported by save_feature_tables : instance, net, wire, map
+struct FeatureTableSet
+{
+  std::vector<FeatureTable> tables;
+};
+
+}  // namespace ieda_feature
@@ -139,4 +139,13 @@ bool FeatureManager::read_route_data(std::string path)
   return feature_parser.readRouteData(path, &_route_data);
 }
 
+bool FeatureManager::save_feature_tables(std::string path, int32_t grid_size)
+{
+  FeatureBuilder builder;
+  auto table_set = builder.buildFeatureTables(grid_size);
+
+  FeatureParser feature_parser;
+  return feature_parser.buildFeatureTables(path, &table_set);
+}
+
 }  // namespace ieda_feature
@@ -60,6 +60,8 @@ class FeatureManager
   // route data
   bool save_route_data(std::string path);
   bool read_route_data(std::string path);
+  // instance, net, wire and map tables, binary columnar for ".fcol", json otherwise
+  bool save_feature_tables(std::string path, int32_t grid_size);
   // evaluation
   bool save_eval_summary(std::string path, int32_t grid_size);
   bool save_timing_eval_summary(std::string path);
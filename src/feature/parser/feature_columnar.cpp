@@ -0,0 +1,552 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+/**
+ * @project		iEDA
+ * @file		feature_columnar.cpp
+ * @date		18/10/2026
+ * @version		0.1
+ * @description
+
+
+        binary columnar feature file
+ *
+ */
+
+#include "feature_columnar.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+namespace ieda_feature {
+
+namespace {
+
+constexpr char kMagic[8] = {'I', 'F', 'E', 'A', 'C', 'O', 'L', '\0'};
+constexpr uint32_t kVersion = 1;
+
+template <typename T>
+void writePod(std::ostream& stream, const T& value)
+{
+  stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+bool readPod(std::istream& stream, T& value)
+{
+  return static_cast<bool>(stream.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+void writeString(std::ostream& stream, const std::string& value)
+{
+  writePod(stream, static_cast<uint32_t>(value.size()));
+  stream.write(value.data(), value.size());
+}
+
+bool readString(std::istream& stream, std::string& value, uint64_t max_size)
+{
+  uint32_t size = 0;
+  if (!readPod(stream, size) || size > max_size) {
+    return false;
+  }
+  value.resize(size);
+  return static_cast<bool>(stream.read(value.data(), size));
+}
+
+template <typename T>
+void writeValues(std::ostream& stream, const std::vector<T>& values, size_t row_begin, size_t row_end)
+{
+  stream.write(reinterpret_cast<const char*>(values.data() + row_begin), (row_end - row_begin) * sizeof(T));
+}
+
+template <typename T>
+bool readValues(const std::vector<char>& buffer, uint64_t rows, std::vector<T>& values)
+{
+  /// compare by division, rows comes from the file and rows * sizeof(T) may overflow
+  if (rows > buffer.size() / sizeof(T)) {
+    return false;
+  }
+  size_t begin = values.size();
+  values.resize(begin + rows);
+  std::memcpy(values.data() + begin, buffer.data(), rows * sizeof(T));
+  return true;
+}
+
+/// the bytes of one value, a string value takes at least its uint32 length
+uint64_t valueSize(FeatureColumnType type)
+{
+  switch (type) {
+    case FeatureColumnType::kInt32:
+      return sizeof(int32_t);
+    case FeatureColumnType::kInt64:
+      return sizeof(int64_t);
+    case FeatureColumnType::kDouble:
+      return sizeof(double);
+    case FeatureColumnType::kString:
+      return sizeof(uint32_t);
+  }
+  return 1;
+}
+
+}  // namespace
+
+bool isFeatureColumnarPath(const std::string& path)
+{
+  std::string suffix(kFeatureColumnarSuffix);
+  return path.size() >= suffix.size() && path.compare(path.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+/// ###################################################################################///
+///  writer
+/// ###################################################################################///
+FeatureColumnarWriter::~FeatureColumnarWriter()
+{
+  if (_stream.is_open()) {
+    close();
+  }
+}
+
+bool FeatureColumnarWriter::open(const std::string& path)
+{
+  _tables.clear();
+  _table_open = false;
+  _stream.open(path, std::ios::binary | std::ios::trunc);
+  if (!_stream.is_open()) {
+    std::cout << "Error : can not open feature file " << path << std::endl;
+    return false;
+  }
+
+  _stream.write(kMagic, sizeof(kMagic));
+  writePod(_stream, kVersion);
+  return static_cast<bool>(_stream);
+}
+
+bool FeatureColumnarWriter::close()
+{
+  if (!_stream.is_open()) {
+    return false;
+  }
+  if (_table_open) {
+    endTable();
+  }
+
+  bool success = writeDirectory();
+  _stream.close();
+  _tables.clear();
+  return success;
+}
+
+bool FeatureColumnarWriter::writeTable(const FeatureTable& table, size_t chunk_rows)
+{
+  if (!beginTable(table.name)) {
+    return false;
+  }
+
+  chunk_rows = std::max<size_t>(1, chunk_rows);
+  size_t row_num = table.get_row_num();
+  for (size_t row_begin = 0; row_begin < row_num; row_begin += chunk_rows) {
+    if (!appendChunk(table, row_begin, std::min(row_num, row_begin + chunk_rows))) {
+      return false;
+    }
+  }
+
+  /// an empty table keeps its schema
+  if (row_num == 0) {
+    for (auto& column : table.columns) {
+      _tables.back().columns.push_back(FeatureColumnMeta{column.name, column.type, {}});
+    }
+  }
+
+  return endTable();
+}
+
+bool FeatureColumnarWriter::beginTable(const std::string& table_name)
+{
+  if (!_stream.is_open() || _table_open) {
+    return false;
+  }
+
+  FeatureTableMeta table_meta;
+  table_meta.name = table_name;
+  _tables.push_back(table_meta);
+  _table_open = true;
+  return true;
+}
+
+bool FeatureColumnarWriter::appendChunk(const FeatureTable& chunk, size_t row_begin, size_t row_end)
+{
+  if (!_table_open) {
+    return false;
+  }
+
+  row_end = std::min(row_end, chunk.get_row_num());
+  if (row_begin >= row_end) {
+    return true;
+  }
+
+  auto& table_meta = _tables.back();
+  if (table_meta.columns.empty()) {
+    for (auto& column : chunk.columns) {
+      table_meta.columns.push_back(FeatureColumnMeta{column.name, column.type, {}});
+    }
+  }
+
+  if (table_meta.columns.size() != chunk.columns.size()) {
+    std::cout << "Error : schema of table " << table_meta.name << " changed between chunks." << std::endl;
+    return false;
+  }
+
+  for (size_t i = 0; i < chunk.columns.size(); ++i) {
+    auto& column = chunk.columns[i];
+    auto& column_meta = table_meta.columns[i];
+    if (column.name != column_meta.name || column.type != column_meta.type || column.size() < row_end) {
+      std::cout << "Error : column " << column.name << " of table " << table_meta.name << " does not match the schema." << std::endl;
+      return false;
+    }
+
+    FeatureChunkBlock block;
+    if (!writeBlock(column, row_begin, row_end, block)) {
+      return false;
+    }
+    column_meta.blocks.push_back(block);
+  }
+
+  table_meta.row_num += row_end - row_begin;
+  return true;
+}
+
+bool FeatureColumnarWriter::endTable()
+{
+  if (!_table_open) {
+    return false;
+  }
+  _table_open = false;
+  return true;
+}
+
+bool FeatureColumnarWriter::writeBlock(const FeatureColumn& column, size_t row_begin, size_t row_end, FeatureChunkBlock& block)
+{
+  block.offset = static_cast<uint64_t>(_stream.tellp());
+  block.rows = row_end - row_begin;
+
+  switch (column.type) {
+    case FeatureColumnType::kInt32:
+      writeValues(_stream, column.int32_data, row_begin, row_end);
+      break;
+    case FeatureColumnType::kInt64:
+      writeValues(_stream, column.int64_data, row_begin, row_end);
+      break;
+    case FeatureColumnType::kDouble:
+      writeValues(_stream, column.double_data, row_begin, row_end);
+      break;
+    case FeatureColumnType::kString: {
+      std::vector<uint32_t> lengths(row_end - row_begin);
+      for (size_t row = row_begin; row < row_end; ++row) {
+        lengths[row - row_begin] = static_cast<uint32_t>(column.string_data[row].size());
+      }
+      writeValues(_stream, lengths, 0, lengths.size());
+      for (size_t row = row_begin; row < row_end; ++row) {
+        _stream.write(column.string_data[row].data(), column.string_data[row].size());
+      }
+      break;
+    }
+  }
+
+  block.bytes = static_cast<uint64_t>(_stream.tellp()) - block.offset;
+  return static_cast<bool>(_stream);
+}
+
+bool FeatureColumnarWriter::writeDirectory()
+{
+  uint64_t directory_offset = static_cast<uint64_t>(_stream.tellp());
+
+  writePod(_stream, static_cast<uint32_t>(_tables.size()));
+  for (auto& table_meta : _tables) {
+    writeString(_stream, table_meta.name);
+    writePod(_stream, table_meta.row_num);
+    writePod(_stream, static_cast<uint32_t>(table_meta.columns.size()));
+    for (auto& column_meta : table_meta.columns) {
+      writeString(_stream, column_meta.name);
+      writePod(_stream, static_cast<uint8_t>(column_meta.type));
+      writePod(_stream, static_cast<uint32_t>(column_meta.blocks.size()));
+      for (auto& block : column_meta.blocks) {
+        writePod(_stream, block.offset);
+        writePod(_stream, block.bytes);
+        writePod(_stream, block.rows);
+      }
+    }
+  }
+
+  writePod(_stream, directory_offset);
+  _stream.write(kMagic, sizeof(kMagic));
+  return static_cast<bool>(_stream);
+}
+
+/// ###################################################################################///
+///  reader
+/// ###################################################################################///
+bool FeatureColumnarReader::open(const std::string& path)
+{
+  close();
+  _stream.open(path, std::ios::binary);
+  if (!_stream.is_open()) {
+    std::cout << "Error : can not open feature file " << path << std::endl;
+    return false;
+  }
+
+  char magic[sizeof(kMagic)];
+  uint32_t version = 0;
+  if (!_stream.read(magic, sizeof(magic)) || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0 || !readPod(_stream, version)
+      || version != kVersion) {
+    std::cout << "Error : " << path << " is not a feature columnar file." << std::endl;
+    close();
+    return false;
+  }
+
+  if (!readDirectory()) {
+    std::cout << "Error : the directory of " << path << " is broken." << std::endl;
+    close();
+    return false;
+  }
+  return true;
+}
+
+void FeatureColumnarReader::close()
+{
+  if (_stream.is_open()) {
+    _stream.close();
+  }
+  _stream.clear();
+  _tables.clear();
+}
+
+bool FeatureColumnarReader::readDirectory()
+{
+  uint64_t trailer_size = sizeof(uint64_t) + sizeof(kMagic);
+  _stream.seekg(0, std::ios::end);
+  auto file_size = static_cast<uint64_t>(_stream.tellg());
+  if (file_size < sizeof(kMagic) + sizeof(uint32_t) + trailer_size) {
+    return false;
+  }
+
+  uint64_t directory_offset = 0;
+  char magic[sizeof(kMagic)];
+  _stream.seekg(file_size - trailer_size);
+  if (!readPod(_stream, directory_offset) || !_stream.read(magic, sizeof(magic)) || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0
+      || directory_offset >= file_size) {
+    return false;
+  }
+
+  /// every count and size in the directory is bounded by the directory bytes, so a broken file never allocates
+  /// or reads past its end
+  uint64_t directory_size = file_size - trailer_size - directory_offset;
+  _stream.seekg(directory_offset);
+  uint32_t table_num = 0;
+  if (!readPod(_stream, table_num) || table_num > directory_size / (sizeof(uint32_t) * 2 + sizeof(uint64_t))) {
+    return false;
+  }
+  _tables.resize(table_num);
+  for (auto& table_meta : _tables) {
+    uint32_t column_num = 0;
+    if (!readString(_stream, table_meta.name, directory_size) || !readPod(_stream, table_meta.row_num) || !readPod(_stream, column_num)
+        || column_num > directory_size / (sizeof(uint32_t) * 2 + sizeof(uint8_t))) {
+      return false;
+    }
+    table_meta.columns.resize(column_num);
+    for (auto& column_meta : table_meta.columns) {
+      uint8_t type = 0;
+      uint32_t block_num = 0;
+      if (!readString(_stream, column_meta.name, directory_size) || !readPod(_stream, type) || !readPod(_stream, block_num)
+          || type > static_cast<uint8_t>(FeatureColumnType::kString) || block_num > directory_size / (sizeof(uint64_t) * 3)) {
+        return false;
+      }
+      column_meta.type = static_cast<FeatureColumnType>(type);
+      column_meta.blocks.resize(block_num);
+      uint64_t column_rows = 0;
+      for (auto& block : column_meta.blocks) {
+        if (!readPod(_stream, block.offset) || !readPod(_stream, block.bytes) || !readPod(_stream, block.rows)
+            || block.offset > directory_offset || block.bytes > directory_offset - block.offset
+            || block.rows > block.bytes / valueSize(column_meta.type)) {
+          return false;
+        }
+        column_rows += block.rows;
+      }
+      if (column_rows != table_meta.row_num) {
+        return false;
+      }
+    }
+
+    /// a chunk is the block of the same index in every column, so the columns must be split the same way
+    for (auto& column_meta : table_meta.columns) {
+      auto& first_blocks = table_meta.columns.front().blocks;
+      if (column_meta.blocks.size() != first_blocks.size()) {
+        return false;
+      }
+      for (size_t i = 0; i < first_blocks.size(); ++i) {
+        if (column_meta.blocks[i].rows != first_blocks[i].rows) {
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+const FeatureTableMeta* FeatureColumnarReader::findTable(const std::string& table_name) const
+{
+  for (auto& table_meta : _tables) {
+    if (table_meta.name == table_name) {
+      return &table_meta;
+    }
+  }
+  return nullptr;
+}
+
+std::vector<std::string> FeatureColumnarReader::getColumnNames(const std::string& table_name) const
+{
+  std::vector<std::string> column_names;
+  auto* table_meta = findTable(table_name);
+  if (table_meta != nullptr) {
+    for (auto& column_meta : table_meta->columns) {
+      column_names.push_back(column_meta.name);
+    }
+  }
+  return column_names;
+}
+
+size_t FeatureColumnarReader::getChunkNum(const std::string& table_name) const
+{
+  auto* table_meta = findTable(table_name);
+  if (table_meta == nullptr || table_meta->columns.empty()) {
+    return 0;
+  }
+  return table_meta->columns.front().blocks.size();
+}
+
+std::vector<const FeatureColumnMeta*> FeatureColumnarReader::selectColumns(const FeatureTableMeta& table_meta,
+                                                                           const std::vector<std::string>& column_names,
+                                                                           bool& found_all) const
+{
+  std::vector<const FeatureColumnMeta*> selected;
+  found_all = true;
+  if (column_names.empty()) {
+    for (auto& column_meta : table_meta.columns) {
+      selected.push_back(&column_meta);
+    }
+    return selected;
+  }
+
+  for (auto& column_name : column_names) {
+    const FeatureColumnMeta* found = nullptr;
+    for (auto& column_meta : table_meta.columns) {
+      if (column_meta.name == column_name) {
+        found = &column_meta;
+        break;
+      }
+    }
+    if (found == nullptr) {
+      std::cout << "Error : column " << column_name << " not found in table " << table_meta.name << std::endl;
+      found_all = false;
+      continue;
+    }
+    selected.push_back(found);
+  }
+  return selected;
+}
+
+bool FeatureColumnarReader::readTable(const std::string& table_name, FeatureTable& table, const std::vector<std::string>& column_names)
+{
+  auto* table_meta = findTable(table_name);
+  if (table_meta == nullptr) {
+    return false;
+  }
+
+  bool found_all = true;
+  auto selected = selectColumns(*table_meta, column_names, found_all);
+
+  table.name = table_meta->name;
+  table.columns.clear();
+  for (auto* column_meta : selected) {
+    auto& column = table.addColumn(column_meta->name, column_meta->type);
+    column.reserve(table_meta->row_num);
+    for (auto& block : column_meta->blocks) {
+      if (!readBlock(block, column)) {
+        return false;
+      }
+    }
+  }
+  return found_all;
+}
+
+bool FeatureColumnarReader::readChunk(const std::string& table_name, size_t chunk_idx, FeatureTable& table,
+                                      const std::vector<std::string>& column_names)
+{
+  auto* table_meta = findTable(table_name);
+  if (table_meta == nullptr || chunk_idx >= getChunkNum(table_name)) {
+    return false;
+  }
+
+  bool found_all = true;
+  auto selected = selectColumns(*table_meta, column_names, found_all);
+
+  table.name = table_meta->name;
+  table.columns.clear();
+  for (auto* column_meta : selected) {
+    auto& column = table.addColumn(column_meta->name, column_meta->type);
+    if (!readBlock(column_meta->blocks[chunk_idx], column)) {
+      return false;
+    }
+  }
+  return found_all;
+}
+
+bool FeatureColumnarReader::readBlock(const FeatureChunkBlock& block, FeatureColumn& column)
+{
+  std::vector<char> buffer(block.bytes);
+  _stream.clear();
+  _stream.seekg(block.offset);
+  if (!_stream.read(buffer.data(), buffer.size())) {
+    return false;
+  }
+
+  switch (column.type) {
+    case FeatureColumnType::kInt32:
+      return readValues(buffer, block.rows, column.int32_data);
+    case FeatureColumnType::kInt64:
+      return readValues(buffer, block.rows, column.int64_data);
+    case FeatureColumnType::kDouble:
+      return readValues(buffer, block.rows, column.double_data);
+    case FeatureColumnType::kString: {
+      std::vector<uint32_t> lengths;
+      if (!readValues(buffer, block.rows, lengths)) {
+        return false;
+      }
+      uint64_t pos = block.rows * sizeof(uint32_t);
+      for (auto length : lengths) {
+        if (pos + length > buffer.size()) {
+          return false;
+        }
+        column.string_data.emplace_back(buffer.data() + pos, length);
+        pos += length;
+      }
+      break;
+    }
+  }
+  return true;
+}
+
+}  // namespace ieda_feature
@@ -0,0 +1,129 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+#pragma once
+/**
+ * @project		iEDA
+ * @file		feature_columnar.h
+ * @date		18/10/2026
+ * @version		0.1
+ * @description
+
+
+        binary columnar feature file.
+
+        layout :
+          header    : magic "IFEACOL\0", uint32 version
+          chunks    : the rows of a table are split into chunks, every column of a chunk is stored as one
+                      contiguous block, so a reader only touches the blocks of the columns it asks for
+          directory : tables -> columns -> chunk blocks (offset, bytes, rows)
+          trailer   : uint64 directory offset, magic
+
+        numbers are stored in the native byte order, a string block is the uint32 lengths followed by the bytes.
+ *
+ */
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "feature_table.h"
+
+namespace ieda_feature {
+
+constexpr const char* kFeatureColumnarSuffix = ".fcol";
+constexpr size_t kFeatureColumnarChunkRows = 65536;
+
+bool isFeatureColumnarPath(const std::string& path);
+
+struct FeatureChunkBlock
+{
+  uint64_t offset = 0;
+  uint64_t bytes = 0;
+  uint64_t rows = 0;
+};
+
+struct FeatureColumnMeta
+{
+  std::string name;
+  FeatureColumnType type = FeatureColumnType::kInt32;
+  std::vector<FeatureChunkBlock> blocks;
+};
+
+struct FeatureTableMeta
+{
+  std::string name;
+  uint64_t row_num = 0;
+  std::vector<FeatureColumnMeta> columns;
+};
+
+class FeatureColumnarWriter
+{
+ public:
+  FeatureColumnarWriter() = default;
+  ~FeatureColumnarWriter();
+
+  bool open(const std::string& path);
+  bool close();
+
+  /// write a whole table, split into chunks of chunk_rows
+  bool writeTable(const FeatureTable& table, size_t chunk_rows = kFeatureColumnarChunkRows);
+
+  /// streaming interface, the chunks appended between begin and end must share the schema of the first chunk
+  bool beginTable(const std::string& table_name);
+  bool appendChunk(const FeatureTable& chunk, size_t row_begin = 0, size_t row_end = SIZE_MAX);
+  bool endTable();
+
+ private:
+  std::ofstream _stream;
+  std::vector<FeatureTableMeta> _tables;
+  bool _table_open = false;
+
+  bool writeBlock(const FeatureColumn& column, size_t row_begin, size_t row_end, FeatureChunkBlock& block);
+  bool writeDirectory();
+};
+
+class FeatureColumnarReader
+{
+ public:
+  FeatureColumnarReader() = default;
+  ~FeatureColumnarReader() = default;
+
+  bool open(const std::string& path);
+  void close();
+
+  const std::vector<FeatureTableMeta>& get_tables() const { return _tables; }
+  const FeatureTableMeta* findTable(const std::string& table_name) const;
+  std::vector<std::string> getColumnNames(const std::string& table_name) const;
+  size_t getChunkNum(const std::string& table_name) const;
+
+  /// load the selected columns of a table, all columns if column_names is empty
+  bool readTable(const std::string& table_name, FeatureTable& table, const std::vector<std::string>& column_names = {});
+  /// load one chunk of the selected columns, for tables which do not fit in memory
+  bool readChunk(const std::string& table_name, size_t chunk_idx, FeatureTable& table, const std::vector<std::string>& column_names = {});
+
+ private:
+  std::ifstream _stream;
+  std::vector<FeatureTableMeta> _tables;
+
+  bool readDirectory();
+  std::vector<const FeatureColumnMeta*> selectColumns(const FeatureTableMeta& table_meta, const std::vector<std::string>& column_names,
+                                                      bool& found_all) const;
+  bool readBlock(const FeatureChunkBlock& block, FeatureColumn& column);
+};
+
+}  // namespace ieda_feature
@@ -33,6 +33,7 @@
 
 #include "feature_parser.h"
 
+#include "feature_columnar.h"
 #include "feature_summary.h"
 #include "flow_config.h"
 #include "idm.h"
@@ -129,6 +130,10 @@ bool FeatureParser::buildTools(std::string json_path, std::string step)
 
 bool FeatureParser::buildRouteData(std::string json_path, RouteAnalyseData* data)
 {
+  if (isFeatureColumnarPath(json_path)) {
+    return buildRouteDataColumnar(json_path, data);
+  }
+
   std::ofstream& file_stream = ieda::getOutputFileStream(json_path);
   json root;
 
@@ -163,6 +168,10 @@ bool FeatureParser::buildRouteData(std::string json_path, RouteAnalyseData* data
 
 bool FeatureParser::readRouteData(std::string json_path, RouteAnalyseData* data)
 {
+  if (isFeatureColumnarPath(json_path)) {
+    return readRouteDataColumnar(json_path, data);
+  }
+
   auto json_file = std::ifstream(json_path);
   if (false == json_file.is_open()) {
     return false;
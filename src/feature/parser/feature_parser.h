@@ -52,6 +52,8 @@ using std::vector;
 
 class FeatureSummary;
 class RouteAnalyseData;
+struct FeatureTable;
+struct FeatureTableSet;
 
 class FeatureParser
 {
@@ -65,8 +67,12 @@ class FeatureParser
   bool buildSummaryMap(std::string csv_path, int bin_cnt_x, int bin_cnt_y);
   bool buildTools(std::string json_path, std::string step);
 
-  bool buildRouteData(std::string json_path, RouteAnalyseData* data);
-  bool readRouteData(std::string json_path, RouteAnalyseData* data);
+  /// route data is saved as a columnar file if the path ends with ".fcol", otherwise as json
+  bool buildRouteData(std::string path, RouteAnalyseData* data);
+  bool readRouteData(std::string path, RouteAnalyseData* data);
+
+  /// columnar tables, a path ending with ".json" exports the same tables as json
+  bool buildFeatureTables(std::string path, FeatureTableSet* table_set);
 
   bool buildSummaryEval(std::string json_path);
   bool buildSummaryEvalJsonl(std::string jsonl_path);
@@ -102,5 +108,9 @@ class FeatureParser
   json buildSummaryCongestion();
   json buildSummaryTiming();
   json buildSummaryPower();
+
+  bool buildRouteDataColumnar(std::string path, RouteAnalyseData* data);
+  bool readRouteDataColumnar(std::string path, RouteAnalyseData* data);
+  json buildTableJson(const FeatureTable& table);
 };
 }  // namespace ieda_feature
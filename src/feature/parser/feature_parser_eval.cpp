@@ -32,6 +32,7 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "Evaluator.hh"
+#include "feature_columnar.h"
 #include "feature_parser.h"
 #include "feature_summary.h"
 #include "flow_config.h"
@@ -83,8 +84,26 @@ bool FeatureParser::buildNetEval(std::string csv_path)
   ieval::TimingAPI::getInst()->runSTA();
   auto net_power_data = ieval::TimingAPI::getInst()->evalNetPower();
 
-  std::ofstream csv_file(csv_path);
-  csv_file << "net_name,pin_num,aspect_ratio,lness,hpwl,rsmt,grwl,hpwl_power,flute_power,egr_power\n";
+  /// the same columns are saved as a columnar table if the path ends with ".fcol"
+  bool is_columnar = isFeatureColumnarPath(csv_path);
+  FeatureTable table;
+  table.name = "net_eval";
+  table.addColumn("net_name", FeatureColumnType::kString);
+  table.addColumn("pin_num", FeatureColumnType::kInt32);
+  table.addColumn("aspect_ratio", FeatureColumnType::kInt32);
+  table.addColumn("lness", FeatureColumnType::kDouble);
+  table.addColumn("hpwl", FeatureColumnType::kInt32);
+  table.addColumn("rsmt", FeatureColumnType::kInt32);
+  table.addColumn("grwl", FeatureColumnType::kInt32);
+  table.addColumn("hpwl_power", FeatureColumnType::kDouble);
+  table.addColumn("flute_power", FeatureColumnType::kDouble);
+  table.addColumn("egr_power", FeatureColumnType::kDouble);
+
+  std::ofstream csv_file;
+  if (!is_columnar) {
+    csv_file.open(csv_path);
+    csv_file << "net_name,pin_num,aspect_ratio,lness,hpwl,rsmt,grwl,hpwl_power,flute_power,egr_power\n";
+  }
 
   for (size_t i = 0; i < idb_design->get_net_list()->get_net_list().size(); i++) {
     auto* idb_net = idb_design->get_net_list()->get_net_list()[i];
@@ -110,10 +129,29 @@ bool FeatureParser::buildNetEval(std::string csv_path)
     double flute_power = net_power_data["FLUTE"][net_name];
     double egr_power = net_power_data["EGR"][net_name];
 
+    if (is_columnar) {
+      table.columns[0].string_data.push_back(net_name);
+      table.columns[1].int32_data.push_back(pin_num);
+      table.columns[2].int32_data.push_back(aspect_ratio);
+      table.columns[3].double_data.push_back(l_ness);
+      table.columns[4].int32_data.push_back(hpwl);
+      table.columns[5].int32_data.push_back(flute);
+      table.columns[6].int32_data.push_back(grwl);
+      table.columns[7].double_data.push_back(hpwl_power);
+      table.columns[8].double_data.push_back(flute_power);
+      table.columns[9].double_data.push_back(egr_power);
+      continue;
+    }
+
     csv_file << net_name << ',' << pin_num << ',' << aspect_ratio << ',' << l_ness << ',' << hpwl << ',' << flute << ',' << grwl << ','
              << hpwl_power << ',' << flute_power << ',' << egr_power << '\n';
   }
 
+  if (is_columnar) {
+    FeatureColumnarWriter writer;
+    return writer.open(csv_path) && writer.writeTable(table) && writer.close();
+  }
+
   csv_file.close();
   return true;
 }
@@ -0,0 +1,184 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+/**
+ * @project		iEDA
+ * @file		feature_parser_table.cpp
+ * @date		18/10/2026
+ * @version		0.1
+ * @description
+
+
+        save and read the columnar feature tables
+ *
+ */
+
+#include "feature_columnar.h"
+#include "feature_irt.h"
+#include "feature_parser.h"
+#include "feature_table.h"
+#include "json_parser.h"
+
+namespace ieda_feature {
+
+bool FeatureParser::buildFeatureTables(std::string path, FeatureTableSet* table_set)
+{
+  if (isFeatureColumnarPath(path)) {
+    FeatureColumnarWriter writer;
+    if (!writer.open(path)) {
+      return false;
+    }
+    for (auto& table : table_set->tables) {
+      if (!writer.writeTable(table)) {
+        std::cout << "Error : save feature table " << table.name << " failed." << std::endl;
+        writer.close();
+        return false;
+      }
+    }
+    if (!writer.close()) {
+      return false;
+    }
+
+    std::cout << std::endl << "Save feature tables success, path = " << path << std::endl;
+    return true;
+  }
+
+  std::ofstream& file_stream = ieda::getOutputFileStream(path);
+  json root;
+  for (auto& table : table_set->tables) {
+    root[table.name] = buildTableJson(table);
+  }
+  file_stream << root;
+  ieda::closeFileStream(file_stream);
+
+  std::cout << std::endl << "Save feature json success, path = " << path << std::endl;
+  return true;
+}
+
+/// a table is exported as column name -> value array
+json FeatureParser::buildTableJson(const FeatureTable& table)
+{
+  json json_table;
+  for (auto& column : table.columns) {
+    switch (column.type) {
+      case FeatureColumnType::kInt32:
+        json_table[column.name] = column.int32_data;
+        break;
+      case FeatureColumnType::kInt64:
+        json_table[column.name] = column.int64_data;
+        break;
+      case FeatureColumnType::kDouble:
+        json_table[column.name] = column.double_data;
+        break;
+      case FeatureColumnType::kString:
+        json_table[column.name] = column.string_data;
+        break;
+    }
+  }
+
+  return json_table;
+}
+
+/// one row per pin access point, a term without pa and a master without term are kept as a row with has_pa = 0
+bool FeatureParser::buildRouteDataColumnar(std::string path, RouteAnalyseData* data)
+{
+  FeatureTable table;
+  table.name = "pin_access";
+  auto& cell_master = table.addColumn("cell_master", FeatureColumnType::kString);
+  auto& term = table.addColumn("term", FeatureColumnType::kString);
+  auto& has_pa = table.addColumn("has_pa", FeatureColumnType::kInt32);
+  auto& layer = table.addColumn("layer", FeatureColumnType::kString);
+  auto& x = table.addColumn("x", FeatureColumnType::kInt32);
+  auto& y = table.addColumn("y", FeatureColumnType::kInt32);
+  auto& number = table.addColumn("number", FeatureColumnType::kInt32);
+
+  auto add_row = [&](const std::string& master_name, const std::string& term_name, const DbPinAccess* pa) {
+    cell_master.string_data.push_back(master_name);
+    term.string_data.push_back(term_name);
+    has_pa.int32_data.push_back(pa == nullptr ? 0 : 1);
+    layer.string_data.push_back(pa == nullptr ? "" : pa->layer);
+    x.int32_data.push_back(pa == nullptr ? 0 : pa->x);
+    y.int32_data.push_back(pa == nullptr ? 0 : pa->y);
+    number.int32_data.push_back(pa == nullptr ? 0 : pa->number);
+  };
+
+  for (auto& [cellmaster_name, cell_master_pa] : data->cell_master_list) {
+    if (cell_master_pa.term_list.empty()) {
+      /// the empty term name marks a master without term
+      add_row(cellmaster_name, "", nullptr);
+      continue;
+    }
+    for (auto& [term_name, term_pa] : cell_master_pa.term_list) {
+      if (term_pa.pa_list.empty()) {
+        add_row(cellmaster_name, term_name, nullptr);
+        continue;
+      }
+      for (auto& pa : term_pa.pa_list) {
+        add_row(cellmaster_name, term_name, &pa);
+      }
+    }
+  }
+
+  FeatureColumnarWriter writer;
+  if (!writer.open(path) || !writer.writeTable(table) || !writer.close()) {
+    return false;
+  }
+
+  std::cout << std::endl << "Save feature route data success, path = " << path << std::endl;
+  return true;
+}
+
+bool FeatureParser::readRouteDataColumnar(std::string path, RouteAnalyseData* data)
+{
+  FeatureColumnarReader reader;
+  FeatureTable table;
+  if (!reader.open(path)
+      || !reader.readTable("pin_access", table, {"cell_master", "term", "has_pa", "layer", "x", "y", "number"})) {
+    return false;
+  }
+
+  auto& cell_master = table.columns[0].string_data;
+  auto& term = table.columns[1].string_data;
+  auto& has_pa = table.columns[2].int32_data;
+  auto& layer = table.columns[3].string_data;
+  auto& x = table.columns[4].int32_data;
+  auto& y = table.columns[5].int32_data;
+  auto& number = table.columns[6].int32_data;
+
+  for (size_t i = 0; i < table.get_row_num(); ++i) {
+    auto& master_pa = data->cell_master_list[cell_master[i]];
+    master_pa.name = cell_master[i];
+    if (has_pa[i] == 0 && term[i].empty()) {
+      continue;
+    }
+
+    auto& term_pa = master_pa.term_list[term[i]];
+    if (has_pa[i] == 0) {
+      continue;
+    }
+
+    DbPinAccess pa;
+    pa.layer = layer[i];
+    pa.x = x[i];
+    pa.y = y[i];
+    pa.number = number[i];
+    term_pa.pa_list.push_back(pa);
+  }
+
+  return true;
+}
+
+}  // namespace ieda_feature
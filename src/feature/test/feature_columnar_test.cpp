@@ -0,0 +1,212 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include "feature_columnar.h"
+#include "feature_irt.h"
+#include "feature_parser.h"
+#include "feature_table.h"
+#include "gtest/gtest.h"
+
+using namespace ieda_feature;
+
+namespace {
+
+RouteAnalyseData makeRouteData()
+{
+  RouteAnalyseData data;
+  auto& nand = data.cell_master_list["NAND2"];
+  nand.name = "NAND2";
+  nand.term_list["A"].pa_list.push_back(DbPinAccess{"M1", 10, 20, 1});
+  nand.term_list["A"].pa_list.push_back(DbPinAccess{"M2", 30, 40, 2});
+  nand.term_list["Y"].pa_list.push_back(DbPinAccess{"M1", 50, 60, 3});
+  /// a term without pa
+  nand.term_list["VDD"];
+
+  /// a master without term
+  data.cell_master_list["FILL1"].name = "FILL1";
+  return data;
+}
+
+void expectSameRouteData(const RouteAnalyseData& lhs, const RouteAnalyseData& rhs)
+{
+  ASSERT_EQ(lhs.cell_master_list.size(), rhs.cell_master_list.size());
+  for (auto& [master_name, master_pa] : lhs.cell_master_list) {
+    auto found = rhs.cell_master_list.find(master_name);
+    ASSERT_TRUE(found != rhs.cell_master_list.end());
+    EXPECT_EQ(master_pa.name, found->second.name);
+    ASSERT_EQ(master_pa.term_list.size(), found->second.term_list.size());
+    for (auto& [term_name, term_pa] : master_pa.term_list) {
+      auto found_term = found->second.term_list.find(term_name);
+      ASSERT_TRUE(found_term != found->second.term_list.end());
+      auto& pa_list = found_term->second.pa_list;
+      ASSERT_EQ(term_pa.pa_list.size(), pa_list.size());
+      for (size_t i = 0; i < pa_list.size(); ++i) {
+        EXPECT_EQ(term_pa.pa_list[i].layer, pa_list[i].layer);
+        EXPECT_EQ(term_pa.pa_list[i].x, pa_list[i].x);
+        EXPECT_EQ(term_pa.pa_list[i].y, pa_list[i].y);
+        EXPECT_EQ(term_pa.pa_list[i].number, pa_list[i].number);
+      }
+    }
+  }
+}
+
+TEST(FeatureColumnarTest, route_data_match_json)
+{
+  std::string json_path = testing::TempDir() + "feature_route_data.json";
+  std::string columnar_path = testing::TempDir() + "feature_route_data" + kFeatureColumnarSuffix;
+
+  auto data = makeRouteData();
+  FeatureParser parser;
+  ASSERT_TRUE(parser.buildRouteData(json_path, &data));
+  ASSERT_TRUE(parser.buildRouteData(columnar_path, &data));
+
+  RouteAnalyseData json_data;
+  RouteAnalyseData columnar_data;
+  ASSERT_TRUE(parser.readRouteData(json_path, &json_data));
+  ASSERT_TRUE(parser.readRouteData(columnar_path, &columnar_data));
+
+  expectSameRouteData(data, json_data);
+  expectSameRouteData(json_data, columnar_data);
+
+  std::remove(json_path.c_str());
+  std::remove(columnar_path.c_str());
+}
+
+TEST(FeatureColumnarTest, table_round_trip)
+{
+  std::string path = testing::TempDir() + "feature_table" + kFeatureColumnarSuffix;
+
+  FeatureTable table;
+  table.name = "net";
+  auto& name = table.addColumn("name", FeatureColumnType::kString);
+  auto& pin_num = table.addColumn("pin_num", FeatureColumnType::kInt32);
+  auto& hpwl = table.addColumn("hpwl", FeatureColumnType::kInt64);
+  auto& power = table.addColumn("power", FeatureColumnType::kDouble);
+  for (int i = 0; i < 10; ++i) {
+    name.string_data.push_back(i % 3 == 0 ? "" : "net_" + std::to_string(i));
+    pin_num.int32_data.push_back(i);
+    hpwl.int64_data.push_back(int64_t(i) << 33);
+    power.double_data.push_back(i * 0.5);
+  }
+
+  FeatureColumnarWriter writer;
+  ASSERT_TRUE(writer.open(path));
+  ASSERT_TRUE(writer.writeTable(table, 3));
+  ASSERT_TRUE(writer.close());
+
+  FeatureColumnarReader reader;
+  ASSERT_TRUE(reader.open(path));
+  EXPECT_EQ(reader.getChunkNum("net"), 4);
+
+  FeatureTable read_table;
+  ASSERT_TRUE(reader.readTable("net", read_table));
+  ASSERT_EQ(read_table.columns.size(), 4);
+  EXPECT_EQ(read_table.columns[0].string_data, name.string_data);
+  EXPECT_EQ(read_table.columns[1].int32_data, pin_num.int32_data);
+  EXPECT_EQ(read_table.columns[2].int64_data, hpwl.int64_data);
+  EXPECT_EQ(read_table.columns[3].double_data, power.double_data);
+
+  FeatureTable chunk;
+  ASSERT_TRUE(reader.readChunk("net", 3, chunk, {"pin_num"}));
+  ASSERT_EQ(chunk.columns.size(), 1);
+  EXPECT_EQ(chunk.columns[0].int32_data, std::vector<int32_t>{9});
+
+  reader.close();
+  std::remove(path.c_str());
+}
+
+TEST(FeatureColumnarTest, broken_block_rows)
+{
+  std::string path = testing::TempDir() + "feature_broken" + kFeatureColumnarSuffix;
+
+  FeatureTable table;
+  table.name = "map";
+  auto& value = table.addColumn("value", FeatureColumnType::kInt64);
+  value.int64_data = {1, 2, 3};
+
+  FeatureColumnarWriter writer;
+  ASSERT_TRUE(writer.open(path));
+  ASSERT_TRUE(writer.writeTable(table));
+  ASSERT_TRUE(writer.close());
+
+  /// the block rows is the last uint64 before the trailer, overwrite it so rows * sizeof(int64_t) overflows
+  std::fstream stream(path, std::ios::binary | std::ios::in | std::ios::out);
+  stream.seekp(-static_cast<std::streamoff>(sizeof(uint64_t) * 2 + 8), std::ios::end);
+  uint64_t rows = (UINT64_MAX / sizeof(int64_t)) + 2;
+  stream.write(reinterpret_cast<const char*>(&rows), sizeof(rows));
+  stream.close();
+
+  FeatureColumnarReader reader;
+  EXPECT_FALSE(reader.open(path));
+  std::remove(path.c_str());
+}
+
+TEST(FeatureColumnarTest, mismatched_block_num)
+{
+  std::string path = testing::TempDir() + "feature_mismatch" + kFeatureColumnarSuffix;
+
+  FeatureTable table;
+  table.name = "net";
+  auto& pin_num = table.addColumn("pin_num", FeatureColumnType::kInt64);
+  auto& hpwl = table.addColumn("hpwl", FeatureColumnType::kInt64);
+  pin_num.int64_data = {1, 2};
+  hpwl.int64_data = {3, 4};
+
+  FeatureColumnarWriter writer;
+  ASSERT_TRUE(writer.open(path));
+  ASSERT_TRUE(writer.writeTable(table, 1));
+  ASSERT_TRUE(writer.close());
+
+  std::string data;
+  {
+    std::ifstream in(path, std::ios::binary);
+    data.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+  }
+
+  /// the last column ends with its block num and 2 blocks of (offset, bytes, rows), then the trailer. Merge its
+  /// blocks into one of 2 rows, the rows of the column still match the table but the first column has 2 blocks
+  size_t trailer_size = sizeof(uint64_t) + 8;
+  size_t block_size = sizeof(uint64_t) * 3;
+  std::string trailer = data.substr(data.size() - trailer_size);
+  size_t block_num_pos = data.size() - trailer_size - block_size * 2 - sizeof(uint32_t);
+  uint64_t block[3];
+  uint64_t next_block[3];
+  std::memcpy(block, data.data() + block_num_pos + sizeof(uint32_t), block_size);
+  std::memcpy(next_block, data.data() + block_num_pos + sizeof(uint32_t) + block_size, block_size);
+  uint32_t block_num = 1;
+  block[1] += next_block[1];
+  block[2] += next_block[2];
+  data.resize(block_num_pos);
+  data.append(reinterpret_cast<const char*>(&block_num), sizeof(block_num));
+  data.append(reinterpret_cast<const char*>(block), block_size);
+  data += trailer;
+  {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(data.data(), data.size());
+  }
+
+  FeatureColumnarReader reader;
+  EXPECT_FALSE(reader.open(path));
+  std::remove(path.c_str());
+}
+
+}  // namespace
@@ -120,6 +120,11 @@ void IdbSpeedUpSetup::initGuiDB() {
   _gui_design->init((QRectF(_transform.db_to_guidb(db_die->get_llx()), _transform.db_to_guidb(db_die->get_lly()),
                             _transform.db_to_guidb(db_die->get_width()), _transform.db_to_guidb(db_die->get_height()))));
 
+  /// large design, the standard cells, the vias and the routed nets go to the tile cache instead of the speedup items
+  bool b_tile_mode = _type != DbSetupType::kClockTree && _type != DbSetupType::kCellMaster
+                     && getTileShapeNumber() > GUI_TILE_SHAPE_THRESHOLD;
+  _gui_design->set_tile_mode(b_tile_mode);
+
   addItem(new QGraphicsRectItem(
       QRectF(_transform.db_to_guidb(db_die->get_llx()) - 50, _transform.db_to_guidb(db_die->get_lly()) - 50,
              _transform.db_to_guidb(db_die->get_width()) + 300, _transform.db_to_guidb(db_die->get_height()) + 100)));
@@ -450,11 +455,17 @@ void IdbSpeedUpSetup::createInstance(IdbInstanceList* inst_list) {
   if (inst_list == nullptr) {
     std::cout << "inst_list == nullptr" << std::endl;
   }
+  if (_gui_design->is_tile_mode()) {
+    createInstanceTile(insts);
+  }
+
   for (IdbInstance* instance : insts) {
     if (instance == nullptr || instance->get_cell_master() == nullptr) {
       continue;
     }
-    createInstanceCore(instance);
+    if (!_gui_design->is_tile_mode()) {
+      createInstanceCore(instance);
+    }
     createInstancePad(instance);
     createInstanceBlock(instance);
   }
@@ -462,10 +473,68 @@ void IdbSpeedUpSetup::createInstance(IdbInstanceList* inst_list) {
   std::cout << "Success to create Instance..." << std::endl;
 }
 
-void IdbSpeedUpSetup::createInstanceCore(IdbInstance* instance) {
+bool IdbSpeedUpSetup::isInstanceCore(IdbInstance* instance) {
   IdbCellMaster* cell_master = instance->get_cell_master();
-  if ((cell_master->is_core() && (!is_floorplan())) ||
-      ((is_floorplan() && (cell_master->is_core_filler() || cell_master->is_endcap())))) {
+  return (cell_master->is_core() && (!is_floorplan()))
+         || ((is_floorplan() && (cell_master->is_core_filler() || cell_master->is_endcap())));
+}
+
+void IdbSpeedUpSetup::createInstanceTile(std::vector<IdbInstance*>& inst_list) {
+  std::cout << "Begin to create Instance tiles..." << std::endl;
+
+  int32_t cell_slot = _layout->get_layers()->get_layers_num();
+  bool b_pin        = DbSetupType::kGlobalPlace != _type;
+
+  /// every thread collects the shapes of its instances, the lists are appended to the cache afterwards
+  int32_t thread_num = omp_get_max_threads();
+  std::vector<std::vector<GuiTileShape>> thread_shape_list(thread_num);
+#pragma omp parallel for schedule(dynamic, 256) num_threads(thread_num)
+  for (size_t i = 0; i < inst_list.size(); ++i) {
+    IdbInstance* instance = inst_list[i];
+    if (instance == nullptr || instance->get_cell_master() == nullptr || !isInstanceCore(instance)) {
+      continue;
+    }
+
+    std::vector<GuiTileShape>& shape_list = thread_shape_list[omp_get_thread_num()];
+    auto add_layer_shape                  = [&](IdbLayerShape* layer_shape) {
+      if (layer_shape->get_layer() == nullptr) {
+        return;
+      }
+      for (IdbRect* rect : layer_shape->get_rect_list()) {
+        shape_list.push_back(GuiTileShape{_transform.db_to_guidb_rect(rect), layer_shape->get_layer()->get_order(),
+                                          static_cast<int8_t>(GuiSpeedupItemType::kInstStandarCell), -1});
+      }
+    };
+
+    shape_list.push_back(GuiTileShape{_transform.db_to_guidb_rect(instance->get_bounding_box()), cell_slot,
+                                      static_cast<int8_t>(GuiSpeedupItemType::kInstStandarCell), -1});
+    if (!b_pin) {
+      continue;
+    }
+    for (IdbPin* pin : instance->get_pin_list()->get_pin_list()) {
+      if (pin != nullptr && pin->get_term()->is_instance_pin()) {
+        for (IdbLayerShape* layer_shape : pin->get_port_box_list()) {
+          add_layer_shape(layer_shape);
+        }
+      }
+    }
+    for (IdbLayerShape* layer_shape : instance->get_obs_box_list()) {
+      add_layer_shape(layer_shape);
+    }
+  }
+
+  size_t number            = 0;
+  GuiTileCache* tile_cache = _gui_design->get_tile_cache();
+  for (auto& shape_list : thread_shape_list) {
+    tile_cache->addShapeList(shape_list);
+    number += shape_list.size();
+  }
+
+  std::cout << "Success to create Instance tiles... shape number = " << number << std::endl;
+}
+
+void IdbSpeedUpSetup::createInstanceCore(IdbInstance* instance) {
+  if (isInstanceCore(instance)) {
     IdbRect* bounding_box    = instance->get_bounding_box();
     QRectF rect              = _transform.db_to_guidb_rect(bounding_box);
     GuiSpeedupInstance* item = _gui_design->get_instance_list()->findItem(rect.center());
@@ -736,10 +805,39 @@ GuiSpeedupItem* IdbSpeedUpSetup::findSpecialNetItem(GuiSpeedupWireContainer* con
                                      _transform.db_to_guidb(segment->get_point_second()->get_y())));
 }
 
+void IdbSpeedUpSetup::createSpecialNetViaTile() {
+  GuiTileCache* tile_cache = _gui_design->get_tile_cache();
+  for (IdbSpecialNet* special_net : _design->get_special_net_list()->get_net_list()) {
+    GuiSpeedupItemType type = special_net->is_vdd() ? GuiSpeedupItemType::kPdnPower : GuiSpeedupItemType::kPdnGround;
+    for (IdbSpecialWire* special_wire : special_net->get_wire_list()->get_wire_list()) {
+      for (IdbSpecialWireSegment* segment : special_wire->get_segment_list()) {
+        if (segment == nullptr || !segment->is_via()) {
+          continue;
+        }
+
+        IdbVia* via = segment->get_via();
+        for (IdbLayerShape layer_shape :
+             {via->get_cut_layer_shape(), via->get_bottom_layer_shape(), via->get_top_layer_shape()}) {
+          if (layer_shape.get_layer() == nullptr) {
+            continue;
+          }
+          for (IdbRect* rect : layer_shape.get_rect_list()) {
+            tile_cache->addShape(_transform.db_to_guidb_rect(rect), layer_shape.get_layer()->get_order(),
+                                 static_cast<int32_t>(type));
+          }
+        }
+      }
+    }
+  }
+}
+
 void IdbSpeedUpSetup::createSpecialNet() {
   std::cout << "Begin to create PDN..." << std::endl;
 
   int number = 0;
+  if (_gui_design->is_tile_mode()) {
+    createSpecialNetViaTile();
+  }
 
   IdbSpecialNetList* special_net_list = _design->get_special_net_list();
   for (IdbSpecialNet* special_net : special_net_list->get_net_list()) {
@@ -764,7 +862,9 @@ void IdbSpeedUpSetup::createSpecialNet() {
             this_gui_wire->set_type(type);
             createSpecialNetPoints(segment, this_gui_wire);
           }
-          createSpecialNetVia(segment, special_net->is_vdd());
+          if (!_gui_design->is_tile_mode()) {
+            createSpecialNetVia(segment, special_net->is_vdd());
+          }
           number++;
         } else {
           /// find gui wire list ptr
@@ -840,6 +940,39 @@ void IdbSpeedUpSetup::createNetRect(IdbRegularWireSegment* segment, GuiSpeedupIt
   rect = nullptr;
 }
 
+IdbRect IdbSpeedUpSetup::getNetPointsRect(IdbRegularWireSegment* segment) {
+  IdbLayerRouting* routing_layer = dynamic_cast<IdbLayerRouting*>(segment->get_layer());
+  int32_t routing_width          = routing_layer->get_width();
+
+  IdbCoordinate<int32_t>* point_1 = segment->get_point_start();
+  IdbCoordinate<int32_t>* point_2 = segment->get_point_second();
+
+  int32_t ll_x = 0;
+  int32_t ll_y = 0;
+  int32_t ur_x = 0;
+  int32_t ur_y = 0;
+  if (point_1->get_y() == point_2->get_y()) {
+    // horizontal
+    ll_x = std::min(point_1->get_x(), point_2->get_x()) - routing_width / 2;
+    ll_y = std::min(point_1->get_y(), point_2->get_y()) - routing_width / 2;
+    ur_x = std::max(point_1->get_x(), point_2->get_x()) + routing_width / 2;
+    ur_y = ll_y + routing_width;
+  } else if (point_1->get_x() == point_2->get_x()) {
+    // vertical
+    ll_x = std::min(point_1->get_x(), point_2->get_x()) - routing_width / 2;
+    ll_y = std::min(point_1->get_y(), point_2->get_y()) - routing_width / 2;
+    ur_x = ll_x + routing_width;
+    ur_y = std::max(point_1->get_y(), point_2->get_y()) + routing_width / 2;
+  } else {
+    // only support horizontal & vertical direction
+    std::cout << "Error...Regular segment only support horizontal & "
+                 "vertical direction... "
+              << segment->get_layer()->get_name() << std::endl;
+  }
+
+  return IdbRect(ll_x, ll_y, ur_x, ur_y);
+}
+
 void IdbSpeedUpSetup::createNetPoints(IdbRegularWireSegment* segment, GuiSpeedupItem* item) {
   if (segment->get_point_number() >= 2)  // ensure the point number >= 2
   {
@@ -849,33 +982,11 @@ void IdbSpeedUpSetup::createNetPoints(IdbRegularWireSegment* segment, GuiSpeedup
     }
 
     IdbLayerRouting* routing_layer = dynamic_cast<IdbLayerRouting*>(segment->get_layer());
-    int32_t routing_width          = routing_layer->get_width();
-
-    IdbCoordinate<int32_t>* point_1 = segment->get_point_start();
-    IdbCoordinate<int32_t>* point_2 = segment->get_point_second();
-
-    int32_t ll_x = 0;
-    int32_t ll_y = 0;
-    int32_t ur_x = 0;
-    int32_t ur_y = 0;
-    if (point_1->get_y() == point_2->get_y()) {
-      // horizontal
-      ll_x = std::min(point_1->get_x(), point_2->get_x()) - routing_width / 2;
-      ll_y = std::min(point_1->get_y(), point_2->get_y()) - routing_width / 2;
-      ur_x = std::max(point_1->get_x(), point_2->get_x()) + routing_width / 2;
-      ur_y = ll_y + routing_width;
-    } else if (point_1->get_x() == point_2->get_x()) {
-      // vertical
-      ll_x = std::min(point_1->get_x(), point_2->get_x()) - routing_width / 2;
-      ll_y = std::min(point_1->get_y(), point_2->get_y()) - routing_width / 2;
-      ur_x = ll_x + routing_width;
-      ur_y = std::max(point_1->get_y(), point_2->get_y()) + routing_width / 2;
-    } else {
-      // only support horizontal & vertical direction
-      std::cout << "Error...Regular segment only support horizontal & "
-                   "vertical direction... "
-                << segment->get_layer()->get_name() << std::endl;
-    }
+    IdbRect points_rect            = getNetPointsRect(segment);
+    int32_t ll_x                   = points_rect.get_low_x();
+    int32_t ll_y                   = points_rect.get_low_y();
+    int32_t ur_x                   = points_rect.get_high_x();
+    int32_t ur_y                   = points_rect.get_high_y();
 
     if (item == nullptr) {
       IdbRect* rect   = new IdbRect(ll_x, ll_y, ur_x, ur_y);
@@ -920,6 +1031,12 @@ void IdbSpeedUpSetup::createNet() {
 
   IdbNetList* net_list = _design->get_net_list();
 
+  /// large design, the shapes go to the tile cache instead of the speedup items
+  if (_gui_design->is_tile_mode()) {
+    createNetTile();
+    return;
+  }
+
   // #pragma omp parallel for
 
   for (IdbNet* net : net_list->get_net_list()) {
@@ -967,6 +1084,118 @@ void IdbSpeedUpSetup::createNet() {
   std::cout << "Success to create NET..." << std::endl;
 }
 
+bool IdbSpeedUpSetup::isNetVisibleType() {
+  return _type == DbSetupType::kChip || _type == DbSetupType::kGlobalRouting || _type == DbSetupType::kDetailRouting;
+}
+
+/// the number of the shapes the tile cache would hold, a via is made of the cut and two enclosures
+int64_t IdbSpeedUpSetup::getTileShapeNumber() {
+  int64_t number = 0;
+  for (IdbInstance* instance : _design->get_instance_list()->get_instance_list()) {
+    if (instance != nullptr && instance->get_cell_master() != nullptr && isInstanceCore(instance)) {
+      number += 1 + instance->get_pin_list()->get_pin_num();
+    }
+  }
+
+  if (_type != DbSetupType::kGlobalPlace) {
+    for (IdbSpecialNet* special_net : _design->get_special_net_list()->get_net_list()) {
+      for (IdbSpecialWire* special_wire : special_net->get_wire_list()->get_wire_list()) {
+        for (IdbSpecialWireSegment* segment : special_wire->get_segment_list()) {
+          number += segment != nullptr && segment->is_via() ? 3 : 0;
+        }
+      }
+    }
+  }
+
+  if (isNetVisibleType()) {
+    for (IdbNet* net : _design->get_net_list()->get_net_list()) {
+      for (IdbRegularWire* wire : net->get_wire_list()->get_wire_list()) {
+        for (IdbRegularWireSegment* segment : wire->get_segment_list()) {
+          number += 1 + 3 * segment->get_via_list().size();
+        }
+      }
+    }
+  }
+
+  return number;
+}
+
+/// the tile cache has no partial update, all its shapes are collected again
+void IdbSpeedUpSetup::updateTile() {
+  _gui_design->get_tile_cache()->clear();
+
+  createInstanceTile(_design->get_instance_list()->get_instance_list());
+  if (_type != DbSetupType::kGlobalPlace) {
+    createSpecialNetViaTile();
+  }
+  if (isNetVisibleType()) {
+    createNetTile();
+  }
+
+  _gui_design->finishTile();
+}
+
+void IdbSpeedUpSetup::createNetTile() {
+  std::cout << "Begin to create NET tiles..." << std::endl;
+
+  auto& net_list = _design->get_net_list()->get_net_list();
+
+  /// every thread collects the shapes of its nets, the lists are appended to the cache afterwards
+  int32_t thread_num = omp_get_max_threads();
+  std::vector<std::vector<GuiTileShape>> thread_shape_list(thread_num);
+#pragma omp parallel for schedule(dynamic, 64) num_threads(thread_num)
+  for (size_t i = 0; i < net_list.size(); ++i) {
+    IdbNet* net                           = net_list[i];
+    GuiSpeedupItemType gui_type           = getNetGuiType(net);
+    std::vector<GuiTileShape>& shape_list = thread_shape_list[omp_get_thread_num()];
+
+    /// the net index is the owner, so the shapes of a net can be found for the search
+    auto add_shape = [&](IdbRect* rect, IdbLayer* layer) {
+      shape_list.push_back(GuiTileShape{_transform.db_to_guidb_rect(rect), layer->get_order(),
+                                        static_cast<int8_t>(gui_type), static_cast<int32_t>(i)});
+    };
+    auto add_layer_shape = [&](IdbLayerShape layer_shape) {
+      if (layer_shape.get_layer() == nullptr) {
+        return;
+      }
+      for (IdbRect* rect : layer_shape.get_rect_list()) {
+        add_shape(rect, layer_shape.get_layer());
+      }
+    };
+
+    for (IdbRegularWire* wire : net->get_wire_list()->get_wire_list()) {
+      for (IdbRegularWireSegment* segment : wire->get_segment_list()) {
+        for (IdbVia* via : segment->get_via_list()) {
+          add_layer_shape(via->get_cut_layer_shape());
+          add_layer_shape(via->get_bottom_layer_shape());
+          add_layer_shape(via->get_top_layer_shape());
+        }
+
+        if (segment->get_layer() == nullptr) {
+          continue;
+        }
+        if (segment->is_rect() && !segment->is_via()) {
+          IdbRect rect(segment->get_delta_rect());
+          rect.moveByStep(segment->get_point_start()->get_x(), segment->get_point_start()->get_y());
+          add_shape(&rect, segment->get_layer());
+        } else if (segment->get_point_number() >= 2) {
+          IdbRect rect = getNetPointsRect(segment);
+          add_shape(&rect, segment->get_layer());
+        }
+      }
+    }
+  }
+
+  GuiTileCache* tile_cache = _gui_design->get_tile_cache();
+  for (auto& shape_list : thread_shape_list) {
+    tile_cache->addShapeList(shape_list);
+    wire_number += shape_list.size();
+  }
+
+  std::cout << "create net tile shape number =  :  " << wire_number << std::endl;
+  std::cout << "Success to create NET tiles..." << std::endl;
+}
+
 GuiSpeedupItem* IdbSpeedUpSetup::findNetItem(IdbRegularWireSegment* segment, GuiSpeedupItemType gui_type) {
   if (segment == nullptr) {
     return nullptr;
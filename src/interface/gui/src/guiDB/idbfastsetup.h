@@ -122,6 +122,8 @@ class IdbSpeedUpSetup : public DbSetup {
   /// Instance
   void createInstance(IdbInstanceList* inst_list = nullptr);
   void createInstanceCore(IdbInstance* instance);
+  void createInstanceTile(std::vector<IdbInstance*>& inst_list);
+  bool isInstanceCore(IdbInstance* instance);
   void createInstancePad(IdbInstance* instance);
   void createInstanceBlock(IdbInstance* instance);
   void createInstanceCorePin(vector<IdbPin*>& pin_list, GuiSpeedupItem* item = nullptr);
@@ -132,12 +134,20 @@ class IdbSpeedUpSetup : public DbSetup {
   void createSpecialNet();
   void createSpecialNetVia(IdbSpecialWireSegment* segment, bool b_vdd = false);
   void createSpecialNetPoints(IdbSpecialWireSegment* segment, GuiSpeedupItem* item);
+  void createSpecialNetViaTile();
   /// nets
   void createNet();
   void createNetVia(IdbRegularWireSegment* segment, GuiSpeedupItemType gui_type);
   void createNetRect(IdbRegularWireSegment* segment, GuiSpeedupItem* item);
   void createNetPoints(IdbRegularWireSegment* segment, GuiSpeedupItem* item);
+  IdbRect getNetPointsRect(IdbRegularWireSegment* segment);
   GuiSpeedupItemType getNetGuiType(IdbNet* net);
+  void createNetTile();
+
+  /// tile cache
+  bool isNetVisibleType();
+  int64_t getTileShapeNumber();
+  void updateTile();
 
   /// Tracks
   void createTrackGrid();
@@ -16,6 +16,8 @@
 // ***************************************************************************************
 #include "idbfastsetup.h"
 
+#include <algorithm>
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -95,6 +97,22 @@ bool IdbSpeedUpSetup::highLightNetWire(IdbNet* net) {
     return false;
   }
 
+  /// the net shapes of a large design are only kept in the tile cache, the owner of a net shape is the net index
+  GuiTileCache* tile_cache = _gui_design->get_tile_cache();
+  if (_gui_design->is_tile_mode() && tile_cache->is_ready()) {
+    auto& net_list = _design->get_net_list()->get_net_list();
+    auto net_iter  = std::find(net_list.begin(), net_list.end(), net);
+    if (net_iter == net_list.end()) {
+      return false;
+    }
+
+    auto& shape_list = tile_cache->get_shape_list();
+    for (int32_t id : tile_cache->queryOwnerShapes(static_cast<int32_t>(net_iter - net_list.begin()))) {
+      _search_item->add_rect(shape_list[id].rect);
+    }
+    return true;
+  }
+
   for (IdbRegularWire* wire : net->get_wire_list()->get_wire_list()) {
     for (IdbRegularWireSegment* segment : wire->get_segment_list()) {
       if (segment == nullptr || segment->is_rect()) {
@@ -18,6 +18,11 @@
 #include "idbfastsetup.h"
 
 bool IdbSpeedUpSetup::updateInstance() {
+  if (_gui_design->is_tile_mode()) {
+    updateTile();
+    return true;
+  }
+
   _gui_design->clearUpdateItemList();
 
   auto& inst_list = _design->get_instance_list()->get_instance_list();
@@ -47,6 +52,11 @@ bool IdbSpeedUpSetup::updateInstance() {
 }
 
 bool IdbSpeedUpSetup::updateNet() {
+  if (_gui_design->is_tile_mode()) {
+    updateTile();
+    return true;
+  }
+
   _gui_design->clearUpdateItemList();
 
   auto& net_list = _design->get_net_list()->get_net_list();
@@ -53,6 +53,13 @@ void GuiSpeedupDesign::clear() {
     _notch_container->clear();
     _min_step_container->clear();
     _min_area_container->clear();
+
+    /// wait for the tile tasks before the item receiving their repaint is deleted
+    _tile_cache->clear();
+    if (_tile_item != nullptr) {
+      delete _tile_item;
+      _tile_item = nullptr;
+    }
   }
 }
 
@@ -72,6 +79,7 @@ void GuiSpeedupDesign::init(QRectF boundingbox) {
     initClockContainer(new_box);
     initTrackGridContainer(new_box);
     initDrcContainer(new_box);
+    initTile(new_box);
   }
 }
 
@@ -240,11 +248,33 @@ void GuiSpeedupDesign::initDrcContainer(QRectF boundingbox) {
   }
 }
 
+/// one layer slot more than the layout for the outline of the standard cells
+void GuiSpeedupDesign::initTile(QRectF boundingbox) {
+  int32_t layer_num = _layout->get_layers()->get_layers_num();
+  _tile_cache->init(boundingbox, layer_num + 1, static_cast<int32_t>(GuiSpeedupItemType::kMax));
+  for (IdbLayer* layer : _layout->get_layers()->get_layers()) {
+    _tile_cache->set_layer_color(layer->get_order(), attributeInst->getLayerColor(layer->get_name()));
+  }
+  _tile_cache->set_layer_color(layer_num, QColor(130, 130, 130));
+}
+
+void GuiSpeedupDesign::finishTile() {
+  if (_tile_item == nullptr) {
+    _tile_item = new GuiSpeedupTileItem(_tile_cache);
+    _scene->addItem(_tile_item);
+  }
+  _tile_cache->buildIndex();
+}
+
 void GuiSpeedupDesign::finishCreateItem() {
   if (_type == DbSetupType::kClockTree) {
     return;
   }
 
+  if (_b_tile_mode) {
+    finishTile();
+  }
+
   _instance_list->finishCreateItem();
   _power_container->finishCreateItem();
   _ground_container->finishCreateItem();
@@ -274,6 +304,10 @@ void GuiSpeedupDesign::update(std::string node_name, std::string parent_name) {
     return;
   }
 
+  if (_tile_item != nullptr) {
+    _tile_item->update();
+  }
+
   if (node_name == "Shape") {
     _instance_list->update();
     return;
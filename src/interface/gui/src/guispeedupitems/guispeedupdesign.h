@@ -35,6 +35,7 @@
 #include "guispeedupdrc.h"
 #include "guispeedupgrid.h"
 #include "guispeedupinstance.h"
+#include "guispeeduptile.h"
 #include "guispeedupvia.h"
 #include "guispeedupwire.h"
 
@@ -73,6 +74,8 @@ class GuiSpeedupDesign {
       _notch_container         = new GuiSpeedupDrcContainer(scene, GuiSpeedupItemType::kDrcNotchSpacing);
       _min_step_container      = new GuiSpeedupDrcContainer(scene, GuiSpeedupItemType::kDrcMinStep);
       _min_area_container      = new GuiSpeedupDrcContainer(scene, GuiSpeedupItemType::kDrcMinArea);
+
+      _tile_cache = new GuiTileCache();
     }
   }
   ~GuiSpeedupDesign() = default;
@@ -137,8 +140,12 @@ class GuiSpeedupDesign {
 
   GuiSpeedupClockTreeItemList* get_clock_list() { return _clock_list; }
 
+  GuiTileCache* get_tile_cache() { return _tile_cache; }
+  bool is_tile_mode() { return _b_tile_mode; }
+
   /// operator
   void set_idb_layout(IdbLayout* layout) { _layout = layout; }
+  void set_tile_mode(bool b_tile_mode) { _b_tile_mode = b_tile_mode; }
   void init(QRectF boundingbox);
   void initViaContainer(QRectF boundingbox);
   void initPdnContainer(QRectF boundingbox, GuiSpeedupWireContainer* pdn_container, GuiSpeedupItemType type);
@@ -152,8 +159,10 @@ class GuiSpeedupDesign {
   void initClockPanelNonPreferContainer(QRectF boundingbox);
   void initTrackGridContainer(QRectF boundingbox);
   void initDrcContainer(QRectF boundingbox);
+  void initTile(QRectF boundingbox);
 
   void finishCreateItem();
+  void finishTile();
   void clear();
 
   void update(std::string node_name, std::string parent_name = "");
@@ -209,6 +218,11 @@ class GuiSpeedupDesign {
   GuiSpeedupDrcContainer* _min_area_container;
 
   GuiSpeedupClockTreeItemList* _clock_list;
+
+  /// standard cells, vias and routed nets of large designs
+  bool _b_tile_mode              = false;
+  GuiTileCache* _tile_cache      = nullptr;
+  GuiSpeedupTileItem* _tile_item = nullptr;
 };
 
 #endif  // GUI_SPEEDUP_DESIGN
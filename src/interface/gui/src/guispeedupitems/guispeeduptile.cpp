@@ -0,0 +1,195 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+#include "guispeeduptile.h"
+
+#include <QMetaObject>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+#include "guiConfig.h"
+#include "guiConfigTree.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+GuiSpeedupTileItem::GuiSpeedupTileItem(GuiTileCache* tile_cache, QGraphicsItem* parent)
+    : QGraphicsObject(parent), _tile_cache(tile_cache) {
+  _bounding_box = tile_cache->get_bounding_box();
+  setFlag(QGraphicsItem::ItemUsesExtendedStyleOption);
+  setZValue(tile_cache->get_layer_number());
+
+  /// the tiles are built in the thread pool, the repaint is queued to the gui thread
+  _tile_cache->set_ready_callback(
+      [this]() { QMetaObject::invokeMethod(this, [this]() { update(); }, Qt::QueuedConnection); });
+}
+
+void GuiSpeedupTileItem::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget) {
+  Q_UNUSED(widget);
+
+  igui::GuiTreeNode& clock_tree = guiConfig->get_clock_tree();
+  if (clock_tree.isChecked("Show") || !_tile_cache->is_ready()) {
+    return;
+  }
+
+  const qreal lod    = option->levelOfDetailFromTransform(painter->worldTransform());
+  QRectF rect        = option->exposedRect.intersected(_bounding_box);
+  GuiTileStyle style = buildStyle();
+
+  qreal tile_pixel = std::min(_tile_cache->get_step_x(), _tile_cache->get_step_y()) * lod;
+  if (tile_pixel < GUI_TILE_SUMMARY_PIXEL) {
+    paintDensity(painter, style, lod);
+  } else if (tile_pixel < GUI_TILE_IMAGE_SIZE) {
+    paintImage(painter, style, rect);
+  } else {
+    paintShape(painter, style, rect, lod);
+  }
+}
+
+void GuiSpeedupTileItem::paintDensity(QPainter* painter, const GuiTileStyle& style, qreal lod) {
+  int32_t level            = _tile_cache->selectLevel(lod);
+  GuiTileLevel& tile_level = _tile_cache->get_level(level);
+  QImage& image            = _tile_cache->getDensityImage(level, style);
+
+  QRectF target(_bounding_box.left(), _bounding_box.top(), tile_level.number_x * tile_level.step_x,
+                tile_level.number_y * tile_level.step_y);
+  painter->drawImage(target, image);
+}
+
+void GuiSpeedupTileItem::paintImage(QPainter* painter, const GuiTileStyle& style, QRectF rect) {
+  QImage& density_image = _tile_cache->getDensityImage(0, style);
+
+  int32_t x_begin, y_begin, x_end, y_end;
+  _tile_cache->get_tile_range(rect, x_begin, y_begin, x_end, y_end);
+  for (int32_t y = y_begin; y <= y_end; ++y) {
+    for (int32_t x = x_begin; x <= x_end; ++x) {
+      int32_t tile     = _tile_cache->get_tile_index(x, y);
+      QRectF tile_rect = _tile_cache->get_tile_rect(x, y);
+
+      QImage image;
+      if (_tile_cache->findImage(tile, style.signature, image)) {
+        painter->drawImage(tile_rect, image);
+      } else {
+        /// draw the density of the tile until its image is ready
+        _tile_cache->requestImage(tile, style);
+        painter->drawImage(tile_rect, density_image, QRectF(x, y, 1, 1));
+      }
+    }
+  }
+}
+
+void GuiSpeedupTileItem::paintShape(QPainter* painter, const GuiTileStyle& style, QRectF rect, qreal lod) {
+  int32_t layer_num = _tile_cache->get_layer_number();
+  int32_t type_num  = _tile_cache->get_type_number();
+  auto& shape_list  = _tile_cache->get_shape_list();
+
+  /// group the visible shapes by layer and type, the lower layer is painted first
+  std::vector<std::vector<int32_t>> group_id_list(static_cast<size_t>(layer_num) * type_num);
+  for (int32_t id : _tile_cache->queryShapes(rect)) {
+    GuiTileShape& shape = shape_list[id];
+    if (style.is_visible(shape.type, shape.z_order, layer_num)) {
+      group_id_list[shape.z_order * type_num + shape.type].push_back(id);
+    }
+  }
+
+  int32_t cell_slot = layer_num - 1;
+  for (int32_t z = 0; z < layer_num; ++z) {
+    for (int32_t type = 0; type < type_num; ++type) {
+      auto& id_list = group_id_list[z * type_num + type];
+      if (id_list.empty()) {
+        continue;
+      }
+
+      const QColor& color = style.get_color(type, z, layer_num);
+      QPen pen(color);
+      pen.setWidthF(0);
+      painter->setPen(pen);
+      if (z == cell_slot) {
+        QBrush brush(color, Qt::BrushStyle::Dense6Pattern);
+        brush.setTransform(painter->worldTransform().inverted());
+        painter->setBrush(brush);
+      } else if (lod >= 50) {
+        QBrush brush(color, z % 2 == 0 ? Qt::BrushStyle::BDiagPattern : Qt::BrushStyle::FDiagPattern);
+        brush.setTransform(painter->worldTransform().inverted());
+        painter->setBrush(brush);
+      } else {
+        painter->setBrush(Qt::BrushStyle::NoBrush);
+      }
+
+      for (int32_t id : id_list) {
+        painter->drawRect(shape_list[id].rect);
+      }
+    }
+  }
+}
+
+GuiTileStyle GuiSpeedupTileItem::buildStyle() {
+  int32_t layer_num = _tile_cache->get_layer_number();
+  int32_t type_num  = _tile_cache->get_type_number();
+  int32_t cell_slot = layer_num - 1;
+  GuiTileStyle style;
+  style.color_list.assign(static_cast<size_t>(type_num) * layer_num, QColor());
+  style.visible.assign(static_cast<size_t>(type_num) * layer_num, 0);
+
+  igui::GuiTreeNode& net_tree        = guiConfig->get_net_tree();
+  igui::GuiTreeNode& specialnet_tree = guiConfig->get_specialnet_tree();
+  igui::GuiTreeNode& instance_tree   = guiConfig->get_instance_tree();
+  bool b_signal                      = net_tree.isChecked("Signal");
+  bool b_clock                       = net_tree.isChecked("Clock");
+  bool b_power                       = net_tree.isChecked("Power");
+  bool b_ground                      = net_tree.isChecked("Ground");
+  bool b_pdn_power                   = specialnet_tree.isChecked("Power");
+  bool b_pdn_ground                  = specialnet_tree.isChecked("Ground");
+  bool b_std_cell                    = instance_tree.isChecked("Standard Cell");
+
+  auto set_style = [&](GuiSpeedupItemType type, int32_t z, bool b_visible, QColor color) {
+    size_t index            = static_cast<size_t>(type) * layer_num + z;
+    style.visible[index]    = b_visible ? 1 : 0;
+    style.color_list[index] = color;
+  };
+
+  for (int32_t z = 0; z < cell_slot; ++z) {
+    QColor color = _tile_cache->get_layer_color(z);
+    bool b_layer = guiConfig->isLayerVisible(z);
+    set_style(GuiSpeedupItemType::kNet, z, b_layer && (b_signal || b_clock || b_power || b_ground), color);
+    set_style(GuiSpeedupItemType::kSignal, z, b_layer && b_signal, color);
+    set_style(GuiSpeedupItemType::kSignalClock, z, b_layer && b_clock, color);
+    set_style(GuiSpeedupItemType::kSignalPower, z, b_layer && b_power, color);
+    set_style(GuiSpeedupItemType::kSignalGround, z, b_layer && b_ground, color);
+    set_style(GuiSpeedupItemType::kPdnPower, z, b_layer && b_pdn_power, color);
+    set_style(GuiSpeedupItemType::kPdnGround, z, b_layer && b_pdn_ground, color);
+    /// pin and obs shapes of the standard cells
+    set_style(GuiSpeedupItemType::kInstStandarCell, z, b_layer && b_std_cell, color.lighter(130));
+  }
+  set_style(GuiSpeedupItemType::kInstStandarCell, cell_slot, b_std_cell, _tile_cache->get_layer_color(cell_slot));
+
+  /// FNV-1a of the visibility and the colors
+  uint64_t signature = 14695981039346656037ULL;
+  auto hash          = [&signature](uint64_t value) {
+    signature ^= value;
+    signature *= 1099511628211ULL;
+  };
+  for (uint8_t b_visible : style.visible) {
+    hash(b_visible);
+  }
+  for (QColor& color : style.color_list) {
+    hash(color.rgba());
+  }
+  style.signature = signature;
+
+  return style;
+}
@@ -0,0 +1,56 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+/**
+ * @file GuiSpeedupTile.h
+ * @brief the item painting the tile cache of a large design. Zoomed out, every tile is painted by the density of its
+ * types and layers, in the middle range by an image rasterized in the background, and zoomed in by its own shapes.
+ * The cache holds one layer slot more than the layout, the last slot keeps the outline of the standard cells.
+ *
+ */
+
+#ifndef GUI_SPEEDUP_TILE
+#define GUI_SPEEDUP_TILE
+
+#include <QGraphicsObject>
+
+#include "guispeedupitem.h"
+#include "guitilecache.h"
+
+class GuiSpeedupTileItem : public QGraphicsObject {
+ public:
+  explicit GuiSpeedupTileItem(GuiTileCache* tile_cache, QGraphicsItem* parent = nullptr);
+  virtual ~GuiSpeedupTileItem() = default;
+
+  virtual QRectF boundingRect() const override { return _bounding_box; }
+  virtual void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget = nullptr) override;
+
+  /// getter
+  GuiTileCache* get_tile_cache() { return _tile_cache; }
+
+  /// painter
+  void paintDensity(QPainter* painter, const GuiTileStyle& style, qreal lod);
+  void paintImage(QPainter* painter, const GuiTileStyle& style, QRectF rect);
+  void paintShape(QPainter* painter, const GuiTileStyle& style, QRectF rect, qreal lod);
+
+ private:
+  GuiTileCache* _tile_cache;
+  QRectF _bounding_box;
+
+  GuiTileStyle buildStyle();
+};
+
+#endif  // GUI_SPEEDUP_TILE
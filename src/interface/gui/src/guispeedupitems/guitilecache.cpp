@@ -0,0 +1,451 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+#include "guitilecache.h"
+
+#include <QPainter>
+#include <QRunnable>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace {
+class GuiTileTask : public QRunnable {
+ public:
+  explicit GuiTileTask(std::function<void()> func) : _func(func) { }
+  virtual ~GuiTileTask() = default;
+
+  void run() override { _func(); }
+
+ private:
+  std::function<void()> _func;
+};
+}  // namespace
+
+void GuiTileCache::init(QRectF bounding_box, int32_t layer_num, int32_t type_num, int32_t max_tile_num) {
+  clear();
+
+  _bounding_box = bounding_box;
+  _layer_num    = std::max(layer_num, 1);
+  _type_num     = std::max(type_num, 1);
+  _color_list.assign(_layer_num, QColor(100, 100, 100));
+
+  /// square tiles, the longer side of the box is split into max_tile_num tiles
+  qreal step = std::max(bounding_box.width(), bounding_box.height()) / std::max(max_tile_num, 1);
+  step       = step > 0 ? step : 1;
+  _step_x    = step;
+  _step_y    = step;
+  _number_x  = std::max(1, static_cast<int32_t>(std::ceil(bounding_box.width() / step)));
+  _number_y  = std::max(1, static_cast<int32_t>(std::ceil(bounding_box.height() / step)));
+}
+
+void GuiTileCache::addShape(QRectF rect, int32_t z_order, int32_t type, int32_t owner) {
+  if (z_order < 0 || z_order >= _layer_num || type < 0 || type >= _type_num) {
+    return;
+  }
+  _shape_list.push_back(GuiTileShape{rect, z_order, static_cast<int8_t>(type), owner});
+}
+
+void GuiTileCache::addShapeList(std::vector<GuiTileShape>& shape_list) {
+  _shape_list.reserve(_shape_list.size() + shape_list.size());
+  for (auto& shape : shape_list) {
+    addShape(shape.rect, shape.z_order, shape.type, shape.owner);
+  }
+}
+
+void GuiTileCache::buildIndex(bool b_async) {
+  auto build = [this]() {
+    buildTileIndex();
+    buildOwnerIndex();
+    buildLevels();
+    _b_ready = true;
+
+    std::cout << "Success to build tile cache... shape number = " << _shape_list.size()
+              << " tile number = " << _number_x * _number_y << std::endl;
+    if (_ready_callback) {
+      _ready_callback();
+    }
+  };
+
+  if (b_async) {
+    _thread_pool.start(new GuiTileTask(build));
+  } else {
+    build();
+  }
+}
+
+void GuiTileCache::clear() {
+  _thread_pool.clear();
+  _thread_pool.waitForDone();
+
+  _b_ready = false;
+  _shape_list.clear();
+  _tile_start.clear();
+  _tile_shape_list.clear();
+  _owner_start.clear();
+  _owner_shape_list.clear();
+  _type_slot.clear();
+  _type_slot_num = 0;
+  _level_list.clear();
+  _density_image_list.clear();
+  _density_signature = 0;
+  clearImages();
+}
+
+void GuiTileCache::get_tile_range(QRectF rect, int32_t& x_begin, int32_t& y_begin, int32_t& x_end, int32_t& y_end) {
+  auto index_x = [this](qreal x) {
+    return std::clamp(static_cast<int32_t>(std::floor((x - _bounding_box.left()) / _step_x)), 0, _number_x - 1);
+  };
+  auto index_y = [this](qreal y) {
+    return std::clamp(static_cast<int32_t>(std::floor((y - _bounding_box.top()) / _step_y)), 0, _number_y - 1);
+  };
+
+  x_begin = index_x(rect.left());
+  x_end   = index_x(rect.right());
+  y_begin = index_y(rect.top());
+  y_end   = index_y(rect.bottom());
+}
+
+void GuiTileCache::buildTileIndex() {
+  int32_t tile_num = _number_x * _number_y;
+
+  /// a shape is recorded in every tile it overlaps, counting sort by tile
+  _tile_start.assign(tile_num + 1, 0);
+  for (auto& shape : _shape_list) {
+    int32_t x_begin, y_begin, x_end, y_end;
+    get_tile_range(shape.rect, x_begin, y_begin, x_end, y_end);
+    for (int32_t y = y_begin; y <= y_end; ++y) {
+      for (int32_t x = x_begin; x <= x_end; ++x) {
+        _tile_start[get_tile_index(x, y) + 1]++;
+      }
+    }
+  }
+
+  for (int32_t i = 0; i < tile_num; ++i) {
+    _tile_start[i + 1] += _tile_start[i];
+  }
+
+  _tile_shape_list.resize(_tile_start[tile_num]);
+  std::vector<int32_t> cursor(_tile_start.begin(), _tile_start.end() - 1);
+  for (int32_t id = 0; id < static_cast<int32_t>(_shape_list.size()); ++id) {
+    int32_t x_begin, y_begin, x_end, y_end;
+    get_tile_range(_shape_list[id].rect, x_begin, y_begin, x_end, y_end);
+    for (int32_t y = y_begin; y <= y_end; ++y) {
+      for (int32_t x = x_begin; x <= x_end; ++x) {
+        _tile_shape_list[cursor[get_tile_index(x, y)]++] = id;
+      }
+    }
+  }
+}
+
+void GuiTileCache::buildOwnerIndex() {
+  int32_t owner_num = 0;
+  for (auto& shape : _shape_list) {
+    owner_num = std::max(owner_num, shape.owner + 1);
+  }
+
+  _owner_start.assign(owner_num + 1, 0);
+  for (auto& shape : _shape_list) {
+    if (shape.owner >= 0) {
+      _owner_start[shape.owner + 1]++;
+    }
+  }
+  for (int32_t i = 0; i < owner_num; ++i) {
+    _owner_start[i + 1] += _owner_start[i];
+  }
+
+  _owner_shape_list.resize(_owner_start[owner_num]);
+  std::vector<int32_t> cursor(_owner_start.begin(), _owner_start.end() - 1);
+  for (int32_t id = 0; id < static_cast<int32_t>(_shape_list.size()); ++id) {
+    if (_shape_list[id].owner >= 0) {
+      _owner_shape_list[cursor[_shape_list[id].owner]++] = id;
+    }
+  }
+}
+
+void GuiTileCache::buildLevels() {
+  _level_list.clear();
+
+  /// a slot for every type having shapes, so the visibility of every type still applies to the density
+  _type_slot.assign(_type_num, -1);
+  _type_slot_num = 0;
+  for (auto& shape : _shape_list) {
+    if (_type_slot[shape.type] < 0) {
+      _type_slot[shape.type] = _type_slot_num++;
+    }
+  }
+  int32_t cell_size = std::max(_type_slot_num, 1) * _layer_num;
+
+  /// level 0, the covered area of every type and layer in the tile
+  GuiTileLevel level;
+  level.number_x = _number_x;
+  level.number_y = _number_y;
+  level.step_x   = _step_x;
+  level.step_y   = _step_y;
+  level.density.assign(static_cast<size_t>(_number_x) * _number_y * cell_size, 0);
+
+  int32_t tile_num = _number_x * _number_y;
+#pragma omp parallel for schedule(dynamic, 16)
+  for (int32_t tile = 0; tile < tile_num; ++tile) {
+    QRectF tile_rect = get_tile_rect(tile % _number_x, tile / _number_x);
+    qreal tile_area  = tile_rect.width() * tile_rect.height();
+    float* density   = &level.density[static_cast<size_t>(tile) * cell_size];
+    for (int32_t i = _tile_start[tile]; i < _tile_start[tile + 1]; ++i) {
+      GuiTileShape& shape = _shape_list[_tile_shape_list[i]];
+      qreal width  = std::min(shape.rect.right(), tile_rect.right()) - std::max(shape.rect.left(), tile_rect.left());
+      qreal height = std::min(shape.rect.bottom(), tile_rect.bottom()) - std::max(shape.rect.top(), tile_rect.top());
+      if (width > 0 && height > 0) {
+        density[_type_slot[shape.type] * _layer_num + shape.z_order] += width * height / tile_area;
+      }
+    }
+  }
+  _level_list.push_back(std::move(level));
+
+  /// every level above averages 2 x 2 cells of the level below
+  while (_level_list.back().number_x > 1 || _level_list.back().number_y > 1) {
+    GuiTileLevel& lower = _level_list.back();
+    GuiTileLevel upper;
+    upper.number_x = (lower.number_x + 1) / 2;
+    upper.number_y = (lower.number_y + 1) / 2;
+    upper.step_x   = lower.step_x * 2;
+    upper.step_y   = lower.step_y * 2;
+    upper.density.assign(static_cast<size_t>(upper.number_x) * upper.number_y * cell_size, 0);
+
+    for (int32_t y = 0; y < upper.number_y; ++y) {
+      for (int32_t x = 0; x < upper.number_x; ++x) {
+        float* density = &upper.density[(static_cast<size_t>(y) * upper.number_x + x) * cell_size];
+        int32_t number = 0;
+        for (int32_t sub_y = 2 * y; sub_y < std::min(2 * y + 2, lower.number_y); ++sub_y) {
+          for (int32_t sub_x = 2 * x; sub_x < std::min(2 * x + 2, lower.number_x); ++sub_x) {
+            float* sub_density = &lower.density[(static_cast<size_t>(sub_y) * lower.number_x + sub_x) * cell_size];
+            for (int32_t i = 0; i < cell_size; ++i) {
+              density[i] += sub_density[i];
+            }
+            number++;
+          }
+        }
+        for (int32_t i = 0; i < cell_size; ++i) {
+          density[i] /= number;
+        }
+      }
+    }
+    _level_list.push_back(std::move(upper));
+  }
+}
+
+std::vector<int32_t> GuiTileCache::queryShapes(QRectF rect) {
+  std::vector<int32_t> id_list;
+  if (!is_ready()) {
+    return id_list;
+  }
+
+  int32_t x_begin, y_begin, x_end, y_end;
+  get_tile_range(rect, x_begin, y_begin, x_end, y_end);
+  for (int32_t y = y_begin; y <= y_end; ++y) {
+    for (int32_t x = x_begin; x <= x_end; ++x) {
+      int32_t tile = get_tile_index(x, y);
+      for (int32_t i = _tile_start[tile]; i < _tile_start[tile + 1]; ++i) {
+        int32_t id          = _tile_shape_list[i];
+        GuiTileShape& shape = _shape_list[id];
+        if (shape.rect.left() > rect.right() || shape.rect.right() < rect.left() || shape.rect.top() > rect.bottom()
+            || shape.rect.bottom() < rect.top()) {
+          continue;
+        }
+        /// a shape in several tiles is only reported by the first tile of the range it overlaps
+        int32_t shape_x_begin, shape_y_begin, shape_x_end, shape_y_end;
+        get_tile_range(shape.rect, shape_x_begin, shape_y_begin, shape_x_end, shape_y_end);
+        if (std::max(shape_x_begin, x_begin) == x && std::max(shape_y_begin, y_begin) == y) {
+          id_list.push_back(id);
+        }
+      }
+    }
+  }
+
+  return id_list;
+}
+
+std::vector<int32_t> GuiTileCache::queryOwnerShapes(int32_t owner) {
+  std::vector<int32_t> id_list;
+  if (!is_ready() || owner < 0 || owner + 1 >= static_cast<int32_t>(_owner_start.size())) {
+    return id_list;
+  }
+
+  id_list.assign(_owner_shape_list.begin() + _owner_start[owner], _owner_shape_list.begin() + _owner_start[owner + 1]);
+  return id_list;
+}
+
+int32_t GuiTileCache::selectLevel(qreal lod) {
+  int32_t level = 0;
+  while (level + 1 < get_level_number()
+         && std::min(_level_list[level].step_x, _level_list[level].step_y) * lod < GUI_TILE_CELL_PIXEL) {
+    level++;
+  }
+  return level;
+}
+
+QImage& GuiTileCache::getDensityImage(int32_t level, const GuiTileStyle& style) {
+  if (_density_signature != style.signature || _density_image_list.size() != _level_list.size()) {
+    _density_image_list.assign(_level_list.size(), QImage());
+    _density_signature = style.signature;
+  }
+
+  QImage& image = _density_image_list[level];
+  if (!image.isNull()) {
+    return image;
+  }
+
+  /// one pixel per cell, the visible types of every layer are blended from the bottom layer up
+  GuiTileLevel& tile_level = _level_list[level];
+  int32_t cell_size        = std::max(_type_slot_num, 1) * _layer_num;
+  std::vector<int32_t> slot_type(_type_slot_num, 0);
+  for (int32_t type = 0; type < _type_num; ++type) {
+    if (_type_slot[type] >= 0) {
+      slot_type[_type_slot[type]] = type;
+    }
+  }
+  image = QImage(tile_level.number_x, tile_level.number_y, QImage::Format_ARGB32_Premultiplied);
+  image.bits();
+
+#pragma omp parallel for schedule(static)
+  for (int32_t y = 0; y < tile_level.number_y; ++y) {
+    QRgb* line = reinterpret_cast<QRgb*>(image.scanLine(y));
+    for (int32_t x = 0; x < tile_level.number_x; ++x) {
+      float* density = &tile_level.density[(static_cast<size_t>(y) * tile_level.number_x + x) * cell_size];
+      float red = 0, green = 0, blue = 0, alpha = 0;
+      for (int32_t z = 0; z < _layer_num; ++z) {
+        for (int32_t slot = 0; slot < _type_slot_num; ++slot) {
+          float type_density = density[slot * _layer_num + z];
+          if (type_density <= 0 || !style.is_visible(slot_type[slot], z, _layer_num)) {
+            continue;
+          }
+          float layer_alpha   = std::min(type_density, 1.0f) * 0.8f;
+          const QColor& color = style.get_color(slot_type[slot], z, _layer_num);
+          red                 = color.red() * layer_alpha + red * (1 - layer_alpha);
+          green               = color.green() * layer_alpha + green * (1 - layer_alpha);
+          blue                = color.blue() * layer_alpha + blue * (1 - layer_alpha);
+          alpha               = 255 * layer_alpha + alpha * (1 - layer_alpha);
+        }
+      }
+      line[x] = qRgba(static_cast<int>(red), static_cast<int>(green), static_cast<int>(blue), static_cast<int>(alpha));
+    }
+  }
+
+  return image;
+}
+
+bool GuiTileCache::findImage(int32_t tile_index, uint64_t signature, QImage& image) {
+  QMutexLocker locker(&_image_mutex);
+  if (signature != _image_signature) {
+    return false;
+  }
+
+  auto it = _image_map.find(tile_index);
+  if (it == _image_map.end()) {
+    return false;
+  }
+
+  _image_lru.splice(_image_lru.begin(), _image_lru, it->second.second);
+  image = it->second.first;
+  return true;
+}
+
+void GuiTileCache::requestImage(int32_t tile_index, const GuiTileStyle& style) {
+  {
+    QMutexLocker locker(&_image_mutex);
+    if (style.signature != _image_signature) {
+      /// colors or visibility changed, the images of the tiles are stale
+      _thread_pool.clear();
+      _image_map.clear();
+      _image_lru.clear();
+      _image_pending.clear();
+      _image_signature = style.signature;
+    }
+
+    if (_image_map.find(tile_index) != _image_map.end() || _image_pending.find(tile_index) != _image_pending.end()) {
+      return;
+    }
+    _image_pending.insert(tile_index);
+  }
+
+  _thread_pool.start(new GuiTileTask([this, tile_index, style]() {
+    QImage image = paintImage(tile_index, style);
+    {
+      QMutexLocker locker(&_image_mutex);
+      _image_pending.erase(tile_index);
+      if (style.signature != _image_signature || _image_map.find(tile_index) != _image_map.end()) {
+        return;
+      }
+
+      _image_lru.push_front(tile_index);
+      _image_map[tile_index] = std::make_pair(image, _image_lru.begin());
+      while (_image_lru.size() > GUI_TILE_IMAGE_MAX) {
+        _image_map.erase(_image_lru.back());
+        _image_lru.pop_back();
+      }
+    }
+
+    if (_ready_callback) {
+      _ready_callback();
+    }
+  }));
+}
+
+void GuiTileCache::clearImages() {
+  QMutexLocker locker(&_image_mutex);
+  _image_map.clear();
+  _image_lru.clear();
+  _image_pending.clear();
+}
+
+QImage GuiTileCache::paintImage(int32_t tile_index, const GuiTileStyle& style) {
+  QRectF tile_rect = get_tile_rect(tile_index % _number_x, tile_index / _number_x);
+
+  /// QImage can be painted out of the gui thread, QPixmap can not
+  QImage image(GUI_TILE_IMAGE_SIZE, GUI_TILE_IMAGE_SIZE, QImage::Format_ARGB32_Premultiplied);
+  image.fill(Qt::transparent);
+
+  std::vector<int32_t> id_list(_tile_shape_list.begin() + _tile_start[tile_index],
+                               _tile_shape_list.begin() + _tile_start[tile_index + 1]);
+  std::stable_sort(id_list.begin(), id_list.end(), [this](int32_t id_1, int32_t id_2) {
+    return std::make_pair(_shape_list[id_1].z_order, _shape_list[id_1].type)
+           < std::make_pair(_shape_list[id_2].z_order, _shape_list[id_2].type);
+  });
+
+  QPainter painter(&image);
+  painter.scale(GUI_TILE_IMAGE_SIZE / tile_rect.width(), GUI_TILE_IMAGE_SIZE / tile_rect.height());
+  painter.translate(-tile_rect.topLeft());
+  painter.setClipRect(tile_rect);
+  painter.setBrush(Qt::BrushStyle::NoBrush);
+
+  int32_t color_index = -1;
+  for (int32_t id : id_list) {
+    GuiTileShape& shape = _shape_list[id];
+    if (!style.is_visible(shape.type, shape.z_order, _layer_num)) {
+      continue;
+    }
+    if (shape.type * _layer_num + shape.z_order != color_index) {
+      color_index = shape.type * _layer_num + shape.z_order;
+      QPen pen(style.color_list[color_index]);
+      pen.setWidthF(0);
+      painter.setPen(pen);
+    }
+    painter.drawRect(shape.rect);
+  }
+  painter.end();
+
+  return image;
+}
+
@@ -0,0 +1,167 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+/**
+ * @file GuiTileCache.h
+ * @brief tiled level-of-detail cache for the shapes of large designs, the shapes are kept in a flat list and indexed
+ * by a uniform tile grid instead of creating the graphics items up front. Only QtCore and QtGui are used, so the cache
+ * runs without a scene and under the offscreen platform.
+ *
+ */
+
+#ifndef GUI_TILE_CACHE
+#define GUI_TILE_CACHE
+
+#include <QColor>
+#include <QImage>
+#include <QMutex>
+#include <QRectF>
+#include <QThreadPool>
+#include <atomic>
+#include <functional>
+#include <list>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "guiattribute.h"
+
+/// type is the item type of the shape, owner is the net index of a net shape and -1 for the others
+struct GuiTileShape {
+  QRectF rect;
+  int32_t z_order;
+  int8_t type;
+  int32_t owner;
+};
+
+/// the density of every type and layer on a grid, level 0 is the tile grid and every level above merges 2 x 2 cells
+struct GuiTileLevel {
+  int32_t number_x = 0;
+  int32_t number_y = 0;
+  qreal step_x     = 0;
+  qreal step_y     = 0;
+  std::vector<float> density;  /// ((y * number_x + x) * type slot number + type slot) * layer_num + z_order
+};
+
+/// colors and visibility used to paint the tiles, both indexed by type * layer_num + z_order, the images are rebuilt
+/// when the signature changes
+struct GuiTileStyle {
+  std::vector<QColor> color_list;
+  std::vector<uint8_t> visible;
+  uint64_t signature = 0;
+
+  bool is_visible(int32_t type, int32_t z_order, int32_t layer_num) const {
+    return visible[type * layer_num + z_order] != 0;
+  }
+  const QColor& get_color(int32_t type, int32_t z_order, int32_t layer_num) const {
+    return color_list[type * layer_num + z_order];
+  }
+};
+
+class GuiTileCache {
+ public:
+  GuiTileCache() = default;
+  ~GuiTileCache() { clear(); }
+
+  /// getter
+  QRectF get_bounding_box() { return _bounding_box; }
+  int32_t get_layer_number() { return _layer_num; }
+  int32_t get_type_number() { return _type_num; }
+  int32_t get_number_x() { return _number_x; }
+  int32_t get_number_y() { return _number_y; }
+  qreal get_step_x() { return _step_x; }
+  qreal get_step_y() { return _step_y; }
+  size_t get_shape_number() { return _shape_list.size(); }
+  std::vector<GuiTileShape>& get_shape_list() { return _shape_list; }
+  int32_t get_level_number() { return _level_list.size(); }
+  GuiTileLevel& get_level(int32_t level) { return _level_list[level]; }
+  int32_t get_type_slot(int32_t type) { return type >= 0 && type < _type_num ? _type_slot[type] : -1; }
+  int32_t get_type_slot_number() { return _type_slot_num; }
+  QColor get_layer_color(int32_t z_order) { return _color_list[z_order]; }
+  bool is_ready() { return _b_ready.load(); }
+
+  /// setter
+  void set_ready_callback(std::function<void()> callback) { _ready_callback = callback; }
+  void set_layer_color(int32_t z_order, QColor color) {
+    if (z_order >= 0 && z_order < _layer_num) {
+      _color_list[z_order] = color;
+    }
+  }
+
+  /// operator
+  void init(QRectF bounding_box, int32_t layer_num, int32_t type_num, int32_t max_tile_num = GUI_TILE_GRID_MAX);
+  void addShape(QRectF rect, int32_t z_order, int32_t type, int32_t owner = -1);
+  void addShapeList(std::vector<GuiTileShape>& shape_list);
+  void buildIndex(bool b_async = true);
+  void clear();
+
+  /// spatial index
+  int32_t get_tile_index(int32_t x, int32_t y) { return y * _number_x + x; }
+  QRectF get_tile_rect(int32_t x, int32_t y) {
+    return QRectF(_bounding_box.left() + x * _step_x, _bounding_box.top() + y * _step_y, _step_x, _step_y);
+  }
+  void get_tile_range(QRectF rect, int32_t& x_begin, int32_t& y_begin, int32_t& x_end, int32_t& y_end);
+  std::vector<int32_t> queryShapes(QRectF rect);
+  std::vector<int32_t> queryOwnerShapes(int32_t owner);
+  int32_t selectLevel(qreal lod);
+
+  /// images
+  QImage& getDensityImage(int32_t level, const GuiTileStyle& style);
+  bool findImage(int32_t tile_index, uint64_t signature, QImage& image);
+  void requestImage(int32_t tile_index, const GuiTileStyle& style);
+  void clearImages();
+
+ private:
+  QRectF _bounding_box;
+  int32_t _layer_num = 0;
+  int32_t _type_num  = 0;
+  int32_t _number_x  = 0;
+  int32_t _number_y  = 0;
+  qreal _step_x      = 0;
+  qreal _step_y      = 0;
+  std::vector<QColor> _color_list;
+
+  /// shapes and the tile index, the shapes of tile i are _tile_shape_list[_tile_start[i] .. _tile_start[i + 1])
+  std::vector<GuiTileShape> _shape_list;
+  std::vector<int32_t> _tile_start;
+  std::vector<int32_t> _tile_shape_list;
+  /// the shapes of owner i are _owner_shape_list[_owner_start[i] .. _owner_start[i + 1])
+  std::vector<int32_t> _owner_start;
+  std::vector<int32_t> _owner_shape_list;
+  /// the density is only kept for the types having shapes, _type_slot maps a type to its slot or -1
+  std::vector<int32_t> _type_slot;
+  int32_t _type_slot_num = 0;
+  std::vector<GuiTileLevel> _level_list;
+  std::atomic<bool> _b_ready{false};
+  std::function<void()> _ready_callback;
+
+  /// image cache, the least recently used image is dropped first
+  QThreadPool _thread_pool;
+  QMutex _image_mutex;
+  uint64_t _image_signature = 0;
+  std::unordered_map<int32_t, std::pair<QImage, std::list<int32_t>::iterator>> _image_map;
+  std::list<int32_t> _image_lru;
+  std::unordered_set<int32_t> _image_pending;
+  std::vector<QImage> _density_image_list;
+  uint64_t _density_signature = 0;
+
+  void buildTileIndex();
+  void buildOwnerIndex();
+  void buildLevels();
+  QImage paintImage(int32_t tile_index, const GuiTileStyle& style);
+};
+
+#endif  // GUI_TILE_CACHE
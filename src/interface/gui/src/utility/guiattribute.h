@@ -44,6 +44,15 @@
 #define GUI_ITEM_INSTANCE_MAX 500
 #define GUI_GRID_MAX          500
 
+/// switch the routed nets to the tile cache above this number of shapes
+#define GUI_TILE_SHAPE_THRESHOLD 1000000
+#define GUI_TILE_GRID_MAX        256
+#define GUI_TILE_IMAGE_SIZE      256
+#define GUI_TILE_IMAGE_MAX       512
+/// a tile smaller than this on screen is painted by the density summary
+#define GUI_TILE_SUMMARY_PIXEL 32
+#define GUI_TILE_CELL_PIXEL    4
+
 #define GUI_GCELL_GRID_COLOR QColor(244, 164, 96)
 
 #define attributeInst GuiAttribute::getInstance()
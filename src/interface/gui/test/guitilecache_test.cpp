@@ -0,0 +1,146 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "guitilecache.h"
+
+namespace {
+
+constexpr int32_t kLayerNum = 2;
+constexpr int32_t kTypeNum  = 3;
+
+/// box 100 x 100 split into 4 x 4 tiles of 25
+void initCache(GuiTileCache& cache) {
+  cache.init(QRectF(0, 0, 100, 100), kLayerNum, kTypeNum, 4);
+  cache.set_layer_color(0, QColor(255, 0, 0));
+  cache.set_layer_color(1, QColor(0, 0, 255));
+}
+
+GuiTileStyle makeStyle(GuiTileCache& cache, std::vector<uint8_t> type_visible) {
+  GuiTileStyle style;
+  for (int32_t type = 0; type < kTypeNum; ++type) {
+    for (int32_t z = 0; z < kLayerNum; ++z) {
+      style.color_list.push_back(cache.get_layer_color(z));
+      style.visible.push_back(type_visible[type]);
+    }
+  }
+  style.signature = type_visible[0] | (type_visible[1] << 1) | (type_visible[2] << 2);
+  return style;
+}
+
+TEST(GuiTileCacheTest, query_match_brute_force) {
+  GuiTileCache cache;
+  initCache(cache);
+
+  std::mt19937 random(7);
+  std::uniform_real_distribution<qreal> coord(0, 100);
+  std::uniform_real_distribution<qreal> size(0, 30);
+  for (int32_t i = 0; i < 500; ++i) {
+    cache.addShape(QRectF(coord(random), coord(random), size(random), size(random)), i % kLayerNum, i % kTypeNum,
+                   i % 50);
+  }
+  cache.buildIndex(false);
+  ASSERT_TRUE(cache.is_ready());
+
+  auto& shape_list = cache.get_shape_list();
+  for (int32_t i = 0; i < 50; ++i) {
+    QRectF rect(coord(random), coord(random), size(random), size(random));
+
+    std::vector<int32_t> expect_id_list;
+    for (int32_t id = 0; id < static_cast<int32_t>(shape_list.size()); ++id) {
+      QRectF& shape_rect = shape_list[id].rect;
+      if (shape_rect.left() <= rect.right() && shape_rect.right() >= rect.left() && shape_rect.top() <= rect.bottom()
+          && shape_rect.bottom() >= rect.top()) {
+        expect_id_list.push_back(id);
+      }
+    }
+
+    auto id_list = cache.queryShapes(rect);
+    std::sort(id_list.begin(), id_list.end());
+    EXPECT_EQ(id_list, expect_id_list);
+  }
+
+  for (int32_t owner = 0; owner < 50; ++owner) {
+    std::vector<int32_t> expect_id_list;
+    for (int32_t id = owner; id < static_cast<int32_t>(shape_list.size()); id += 50) {
+      expect_id_list.push_back(id);
+    }
+    EXPECT_EQ(cache.queryOwnerShapes(owner), expect_id_list);
+  }
+  EXPECT_TRUE(cache.queryOwnerShapes(50).empty());
+}
+
+TEST(GuiTileCacheTest, density_pyramid_by_type) {
+  GuiTileCache cache;
+  initCache(cache);
+
+  /// type 1 covers tile (0, 0) on layer 0, type 2 covers tile (1, 0) on layer 1
+  cache.addShape(QRectF(0, 0, 25, 25), 0, 1);
+  cache.addShape(QRectF(25, 0, 25, 25), 1, 2);
+  cache.buildIndex(false);
+
+  ASSERT_EQ(cache.get_level_number(), 3);
+  EXPECT_EQ(cache.get_type_slot(0), -1);
+  int32_t slot_1    = cache.get_type_slot(1);
+  int32_t slot_2    = cache.get_type_slot(2);
+  int32_t cell_size = cache.get_type_slot_number() * kLayerNum;
+  ASSERT_EQ(cache.get_type_slot_number(), 2);
+
+  auto density = [&](int32_t level, int32_t x, int32_t y, int32_t slot, int32_t z) {
+    GuiTileLevel& tile_level = cache.get_level(level);
+    return tile_level.density[(static_cast<size_t>(y) * tile_level.number_x + x) * cell_size + slot * kLayerNum + z];
+  };
+
+  EXPECT_FLOAT_EQ(density(0, 0, 0, slot_1, 0), 1.0f);
+  EXPECT_FLOAT_EQ(density(0, 0, 0, slot_2, 1), 0.0f);
+  EXPECT_FLOAT_EQ(density(0, 1, 0, slot_2, 1), 1.0f);
+  EXPECT_FLOAT_EQ(density(0, 1, 0, slot_1, 0), 0.0f);
+
+  EXPECT_EQ(cache.get_level(1).number_x, 2);
+  EXPECT_FLOAT_EQ(density(1, 0, 0, slot_1, 0), 0.25f);
+  EXPECT_FLOAT_EQ(density(1, 0, 0, slot_2, 1), 0.25f);
+  EXPECT_FLOAT_EQ(density(1, 1, 0, slot_1, 0), 0.0f);
+
+  EXPECT_EQ(cache.get_level(2).number_x, 1);
+  EXPECT_FLOAT_EQ(density(2, 0, 0, slot_1, 0), 1.0f / 16);
+  EXPECT_FLOAT_EQ(density(2, 0, 0, slot_2, 1), 1.0f / 16);
+}
+
+TEST(GuiTileCacheTest, density_image_by_type_visibility) {
+  GuiTileCache cache;
+  initCache(cache);
+
+  cache.addShape(QRectF(0, 0, 25, 25), 0, 1);
+  cache.addShape(QRectF(25, 0, 25, 25), 1, 2);
+  cache.buildIndex(false);
+
+  QImage all_image = cache.getDensityImage(0, makeStyle(cache, {1, 1, 1}));
+  EXPECT_GT(qAlpha(all_image.pixel(0, 0)), 0);
+  EXPECT_GT(qAlpha(all_image.pixel(1, 0)), 0);
+  EXPECT_EQ(qAlpha(all_image.pixel(2, 0)), 0);
+
+  /// the type 2 is hidden, its tile is empty in the summary
+  QImage type_1_image = cache.getDensityImage(0, makeStyle(cache, {1, 1, 0}));
+  EXPECT_GT(qAlpha(type_1_image.pixel(0, 0)), 0);
+  EXPECT_EQ(qAlpha(type_1_image.pixel(1, 0)), 0);
+  EXPECT_GT(qRed(type_1_image.pixel(0, 0)), qBlue(type_1_image.pixel(0, 0)));
+}
+
+}  // namespace
@@ -16,8 +16,11 @@
 // ***************************************************************************************
 #include "py_eval.h"
 
+#include <stdexcept>
+
 #include "congestion_api.h"
 #include "density_api.h"
+#include "py_numpy.h"
 #include "timing_api.hh"
 #include "wirelength_api.h"
 
@@ -101,6 +104,45 @@ std::vector<float> eval_overflow()
   return {};
 }
 
+namespace {
+
+pybind11::array_t<double> gridMapToNumpy(GridMap&& grid_map)
+{
+  pybind11::ssize_t rows = grid_map.rows;
+  pybind11::ssize_t cols = grid_map.cols;
+  return moveToNumpy(std::move(grid_map.values), {rows, cols});
+}
+
+}  // namespace
+
+pybind11::array_t<double> eval_rudy_map(int grid_size, const std::string& rudy_type, bool use_lut)
+{
+  if (rudy_type != "horizontal" && rudy_type != "vertical" && rudy_type != "union") {
+    throw std::invalid_argument("rudy_type must be horizontal, vertical or union, got " + rudy_type);
+  }
+  return gridMapToNumpy(CONGESTION_API_INST->rudyGridMap(grid_size, rudy_type, use_lut));
+}
+
+pybind11::array_t<double> eval_density_map(int grid_size, const std::string& map_type, const std::string& obj_type, bool neighbor)
+{
+  if (map_type == "net") {
+    if (obj_type != "local" && obj_type != "global" && obj_type != "all") {
+      throw std::invalid_argument("obj_type of the net map must be local, global or all, got " + obj_type);
+    }
+    return gridMapToNumpy(DENSITY_API_INST->netDensityGridMap(grid_size, obj_type, neighbor));
+  }
+  if (map_type != "cell" && map_type != "pin") {
+    throw std::invalid_argument("map_type must be cell, pin or net, got " + map_type);
+  }
+  if (obj_type != "macro" && obj_type != "stdcell" && obj_type != "all") {
+    throw std::invalid_argument("obj_type of the " + map_type + " map must be macro, stdcell or all, got " + obj_type);
+  }
+  if (map_type == "pin") {
+    return gridMapToNumpy(DENSITY_API_INST->pinDensityGridMap(grid_size, obj_type, neighbor));
+  }
+  return gridMapToNumpy(DENSITY_API_INST->cellDensityGridMap(grid_size, obj_type));
+}
+
 // timing evaluation
 void init_timing_eval()
 {
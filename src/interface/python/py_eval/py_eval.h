@@ -16,6 +16,8 @@
 // ***************************************************************************************
 #pragma once
 
+#include <pybind11/numpy.h>
+
 #include <string>
 #include <vector>
 namespace python_interface {
@@ -43,6 +45,11 @@ void eval_pin_density(int inst_status, int level = 0);
 void eval_rudy_cong(int rudy_type, int direction);
 std::vector<float> eval_overflow();
 
+// evaluation grids as (rows, cols) numpy arrays, row 0 is the bottom row of the die, an unknown type raises ValueError
+pybind11::array_t<double> eval_rudy_map(int grid_size = 1, const std::string& rudy_type = "union", bool use_lut = false);
+pybind11::array_t<double> eval_density_map(int grid_size = 1, const std::string& map_type = "cell", const std::string& obj_type = "all",
+                                           bool neighbor = false);
+
 // timing evaluation
 void init_timing_eval();
 
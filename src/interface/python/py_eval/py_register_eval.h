@@ -46,6 +46,9 @@ void register_eval(py::module& m)
   m.def("eval_pin_density", eval_pin_density, py::arg("inst_status"), py::arg("level"));
   m.def("eval_rudy_cong", eval_rudy_cong, py::arg("rudy_type"), py::arg("direction"));
   m.def("eval_overflow", eval_overflow);
+  m.def("eval_rudy_map", eval_rudy_map, py::arg("grid_size") = 1, py::arg("rudy_type") = "union", py::arg("use_lut") = false);
+  m.def("eval_density_map", eval_density_map, py::arg("grid_size") = 1, py::arg("map_type") = "cell", py::arg("obj_type") = "all",
+        py::arg("neighbor") = false);
 
   // timing evaluation
   m.def("init_timing_eval", init_timing_eval);
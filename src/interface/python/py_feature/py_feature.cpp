@@ -50,6 +50,11 @@ bool feature_route_read(const std::string& path)
   return featureInst->read_route_data(path);
 }
 
+bool feature_tables(const std::string& path, int32_t grid_size)
+{
+  return featureInst->save_feature_tables(path, grid_size);
+}
+
 bool feature_eval_summary(const std::string& path, int32_t grid_size)
 {
   return featureInst->save_eval_summary(path, grid_size);
@@ -32,6 +32,7 @@ void register_feature(py::module& m)
   m.def("feature_eval_summary", feature_eval_summary, py::arg("path"), py::arg("grid_size"));
   m.def("feature_timing_eval_summary", feature_timing_eval_summary, py::arg("path"));
   m.def("feature_net_eval", feature_net_eval, py::arg("path"));
+  m.def("feature_tables", feature_tables, py::arg("path"), py::arg("grid_size") = 1);
 }
 
 }  // namespace python_interface
\ No newline at end of file
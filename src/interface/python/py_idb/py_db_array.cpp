@@ -0,0 +1,166 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+#include "py_db_array.h"
+
+#include <idm.h>
+
+#include <stdexcept>
+#include <unordered_map>
+
+#include "IdbInstance.h"
+#include "IdbNet.h"
+#include "IdbPins.h"
+#include "py_numpy.h"
+
+namespace python_interface {
+
+namespace {
+
+std::vector<idb::IdbInstance*>& getInstList()
+{
+  return dmInst->get_idb_design()->get_instance_list()->get_instance_list();
+}
+
+}  // namespace
+
+std::vector<std::string> idbGetInstNames()
+{
+  auto& inst_list = getInstList();
+  std::vector<std::string> inst_names;
+  inst_names.reserve(inst_list.size());
+  for (auto* inst : inst_list) {
+    inst_names.push_back(inst->get_name());
+  }
+  return inst_names;
+}
+
+py::array_t<int32_t> idbGetInstCoords()
+{
+  auto& inst_list = getInstList();
+  std::vector<int32_t> coords(inst_list.size() * 2);
+  for (size_t i = 0; i < inst_list.size(); ++i) {
+    coords[2 * i] = inst_list[i]->get_coordinate()->get_x();
+    coords[2 * i + 1] = inst_list[i]->get_coordinate()->get_y();
+  }
+  return moveToNumpy(std::move(coords), {static_cast<py::ssize_t>(inst_list.size()), 2});
+}
+
+py::array_t<int32_t> idbGetInstSizes()
+{
+  auto& inst_list = getInstList();
+  std::vector<int32_t> sizes(inst_list.size() * 2, 0);
+  for (size_t i = 0; i < inst_list.size(); ++i) {
+    auto* cell_master = inst_list[i]->get_cell_master();
+    if (cell_master != nullptr) {
+      sizes[2 * i] = cell_master->get_width();
+      sizes[2 * i + 1] = cell_master->get_height();
+    }
+  }
+  return moveToNumpy(std::move(sizes), {static_cast<py::ssize_t>(inst_list.size()), 2});
+}
+
+py::array_t<bool> idbGetInstFixed()
+{
+  auto& inst_list = getInstList();
+  py::array_t<bool> fixed(static_cast<py::ssize_t>(inst_list.size()));
+  auto fixed_view = fixed.mutable_unchecked<1>();
+  for (size_t i = 0; i < inst_list.size(); ++i) {
+    fixed_view(i) = inst_list[i]->is_fixed();
+  }
+  return fixed;
+}
+
+std::vector<std::string> idbGetNetNames()
+{
+  auto& net_list = dmInst->get_idb_design()->get_net_list()->get_net_list();
+  std::vector<std::string> net_names;
+  net_names.reserve(net_list.size());
+  for (auto* net : net_list) {
+    net_names.push_back(net->get_net_name());
+  }
+  return net_names;
+}
+
+py::dict idbGetNetPinCsr()
+{
+  auto& inst_list = getInstList();
+  std::unordered_map<idb::IdbInstance*, int32_t> inst_index;
+  inst_index.reserve(inst_list.size());
+  for (size_t i = 0; i < inst_list.size(); ++i) {
+    inst_index.emplace(inst_list[i], static_cast<int32_t>(i));
+  }
+
+  auto& net_list = dmInst->get_idb_design()->get_net_list()->get_net_list();
+  std::vector<int64_t> offsets;
+  std::vector<int32_t> pin_inst;
+  std::vector<int32_t> pin_coords;
+  offsets.reserve(net_list.size() + 1);
+  offsets.push_back(0);
+
+  auto add_pin = [&](idb::IdbPin* pin) {
+    auto iter = inst_index.find(pin->get_instance());
+    pin_inst.push_back(iter == inst_index.end() ? -1 : iter->second);
+    pin_coords.push_back(pin->get_average_coordinate()->get_x());
+    pin_coords.push_back(pin->get_average_coordinate()->get_y());
+  };
+  for (auto* net : net_list) {
+    for (auto* pin : net->get_instance_pin_list()->get_pin_list()) {
+      add_pin(pin);
+    }
+    for (auto* pin : net->get_io_pins()->get_pin_list()) {
+      add_pin(pin);
+    }
+    offsets.push_back(static_cast<int64_t>(pin_inst.size()));
+  }
+
+  py::ssize_t pin_num = static_cast<py::ssize_t>(pin_inst.size());
+  py::dict csr;
+  csr["offsets"] = moveToNumpy(std::move(offsets));
+  csr["pin_inst"] = moveToNumpy(std::move(pin_inst));
+  csr["pin_coords"] = moveToNumpy(std::move(pin_coords), {pin_num, 2});
+  return csr;
+}
+
+int idbSetInstCoords(py::array_t<int32_t, py::array::c_style | py::array::forcecast> coords, bool skip_fixed)
+{
+  auto& inst_list = getInstList();
+  if (coords.ndim() != 2 || coords.shape(1) != 2 || static_cast<size_t>(coords.shape(0)) != inst_list.size()) {
+    throw std::invalid_argument("coords must be an (instance_num, 2) array");
+  }
+
+  const int32_t* data = coords.data();
+  int updated_num = 0;
+  py::gil_scoped_release release;
+  for (size_t i = 0; i < inst_list.size(); ++i) {
+    auto* inst = inst_list[i];
+    if (skip_fixed && inst->is_fixed()) {
+      continue;
+    }
+    auto* coord = inst->get_coordinate();
+    if (coord->get_x() == data[2 * i] && coord->get_y() == data[2 * i + 1] && inst->get_status() != idb::IdbPlacementStatus::kUnplaced) {
+      continue;
+    }
+    inst->set_coodinate(data[2 * i], data[2 * i + 1]);
+    if (inst->get_status() == idb::IdbPlacementStatus::kUnplaced) {
+      inst->set_status_placed();
+    }
+    ++updated_num;
+  }
+  return updated_num;
+}
+
+}  // namespace python_interface
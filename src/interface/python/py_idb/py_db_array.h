@@ -0,0 +1,37 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+#pragma once
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+#include <string>
+#include <vector>
+
+namespace python_interface {
+namespace py = pybind11;
+
+// bulk access of the placement data, arrays are ordered as the instance list / net list of idb
+std::vector<std::string> idbGetInstNames();
+py::array_t<int32_t> idbGetInstCoords();
+py::array_t<int32_t> idbGetInstSizes();
+py::array_t<bool> idbGetInstFixed();
+std::vector<std::string> idbGetNetNames();
+py::dict idbGetNetPinCsr();
+int idbSetInstCoords(py::array_t<int32_t, py::array::c_style | py::array::forcecast> coords, bool skip_fixed = true);
+
+}  // namespace python_interface
@@ -19,6 +19,7 @@
 #include <pybind11/cast.h>
 
 #include "py_db.h"
+#include "py_db_array.h"
 #include "py_db_op.h"
 
 namespace python_interface {
@@ -47,6 +48,15 @@ void register_idb_op(pybind11::module& m)
   m.def("create_inst", idbCreateInstance, py::arg("inst_name"), py::arg("cell_master"), py::arg("coord_x") = 0, py::arg("coord_y") = 0,
         py::arg("orient") = "", py::arg("type") = "", py::arg("status") = "");
   m.def("create_net", idbCreateNet, py::arg("net_name"), py::arg("conn_type") = "");
+
+  // numpy arrays for placement data
+  m.def("get_inst_names", idbGetInstNames);
+  m.def("get_inst_coords", idbGetInstCoords);
+  m.def("get_inst_sizes", idbGetInstSizes);
+  m.def("get_inst_fixed", idbGetInstFixed);
+  m.def("get_net_names", idbGetNetNames);
+  m.def("get_net_pin_csr", idbGetNetPinCsr);
+  m.def("set_inst_coords", idbSetInstCoords, py::arg("coords"), py::arg("skip_fixed") = true);
 }
 
 }  // namespace python_interface
\ No newline at end of file
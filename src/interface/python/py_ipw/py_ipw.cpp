@@ -29,6 +29,19 @@ bool readRustVCD(const char* vcd_path, const char* top_instance_name) {
   return ipower->readRustVCD(vcd_path, top_instance_name);
 }
 
+bool readVCDStream(const char* vcd_path, const char* top_instance_name,
+                   std::vector<std::pair<int64_t, int64_t>> time_windows) {
+  ista::Sta* ista = ista::Sta::getOrCreateSta();
+  ipower::Power* ipower = ipower::Power::getOrCreatePower(&(ista->get_graph()));
+
+  std::vector<ipower::VcdTimeWindow> vcd_time_windows;
+  for (auto [begin_time, end_time] : time_windows) {
+    vcd_time_windows.emplace_back(ipower::VcdTimeWindow{begin_time, end_time});
+  }
+  return ipower->readVCDStream(vcd_path, top_instance_name,
+                               std::move(vcd_time_windows));
+}
+
 unsigned reportPower() {
   Sta* ista = Sta::getOrCreateSta();
   ipower::Power* ipower = ipower::Power::getOrCreatePower(&(ista->get_graph()));
@@ -38,6 +51,13 @@ unsigned reportPower() {
   return 1;
 }
 
+unsigned reportTimeWindowPower(const char* rpt_file_name) {
+  Sta* ista = Sta::getOrCreateSta();
+  ipower::Power* ipower = ipower::Power::getOrCreatePower(&(ista->get_graph()));
+
+  return ipower->reportTimeWindowPower(rpt_file_name);
+}
+
 unsigned create_data_flow() {
   auto* power_engine = ipower::PowerEngine::getOrCreatePowerEngine();
   return power_engine->creatDataflow();
@@ -19,12 +19,17 @@
 #include <map>
 #include <set>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "api/PowerEngine.hh"
 
 namespace python_interface {
 bool readRustVCD(const char* vcd_path, const char* top_instance_name);
+bool readVCDStream(const char* vcd_path, const char* top_instance_name,
+                   std::vector<std::pair<int64_t, int64_t>> time_windows);
 unsigned reportPower();
+unsigned reportTimeWindowPower(const char* rpt_file_name);
 
 // for dataflow.
 unsigned create_data_flow();
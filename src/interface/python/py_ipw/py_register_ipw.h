@@ -29,7 +29,10 @@ namespace python_interface {
 void register_ipw(py::module& m)
 {
   m.def("read_vcd_cpp", &readRustVCD, py::arg("file_name"), py::arg("top_name"));
+  m.def("read_vcd_stream_cpp", &readVCDStream, py::arg("file_name"), py::arg("top_name"),
+        py::arg("time_windows") = std::vector<std::pair<int64_t, int64_t>>{});
   m.def("report_power_cpp", &reportPower);
+  m.def("report_time_window_power_cpp", &reportTimeWindowPower, py::arg("file_name"));
 
   // for dataflow.
   m.def("create_data_flow", &create_data_flow);
@@ -18,9 +18,12 @@
 
 #include <tool_manager.h>
 
+#include <limits>
+
 #include "api/TimingEngine.hh"
 #include "api/TimingIDBAdapter.hh"
 #include "log/Log.hh"
+#include "py_numpy.h"
 #include "sta/Sta.hh"
 
 namespace python_interface {
@@ -123,6 +126,57 @@ std::vector<std::string> get_used_libs()
   return ret;
 }
 
+std::vector<std::string> get_timing_pin_names()
+{
+  auto* ista = ista::Sta::getOrCreateSta();
+  auto& vertexes = ista->get_graph().get_vertexes();
+
+  std::vector<std::string> pin_names;
+  pin_names.reserve(vertexes.size());
+  for (auto& vertex : vertexes) {
+    pin_names.push_back(vertex->getName());
+  }
+  return pin_names;
+}
+
+pybind11::dict get_timing_pin_arrays()
+{
+  auto* ista = ista::Sta::getOrCreateSta();
+  auto& vertexes = ista->get_graph().get_vertexes();
+
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  std::vector<double> setup_slack(vertexes.size(), nan);
+  std::vector<double> hold_slack(vertexes.size(), nan);
+  std::vector<double> max_slew(vertexes.size(), nan);
+  std::vector<double> max_arrive_time(vertexes.size(), nan);
+  for (size_t i = 0; i < vertexes.size(); ++i) {
+    auto& vertex = vertexes[i];
+    if (auto slack = vertex->getWorstSlackNs(ista::AnalysisMode::kMax)) {
+      setup_slack[i] = *slack;
+    }
+    if (auto slack = vertex->getWorstSlackNs(ista::AnalysisMode::kMin)) {
+      hold_slack[i] = *slack;
+    }
+    if (auto slew = vertex->getWorstSlewNs(ista::AnalysisMode::kMax)) {
+      max_slew[i] = *slew;
+    }
+    auto rise_arrive_time = vertex->getArriveTimeNs(ista::AnalysisMode::kMax, ista::TransType::kRise);
+    auto fall_arrive_time = vertex->getArriveTimeNs(ista::AnalysisMode::kMax, ista::TransType::kFall);
+    if (rise_arrive_time && fall_arrive_time) {
+      max_arrive_time[i] = std::max(*rise_arrive_time, *fall_arrive_time);
+    } else if (rise_arrive_time || fall_arrive_time) {
+      max_arrive_time[i] = rise_arrive_time ? *rise_arrive_time : *fall_arrive_time;
+    }
+  }
+
+  pybind11::dict pin_arrays;
+  pin_arrays["setup_slack"] = moveToNumpy(std::move(setup_slack));
+  pin_arrays["hold_slack"] = moveToNumpy(std::move(hold_slack));
+  pin_arrays["max_slew"] = moveToNumpy(std::move(max_slew));
+  pin_arrays["max_arrive_time"] = moveToNumpy(std::move(max_arrive_time));
+  return pin_arrays;
+}
+
 bool initLog(std::string log_dir)
 {
   char config[] = "test";
@@ -16,6 +16,9 @@
 // ***************************************************************************************
 #pragma once
 
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
 #include <set>
 #include <string>
 #include <vector>
@@ -44,4 +47,8 @@ bool reportTiming(int digits, const std::string& delay_type, std::set<std::strin
 
 std::vector<std::string> get_used_libs();
 
+// per pin timing as numpy arrays, ordered as the timing graph vertexes
+std::vector<std::string> get_timing_pin_names();
+pybind11::dict get_timing_pin_arrays();
+
 }  // namespace python_interface
\ No newline at end of file
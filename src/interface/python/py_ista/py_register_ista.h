@@ -39,5 +39,7 @@ void register_ista(py::module& m)
   m.def("report_timing", reportTiming, py::arg("digits"), py::arg("delay_type"), py::arg("exclude_cell_names"), py::arg("derate"));
 
   m.def("get_used_libs", get_used_libs);
+  m.def("get_timing_pin_names", get_timing_pin_names);
+  m.def("get_timing_pin_arrays", get_timing_pin_arrays);
 }
 }  // namespace python_interface
\ No newline at end of file
@@ -0,0 +1,45 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+#pragma once
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+#include <utility>
+#include <vector>
+
+namespace python_interface {
+namespace py = pybind11;
+
+/**
+ * @brief hand a C++ buffer to numpy without copying, the array owns the vector through a capsule.
+ */
+template <typename T>
+py::array_t<T> moveToNumpy(std::vector<T>&& data, std::vector<py::ssize_t> shape)
+{
+  auto* buffer = new std::vector<T>(std::move(data));
+  py::capsule owner(buffer, [](void* ptr) { delete reinterpret_cast<std::vector<T>*>(ptr); });
+  return py::array_t<T>(shape, buffer->data(), owner);
+}
+
+template <typename T>
+py::array_t<T> moveToNumpy(std::vector<T>&& data)
+{
+  py::ssize_t size = static_cast<py::ssize_t>(data.size());
+  return moveToNumpy(std::move(data), {size});
+}
+
+}  // namespace python_interface
@@ -0,0 +1,191 @@
+#!/bin/python3
+# ***************************************************************************************
+# Copyright (c) 2023-2025 Peng Cheng Laboratory
+# Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+# Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+#
+# iEDA is licensed under Mulan PSL v2.
+# You can use this software according to the terms and conditions of the Mulan PSL v2.
+# You may obtain a copy of Mulan PSL v2 at:
+# http://license.coscl.org.cn/MulanPSL2
+#
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+# EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+# MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+#
+# See the Mulan PSL v2 for more details.
+# ***************************************************************************************
+# check the numpy arrays of the python api against the list getters and the design they are read from.
+# run with ieda_py on PYTHONPATH, e.g. PYTHONPATH=<iEDA>/bin python3 test_numpy_arrays.py
+import os
+import tempfile
+import unittest
+
+import numpy as np
+
+import ieda_py as ieda
+
+repo_dir = os.path.abspath(os.path.join(os.path.dirname(__file__), '../../../..'))
+lef_dir = f'{repo_dir}/scripts/foundry/sky130/lef'
+
+# a 15 x 10 grid of 2720 (one row height), the cells are 1380 x 2720
+test_def = '''VERSION 5.8 ;
+DIVIDERCHAR "/" ;
+BUSBITCHARS "[]" ;
+DESIGN numpy_test ;
+UNITS DISTANCE MICRONS 1000 ;
+DIEAREA ( 0 0 ) ( 40800 27200 ) ;
+ROW ROW_0 unithd 0 0 N DO 88 BY 1 STEP 460 0 ;
+ROW ROW_1 unithd 0 2720 FS DO 88 BY 1 STEP 460 0 ;
+COMPONENTS 5 ;
+- u0 sky130_fd_sc_hd__inv_1 + PLACED ( 1380 0 ) N ;
+- u1 sky130_fd_sc_hd__inv_1 + FIXED ( 4600 0 ) N ;
+- u2 sky130_fd_sc_hd__inv_1 + PLACED ( 1380 2720 ) FS ;
+- u3 sky130_fd_sc_hd__nand2_1 + PLACED ( 2000 2720 ) FS ;
+- u4 sky130_fd_sc_hd__buf_1 + PLACED ( 13800 0 ) N ;
+END COMPONENTS
+PINS 1 ;
+- in + NET in + DIRECTION INPUT + USE SIGNAL
+  + LAYER met2 ( -140 -140 ) ( 140 140 )
+  + PLACED ( 1000 27060 ) N ;
+END PINS
+NETS 3 ;
+- in ( PIN in ) ( u0 A ) ;
+- n1 ( u0 Y ) ( u3 A ) ( u2 A ) ;
+- n2 ( u3 Y ) ( u4 A ) ;
+END NETS
+END DESIGN
+'''
+
+expect_insts = {
+    'u0': ((1380, 0), False),
+    'u1': ((4600, 0), True),
+    'u2': ((1380, 2720), False),
+    'u3': ((2000, 2720), False),
+    'u4': ((13800, 0), False),
+}
+expect_nets = {'in': ['u0'], 'n1': ['u0', 'u3', 'u2'], 'n2': ['u3', 'u4']}
+cell_size = (1380, 2720)
+grid_size = 2720
+
+
+class NumpyArrayTest(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        with tempfile.NamedTemporaryFile('w', suffix='.def', delete=False) as def_file:
+            def_file.write(test_def)
+        ieda.tech_lef_init(f'{lef_dir}/sky130_fd_sc_hd.tlef')
+        ieda.lef_init([f'{lef_dir}/sky130_fd_sc_hd_merged.lef'])
+        assert ieda.def_init(def_file.name)
+        os.remove(def_file.name)
+
+    def test_inst_arrays(self):
+        names = ieda.get_inst_names()
+        coords = ieda.get_inst_coords()
+        sizes = ieda.get_inst_sizes()
+        fixed = ieda.get_inst_fixed()
+
+        self.assertEqual(sorted(names), sorted(expect_insts))
+        self.assertEqual(coords.shape, (len(names), 2))
+        self.assertEqual(sizes.shape, (len(names), 2))
+        self.assertEqual(fixed.shape, (len(names), ))
+        self.assertEqual(coords.dtype, np.int32)
+        self.assertEqual(fixed.dtype, np.bool_)
+        for i, name in enumerate(names):
+            coord, is_fixed = expect_insts[name]
+            self.assertEqual(tuple(coords[i]), coord)
+            self.assertEqual(tuple(sizes[i]), cell_size)
+            self.assertEqual(bool(fixed[i]), is_fixed)
+
+    def test_net_pin_csr(self):
+        inst_names = ieda.get_inst_names()
+        net_names = ieda.get_net_names()
+        csr = ieda.get_net_pin_csr()
+        offsets = csr['offsets']
+        pin_inst = csr['pin_inst']
+        pin_coords = csr['pin_coords']
+
+        self.assertEqual(sorted(net_names), sorted(expect_nets))
+        self.assertEqual(offsets.shape, (len(net_names) + 1, ))
+        self.assertEqual(offsets[0], 0)
+        self.assertEqual(offsets[-1], len(pin_inst))
+        self.assertEqual(pin_coords.shape, (len(pin_inst), 2))
+
+        coords = ieda.get_inst_coords()
+        for i, net_name in enumerate(net_names):
+            net_pin_inst = pin_inst[offsets[i]:offsets[i + 1]]
+            # the io pin has no instance
+            expect_pin_num = len(expect_nets[net_name]) + (1 if net_name == 'in' else 0)
+            self.assertEqual(len(net_pin_inst), expect_pin_num)
+            self.assertEqual(sorted(inst_names[j] for j in net_pin_inst if j >= 0), sorted(expect_nets[net_name]))
+            for pin_index in range(offsets[i], offsets[i + 1]):
+                inst_index = pin_inst[pin_index]
+                if inst_index < 0:
+                    continue
+                x, y = pin_coords[pin_index]
+                lx, ly = coords[inst_index]
+                self.assertTrue(lx <= x <= lx + cell_size[0] and ly <= y <= ly + cell_size[1])
+
+    def test_set_inst_coords(self):
+        names = ieda.get_inst_names()
+        coords = ieda.get_inst_coords()
+        moved = coords.copy()
+        moved[:, 0] += 460
+
+        # the fixed instance is skipped
+        self.assertEqual(ieda.set_inst_coords(moved), len(names) - 1)
+        fixed = ieda.get_inst_fixed()
+        new_coords = ieda.get_inst_coords()
+        np.testing.assert_array_equal(new_coords[~fixed], moved[~fixed])
+        np.testing.assert_array_equal(new_coords[fixed], coords[fixed])
+
+        with self.assertRaises(ValueError):
+            ieda.set_inst_coords(np.zeros((len(names) + 1, 2), dtype=np.int32))
+
+        self.assertEqual(ieda.set_inst_coords(coords), len(names) - 1)
+        np.testing.assert_array_equal(ieda.get_inst_coords(), coords)
+
+    def test_cell_density_map(self):
+        density_map = ieda.eval_density_map(grid_size=1, map_type='cell', obj_type='all')
+        self.assertEqual(density_map.shape, (10, 15))
+
+        # the overlap of each cell and grid, divided by the grid area
+        expect_map = np.zeros((10, 15))
+        for lx, ly in ieda.get_inst_coords():
+            ux, uy = lx + cell_size[0], ly + cell_size[1]
+            for row in range(10):
+                for col in range(15):
+                    overlap_w = min(ux, (col + 1) * grid_size) - max(lx, col * grid_size)
+                    overlap_h = min(uy, (row + 1) * grid_size) - max(ly, row * grid_size)
+                    if overlap_w > 0 and overlap_h > 0:
+                        expect_map[row, col] += overlap_w * overlap_h / (grid_size * grid_size)
+        np.testing.assert_allclose(density_map, expect_map, atol=1e-9)
+
+    def test_pin_density_map(self):
+        pin_map = ieda.eval_density_map(grid_size=1, map_type='pin', obj_type='all')
+        self.assertEqual(pin_map.shape, (10, 15))
+        net_map = ieda.eval_density_map(grid_size=2, map_type='net', obj_type='all')
+        self.assertEqual(net_map.shape, (5, 8))
+
+    def test_unknown_map_type(self):
+        with self.assertRaises(ValueError):
+            ieda.eval_density_map(map_type='macro')
+        with self.assertRaises(ValueError):
+            ieda.eval_density_map(map_type='cell', obj_type='local')
+        with self.assertRaises(ValueError):
+            ieda.eval_density_map(map_type='net', obj_type='stdcell')
+        with self.assertRaises(ValueError):
+            ieda.eval_rudy_map(rudy_type='diagonal')
+
+    def test_timing_pin_arrays(self):
+        # no design is linked to sta here, the arrays follow the pin names list
+        pin_names = ieda.get_timing_pin_names()
+        pin_arrays = ieda.get_timing_pin_arrays()
+        for key in ['setup_slack', 'hold_slack', 'max_slew', 'max_arrive_time']:
+            self.assertEqual(pin_arrays[key].shape, (len(pin_names), ))
+            self.assertEqual(pin_arrays[key].dtype, np.float64)
+
+
+if __name__ == '__main__':
+    unittest.main()
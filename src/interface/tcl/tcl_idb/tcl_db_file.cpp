@@ -325,6 +325,9 @@ CmdSaveGDS::CmdSaveGDS(const char* cmd_name) : TclCmd(cmd_name)
 
   auto* path = new TclStringOption(TCL_PATH, 1);
   addOption(path);
+
+  auto* stream = new TclSwitchOption("-stream");
+  addOption(stream);
 }
 
 unsigned CmdSaveGDS::check()
@@ -346,7 +349,8 @@ unsigned CmdSaveGDS::exec()
   TclOption* def_path = getOptionOrArg(TCL_PATH);
   auto str_path = def_path->getStringVal();
   if (str_path != nullptr) {
-    dmInst->saveGDSII(str_path);
+    TclOption* stream_option = getOptionOrArg("-stream");
+    dmInst->saveGDSII(str_path, stream_option->is_set_val());
     return 1;
   }
   return 1;
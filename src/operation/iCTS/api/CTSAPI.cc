@@ -348,6 +348,8 @@ double CTSAPI::getSinkCap(const std::string& load_pin_full_name) const
   // remove all "\" in inst_name
   auto name = load_pin_full_name;
   name.erase(std::remove(name.begin(), name.end(), '\\'), name.end());
+  // the timing engine is shared by the concurrent solvers
+  std::lock_guard<std::mutex> lock(_timing_mutex);
   return _timing_engine->getInstPinCapacitance(name.c_str());
 }
 
@@ -552,6 +554,8 @@ std::vector<double> CTSAPI::queryCellLibValue(const std::string& cell_master, co
 icts::CtsCellLib* CTSAPI::getCellLib(const std::string& cell_master, const std::string& from_port, const std::string& to_port,
                                      const bool& use_work_value)
 {
+  // the lib cache is shared by the concurrent solvers
+  std::lock_guard<std::mutex> lock(_lib_mutex);
   CtsCellLib* lib = _libs->findLib(cell_master);
   if (lib) {
     return lib;
@@ -661,16 +665,19 @@ double CTSAPI::getClockAT(const std::string& pin_name, const std::string& belong
 
 std::string CTSAPI::getCellType(const std::string& cell_master) const
 {
+  std::lock_guard<std::mutex> lock(_timing_mutex);
   return _timing_engine->getCellType(cell_master.c_str());
 }
 
 double CTSAPI::getCellArea(const std::string& cell_master) const
 {
+  std::lock_guard<std::mutex> lock(_timing_mutex);
   return _timing_engine->getCellArea(cell_master.c_str());
 }
 
 double CTSAPI::getCellCap(const std::string& cell_master) const
 {
+  std::lock_guard<std::mutex> lock(_timing_mutex);
   auto input_pin_names = _timing_engine->getLibertyCellInputpin(cell_master.c_str());
   auto cell_pin_name = CTSAPIInst.toString(cell_master.c_str(), ":", input_pin_names[0].c_str());
   auto init_cap = _timing_engine->getLibertyCellPinCapacitance(cell_pin_name.c_str());
@@ -679,11 +686,13 @@ double CTSAPI::getCellCap(const std::string& cell_master) const
 
 double CTSAPI::getSlewIn(const std::string& pin_name) const
 {
+  std::lock_guard<std::mutex> lock(_timing_mutex);
   return _timing_engine->getSlew(pin_name.c_str(), ista::AnalysisMode::kMin, ista::TransType::kRise);
 }
 
 double CTSAPI::getCapOut(const std::string& pin_name) const
 {
+  std::lock_guard<std::mutex> lock(_timing_mutex);
   return _timing_engine->getInstPinCapacitance(pin_name.c_str(), ista::AnalysisMode::kMin, ista::TransType::kRise);
 }
 
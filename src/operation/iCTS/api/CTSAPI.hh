@@ -24,6 +24,7 @@
 #include <cassert>
 #include <fstream>
 #include <map>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -163,6 +164,7 @@ class CTSAPI
   template <typename... Args>
   void saveToLog(const Args&... args)
   {
+    std::lock_guard<std::mutex> lock(_log_mutex);
     (*_log_ofs) << toString(args...) << std::endl;
   }
 
@@ -218,6 +220,9 @@ class CTSAPI
   icts::CtsReportTable* _report = nullptr;
   std::ofstream* _log_ofs = nullptr;
   icts::CtsLibs* _libs = nullptr;
+  std::mutex _lib_mutex;
+  std::mutex _log_mutex;
+  mutable std::mutex _timing_mutex;  //!< guard the timing engine queries of the concurrent solvers
   icts::Evaluator* _evaluator = nullptr;
   icts::ModelFactory* _model_factory = nullptr;
   ista::TimingEngine* _timing_engine = nullptr;
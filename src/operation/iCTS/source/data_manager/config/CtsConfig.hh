@@ -81,6 +81,7 @@ class CtsConfig
   bool is_root_buffer_required() const { return _root_buffer_required; }
   bool is_inherit_root() const { return _inherit_root; }
   bool is_break_long_wire() const { return _break_long_wire; }
+  int get_num_threads() const { return _num_threads; }
   // level constraint
   std::vector<double> get_level_max_length() const { return _level_max_length; }
   std::vector<int> get_level_max_fanout() const { return _level_max_fanout; }
@@ -123,6 +124,7 @@ class CtsConfig
   void set_root_buffer_required(const bool& required) { _root_buffer_required = required; }
   void set_inherit_root(const bool& inherit_root) { _inherit_root = inherit_root; }
   void set_break_long_wire(const bool& break_long_wire) { _break_long_wire = break_long_wire; }
+  void set_num_threads(const int& num_threads) { _num_threads = num_threads; }
   // level constraint
   void set_level_max_length(const std::vector<double>& level_max_length) { _level_max_length = level_max_length; }
   void set_level_max_fanout(const std::vector<int>& level_max_fanout) { _level_max_fanout = level_max_fanout; }
@@ -236,6 +238,7 @@ class CtsConfig
   bool _root_buffer_required = false;
   bool _inherit_root = false;
   bool _break_long_wire = false;
+  int _num_threads = 1;
   // level constraint
   std::vector<double> _level_max_length;
   std::vector<int> _level_max_fanout;
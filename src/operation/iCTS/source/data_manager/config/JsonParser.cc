@@ -139,6 +139,10 @@ void JsonParser::parse(const string& json_file, CtsConfig* config) const
         config->set_break_long_wire(false);
       }
     }
+    if (COMUtil::getData(json, {"num_threads"}) != nullptr) {
+      int num_threads = COMUtil::getData(json, {"num_threads"});
+      config->set_num_threads(num_threads);
+    }
     if (COMUtil::getData(json, {"level_max_length"}) != nullptr) {
       std::vector<std::string> level_max_length = COMUtil::getData(json, {"level_max_length"});
       std::vector<double> level_max_length_double;
@@ -20,9 +20,12 @@
  */
 #include "Router.hh"
 
+#include <climits>
+
 #include "CTSAPI.hh"
 #include "CtsDBWrapper.hh"
 #include "Solver.hh"
+#include "ThreadPool/ThreadPool.h"
 #include "TimingPropagator.hh"
 #include "usage/usage.hh"
 namespace icts {
@@ -56,22 +59,43 @@ void Router::build()
 {
   ieda::Stats stats;
   CTSAPIInst.saveToLog("--Clock Net Info--");
+  std::vector<CtsNet*> clk_nets;
   for (auto* clock : _clocks) {
-    auto* design = CTSAPIInst.get_design();
     auto& clock_nets = clock->get_clock_nets();
     for (auto* clk_net : clock_nets) {
       CTSAPIInst.saveToLog("Net name: ", clk_net->get_net_name());
       LOG_INFO << "Net name: " << clk_net->get_net_name();
-      design->resetId();
       auto sink_pins = getSinkPins(clk_net);
       auto buf_pins = getBufferPins(clk_net);
       CTSAPIInst.saveToLog("\tSink pins num: ", sink_pins.size());
       LOG_INFO << "\tSink pins num: " << sink_pins.size();
       CTSAPIInst.saveToLog("\tBuffer pins num: ", buf_pins.size());
       LOG_INFO << "\tBuffer pins num: " << buf_pins.size();
-      routing(clk_net);
-      clk_net->setClockRouted();
+      clk_nets.push_back(clk_net);
+    }
+  }
+  // clock nets are independent, synthesize them concurrently and split the rest threads to the levels of each net
+  size_t num_threads = std::max(1, CTSAPIInst.get_config()->get_num_threads());
+  size_t net_threads = std::clamp(clk_nets.size(), static_cast<size_t>(1), num_threads);
+  auto level_threads = static_cast<uint8_t>(std::min(num_threads / net_threads, static_cast<size_t>(UINT8_MAX)));
+  std::vector<std::vector<Net*>> net_results(clk_nets.size());
+  {
+    ThreadPool pool(net_threads);
+    std::vector<std::future<void>> results;
+    for (size_t i = 0; i < clk_nets.size(); ++i) {
+      results.emplace_back(pool.enqueue([&, i] { net_results[i] = routing(clk_nets[i], level_threads); }));
     }
+    for (auto&& result : results) {
+      result.get();
+    }
+  }
+  // merge in the net order, keep the result same as the serial flow
+  for (size_t i = 0; i < clk_nets.size(); ++i) {
+    std::ranges::for_each(net_results[i], [&](Net* net) {
+      _solver_set.add_net(net);
+      std::ranges::for_each(net->get_pins(), [&](Pin* pin) { _solver_set.add_pin(pin); });
+    });
+    clk_nets[i]->setClockRouted();
   }
   CTSAPIInst.saveToLog("");
 }
@@ -100,26 +124,19 @@ void Router::printLog()
   LOG_INFO << "Enter router!";
 }
 
-void Router::routing(CtsNet* clk_net)
+std::vector<Net*> Router::routing(CtsNet* clk_net, const uint8_t& max_thread)
 {
   auto pins = clk_net->get_load_pins();
   if (pins.empty()) {
     LOG_WARNING << "Net: " << clk_net->get_net_name() << " is empty!";
-    return;
+    return {};
   }
   auto net_name = clk_net->get_net_name();
   // total topology
   auto solver = Solver(net_name, clk_net->get_driver_pin(), pins);
-  solver.set_max_thread(1);
+  solver.set_max_thread(max_thread);
   solver.run();
-  auto clk_nets = solver.get_solver_nets();
-  if (clk_nets.empty()) {
-    return;
-  }
-  std::ranges::for_each(clk_nets, [&](Net* net) {
-    _solver_set.add_net(net);
-    std::ranges::for_each(net->get_pins(), [&](Pin* pin) { _solver_set.add_pin(pin); });
-  });
+  return solver.get_solver_nets();
 }
 
 std::vector<CtsPin*> Router::getSinkPins(CtsNet* clk_net)
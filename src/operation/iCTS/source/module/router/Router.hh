@@ -89,10 +89,12 @@ class Router
   void init();
   void build();
   void update();
+  // get
+  SolverSet& get_solver_set() { return _solver_set; }
 
  private:
   void printLog();
-  void routing(CtsNet* clk_net);
+  std::vector<Net*> routing(CtsNet* clk_net, const uint8_t& max_thread);
   std::vector<CtsPin*> getSinkPins(CtsNet* clk_net);
   std::vector<CtsPin*> getBufferPins(CtsNet* clk_net);
 
@@ -131,22 +131,28 @@ namespace icts {
   {
     auto skew_bound = assign.skew_bound;
     std::vector<Inst*> level_insts;
-    if (_max_thread > 1) {
-      ThreadPool pool(_max_thread);
+    if (_max_thread > 1 && clusters.size() > 1) {
+      // reserve net names in cluster order, the result is independent of the thread schedule
+      std::vector<std::string> net_names;
+      net_names.reserve(clusters.size());
+      for (size_t i = 0; i < clusters.size(); ++i) {
+        net_names.push_back(CTSAPIInst.toString(_net_name, "_", genId()));
+      }
+      ThreadPool pool(std::min(static_cast<size_t>(_max_thread), clusters.size()));
       std::vector<std::future<Inst*>> results;
       for (size_t i = 0; i < clusters.size(); ++i) {
-        auto cluster = clusters[i];
-        auto guide_center = guide_locs[i];
-        results.emplace_back(pool.enqueue([&] {
+        results.emplace_back(pool.enqueue([this, &clusters, &guide_locs, &net_names, &assign, skew_bound, i] {
+          auto cluster = clusters[i];
           if (_level > _latency_opt_level) {
             BalanceClustering::latencyOpt(cluster, skew_bound, _local_latency_opt_ratio);
           }
-          auto* buf = netAssign(cluster, assign, guide_center, _level > _shift_level);
-          return buf;
+          return netAssign(net_names[i], cluster, assign, guide_locs[i], _level > _shift_level);
           }));
       }
       for (auto&& result : results) {
-        level_insts.push_back(result.get());
+        auto* buf = result.get();
+        level_insts.push_back(buf);
+        _nets.push_back(buf->get_driver_pin()->get_net());
       }
       return level_insts;
     }
@@ -232,7 +238,7 @@ namespace icts {
       BalanceClustering::latencyOpt(insts, skew_bound, _global_latency_opt_ratio);
     }
 
-    auto clusters = BalanceClustering::iterClustering(target_insts, max_fanout, 5, 5, cluster_ratio);
+    auto clusters = BalanceClustering::iterClustering(target_insts, max_fanout, 5, 5, cluster_ratio, false, _max_thread);
     // auto enhanced_clusters = clusters;
     auto enhanced_clusters = BalanceClustering::slackClustering(clusters, max_net_len, max_fanout);
     if (enhanced_clusters.size() < insts.size()) {
@@ -291,7 +297,7 @@ namespace icts {
       auto center_dist = TimingPropagator::calcDist(loc, center);
       auto shift_dist = std::min(max_dist / 2, center_dist);
       auto new_loc = (center - loc) * (1.0 * shift_dist / center_dist) + loc;
-      auto net_name = CTSAPIInst.toString(_net_name, "_", CTSAPIInst.genId());
+      auto net_name = CTSAPIInst.toString(_net_name, "_", genId());
       auto* buffer = TreeBuilder::genBufInst(net_name, new_loc);
       buffer->set_cell_master(TimingPropagator::getMinSizeCell());
       auto* load_pin = min_delay_inst->get_load_pin();
@@ -307,6 +313,14 @@ namespace icts {
     return sorted_insts;
   }
   Inst* Solver::netAssign(const std::vector<Inst*>& insts, const Assign& assign, const Point& guide_center, const bool& shift)
+  {
+    auto net_name = CTSAPIInst.toString(_net_name, "_", genId());
+    auto* buffer = netAssign(net_name, insts, assign, guide_center, shift);
+    _nets.push_back(buffer->get_driver_pin()->get_net());
+    return buffer;
+  }
+  Inst* Solver::netAssign(const std::string& net_name, const std::vector<Inst*>& insts, const Assign& assign, const Point& guide_center,
+    const bool& shift)
   {
     auto max_net_len = assign.max_net_len;
     auto skew_bound = assign.skew_bound;
@@ -324,7 +338,6 @@ namespace icts {
       auto shift_dist = std::min(max_dist - net_dist, allow_center_dist);
       guide_loc = center_dist > 0 ? (guide_center - center) * (1.0 * shift_dist / center_dist) + center : center;
     }
-    auto net_name = CTSAPIInst.toString(_net_name, "_", CTSAPIInst.genId());
     std::vector<Pin*> cluster_load_pins;
     std::ranges::for_each(insts, [&cluster_load_pins](Inst* inst) {
       auto load_pin = inst->get_load_pin();
@@ -342,7 +355,6 @@ namespace icts {
       TreeBuilder::directConnectTree(driver_pin, load_pin);
       auto* net = TimingPropagator::genNet(net_name, driver_pin, cluster_load_pins);
       TimingPropagator::update(net);
-      _nets.push_back(net);
       return buffer;
     }
 
@@ -356,7 +368,6 @@ namespace icts {
     // TreeBuilder::iterativeFixSkew(cbs_net, skew_bound, guide_loc); // TBD for testing
     // TreeBuilder::iterativeFixSkew(cbs_net, skew_bound, guide_loc);
     TimingPropagator::update(cbs_net);
-    _nets.push_back(cbs_net);
     return buffer;
     // }
 
@@ -448,7 +459,7 @@ namespace icts {
       auto load_pin = inst->get_load_pin();
       cluster_load_pins.push_back(load_pin);
       });
-    auto net_name = CTSAPIInst.toString(_net_name, "_", CTSAPIInst.genId());
+    auto net_name = CTSAPIInst.toString(_net_name, "_", genId());
     std::ranges::for_each(loc_list, [&](const Point& loc) {
       for (size_t i = 0; i < lib_list.size(); ++i) {
         auto* lib = lib_list[i];
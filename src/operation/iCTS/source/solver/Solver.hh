@@ -67,12 +67,16 @@ class Solver
   std::vector<Inst*> assignApply(const std::vector<Inst*>& insts, const Assign& assign);
   std::vector<Inst*> topGuide(const std::vector<Inst*>& insts, const Assign& assign);
   Inst* netAssign(const std::vector<Inst*>& insts, const Assign& assign, const Point& guide_center, const bool& shift = true);
+  Inst* netAssign(const std::string& net_name, const std::vector<Inst*>& insts, const Assign& assign, const Point& guide_center,
+                  const bool& shift = true);
   Net* saltOpt(const std::vector<Inst*>& insts, const Assign& assign);
   void higherDelayOpt(std::vector<std::vector<Inst*>>& clusters, std::vector<Point>& guide_centers, std::vector<Inst*>& level_insts) const;
   // report
   void writeNetPy(Pin* root, const std::string& save_name = "net") const;
   void levelReport() const;
   void pinCapDistReport(const std::vector<Inst*>& insts) const;
+  // id, local to the solver so that concurrent solvers don't share a counter
+  int genId() { return _id++; }
   // member
   std::string _net_name;
   CtsPin* _cts_driver;
@@ -83,6 +87,7 @@ class Solver
   Pin* _driver = nullptr;
   std::vector<Net*> _nets;
   int _level = 1;
+  int _id = 0;
   uint8_t _max_thread = 1;
   // config
   bool _root_buffer_required = true;
@@ -21,19 +21,114 @@
 #include "BalanceClustering.hh"
 
 #include <algorithm>
+#include <cmath>
 #include <filesystem>
+#include <future>
 #include <limits>
+#include <memory>
 #include <random>
 #include <ranges>
 
 #include "CTSAPI.hh"
+#include "CenterGrid.hh"
 #include "CtsConfig.hh"
+#include "ThreadPool/ThreadPool.h"
 #include "TimingPropagator.hh"
 #include "TreeBuilder.hh"
 #include "anneal_opt/AnnealOpt.hh"
 #include "log/Log.hh"
 #include "min_cost_flow/MinCostFlow.hh"
 namespace icts {
+namespace {
+// the insts less than it are clustered in the calling thread
+constexpr size_t kParallelMinNum = 4096;
+/**
+ * @brief the thread pool for the clustering, nullptr means clustering in the calling thread
+ *       the pool shared by the caller is used if it is given, otherwise the pool is made and owned by own_pool
+ *
+ * @param shared_pool
+ * @param num_threads
+ * @param num
+ * @param own_pool
+ * @return ThreadPool*
+ */
+ThreadPool* makePool(ThreadPool* shared_pool, const size_t& num_threads, const size_t& num, std::unique_ptr<ThreadPool>& own_pool)
+{
+  if (num_threads <= 1 || num < kParallelMinNum) {
+    return nullptr;
+  }
+  if (shared_pool != nullptr) {
+    return shared_pool;
+  }
+  own_pool = std::make_unique<ThreadPool>(num_threads);
+  return own_pool.get();
+}
+/**
+ * @brief run func(begin, end) on the chunks of [0, num), each chunk writes its own range so the result is independent of the schedule
+ *
+ * @param pool
+ * @param num_threads
+ * @param num
+ * @param func
+ */
+template <typename Func>
+void parallelFor(ThreadPool* pool, const size_t& num_threads, const size_t& num, const Func& func)
+{
+  if (pool == nullptr) {
+    func(0, num);
+    return;
+  }
+  size_t chunk_size = (num + num_threads * 4 - 1) / (num_threads * 4);
+  std::vector<std::future<void>> results;
+  for (size_t begin = 0; begin < num; begin += chunk_size) {
+    auto end = std::min(num, begin + chunk_size);
+    results.emplace_back(pool->enqueue([&func, begin, end] { func(begin, end); }));
+  }
+  for (auto&& result : results) {
+    result.get();
+  }
+}
+/**
+ * @brief bounding box of the locations
+ *
+ * @param locs
+ * @return std::pair<Point, Point>
+ */
+std::pair<Point, Point> calcBound(const std::vector<Point>& locs)
+{
+  Point lower(std::numeric_limits<int>::max(), std::numeric_limits<int>::max());
+  Point upper(std::numeric_limits<int>::min(), std::numeric_limits<int>::min());
+  std::ranges::for_each(locs, [&lower, &upper](const Point& loc) {
+    lower = Point(std::min(lower.x(), loc.x()), std::min(lower.y(), loc.y()));
+    upper = Point(std::max(upper.x(), loc.x()), std::max(upper.y(), loc.y()));
+  });
+  return {lower, upper};
+}
+/**
+ * @brief assign each location to the nearest center
+ *
+ * @param locs
+ * @param centers
+ * @param pool
+ * @param num_threads
+ * @param assignments
+ */
+void assignCenters(const std::vector<Point>& locs, const std::vector<Point>& centers, ThreadPool* pool, const size_t& num_threads,
+                   std::vector<int>& assignments)
+{
+  // the centers may move out of the locations bound, e.g. the random center
+  auto [lower, upper] = calcBound(centers);
+  auto [loc_lower, loc_upper] = calcBound(locs);
+  lower = Point(std::min(lower.x(), loc_lower.x()), std::min(lower.y(), loc_lower.y()));
+  upper = Point(std::max(upper.x(), loc_upper.x()), std::max(upper.y(), loc_upper.y()));
+  CenterGrid grid(centers, lower, upper);
+  parallelFor(pool, num_threads, locs.size(), [&](const size_t& begin, const size_t& end) {
+    for (size_t i = begin; i < end; ++i) {
+      assignments[i] = grid.nearest(locs[i]);
+    }
+  });
+}
+}  // namespace
 /**
  * @brief init clustering
  *
@@ -42,16 +137,23 @@ namespace icts {
  * @param seed
  * @param max_iter
  * @param no_change_stop
+ * @param num_threads
+ * @param pool the pool shared by the caller, nullptr means making the pool if needed
  * @return std::vector<std::vector<Inst*>>
  */
 std::vector<std::vector<Inst*>> BalanceClustering::kMeansPlus(const std::vector<Inst*>& insts, const size_t& k, const int& seed,
-                                                              const size_t& max_iter, const size_t& no_change_stop)
+                                                              const size_t& max_iter, const size_t& no_change_stop,
+                                                              const size_t& num_threads, ThreadPool* pool)
 {
   std::vector<std::vector<Inst*>> best_clusters(k);
 
   std::vector<Point> centers;
   size_t num_instances = insts.size();
   std::vector<int> assignments(num_instances);
+  std::vector<Point> locs(num_instances);
+  std::ranges::transform(insts, locs.begin(), [](const Inst* inst) { return inst->get_location(); });
+  std::unique_ptr<ThreadPool> own_pool;
+  auto* cluster_pool = makePool(pool, num_threads, num_instances, own_pool);
 
   // Randomly choose first center from instances
   // std::random_device rd;
@@ -62,16 +164,18 @@ std::vector<std::vector<Inst*>> BalanceClustering::kMeansPlus(const std::vector<
   // Choose k-1 remaining centers using kmeans++ algorithm
   auto loc = insts[dis(gen)]->get_location();
   centers.emplace_back(loc);
+  // min distance to the chosen centers, only the last chosen center need to be checked
+  std::vector<double> min_distances(num_instances, std::numeric_limits<double>::max());
+  std::vector<double> distances(num_instances);
   while (centers.size() < k) {
-    std::vector<double> distances(num_instances, std::numeric_limits<double>::max());
-    for (size_t i = 0; i < num_instances; i++) {
-      double min_distance = std::numeric_limits<double>::max();
-      for (size_t j = 0; j < centers.size(); j++) {
-        double distance = TimingPropagator::calcDist(insts[i]->get_location(), centers[j]);
-        min_distance = std::min(min_distance, distance);
+    const auto& last_center = centers.back();
+    parallelFor(cluster_pool, num_threads, num_instances, [&](const size_t& begin, const size_t& end) {
+      for (size_t i = begin; i < end; i++) {
+        double distance = TimingPropagator::calcDist(locs[i], last_center);
+        min_distances[i] = std::min(min_distances[i], distance);
+        distances[i] = min_distances[i] * min_distances[i];  // square distance
       }
-      distances[i] = min_distance * min_distance;  // square distance
-    }
+    });
     std::discrete_distribution<> distribution(distances.begin(), distances.end());
     int selected_index = distribution(gen);
     auto select_loc = insts[selected_index]->get_location();
@@ -83,24 +187,13 @@ std::vector<std::vector<Inst*>> BalanceClustering::kMeansPlus(const std::vector<
   size_t no_change = 0;
   while (num_iterations++ < max_iter && no_change++ < no_change_stop) {
     // Assignment step
-    for (size_t i = 0; i < num_instances; i++) {
-      double min_distance = std::numeric_limits<double>::max();
-      int min_center_index = -1;
-      for (size_t j = 0; j < centers.size(); j++) {
-        double distance = TimingPropagator::calcDist(insts[i]->get_location(), centers[j]);
-        if (distance < min_distance) {
-          min_distance = distance;
-          min_center_index = j;
-        }
-      }
-      assignments[i] = min_center_index;
-    }
+    assignCenters(locs, centers, cluster_pool, num_threads, assignments);
     // Update step
     std::vector<Point> new_centers(k, Point(0, 0));
     std::vector<int> center_counts(k, 0);
     for (size_t i = 0; i < num_instances; i++) {
       int center_index = assignments[i];
-      new_centers[center_index] += insts[i]->get_location();
+      new_centers[center_index] += locs[i];
       center_counts[center_index]++;
     }
     for (size_t i = 0; i < k; i++) {
@@ -145,15 +238,22 @@ std::vector<std::vector<Inst*>> BalanceClustering::kMeansPlus(const std::vector<
  * @param k
  * @param seed
  * @param max_iter
+ * @param num_threads
+ * @param pool the pool shared by the caller, nullptr means making the pool if needed
  * @return std::vector<std::vector<Inst*>>
  */
 std::vector<std::vector<Inst*>> BalanceClustering::kMeans(const std::vector<Inst*>& insts, const size_t& k, const int& seed,
-                                                          const size_t& max_iter)
+                                                          const size_t& max_iter, const size_t& num_threads, ThreadPool* pool)
 {
   size_t num_instances = insts.size();
   std::mt19937 gen(static_cast<std::mt19937::result_type>(seed));
   std::uniform_int_distribution<> dis(0, num_instances - 1);
 
+  std::vector<Point> locs(num_instances);
+  std::ranges::transform(insts, locs.begin(), [](const Inst* inst) { return inst->get_location(); });
+  std::unique_ptr<ThreadPool> own_pool;
+  auto* cluster_pool = makePool(pool, num_threads, num_instances, own_pool);
+
   std::vector<int> assignments(num_instances);
   std::vector<Point> centers(k);
   for (size_t i = 0; i < k; ++i) {
@@ -165,19 +265,12 @@ std::vector<std::vector<Inst*>> BalanceClustering::kMeans(const std::vector<Inst
     std::vector<double> new_center_y(k, 0);
     std::vector<Point> new_centers(k);
     std::vector<int> center_counts(k, 0);
+    assignCenters(locs, centers, cluster_pool, num_threads, assignments);
+    // accumulate in the inst order, keep the float sum same as the serial flow
     for (size_t i = 0; i < num_instances; ++i) {
-      double min_distance = std::numeric_limits<double>::max();
-      int min_center_index = -1;
-      for (size_t j = 0; j < k; ++j) {
-        double distance = TimingPropagator::calcDist(insts[i]->get_location(), centers[j]);
-        if (distance < min_distance) {
-          min_distance = distance;
-          min_center_index = j;
-        }
-      }
-      assignments[i] = min_center_index;
-      new_center_x[min_center_index] += insts[i]->get_location().x();
-      new_center_y[min_center_index] += insts[i]->get_location().y();
+      int min_center_index = assignments[i];
+      new_center_x[min_center_index] += locs[i].x();
+      new_center_y[min_center_index] += locs[i].y();
       center_counts[min_center_index]++;
     }
     for (size_t i = 0; i < k; ++i) {
@@ -214,25 +307,31 @@ std::vector<std::vector<Inst*>> BalanceClustering::kMeans(const std::vector<Inst
  * @param no_change_stop
  * @param limit_ratio
  * @param log
+ * @param num_threads
+ * @param pool the pool shared by the caller, nullptr means making the pool if needed
  * @return std::vector<std::vector<Inst*>>
  */
 std::vector<std::vector<Inst*>> BalanceClustering::iterClustering(const std::vector<Inst*>& insts, const size_t& max_fanout,
                                                                   const size_t& iters, const size_t& no_change_stop,
-                                                                  const double& limit_ratio, const bool& log)
+                                                                  const double& limit_ratio, const bool& log, const size_t& num_threads,
+                                                                  ThreadPool* pool)
 {
   LOG_FATAL_IF(max_fanout < 2) << "max_fanout should be greater than 1";
   if (insts.size() == 2) {
     return {insts};
   }
+  // the pool is made once and shared by all the kmeans calls and the sub clusterings
+  std::unique_ptr<ThreadPool> own_pool;
+  auto* cluster_pool = makePool(pool, num_threads, insts.size(), own_pool);
   LOG_INFO_IF(log) << "iterative clustering";
   const size_t max_num = 40000;
   if (insts.size() > max_num) {
     auto divide_num = 4;
     LOG_INFO << "Inst num: " << insts.size() << ", K-Means init clustering to " << divide_num << " clusters";
-    auto divide_clusters = kMeansPlus(insts, divide_num, 0, iters, no_change_stop);
+    auto divide_clusters = kMeansPlus(insts, divide_num, 0, iters, no_change_stop, num_threads, cluster_pool);
     std::vector<std::vector<Inst*>> clusters;
     std::ranges::for_each(divide_clusters, [&](const std::vector<Inst*>& divide_cluster) {
-      auto sub_cluster = iterClustering(divide_cluster, max_fanout, iters, no_change_stop, limit_ratio, log);
+      auto sub_cluster = iterClustering(divide_cluster, max_fanout, iters, no_change_stop, limit_ratio, log, num_threads, cluster_pool);
       clusters.insert(clusters.end(), sub_cluster.begin(), sub_cluster.end());
     });
     return clusters;
@@ -243,7 +342,7 @@ std::vector<std::vector<Inst*>> BalanceClustering::iterClustering(const std::vec
   if (cluster_num == insts.size()) {
     cluster_num = insts.size() - 1;
   }
-  auto clusters = kMeansPlus(insts, cluster_num);
+  auto clusters = kMeansPlus(insts, cluster_num, 0, 100, 5, num_threads, cluster_pool);
   size_t kmeans_num
       = std::accumulate(clusters.begin(), clusters.end(), 0, [](size_t sum, const std::vector<Inst*>& c) { return sum + c.size(); });
   LOG_FATAL_IF(kmeans_num != insts.size()) << "num of insts is not equal to num of clusters (kmeans insts num: " << kmeans_num
@@ -287,7 +386,7 @@ std::vector<std::vector<Inst*>> BalanceClustering::iterClustering(const std::vec
       no_change = 0;
       LOG_INFO_IF(log) << "update in mcf iter: " << i + 1;
     } else {
-      clusters = kMeansPlus(insts, cluster_num, i, 5);
+      clusters = kMeansPlus(insts, cluster_num, i, 5, 5, num_threads, cluster_pool);
       auto temp_buffers = getCentroidBuffers(clusters);
       auto temp_kmeans_var = calcBalanceVariance(clusters, temp_buffers);
       if (temp_kmeans_var < kmeans_var) {
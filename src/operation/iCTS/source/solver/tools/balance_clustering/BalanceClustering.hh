@@ -23,6 +23,8 @@
 
 #include "Inst.hh"
 
+class ThreadPool;
+
 namespace icts {
 enum class EnhanceType
 {
@@ -139,14 +141,16 @@ class BalanceClustering
   BalanceClustering() = delete;
   ~BalanceClustering() = default;
   static std::vector<std::vector<Inst*>> kMeansPlus(const std::vector<Inst*>& insts, const size_t& k, const int& seed = 0,
-                                                    const size_t& max_iter = 100, const size_t& no_change_stop = 5);
+                                                    const size_t& max_iter = 100, const size_t& no_change_stop = 5,
+                                                    const size_t& num_threads = 1, ThreadPool* pool = nullptr);
 
   static std::vector<std::vector<Inst*>> kMeans(const std::vector<Inst*>& insts, const size_t& k, const int& seed = 0,
-                                                const size_t& max_iter = 100);
+                                                const size_t& max_iter = 100, const size_t& num_threads = 1, ThreadPool* pool = nullptr);
 
   static std::vector<std::vector<Inst*>> iterClustering(const std::vector<Inst*>& insts, const size_t& max_fanout,
                                                         const size_t& iters = 100, const size_t& no_change_stop = 5,
-                                                        const double& limit_ratio = 0.8, const bool& log = false);
+                                                        const double& limit_ratio = 0.8, const bool& log = false,
+                                                        const size_t& num_threads = 1, ThreadPool* pool = nullptr);
 
   static std::vector<std::vector<Inst*>> slackClustering(const std::vector<std::vector<Inst*>>& clusters, const double& max_net_length,
                                                          const size_t& max_fanout);
@@ -0,0 +1,124 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+/**
+ * @file CenterGrid.hh
+ * @brief the grid index of the cluster centers for the nearest center search
+ */
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "CtsPoint.hh"
+
+namespace icts {
+/**
+ * @brief uniform grid of the cluster centers
+ *       the nearest center (manhattan distance) is searched ring by ring around the cell of the query location,
+ *       the tie is broken by the smaller center index, so the result is same as the brute force search
+ *
+ */
+class CenterGrid
+{
+ public:
+  CenterGrid(const std::vector<Point>& centers, const Point& lower, const Point& upper) : _lower(lower)
+  {
+    int64_t width = static_cast<int64_t>(upper.x()) - lower.x() + 1;
+    int64_t height = static_cast<int64_t>(upper.y()) - lower.y() + 1;
+    // about one center per cell
+    auto cell_area = std::max<int64_t>(1, width * height / static_cast<int64_t>(centers.size()));
+    _side = std::max<int64_t>(1, static_cast<int64_t>(std::ceil(std::sqrt(static_cast<double>(cell_area)))));
+    _num_x = (width + _side - 1) / _side;
+    _num_y = (height + _side - 1) / _side;
+    // counting sort keep the center index order in each cell
+    std::vector<int64_t> cell_ids(centers.size());
+    _cell_start.assign(_num_x * _num_y + 1, 0);
+    for (size_t i = 0; i < centers.size(); ++i) {
+      cell_ids[i] = cellX(centers[i].x()) + cellY(centers[i].y()) * _num_x;
+      ++_cell_start[cell_ids[i] + 1];
+    }
+    for (size_t cell = 1; cell < _cell_start.size(); ++cell) {
+      _cell_start[cell] += _cell_start[cell - 1];
+    }
+    // the center coordinates of a cell are contiguous, so the distance loop is vectorizable
+    auto fill_pos = _cell_start;
+    _xs.resize(centers.size());
+    _ys.resize(centers.size());
+    _ids.resize(centers.size());
+    for (size_t i = 0; i < centers.size(); ++i) {
+      auto pos = fill_pos[cell_ids[i]]++;
+      _xs[pos] = centers[i].x();
+      _ys[pos] = centers[i].y();
+      _ids[pos] = static_cast<int>(i);
+    }
+  }
+
+  int nearest(const Point& loc) const
+  {
+    auto cell_x = cellX(loc.x());
+    auto cell_y = cellY(loc.y());
+    int64_t best_dist = std::numeric_limits<int64_t>::max();
+    int best_id = -1;
+    auto max_ring = std::max(_num_x, _num_y);
+    for (int64_t ring = 0; ring <= max_ring; ++ring) {
+      // the centers in the ring are at least (ring - 1) cells away
+      if (ring > 0 && (ring - 1) * _side > best_dist) {
+        break;
+      }
+      for (auto y = cell_y - ring; y <= cell_y + ring; ++y) {
+        if (y < 0 || y >= _num_y) {
+          continue;
+        }
+        // the top and bottom row of the ring are full, the other rows only have the two side cells
+        auto step = (y == cell_y - ring || y == cell_y + ring) ? 1 : 2 * ring;
+        for (auto x = cell_x - ring; x <= cell_x + ring; x += step) {
+          if (x >= 0 && x < _num_x) {
+            searchCell(x + y * _num_x, loc, best_dist, best_id);
+          }
+        }
+      }
+    }
+    return best_id;
+  }
+
+ private:
+  int64_t cellX(const int& x) const { return std::clamp<int64_t>((static_cast<int64_t>(x) - _lower.x()) / _side, 0, _num_x - 1); }
+  int64_t cellY(const int& y) const { return std::clamp<int64_t>((static_cast<int64_t>(y) - _lower.y()) / _side, 0, _num_y - 1); }
+
+  void searchCell(const int64_t& cell, const Point& loc, int64_t& best_dist, int& best_id) const
+  {
+    for (auto pos = _cell_start[cell]; pos < _cell_start[cell + 1]; ++pos) {
+      int64_t dist = std::abs(static_cast<int64_t>(_xs[pos]) - loc.x()) + std::abs(static_cast<int64_t>(_ys[pos]) - loc.y());
+      if (dist < best_dist || (dist == best_dist && _ids[pos] < best_id)) {
+        best_dist = dist;
+        best_id = _ids[pos];
+      }
+    }
+  }
+
+  Point _lower;
+  int64_t _side = 1;
+  int64_t _num_x = 1;
+  int64_t _num_y = 1;
+  std::vector<size_t> _cell_start;
+  std::vector<int> _xs;
+  std::vector<int> _ys;
+  std::vector<int> _ids;
+};
+}  // namespace icts
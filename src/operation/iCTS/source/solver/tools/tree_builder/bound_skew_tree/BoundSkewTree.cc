@@ -38,6 +38,7 @@ BoundSkewTree::BoundSkewTree(const std::string& net_name, const std::vector<Pin*
   LOG_FATAL_IF(topo_type == TopoType::kInputTopo) << "error topo type";
   // Not input topology
   _net_name = net_name;
+  _gen.seed(static_cast<std::mt19937::result_type>(std::hash<std::string>{}(net_name)));
   _load_pins = pins;
   _skew_bound = skew_bound.value_or(Timing::getSkewBound());
   _topo_type = topo_type;
@@ -60,7 +61,7 @@ BoundSkewTree::BoundSkewTree(const std::string& net_name, const std::vector<Pin*
 #endif
       pin->set_min_delay(pin->get_max_delay() - _skew_bound);
     }
-    auto* node = new Area(pin);
+    auto* node = new Area(pin, _gen);
     _unmerged_nodes.push_back(node);
     _node_map.insert({pin->get_name(), pin});
   });
@@ -68,6 +69,7 @@ BoundSkewTree::BoundSkewTree(const std::string& net_name, const std::vector<Pin*
 BoundSkewTree::BoundSkewTree(const std::string& net_name, Pin* driver_pin, const std::optional<double>& skew_bound, const bool& estimation)
 {
   _net_name = net_name;
+  _gen.seed(static_cast<std::mt19937::result_type>(std::hash<std::string>{}(net_name)));
   _root_buf = driver_pin->get_inst();
   _skew_bound = skew_bound.value_or(Timing::getSkewBound());
   TreeBuilder::convertToBinaryTree(driver_pin);
@@ -92,7 +94,7 @@ BoundSkewTree::BoundSkewTree(const std::string& net_name, Pin* driver_pin, const
         pin->set_min_delay(pin->get_max_delay() - _skew_bound);
       }
     }
-    auto* area = new Area(node);
+    auto* area = new Area(node, _gen);
     node_area_map[node] = area;
     area->set_pattern(node->get_pattern());
     _node_map.insert({node->get_name(), node});
@@ -20,6 +20,7 @@
  */
 #pragma once
 #include <array>
+#include <random>
 #include <string>
 #include <vector>
 
@@ -212,6 +213,7 @@ class BoundSkewTree
    */
   size_t _id = 0;
   std::string _net_name = "";
+  std::mt19937 _gen;  // seeded by the net name, the random choice only depends on the net
 
   Inst* _root_buf = nullptr;
   std::vector<Pin*> _load_pins;
@@ -20,6 +20,8 @@
  */
 #pragma once
 
+#include <random>
+
 #include "TimingPropagator.hh"
 #include "log/Log.hh"
 namespace icts {
@@ -120,11 +122,12 @@ class Area
 {
  public:
   Area(const size_t& id) { _name = CTSAPIInst.toString("steiner_", id); };
-  Area(Node* node) : _name(node->get_name())
+  Area(Node* node, std::mt19937& gen) : _name(node->get_name())
   {
     _pattern = node->get_pattern();
     if (_pattern == RCPattern::kSingle) {
-      _pattern = static_cast<RCPattern>(1 + std::rand() % 2);
+      // random pick by the generator of the tree, keep the pattern same when the trees are built concurrently
+      _pattern = static_cast<RCPattern>(1 + gen() % 2);
     }
     auto loc = node->get_location();
     auto x = 1.0 * loc.x() / Timing::getDbUnit();
@@ -21,12 +21,16 @@
 
 #include <gtest/gtest.h>
 
+#include <random>
+
 #include "TestInterface.hh"
 #include "anneal_opt/AnnealOpt.hh"
 #include "balance_clustering/BalanceClustering.hh"
+#include "balance_clustering/CenterGrid.hh"
 #include "log/Log.hh"
 namespace {
 using icts::BalanceClustering;
+using icts::CenterGrid;
 using icts::LatAnnealOpt;
 using icts::VioAnnealOpt;
 
@@ -63,8 +67,62 @@ class AnnealOptAux : public TestInterface
     std::ranges::for_each(bufs, [](auto& buf) { delete buf; });
   }
 
+  void runParallelClusteringTest(const EnvInfo& env_info, const size_t& cluster_num, const size_t& num_threads) const
+  {
+    auto bufs = genRandomBuffers(env_info);
+    auto serial_clusters = BalanceClustering::kMeansPlus(bufs, cluster_num);
+    auto parallel_clusters = BalanceClustering::kMeansPlus(bufs, cluster_num, 0, 100, 5, num_threads);
+    EXPECT_TRUE(BalanceClustering::isSame(serial_clusters, parallel_clusters));
+    serial_clusters = BalanceClustering::kMeans(bufs, cluster_num);
+    parallel_clusters = BalanceClustering::kMeans(bufs, cluster_num, 0, 100, num_threads);
+    EXPECT_TRUE(BalanceClustering::isSame(serial_clusters, parallel_clusters));
+    std::ranges::for_each(bufs, [](auto& buf) { delete buf; });
+  }
+
  private:
 };
+/**
+ * @brief the nearest center by the brute force search, the tie is broken by the smaller center index
+ *
+ */
+int bruteForceNearest(const std::vector<Point>& centers, const Point& loc)
+{
+  int64_t best_dist = std::numeric_limits<int64_t>::max();
+  int best_id = -1;
+  for (size_t i = 0; i < centers.size(); ++i) {
+    int64_t dist = std::abs(static_cast<int64_t>(centers[i].x()) - loc.x()) + std::abs(static_cast<int64_t>(centers[i].y()) - loc.y());
+    if (dist < best_dist) {
+      best_dist = dist;
+      best_id = static_cast<int>(i);
+    }
+  }
+  return best_id;
+}
+
+void runCenterGridTest(const size_t& center_num, const size_t& loc_num, const int& range, const int& seed)
+{
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> coord(0, range);
+  std::vector<Point> centers(center_num);
+  for (auto& center : centers) {
+    center = Point(coord(gen), coord(gen));
+  }
+  // the duplicate centers and the centers out of the locations make the ties and the empty cells
+  centers.push_back(centers.front());
+  centers.emplace_back(-range, 2 * range);
+  std::vector<Point> locs(loc_num);
+  for (auto& loc : locs) {
+    loc = Point(coord(gen), coord(gen));
+  }
+  locs.insert(locs.end(), centers.begin(), centers.end());
+
+  Point lower(-range, 0);
+  Point upper(range, 2 * range);
+  CenterGrid grid(centers, lower, upper);
+  for (const auto& loc : locs) {
+    EXPECT_EQ(grid.nearest(loc), bruteForceNearest(centers, loc));
+  }
+}
 
 class AnnealOptTest : public testing::Test
 {
@@ -120,4 +178,23 @@ TEST_F(AnnealOptTest, ViolationCostTest)
   auto skew_bound = TimingPropagator::getSkewBound();
   anneal_opt.runViolationCostTest(env_info, cluster_num, max_iter, cooling_rate, temperature, max_fanout, max_cap, max_net_len, skew_bound);
 }
+
+TEST_F(AnnealOptTest, CenterGridTest)
+{
+  runCenterGridTest(1, 1000, 100000, 0);
+  runCenterGridTest(10, 10000, 100000, 1);
+  runCenterGridTest(2000, 20000, 1000000, 2);
+  // the coarse range makes many equal distances
+  runCenterGridTest(500, 20000, 50, 3);
+}
+
+TEST_F(AnnealOptTest, ParallelClusteringTest)
+{
+  AnnealOptAux anneal_opt("/home/liweiguo/project/iEDA/scripts/salsa20/iEDA_config/db_default_config.json",
+                          "/home/liweiguo/project/iEDA/scripts/salsa20/iEDA_config/cts_default_config.json");
+  EnvInfo env_info{50000, 1500000, 50000, 1500000, 10000, 12000};
+  size_t cluster_num = 400;
+  size_t num_threads = 8;
+  anneal_opt.runParallelClusteringTest(env_info, cluster_num, num_threads);
+}
 }  // namespace
\ No newline at end of file
@@ -0,0 +1,94 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+/**
+ * @file RouterTest.cc
+ * @brief the clock nets synthesized by multiple threads should be the same as the serial flow
+ */
+#include <string>
+#include <vector>
+
+#include "Router.hh"
+#include "TestInterface.hh"
+#include "gtest/gtest.h"
+#include "log/Log.hh"
+
+namespace {
+using icts::Net;
+using icts::Node;
+using icts::Router;
+using ieda::Log;
+
+class RouterAux : public TestInterface
+{
+ public:
+  RouterAux(const std::string& db_config_path, const std::string& cts_config_path) : TestInterface(db_config_path, cts_config_path)
+  {
+    CTSAPIInst.readData();
+  }
+  /**
+   * @brief synthesize all the clock nets, return the net, buffer and steiner node of the result in the net order
+   *
+   * @param num_threads
+   * @return std::vector<std::string>
+   */
+  std::vector<std::string> synthesize(const int& num_threads) const
+  {
+    CTSAPIInst.get_config()->set_num_threads(num_threads);
+    Router router;
+    router.init();
+    router.build();
+
+    std::vector<std::string> records;
+    for (auto* net : router.get_solver_set().get_nets()) {
+      records.push_back(CTSAPIInst.toString("net ", net->get_name()));
+      net->get_driver_pin()->preOrder([&records](Node* node) {
+        auto loc = node->get_location();
+        auto cell_master = node->isPin() ? node->get_cell_master() : "";
+        records.push_back(CTSAPIInst.toString(node->get_name(), " ", cell_master, " (", loc.x(), ", ", loc.y(), ") ",
+                                              static_cast<int>(node->get_pattern())));
+      });
+    }
+    return records;
+  }
+};
+
+class RouterTest : public testing::Test
+{
+  void SetUp()
+  {
+    char config[] = "RouterTest";
+    char* argv[] = {config};
+    Log::init(argv);
+  }
+  void TearDown() { Log::end(); }
+};
+
+TEST_F(RouterTest, ParallelSynthesisTest)
+{
+  RouterAux router("/home/liweiguo/project/iEDA/scripts/design/eval/iEDA_config/db_default_config.json",
+                   "/home/liweiguo/project/iEDA/scripts/design/eval/iEDA_config/cts_default_config.json");
+  auto serial_records = router.synthesize(1);
+  auto parallel_records = router.synthesize(8);
+  ASSERT_FALSE(serial_records.empty());
+  ASSERT_EQ(serial_records.size(), parallel_records.size());
+  for (size_t i = 0; i < serial_records.size(); ++i) {
+    EXPECT_EQ(serial_records[i], parallel_records[i]);
+  }
+  // the same clocks synthesized again are the same, no global random state is used
+  EXPECT_EQ(router.synthesize(8), parallel_records);
+}
+}  // namespace
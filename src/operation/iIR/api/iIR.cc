@@ -34,6 +34,8 @@ unsigned iIR::init() {
  */
 unsigned iIR::readSpef(std::string_view spef_file_path) {
   _rc_data = read_spef(spef_file_path.data());
+  // the G matrix is changed.
+  _net_to_solver.clear();
   return 1;
 };
 
@@ -47,6 +49,35 @@ unsigned iIR::readInstancePowerDB(std::string_view instance_power_file_path) {
   return 1;
 }
 
+/**
+ * @brief get the solver of the net, create by the solver method.
+ *
+ * @param net_name
+ * @return IRSolver*
+ */
+IRSolver* iIR::getOrCreateSolver(const char* net_name) {
+  auto& ir_solver = _net_to_solver[net_name];
+  if (!ir_solver) {
+    switch (_solver_method) {
+      case IRSolverMethod::kCGSolver: {
+        auto cg_solver = std::make_unique<IRCGSolver>(_cg_preconditioner);
+        cg_solver->set_tolerance(_cg_tolerance);
+        cg_solver->set_max_iteration(_cg_max_iteration);
+        ir_solver = std::move(cg_solver);
+        break;
+      }
+      case IRSolverMethod::kCholeskySolver:
+        ir_solver = std::make_unique<IRCholeskySolver>();
+        break;
+      default:
+        ir_solver = std::make_unique<IRLUSolver>();
+        break;
+    }
+  }
+
+  return ir_solver.get();
+}
+
 /**
  * @brief solve the power net IR drop.
  *
@@ -64,8 +95,8 @@ unsigned iIR::solveIRDrop(const char* net_name) {
   auto J_vector = ir_matrix.buildCurrentVector(current_rust_map,
                                                one_net_matrix_data.node_num);
 
-  IRSolver ir_solver;
-  auto grid_voltages = ir_solver(G_matrix, J_vector);
+  auto* ir_solver = getOrCreateSolver(net_name);
+  auto grid_voltages = (*ir_solver)(G_matrix, J_vector);
 
   auto instance_node_ids = get_instance_node_ids(_rc_data, net_name);
   uintptr_t* instance_id;
@@ -10,8 +10,12 @@
 #pragma once
 
 #include <map>
+#include <memory>
+#include <string>
 #include <string_view>
 
+#include "ir-solver/IRSolver.hh"
+
 namespace iir {
 class iIR {
  public:
@@ -21,8 +25,44 @@ class iIR {
 
   unsigned solveIRDrop(const char* net_name);
 
+  void set_solver_method(IRSolverMethod solver_method) {
+    _solver_method = solver_method;
+    _net_to_solver.clear();
+  }
+  auto get_solver_method() const { return _solver_method; }
+
+  void set_cg_preconditioner(IRCGSolver::Preconditioner cg_preconditioner) {
+    _cg_preconditioner = cg_preconditioner;
+    _net_to_solver.clear();
+  }
+  auto get_cg_preconditioner() const { return _cg_preconditioner; }
+
+  void set_cg_tolerance(double cg_tolerance) {
+    _cg_tolerance = cg_tolerance;
+    _net_to_solver.clear();
+  }
+  auto get_cg_tolerance() const { return _cg_tolerance; }
+
+  void set_cg_max_iteration(int cg_max_iteration) {
+    _cg_max_iteration = cg_max_iteration;
+    _net_to_solver.clear();
+  }
+  auto get_cg_max_iteration() const { return _cg_max_iteration; }
+
  private:
+  IRSolver* getOrCreateSolver(const char* net_name);
+
   const void* _rc_data = nullptr;
   const void* _power_data = nullptr;
+
+  IRSolverMethod _solver_method = IRSolverMethod::kLUSolver;
+  //!< The options of the CG solver.
+  IRCGSolver::Preconditioner _cg_preconditioner =
+      IRCGSolver::Preconditioner::kJacobi;
+  double _cg_tolerance = 1e-9;
+  int _cg_max_iteration = 10000;
+  //!< The solver of each net, the cholesky factorization is kept for solving
+  //!< the other current vector of the net.
+  std::map<std::string, std::unique_ptr<IRSolver>> _net_to_solver;
 };
 }  // namespace iir
\ No newline at end of file
@@ -0,0 +1,22 @@
+# Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+# file Copyright.txt or https://cmake.org/licensing for details.
+
+cmake_minimum_required(VERSION 3.5)
+
+file(MAKE_DIRECTORY
+  "/root/repo/src/operation/iIR/source/iir-rust/iir"
+  "/root/repo/src/operation/iIR/source/iir-rust/iir"
+  "/root/repo/src/operation/iIR/source/iir-rust/iir"
+  "/root/repo/src/operation/iIR/source/iir-rust/iir/tmp"
+  "/root/repo/src/operation/iIR/source/iir-rust/iir/src/iir-stamp"
+  "/root/repo/src/operation/iIR/source/iir-rust/iir/src"
+  "/root/repo/src/operation/iIR/source/iir-rust/iir/src/iir-stamp"
+)
+
+set(configSubDirs )
+foreach(subDir IN LISTS configSubDirs)
+    file(MAKE_DIRECTORY "/root/repo/src/operation/iIR/source/iir-rust/iir/src/iir-stamp/${subDir}")
+endforeach()
+if(cfgdir)
+  file(MAKE_DIRECTORY "/root/repo/src/operation/iIR/source/iir-rust/iir/src/iir-stamp${cfgdir}") # cfgdir has leading slash
+endif()
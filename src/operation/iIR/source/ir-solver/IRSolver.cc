@@ -35,6 +35,25 @@ void PrintMatrix(Eigen::Map<Eigen::SparseMatrix<double>>& G_matrix,
   }
 }
 
+/**
+ * @brief get ir drop from the node voltages.
+ *
+ * @param v_vector
+ * @return std::vector<double>
+ */
+std::vector<double> IRSolver::getIRDrop(Eigen::VectorXd& v_vector) {
+  auto node_num = v_vector.size();
+  double voltage_max = v_vector.maxCoeff();
+  std::vector<double> ir_drops;
+  ir_drops.reserve(node_num);
+  for (Eigen::Index i = 0; i < node_num; ++i) {
+    double val = v_vector(i);
+    ir_drops.push_back(voltage_max - val);
+  }
+
+  return ir_drops;
+}
+
 /**
  * @brief solver the ir drop.
  *
@@ -42,11 +61,9 @@ void PrintMatrix(Eigen::Map<Eigen::SparseMatrix<double>>& G_matrix,
  * @param J_vector
  * @return std::vector<double>
  */
-std::vector<double> IRSolver::operator()(
+std::vector<double> IRLUSolver::operator()(
     Eigen::Map<Eigen::SparseMatrix<double>>& G_matrix,
     Eigen::VectorXd& J_vector) {
-  unsigned node_num = J_vector.size();
-
   Eigen::SparseLU<Eigen::SparseMatrix<double>> solver;
   solver.analyzePattern(G_matrix);
   solver.factorize(G_matrix);
@@ -58,15 +75,91 @@ std::vector<double> IRSolver::operator()(
 
   Eigen::VectorXd v_vector = solver.solve(J_vector);
 
-  double voltage_max = v_vector.maxCoeff();
-  std::vector<double> ir_drops;
-  ir_drops.reserve(node_num);
-  for (unsigned i = 0; i < node_num; ++i) {
-    double val = v_vector(i);
-    ir_drops.push_back(voltage_max - val);
+  return getIRDrop(v_vector);
+}
+
+/**
+ * @brief run the conjugate gradient, the matrix vector product is parallel by
+ * openmp when both lower and upper triangle are used.
+ *
+ * @tparam CGSolver
+ * @param solver
+ * @param G_matrix
+ * @param J_vector
+ * @return Eigen::VectorXd
+ */
+template <typename CGSolver>
+Eigen::VectorXd IRCGSolver::solve(
+    CGSolver& solver, Eigen::Map<Eigen::SparseMatrix<double>>& G_matrix,
+    Eigen::VectorXd& J_vector) {
+  solver.setTolerance(_tolerance);
+  solver.setMaxIterations(_max_iteration);
+  solver.compute(G_matrix);
+
+  if (solver.info() != Eigen::Success) {
+    PrintMatrix(G_matrix, 0);
+    LOG_FATAL << "CG solver preconditioner error";
   }
 
-  return ir_drops;
+  Eigen::VectorXd v_vector = solver.solve(J_vector);
+  LOG_INFO << "CG solver iterations " << solver.iterations() << " error "
+           << solver.error();
+  LOG_ERROR_IF(solver.info() != Eigen::Success)
+      << "CG solver not converged in " << _max_iteration << " iterations";
+
+  return v_vector;
+}
+
+/**
+ * @brief solver the ir drop by PCG.
+ *
+ * @param G_matrix
+ * @param J_vector
+ * @return std::vector<double>
+ */
+std::vector<double> IRCGSolver::operator()(
+    Eigen::Map<Eigen::SparseMatrix<double>>& G_matrix,
+    Eigen::VectorXd& J_vector) {
+  Eigen::VectorXd v_vector;
+  if (_preconditioner == Preconditioner::kIncompleteCholesky) {
+    Eigen::ConjugateGradient<Eigen::SparseMatrix<double>,
+                             Eigen::Lower | Eigen::Upper,
+                             Eigen::IncompleteCholesky<double>>
+        solver;
+    v_vector = solve(solver, G_matrix, J_vector);
+  } else {
+    Eigen::ConjugateGradient<Eigen::SparseMatrix<double>,
+                             Eigen::Lower | Eigen::Upper,
+                             Eigen::DiagonalPreconditioner<double>>
+        solver;
+    v_vector = solve(solver, G_matrix, J_vector);
+  }
+
+  return getIRDrop(v_vector);
+}
+
+/**
+ * @brief solver the ir drop by cholesky, reuse the factorization.
+ *
+ * @param G_matrix
+ * @param J_vector
+ * @return std::vector<double>
+ */
+std::vector<double> IRCholeskySolver::operator()(
+    Eigen::Map<Eigen::SparseMatrix<double>>& G_matrix,
+    Eigen::VectorXd& J_vector) {
+  if (!_is_factorized) {
+    _solver.compute(G_matrix);
+    if (_solver.info() != Eigen::Success) {
+      PrintMatrix(G_matrix, 0);
+      LOG_FATAL << "Cholesky solver error";
+    }
+    _is_factorized = true;
+  }
+
+  Eigen::VectorXd v_vector = _solver.solve(J_vector);
+
+  return getIRDrop(v_vector);
 }
 
 }  // namespace iir
\ No newline at end of file
@@ -11,17 +11,100 @@
 
 #pragma once
 #include <Eigen/Dense>
+#include <Eigen/IterativeLinearSolvers>
 #include <Eigen/Sparse>
+#include <Eigen/SparseCholesky>
 #include <Eigen/SparseLU>
 #include <map>
-
+#include <vector>
 namespace iir {
 
 void PrintMatrix(Eigen::Map<Eigen::SparseMatrix<double>>& G_matrix, Eigen::Index base_index); 
+
+/**
+ * @brief The ir solver method.
+ *
+ */
+enum class IRSolverMethod {
+  kLUSolver,        //!< sparse LU, factorize every call.
+  kCGSolver,        //!< multi-threaded preconditioned conjugate gradient.
+  kCholeskySolver,  //!< cholesky, the factorization is reused for every
+                    //!< current vector of the same G matrix.
+};
+
+/**
+ * @brief The base class of ir solver.
+ *
+ */
 class IRSolver {
  public:
+  virtual ~IRSolver() = default;
+  virtual std::vector<double> operator()(
+      Eigen::Map<Eigen::SparseMatrix<double>>& G_matrix,
+      Eigen::VectorXd& J_vector) = 0;
+
+ protected:
+  std::vector<double> getIRDrop(Eigen::VectorXd& v_vector);
+};
+
+/**
+ * @brief The sparse LU solver.
+ *
+ */
+class IRLUSolver : public IRSolver {
+ public:
+  std::vector<double> operator()(
+      Eigen::Map<Eigen::SparseMatrix<double>>& G_matrix,
+      Eigen::VectorXd& J_vector) override;
+};
+
+/**
+ * @brief The preconditioned conjugate gradient solver, the G matrix of power
+ * grid is symmetric positive definite.
+ *
+ */
+class IRCGSolver : public IRSolver {
+ public:
+  enum class Preconditioner { kJacobi, kIncompleteCholesky };
+
+  explicit IRCGSolver(Preconditioner preconditioner = Preconditioner::kJacobi)
+      : _preconditioner(preconditioner) {}
+
+  void set_tolerance(double tolerance) { _tolerance = tolerance; }
+  void set_max_iteration(int max_iteration) { _max_iteration = max_iteration; }
+
   std::vector<double> operator()(
       Eigen::Map<Eigen::SparseMatrix<double>>& G_matrix,
-      Eigen::VectorXd& J_vector);
+      Eigen::VectorXd& J_vector) override;
+
+ private:
+  template <typename CGSolver>
+  Eigen::VectorXd solve(CGSolver& solver,
+                        Eigen::Map<Eigen::SparseMatrix<double>>& G_matrix,
+                        Eigen::VectorXd& J_vector);
+
+  Preconditioner _preconditioner;
+  double _tolerance = 1e-9;
+  int _max_iteration = 10000;
 };
+
+/**
+ * @brief The cholesky solver, factorize once and solve for each current
+ * vector, call reset() when the G matrix is changed.
+ *
+ */
+class IRCholeskySolver : public IRSolver {
+ public:
+  std::vector<double> operator()(
+      Eigen::Map<Eigen::SparseMatrix<double>>& G_matrix,
+      Eigen::VectorXd& J_vector) override;
+
+  void reset() { _is_factorized = false; }
+  [[nodiscard]] bool isFactorized() const { return _is_factorized; }
+
+ private:
+  Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> _solver;
+  bool _is_factorized = false;
+};
+
 }  // namespace iir
\ No newline at end of file
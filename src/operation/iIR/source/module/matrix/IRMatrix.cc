@@ -23,11 +23,15 @@ Eigen::Map<Eigen::SparseMatrix<double>> IRMatrix::buildConductanceMatrix(
   auto node_num = one_net_matrix_data.node_num;
   _mat = std::make_unique<Eigen::SparseMatrix<double>>(node_num, node_num);
 
-  std::vector<Eigen::Triplet<double>> triplets;
-  RustMatrix* one_data;
-  FOREACH_VEC_ELEM(&one_net_matrix_data.g_matrix_vec, RustMatrix, one_data) {
-    triplets.emplace_back(
-        Eigen::Triplet<double>(one_data->row, one_data->col, one_data->data));
+  // the rust vec is contiguous, fill the triplets in parallel.
+  auto* g_matrix_vec = &one_net_matrix_data.g_matrix_vec;
+  int64_t triplet_num = g_matrix_vec->len;
+  std::vector<Eigen::Triplet<double>> triplets(triplet_num);
+#pragma omp parallel for schedule(static)
+  for (int64_t i = 0; i < triplet_num; ++i) {
+    auto* one_data = GetRustVecElem<RustMatrix>(g_matrix_vec, i);
+    triplets[i] =
+        Eigen::Triplet<double>(one_data->row, one_data->col, one_data->data);
   }
   _mat->setFromTriplets(triplets.begin(), triplets.end());
 
@@ -15,6 +15,7 @@
 // See the Mulan PSL v2 for more details.
 // ***************************************************************************************
 #include "api/iIR.hh"
+#include "ir-solver/IRSolver.hh"
 #include "gtest/gtest.h"
 #include "log/Log.hh"
 #include "string/Str.hh"
@@ -58,4 +59,47 @@ TEST_F(IRTest, ir_small) {
   ir_analysis.solveIRDrop("VDD");
 }
 
+TEST_F(IRTest, ir_solver_method) {
+  // a 1-D resistor chain, the first node tied to the supply by a resistor.
+  const int node_num = 64;
+  std::vector<Eigen::Triplet<double>> triplets;
+  for (int i = 0; i < node_num; ++i) {
+    double diag = (i == 0) ? 3.0 : 2.0;
+    if (i == node_num - 1) {
+      diag -= 1.0;
+    }
+    triplets.emplace_back(i, i, diag);
+    if (i + 1 < node_num) {
+      triplets.emplace_back(i, i + 1, -1.0);
+      triplets.emplace_back(i + 1, i, -1.0);
+    }
+  }
+  Eigen::SparseMatrix<double> mat(node_num, node_num);
+  mat.setFromTriplets(triplets.begin(), triplets.end());
+  Eigen::Map<Eigen::SparseMatrix<double>> G_matrix(
+      mat.rows(), mat.cols(), mat.nonZeros(), mat.outerIndexPtr(),
+      mat.innerIndexPtr(), mat.valuePtr());
+
+  Eigen::VectorXd J_vector;
+  J_vector.setConstant(node_num, -1e-3);
+  J_vector(0) += 1.0;
+
+  IRLUSolver lu_solver;
+  auto lu_drops = lu_solver(G_matrix, J_vector);
+
+  IRCGSolver cg_solver(IRCGSolver::Preconditioner::kIncompleteCholesky);
+  auto cg_drops = cg_solver(G_matrix, J_vector);
+
+  IRCholeskySolver cholesky_solver;
+  auto cholesky_drops = cholesky_solver(G_matrix, J_vector);
+  EXPECT_TRUE(cholesky_solver.isFactorized());
+  // solve again with the cached factorization.
+  cholesky_drops = cholesky_solver(G_matrix, J_vector);
+
+  for (int i = 0; i < node_num; ++i) {
+    EXPECT_NEAR(lu_drops[i], cg_drops[i], 1e-6);
+    EXPECT_NEAR(lu_drops[i], cholesky_drops[i], 1e-9);
+  }
+}
+
 }  // namespace
@@ -16,6 +16,8 @@
 // ***************************************************************************************
 #include "pdn_cut_stripe.h"
 
+#include <algorithm>
+
 #include "IdbEnum.h"
 #include "IdbSpecialNet.h"
 #include "IdbSpecialWire.h"
@@ -764,6 +766,69 @@ bool CutStripe::get_intersect_coordinate(idb::IdbSpecialWireSegment* segment_fir
   }
   return false;
 }
+/**
+ * @brief  find all the intersected segment pairs between two segment lists, the pairs are sorted by the first index and then the
+ * second index, the same order as comparing every segment pair
+ * @param  segment_list_first
+ * @param  segment_list_second
+ * @return std::vector<std::pair<size_t, size_t>>
+ */
+std::vector<std::pair<size_t, size_t>> CutStripe::findIntersectPairList(std::vector<idb::IdbSpecialWireSegment*>& segment_list_first,
+                                                                        std::vector<idb::IdbSpecialWireSegment*>& segment_list_second)
+{
+  /// sweep along the axis on which the second segments are narrow, the stripes of a layer are narrow on the cross direction
+  int64_t max_span_x = 0;
+  int64_t max_span_y = 0;
+  for (idb::IdbSpecialWireSegment* segment : segment_list_second) {
+    if (!segment->is_line()) {
+      continue;
+    }
+    IdbRect* rect = segment->get_bounding_box();
+    max_span_x = std::max(max_span_x, static_cast<int64_t>(rect->get_high_x()) - rect->get_low_x());
+    max_span_y = std::max(max_span_y, static_cast<int64_t>(rect->get_high_y()) - rect->get_low_y());
+  }
+  bool sweep_x = max_span_x <= max_span_y;
+  int64_t max_span = sweep_x ? max_span_x : max_span_y;
+
+  /// second segments sorted by the low coordinate on the sweep axis
+  std::vector<std::pair<int64_t, size_t>> low_index_list;
+  for (size_t i = 0; i < segment_list_second.size(); ++i) {
+    if (!segment_list_second[i]->is_line()) {
+      continue;
+    }
+    IdbRect* rect = segment_list_second[i]->get_bounding_box();
+    low_index_list.emplace_back(sweep_x ? rect->get_low_x() : rect->get_low_y(), i);
+  }
+  std::sort(low_index_list.begin(), low_index_list.end());
+
+  std::vector<std::vector<size_t>> intersect_index_list(segment_list_first.size());
+#pragma omp parallel for schedule(dynamic, 64)
+  for (size_t i = 0; i < segment_list_first.size(); ++i) {
+    if (!segment_list_first[i]->is_line()) {
+      continue;
+    }
+    IdbRect* rect = segment_list_first[i]->get_bounding_box();
+    int64_t low = sweep_x ? rect->get_low_x() : rect->get_low_y();
+    int64_t high = sweep_x ? rect->get_high_x() : rect->get_high_y();
+    /// only the second segments start in [low - max_span, high] may touch this segment
+    auto iter = std::lower_bound(low_index_list.begin(), low_index_list.end(), std::make_pair(low - max_span, size_t(0)));
+    for (; iter != low_index_list.end() && iter->first <= high; ++iter) {
+      if (rect->isIntersection(segment_list_second[iter->second]->get_bounding_box())) {
+        intersect_index_list[i].push_back(iter->second);
+      }
+    }
+    std::sort(intersect_index_list[i].begin(), intersect_index_list[i].end());
+  }
+
+  std::vector<std::pair<size_t, size_t>> intersect_pair_list;
+  for (size_t i = 0; i < intersect_index_list.size(); ++i) {
+    for (size_t j : intersect_index_list[i]) {
+      intersect_pair_list.emplace_back(i, j);
+    }
+  }
+  return intersect_pair_list;
+}
+
 bool get_intersect_coordinate(idb::IdbSpecialWireSegment* segment_first, idb::IdbSpecialWireSegment* segment_second,
                               idb::IdbCoordinate<int32_t>& intersect_coordinate)
 {
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace idb {
@@ -196,6 +197,8 @@ class CutStripe
   bool get_intersect_coordinate(idb::IdbSpecialWireSegment* segment_first, idb::IdbSpecialWireSegment* segment_second,
                                 idb::IdbCoordinate<int32_t>& intersect_coordinate);
   bool containLine(idb::IdbSpecialWireSegment* segment_first, idb::IdbCoordinate<int32_t>* start, idb::IdbCoordinate<int32_t>* end);
+  std::vector<std::pair<size_t, size_t>> findIntersectPairList(std::vector<idb::IdbSpecialWireSegment*>& segment_list_first,
+                                                               std::vector<idb::IdbSpecialWireSegment*>& segment_list_second);
 
  private:
   std::vector<FPdbSpecialNetEdgeSegmenArray*> _edge_list;
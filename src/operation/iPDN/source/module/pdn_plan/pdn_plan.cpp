@@ -530,6 +530,9 @@ void PdnPlan::connectLayer(std::string layer_name_first, std::string layer_name_
     return;
   }
 
+  /// the via masters are shared by all the nets
+  PdnVia pdn_via;
+
   /// connect each net
   for (IdbSpecialNet* net : idb_pdn_list->get_net_list()) {
     /// get the routing width and height to find via
@@ -539,10 +542,7 @@ void PdnPlan::connectLayer(std::string layer_name_first, std::string layer_name_
     // int width = layer_top->is_vertical() ? width_top : width_bottom;
     // int height = layer_bottom->is_horizontal() ? width_bottom : width_top;
 
-    /// find via list that fit the 2 layers for each net
-    std::vector<IdbVia*> via_find_list;
-
-    connectTwoLayerForNet(net, via_find_list, layer_top, layer_bottom);
+    connectTwoLayerForNet(net, pdn_via, layer_top, layer_bottom);
     std::cout << "Success : ConnectTwoLayerForNet " << net->get_net_name() << std::endl;
   }
 
@@ -579,11 +579,11 @@ void PdnPlan::updateRouteMap()
  * @brief Connect power lines on different layers of the same specialnet
  *
  * @param net
- * @param via_list
+ * @param pdn_via
  * @param layer_top
  * @param layer_bottom
  */
-void PdnPlan::connectTwoLayerForNet(idb::IdbSpecialNet* net, std::vector<idb::IdbVia*>& via_list, idb::IdbLayerRouting* layer_top,
+void PdnPlan::connectTwoLayerForNet(idb::IdbSpecialNet* net, PdnVia& pdn_via, idb::IdbLayerRouting* layer_top,
                                     idb::IdbLayerRouting* layer_bottom)
 {
   /// find wire list which this net has
@@ -610,20 +610,20 @@ void PdnPlan::connectTwoLayerForNet(idb::IdbSpecialNet* net, std::vector<idb::Id
 
     std::cout << net->get_net_name() << " Finish construct segment list" << std::endl;
 
-    connectTwoLayerForWire(wire, via_list, segment_list_top, segment_list_bottom);
+    connectTwoLayerForWire(wire, pdn_via, segment_list_top, segment_list_bottom);
   }
 }
 
 /**
- * @brief Connect power line segments of the same wire on different layers
+ * @brief Connect power line segments of the same wire on different layers, the intersected segment pairs are found by sweeping the
+ * sorted bottom segments instead of comparing every segment pair
  *
  * @param wire
- * @param via_list
+ * @param pdn_via
  * @param segment_list_top
  * @param segment_list_bottom
  */
-void PdnPlan::connectTwoLayerForWire(idb::IdbSpecialWire* wire, std::vector<idb::IdbVia*>& via_list,
-                                     std::vector<idb::IdbSpecialWireSegment*>& segment_list_top,
+void PdnPlan::connectTwoLayerForWire(idb::IdbSpecialWire* wire, PdnVia& pdn_via, std::vector<idb::IdbSpecialWireSegment*>& segment_list_top,
                                      std::vector<idb::IdbSpecialWireSegment*>& segment_list_bottom)
 {
   if (segment_list_top.size() <= 0 || segment_list_bottom.size() <= 0) {
@@ -632,51 +632,44 @@ void PdnPlan::connectTwoLayerForWire(idb::IdbSpecialWire* wire, std::vector<idb:
 
   auto idb_layout = dmInst->get_idb_layout();
   auto idb_layer_list = idb_layout->get_layers();
-  PdnVia pdn_via;
   int number = 0;
 
   idb::IdbLayerRouting* layer_bottom_routing
       = dynamic_cast<idb::IdbLayerRouting*>(idb_layer_list->find_layer(segment_list_bottom[0]->get_layer()->get_name()));
   idb::IdbLayerRouting* layer_top_routing
       = dynamic_cast<idb::IdbLayerRouting*>(idb_layer_list->find_layer(segment_list_top[0]->get_layer()->get_name()));
-  for (idb::IdbSpecialWireSegment* segment_top : segment_list_top) {
-    for (idb::IdbSpecialWireSegment* segment_bottom : segment_list_bottom) {
-      /// calculate intersection between layer stripe
-      idb::IdbRect coordinate;
-      // if (segment_top->get_intersect_coordinate(segment_bottom, coordinate))
-      // {
-      if (_cut_stripe->get_intersect_coordinate(segment_top, segment_bottom, coordinate)) {
-        // for (IdbVia *via : via_list) {
-        // IdbLayer *             layer_top =
-        // via->get_top_layer_shape().get_layer();
-        for (int32_t layer_order = layer_bottom_routing->get_order(); layer_order <= (layer_top_routing->get_order() - 2);) {
-          // int32_t layer_order_bottom = layer_bottom_routing->get_order();
-          idb::IdbLayerCut* layer_cut_find = dynamic_cast<idb::IdbLayerCut*>(idb_layer_list->find_layer_by_order(layer_order + 1));
-          if (layer_cut_find == nullptr) {
-            std::cout << "Error : layer input illegal." << std::endl;
-            return;
-          }
-          //   IdbVia *via_find = via_listt->find_via_generate(
-          //       layer_cut_find, coordinate.get_width(),
-          //       coordinate.get_height());
-          idb::IdbVia* via_find = pdn_via.findVia(layer_cut_find, coordinate.get_width(), coordinate.get_height());
-          if (via_find == nullptr) {
-            std::cout << "Error : can not find VIA matchs." << std::endl;
-            continue;
-          }
-          idb::IdbLayer* layer_top = via_find->get_top_layer_shape().get_layer();
-          idb::IdbCoordinate<int32_t> middle = coordinate.get_middle_point();
-          idb::IdbSpecialWireSegment* segment_via
-              = pdn_via.createSpecialWireVia(layer_top, 0, idb::IdbWireShapeType::kStripe, &middle, via_find);
-          wire->add_segment(segment_via);
-          number++;
-
-          if (number % 10000 == 0) {
-            std::cout << "-";
-          }
-          layer_order += 2;
-          // }
-        }
+
+  /// the cut layers between the two routing layers
+  std::vector<idb::IdbLayerCut*> layer_cut_list;
+  for (int32_t layer_order = layer_bottom_routing->get_order(); layer_order <= (layer_top_routing->get_order() - 2); layer_order += 2) {
+    idb::IdbLayerCut* layer_cut_find = dynamic_cast<idb::IdbLayerCut*>(idb_layer_list->find_layer_by_order(layer_order + 1));
+    if (layer_cut_find == nullptr) {
+      std::cout << "Error : layer input illegal." << std::endl;
+      return;
+    }
+    layer_cut_list.push_back(layer_cut_find);
+  }
+
+  for (auto& [top_index, bottom_index] : _cut_stripe->findIntersectPairList(segment_list_top, segment_list_bottom)) {
+    /// calculate intersection between layer stripe
+    idb::IdbRect coordinate;
+    if (!_cut_stripe->get_intersect_coordinate(segment_list_top[top_index], segment_list_bottom[bottom_index], coordinate)) {
+      continue;
+    }
+    for (idb::IdbLayerCut* layer_cut_find : layer_cut_list) {
+      idb::IdbVia* via_find = pdn_via.findVia(layer_cut_find, coordinate.get_width(), coordinate.get_height());
+      if (via_find == nullptr) {
+        std::cout << "Error : can not find VIA matchs." << std::endl;
+        continue;
+      }
+      idb::IdbLayer* layer_top = via_find->get_top_layer_shape().get_layer();
+      idb::IdbCoordinate<int32_t> middle = coordinate.get_middle_point();
+      idb::IdbSpecialWireSegment* segment_via = pdn_via.createSpecialWireVia(layer_top, 0, idb::IdbWireShapeType::kStripe, &middle, via_find);
+      wire->add_segment(segment_via);
+      number++;
+
+      if (number % 10000 == 0) {
+        std::cout << "-";
       }
     }
   }
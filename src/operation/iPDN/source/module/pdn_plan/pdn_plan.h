@@ -46,6 +46,8 @@ class IdbCoordinate;
 
 namespace ipdn {
 
+class PdnVia;
+
 class PdnPlan
 {
  public:
@@ -100,11 +102,9 @@ class PdnPlan
   std::map<std::string, std::vector<idb::IdbRect>> mergeOverlapRect(idb::IdbPin* pin);
   std::vector<idb::IdbRect> mergeOverlapRect(std::vector<idb::IdbRect*> rect_list);
 
-  void connectTwoLayerForNet(idb::IdbSpecialNet* net, std::vector<idb::IdbVia*>& via_list, idb::IdbLayerRouting* layer_top,
-                             idb::IdbLayerRouting* layer_bottom);
+  void connectTwoLayerForNet(idb::IdbSpecialNet* net, PdnVia& pdn_via, idb::IdbLayerRouting* layer_top, idb::IdbLayerRouting* layer_bottom);
 
-  void connectTwoLayerForWire(idb::IdbSpecialWire* wire, std::vector<idb::IdbVia*>& via_list,
-                              std::vector<idb::IdbSpecialWireSegment*>& segment_list_top,
+  void connectTwoLayerForWire(idb::IdbSpecialWire* wire, PdnVia& pdn_via, std::vector<idb::IdbSpecialWireSegment*>& segment_list_top,
                               std::vector<idb::IdbSpecialWireSegment*>& segment_list_bottom);
 };
 
@@ -0,0 +1,137 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "IdbEnum.h"
+#include "IdbGeometry.h"
+#include "IdbSpecialWire.h"
+#include "gtest/gtest.h"
+#include "pdn_cut_stripe.h"
+
+namespace ipdn {
+
+class PdnCutStripeTest : public testing::Test
+{
+ protected:
+  void TearDown() override
+  {
+    for (idb::IdbSpecialWireSegment* segment : _segment_pool) {
+      delete segment;
+    }
+    _segment_pool.clear();
+  }
+
+  idb::IdbSpecialWireSegment* createSegment(int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t width,
+                                            idb::IdbWireShapeType shape_type = idb::IdbWireShapeType::kStripe)
+  {
+    idb::IdbSpecialWireSegment* segment = new idb::IdbSpecialWireSegment();
+    segment->set_shape_type(shape_type);
+    segment->set_route_width(width);
+    segment->add_point(x1, y1);
+    segment->add_point(x2, y2);
+    segment->set_bounding_box();
+    _segment_pool.push_back(segment);
+    return segment;
+  }
+
+  /**
+   * @brief the pairs found by comparing every segment pair, as connectTwoLayerForWire did before the sweep.
+   */
+  std::vector<std::pair<size_t, size_t>> findIntersectPairListByLoop(std::vector<idb::IdbSpecialWireSegment*>& segment_list_first,
+                                                                     std::vector<idb::IdbSpecialWireSegment*>& segment_list_second)
+  {
+    std::vector<std::pair<size_t, size_t>> intersect_pair_list;
+    for (size_t i = 0; i < segment_list_first.size(); ++i) {
+      for (size_t j = 0; j < segment_list_second.size(); ++j) {
+        idb::IdbRect coordinate;
+        if (_cut_stripe.get_intersect_coordinate(segment_list_first[i], segment_list_second[j], coordinate)) {
+          intersect_pair_list.emplace_back(i, j);
+        }
+      }
+    }
+    return intersect_pair_list;
+  }
+
+  CutStripe _cut_stripe;
+  std::vector<idb::IdbSpecialWireSegment*> _segment_pool;
+};
+
+TEST_F(PdnCutStripeTest, stripe_grid_match_loop)
+{
+  /// vertical stripes on the top layer, horizontal stripes on the bottom layer
+  std::vector<idb::IdbSpecialWireSegment*> segment_list_top;
+  for (int32_t x = 1000; x <= 20000; x += 1800) {
+    segment_list_top.push_back(createSegment(x, 0, x, 20000, 400));
+  }
+  /// a short stripe, a stripe touching the last one and a segment which is not a line
+  segment_list_top.push_back(createSegment(5000, 3000, 5000, 6000, 200));
+  segment_list_top.push_back(createSegment(19400, 0, 19400, 20000, 400));
+  segment_list_top.push_back(createSegment(3000, 0, 3000, 20000, 400, idb::IdbWireShapeType::kNone));
+
+  std::vector<idb::IdbSpecialWireSegment*> segment_list_bottom;
+  for (int32_t y = 500; y <= 20000; y += 1200) {
+    segment_list_bottom.push_back(createSegment(0, y, 20000, y, 200));
+  }
+  /// a horizontal stripe only crossing the first top stripes
+  segment_list_bottom.push_back(createSegment(0, 4000, 4000, 4000, 600));
+  segment_list_bottom.push_back(createSegment(0, 8000, 20000, 8000, 600, idb::IdbWireShapeType::kNone));
+
+  auto expect_pair_list = findIntersectPairListByLoop(segment_list_top, segment_list_bottom);
+  ASSERT_FALSE(expect_pair_list.empty());
+  EXPECT_EQ(_cut_stripe.findIntersectPairList(segment_list_top, segment_list_bottom), expect_pair_list);
+  EXPECT_EQ(_cut_stripe.findIntersectPairList(segment_list_bottom, segment_list_top),
+            findIntersectPairListByLoop(segment_list_bottom, segment_list_top));
+}
+
+TEST_F(PdnCutStripeTest, random_segments_match_loop)
+{
+  /// both lists mix horizontal and vertical segments of different widths
+  std::mt19937 random_engine(2024);
+  std::uniform_int_distribution<int32_t> coord_dist(0, 50000);
+  std::uniform_int_distribution<int32_t> width_dist(1, 10);
+  auto create_random_segments = [&](size_t segment_num) {
+    std::vector<idb::IdbSpecialWireSegment*> segment_list;
+    for (size_t i = 0; i < segment_num; ++i) {
+      int32_t coord = coord_dist(random_engine);
+      int32_t start = coord_dist(random_engine);
+      int32_t end = coord_dist(random_engine);
+      int32_t width = width_dist(random_engine) * 100;
+      segment_list.push_back(i % 3 == 0 ? createSegment(coord, start, coord, end, width)
+                                        : createSegment(start, coord, end, coord, width));
+    }
+    return segment_list;
+  };
+
+  auto segment_list_first = create_random_segments(300);
+  auto segment_list_second = create_random_segments(500);
+
+  auto expect_pair_list = findIntersectPairListByLoop(segment_list_first, segment_list_second);
+  ASSERT_FALSE(expect_pair_list.empty());
+  EXPECT_EQ(_cut_stripe.findIntersectPairList(segment_list_first, segment_list_second), expect_pair_list);
+}
+
+TEST_F(PdnCutStripeTest, empty_list)
+{
+  std::vector<idb::IdbSpecialWireSegment*> segment_list_top{createSegment(0, 0, 0, 1000, 100)};
+  std::vector<idb::IdbSpecialWireSegment*> segment_list_bottom;
+  EXPECT_TRUE(_cut_stripe.findIntersectPairList(segment_list_top, segment_list_bottom).empty());
+  EXPECT_TRUE(_cut_stripe.findIntersectPairList(segment_list_bottom, segment_list_top).empty());
+}
+
+}  // namespace ipdn
@@ -96,6 +96,9 @@ void Config::initConfigByJson(nlohmann::json json)
   int32_t dp_max_displacement = getDataByJson(json, {"PL", "DP", "max_displacement"});
   int32_t dp_global_padding = getDataByJson(json, {"PL", "DP", "global_right_padding"});
   int32_t dp_enable_networkflow = getDataByJson(json, {"PL", "DP", "enable_networkflow"});
+  // optional keys, older config files do not have the window parallel mode
+  int32_t dp_enable_window_parallel = json["PL"]["DP"].value("enable_window_parallel", 0);
+  int32_t dp_window_row_num = json["PL"]["DP"].value("window_row_num", 16);
 
   // Filler
   std::vector<std::vector<std::string>> filler_group_list;
@@ -201,6 +204,8 @@ void Config::initConfigByJson(nlohmann::json json)
   _dp_config.set_max_displacement(dp_max_displacement);
   _dp_config.set_global_padding(dp_global_padding);
   _dp_config.set_enable_networkflow(dp_enable_networkflow);
+  _dp_config.set_enable_window_parallel(dp_enable_window_parallel);
+  _dp_config.set_window_row_num(dp_window_row_num);
 
   // Filler
   _filler_config.set_thread_num(num_threads);
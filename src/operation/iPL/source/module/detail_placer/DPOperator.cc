@@ -28,6 +28,7 @@ DPOperator::~DPOperator()
 {
   delete _topo_manager;
   delete _grid_manager;
+  delete _window_manager;
 }
 
 void DPOperator::initDPOperator(DPDatabase* database, DPConfig* config)
@@ -36,6 +37,7 @@ void DPOperator::initDPOperator(DPDatabase* database, DPConfig* config)
   _config = config;
   initTopoManager();
   initGridManager();
+  _window_manager = new DPWindowManager(config, database);
 }
 
 std::pair<int32_t, int32_t> DPOperator::obtainOptimalXCoordiLine(DPInstance* inst)
@@ -52,6 +54,9 @@ std::pair<int32_t, int32_t> DPOperator::obtainOptimalXCoordiLine(DPInstance* ins
     std::pair<int32_t, int32_t> pin_offset = std::move(inst->calInstPinModifyOffest(inst_pin));
 
     auto* pin_net = inst_pin->get_net();
+    if (pin_net->isFrozen()) {
+      continue;
+    }
     DPPin* l_pin = nullptr;
     DPPin* r_pin = nullptr;
     int32_t max_x = INT32_MIN;
@@ -117,6 +122,9 @@ std::pair<int32_t, int32_t> DPOperator::obtainOptimalYCoordiLine(DPInstance* ins
     std::pair<int32_t, int32_t> pin_offset = std::move(inst->calInstPinModifyOffest(inst_pin));
 
     auto* pin_net = inst_pin->get_net();
+    if (pin_net->isFrozen()) {
+      continue;
+    }
     DPPin* up_pin = nullptr;
     DPPin* down_pin = nullptr;
     int32_t max_y = INT32_MIN;
@@ -180,6 +188,9 @@ int64_t DPOperator::calInstAffectiveHPWL(DPInstance* inst)
   int64_t affective_hpwl = 0;
   for (auto* pin : inst->get_pin_list()) {
     auto* pin_net = pin->get_net();
+    if (pin_net->isFrozen()) {
+      continue;
+    }
     affective_hpwl += pin_net->calCurrentHPWL();
   }
   return affective_hpwl;
@@ -196,6 +207,9 @@ int64_t DPOperator::calInstPairAffectiveHPWL(DPInstance* inst_1, DPInstance* ins
     net_set.emplace(pin->get_net());
   }
   for (auto* net : net_set) {
+    if (net->isFrozen()) {
+      continue;
+    }
     affective_hpwl += net->calCurrentHPWL();
   }
 
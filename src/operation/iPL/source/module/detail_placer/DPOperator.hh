@@ -19,6 +19,7 @@
 
 #include <string>
 
+#include "DPWindow.hh"
 #include "GridManager.hh"
 #include "TopologyManager.hh"
 #include "data/Rectangle.hh"
@@ -40,6 +41,7 @@ class DPOperator
 
   TopologyManager* get_topo_manager() const { return _topo_manager; }
   GridManager* get_grid_manager() const { return _grid_manager; }
+  DPWindowManager* get_window_manager() const { return _window_manager; }
 
   void initDPOperator(DPDatabase* database, DPConfig* config);
   void updateTopoManager();
@@ -71,6 +73,7 @@ class DPOperator
   DPConfig* _config;
   TopologyManager* _topo_manager;
   GridManager* _grid_manager;
+  DPWindowManager* _window_manager;
 
   void initTopoManager();
   void initGridManager();
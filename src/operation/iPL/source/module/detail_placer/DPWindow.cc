@@ -0,0 +1,231 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+#include "DPWindow.hh"
+
+#include "module/logger/Log.hh"
+
+namespace ipl {
+
+// nets with more pins are frozen while the windows run, otherwise they would join most of the windows.
+static constexpr size_t kMaxConflictNetDegree = 64;
+
+DPWindow::DPWindow(int32_t window_id) : _window_id(window_id), _color(-1)
+{
+}
+
+DPWindow::~DPWindow()
+{
+}
+
+void DPWindow::add_interval(DPInterval* interval)
+{
+  _interval_list.push_back(interval);
+  _interval_set.emplace(interval);
+}
+
+void DPWindow::obtainInstList(std::vector<DPInstance*>& inst_list) const
+{
+  for (auto* interval : _interval_list) {
+    auto* cur_cluster = interval->get_cluster_root();
+    while (cur_cluster) {
+      for (auto* inst : cur_cluster->get_inst_list()) {
+        inst_list.push_back(inst);
+      }
+      cur_cluster = cur_cluster->get_back_cluster();
+    }
+  }
+}
+
+DPWindowManager::DPWindowManager(DPConfig* config, DPDatabase* database) : _config(config), _database(database), _build_count(0)
+{
+}
+
+DPWindowManager::~DPWindowManager()
+{
+  clearWindowList();
+}
+
+void DPWindowManager::buildWindowList()
+{
+  clearWindowList();
+  partitionIntervals();
+
+  std::vector<std::vector<int32_t>> conflict_list;
+  buildConflictList(conflict_list);
+  colorWindowList(conflict_list);
+
+  LOG_INFO << "Detail Placement Windows: " << _window_list.size() << ", Colors: " << _color_window_list.size()
+           << ", Frozen Nets: " << _frozen_net_list.size();
+}
+
+DPWindow* DPWindowManager::findWindow(DPInterval* interval) const
+{
+  DPWindow* window = nullptr;
+  auto it = _interval_to_window.find(interval);
+  if (it != _interval_to_window.end()) {
+    window = it->second;
+  }
+  return window;
+}
+
+void DPWindowManager::clearWindowList()
+{
+  for (auto* window : _window_list) {
+    delete window;
+  }
+  _window_list.clear();
+  _color_window_list.clear();
+  _interval_to_window.clear();
+  _frozen_net_list.clear();
+}
+
+void DPWindowManager::partitionIntervals()
+{
+  auto* layout = _database->get_layout();
+  int32_t row_height = layout->get_row_height();
+  int32_t site_width = layout->get_site_width();
+  int32_t window_row_num = std::max(1, _config->get_window_row_num());
+  int32_t window_width = std::max(site_width, (window_row_num * row_height / site_width) * site_width);
+
+  // shift the windows by half a window every other build, so the boundaries of the last build are optimized
+  bool is_shift = (_build_count++ % 2 == 1);
+  int32_t row_offset = is_shift ? window_row_num / 2 : 0;
+  int32_t x_offset = is_shift ? window_width / 2 : 0;
+
+  const auto& interval_2d_list = layout->get_interval_2d_list();
+  int32_t row_num = interval_2d_list.size();
+  int32_t window_cnt_x = (layout->get_max_x() + x_offset + window_width - 1) / window_width;
+  int32_t window_cnt_y = (row_num + row_offset + window_row_num - 1) / window_row_num;
+  window_cnt_x = std::max(1, window_cnt_x);
+  window_cnt_y = std::max(1, window_cnt_y);
+
+  // an interval belongs to the window of its row and its min x
+  std::vector<DPWindow*> window_grid(static_cast<size_t>(window_cnt_x) * window_cnt_y, nullptr);
+  for (int32_t i = 0; i < row_num; i++) {
+    int32_t index_y = (i + row_offset) / window_row_num;
+    for (auto* interval : interval_2d_list[i]) {
+      int32_t index_x = std::clamp((interval->get_min_x() + x_offset) / window_width, 0, window_cnt_x - 1);
+      auto*& window = window_grid[static_cast<size_t>(index_y) * window_cnt_x + index_x];
+      if (!window) {
+        window = new DPWindow(-1);
+      }
+      window->add_interval(interval);
+      _interval_to_window.emplace(interval, window);
+    }
+  }
+
+  for (auto* window : window_grid) {
+    if (window) {
+      window->set_window_id(_window_list.size());
+      _window_list.push_back(window);
+    }
+  }
+}
+
+void DPWindowManager::buildConflictList(std::vector<std::vector<int32_t>>& conflict_list)
+{
+  conflict_list.resize(_window_list.size());
+
+  std::vector<int32_t> window_id_list;
+  for (auto* net : _database->get_design()->get_net_list()) {
+    if (net->get_pins().size() > kMaxConflictNetDegree) {
+      _frozen_net_list.push_back(net);
+      continue;
+    }
+
+    window_id_list.clear();
+    for (auto* pin : net->get_pins()) {
+      auto* window = findInstWindow(pin->get_instance());
+      if (window) {
+        window_id_list.push_back(window->get_window_id());
+      }
+    }
+    std::sort(window_id_list.begin(), window_id_list.end());
+    window_id_list.erase(std::unique(window_id_list.begin(), window_id_list.end()), window_id_list.end());
+
+    for (size_t i = 0; i < window_id_list.size(); i++) {
+      for (size_t j = i + 1; j < window_id_list.size(); j++) {
+        conflict_list[window_id_list[i]].push_back(window_id_list[j]);
+        conflict_list[window_id_list[j]].push_back(window_id_list[i]);
+      }
+    }
+  }
+
+  for (auto& window_conflicts : conflict_list) {
+    std::sort(window_conflicts.begin(), window_conflicts.end());
+    window_conflicts.erase(std::unique(window_conflicts.begin(), window_conflicts.end()), window_conflicts.end());
+  }
+}
+
+void DPWindowManager::colorWindowList(std::vector<std::vector<int32_t>>& conflict_list)
+{
+  int32_t window_num = _window_list.size();
+
+  // greedy coloring, the windows with more conflicts first and ties broken by the window id
+  std::vector<int32_t> order_list(window_num);
+  for (int32_t i = 0; i < window_num; i++) {
+    order_list[i] = i;
+  }
+  std::stable_sort(order_list.begin(), order_list.end(),
+                   [&conflict_list](int32_t l_id, int32_t r_id) { return conflict_list[l_id].size() > conflict_list[r_id].size(); });
+
+  // color_mark[c] == id when the color c is taken by a neighbor of the window id
+  std::vector<int32_t> color_mark;
+  for (int32_t window_id : order_list) {
+    for (int32_t neighbor_id : conflict_list[window_id]) {
+      int32_t neighbor_color = _window_list[neighbor_id]->get_color();
+      if (neighbor_color >= 0) {
+        color_mark[neighbor_color] = window_id;
+      }
+    }
+
+    int32_t color = 0;
+    while (color < static_cast<int32_t>(color_mark.size()) && color_mark[color] == window_id) {
+      color++;
+    }
+    if (color == static_cast<int32_t>(color_mark.size())) {
+      color_mark.push_back(-1);
+    }
+    _window_list[window_id]->set_color(color);
+  }
+
+  _color_window_list.resize(color_mark.size());
+  for (auto* window : _window_list) {
+    _color_window_list[window->get_color()].push_back(window);
+  }
+}
+
+DPWindow* DPWindowManager::findInstWindow(DPInstance* inst) const
+{
+  if (!inst || inst->get_state() == DPINSTANCE_STATE::kFixed) {
+    return nullptr;
+  }
+  auto* cluster = inst->get_belong_cluster();
+  if (!cluster) {
+    return nullptr;
+  }
+  return findWindow(cluster->get_belong_interval());
+}
+
+void DPWindowManager::freezeNets(bool is_frozen)
+{
+  for (auto* net : _frozen_net_list) {
+    net->set_frozen(is_frozen);
+  }
+}
+
+}  // namespace ipl
@@ -0,0 +1,129 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+#ifndef IPL_DPWINDOW_H
+#define IPL_DPWINDOW_H
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "config/DetailPlacerConfig.hh"
+#include "database/DPDatabase.hh"
+
+namespace ipl {
+
+class DPWindow
+{
+ public:
+  DPWindow() = delete;
+  explicit DPWindow(int32_t window_id);
+  DPWindow(const DPWindow&) = delete;
+  DPWindow(DPWindow&&) = delete;
+  ~DPWindow();
+
+  DPWindow& operator=(const DPWindow&) = delete;
+  DPWindow& operator=(DPWindow&&) = delete;
+
+  // getter
+  int32_t get_window_id() const { return _window_id; }
+  int32_t get_color() const { return _color; }
+  const std::vector<DPInterval*>& get_interval_list() const { return _interval_list; }
+
+  // setter
+  void set_window_id(int32_t window_id) { _window_id = window_id; }
+  void set_color(int32_t color) { _color = color; }
+  void add_interval(DPInterval* interval);
+
+  // function
+  bool isOwned(DPInterval* interval) const { return _interval_set.find(interval) != _interval_set.end(); }
+  void obtainInstList(std::vector<DPInstance*>& inst_list) const;
+
+ private:
+  int32_t _window_id;
+  int32_t _color;
+  std::vector<DPInterval*> _interval_list;
+  std::unordered_set<DPInterval*> _interval_set;
+};
+
+/**
+ * @brief split the core into windows of rows and own every interval by one window. Two windows conflict when a net
+ * connects movable instances of both, the conflicting windows get different colors. The windows of one color touch
+ * disjoint intervals and disjoint nets, so they run in parallel and the result does not depend on the thread scheduling.
+ * Nets with more pins than the degree limit would join too many windows, they are frozen (skipped by the operators)
+ * while the windows run.
+ */
+class DPWindowManager
+{
+ public:
+  DPWindowManager() = delete;
+  DPWindowManager(DPConfig* config, DPDatabase* database);
+  DPWindowManager(const DPWindowManager&) = delete;
+  DPWindowManager(DPWindowManager&&) = delete;
+  ~DPWindowManager();
+
+  DPWindowManager& operator=(const DPWindowManager&) = delete;
+  DPWindowManager& operator=(DPWindowManager&&) = delete;
+
+  // getter
+  const std::vector<DPWindow*>& get_window_list() const { return _window_list; }
+  int32_t get_color_num() const { return _color_window_list.size(); }
+
+  // function
+  void buildWindowList();
+  DPWindow* findWindow(DPInterval* interval) const;
+
+  template <typename Func>
+  void runWindowList(Func&& func);
+
+ private:
+  DPConfig* _config;
+  DPDatabase* _database;
+  int32_t _build_count;
+
+  std::vector<DPWindow*> _window_list;
+  std::vector<std::vector<DPWindow*>> _color_window_list;
+  std::unordered_map<DPInterval*, DPWindow*> _interval_to_window;
+  std::vector<DPNet*> _frozen_net_list;
+
+  void clearWindowList();
+  void partitionIntervals();
+  void buildConflictList(std::vector<std::vector<int32_t>>& conflict_list);
+  void colorWindowList(std::vector<std::vector<int32_t>>& conflict_list);
+  DPWindow* findInstWindow(DPInstance* inst) const;
+  void freezeNets(bool is_frozen);
+};
+
+template <typename Func>
+void DPWindowManager::runWindowList(Func&& func)
+{
+  freezeNets(true);
+  int32_t thread_num = std::max(1, _config->get_thread_num());
+  for (auto& window_list : _color_window_list) {
+    int32_t window_num = window_list.size();
+#pragma omp parallel for num_threads(thread_num) schedule(dynamic, 1)
+    for (int32_t i = 0; i < window_num; i++) {
+      func(window_list[i]);
+    }
+  }
+  freezeNets(false);
+}
+
+}  // namespace ipl
+
+#endif
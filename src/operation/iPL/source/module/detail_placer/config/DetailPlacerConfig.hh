@@ -48,6 +48,8 @@ public:
     int32_t get_grid_cnt_x() const { return _grid_cnt_x;}
     int32_t get_grid_cnt_y() const { return _grid_cnt_y;}
     int32_t isEnableNetworkflow() const { return _enable_networkflow;} 
+    int32_t isEnableWindowParallel() const { return _enable_window_parallel;}
+    int32_t get_window_row_num() const { return _window_row_num;}
 
     // setter
     void set_thread_num(int32_t num_thread) { _thread_num = num_thread;}
@@ -56,6 +58,8 @@ public:
     void set_grid_cnt_x(int32_t grid_cnt_x) { _grid_cnt_x = grid_cnt_x;}
     void set_grid_cnt_y(int32_t grid_cnt_y) { _grid_cnt_y = grid_cnt_y;}
     void set_enable_networkflow(int32_t enable_networkflow) {_enable_networkflow = enable_networkflow;}
+    void set_enable_window_parallel(int32_t enable_window_parallel) { _enable_window_parallel = enable_window_parallel;}
+    void set_window_row_num(int32_t window_row_num) { _window_row_num = window_row_num;}
 
 private:
     int32_t _thread_num;
@@ -63,6 +67,10 @@ private:
     int32_t _global_padding;
     int32_t _enable_networkflow;
 
+    // window parallel mode, the core is split into windows of _window_row_num rows
+    int32_t _enable_window_parallel = 0;
+    int32_t _window_row_num = 16;
+
     // tmp keep the same as global placement
     int32_t _grid_cnt_x;
     int32_t _grid_cnt_y;
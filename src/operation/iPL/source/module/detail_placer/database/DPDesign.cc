@@ -81,6 +81,7 @@ void DPDesign::add_pin(DPPin* pin)
 
 void DPDesign::add_cluster(DPCluster* cluster)
 {
+  std::lock_guard<std::mutex> lock(_cluster_mutex);
   _dpCluster_map.emplace(cluster->get_name(), cluster);
 }
 
@@ -122,6 +123,7 @@ DPPin* DPDesign::find_pin(std::string pin_name)
 
 DPCluster* DPDesign::find_cluster(std::string cluster_name)
 {
+  std::lock_guard<std::mutex> lock(_cluster_mutex);
   DPCluster* dp_cluster = nullptr;
   auto it = _dpCluster_map.find(cluster_name);
   if (it != _dpCluster_map.end()) {
@@ -161,6 +163,7 @@ int64_t DPDesign::calInstAffectiveHPWL(DPInstance* inst)
 
 void DPDesign::deleteCluster(std::string cluster_name)
 {
+  std::lock_guard<std::mutex> lock(_cluster_mutex);
   auto it = _dpCluster_map.find(cluster_name);
   if (it != _dpCluster_map.end()) {
     delete it->second;
@@ -28,6 +28,7 @@
 #define IPL_DPDESIGN_H
 
 #include <map>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -86,6 +87,7 @@ class DPDesign
   std::map<std::string, DPPin*> _dpPin_map;
 
   std::map<std::string, DPCluster*> _dpCluster_map;
+  std::mutex _cluster_mutex;  // clusters are created and deleted by the parallel windows
 
   std::map<DPInstance*, Instance*> _dpInst_inst_map;
   std::map<Instance*, DPInstance*> _inst_dpInst_map;
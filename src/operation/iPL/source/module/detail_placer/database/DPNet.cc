@@ -28,7 +28,7 @@
 
 namespace ipl {
 
-DPNet::DPNet(std::string name) : _dp_net_id(-1), _name(name), _netweight(1.0f), _driver_pin(nullptr)
+DPNet::DPNet(std::string name) : _dp_net_id(-1), _name(name), _netweight(1.0f), _driver_pin(nullptr), _is_frozen(false)
 {
 }
 
@@ -69,6 +69,7 @@ class DPNet
   float get_netwight() const { return _netweight; }
   DPPin* get_driver_pin() const { return _driver_pin; }
   const std::vector<DPPin*>& get_pins() const { return _pins; }
+  bool isFrozen() const { return _is_frozen; }
 
   // setter
   void set_net_id(int32_t id) { _dp_net_id = id; }
@@ -77,6 +78,7 @@ class DPNet
   void set_netweight(float weight) { _netweight = weight; }
   void set_net_type(DPNET_TYPE net_type) { _type = net_type; }
   void set_net_state(DPNET_STATE net_state) { _state = net_state; }
+  void set_frozen(bool is_frozen) { _is_frozen = is_frozen; }
 
   // function
   int64_t calCurrentHPWL();
@@ -89,6 +91,7 @@ class DPNet
   DPNET_STATE _state;
   float _netweight;
   DPPin* _driver_pin;
+  bool _is_frozen;  // skipped by the operators while the windows run in parallel
   std::vector<DPPin*> _pins;
 };
 }  // namespace ipl
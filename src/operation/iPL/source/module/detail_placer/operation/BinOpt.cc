@@ -50,13 +50,13 @@ void BinOpt::runBinOpt()
 
   // left to right
   auto& grid_2d_list = grid_manager->get_grid_2d_list();
-  for (auto& grid_row : grid_2d_list) {
+  runGridRowList(grid_2d_list, [this, grid_area](std::vector<Grid>& grid_row) {
     for (size_t i = 0, j = i + 1; i < grid_row.size() && j < grid_row.size(); i++, j++) {
       auto* supply_grid = &grid_row[i];
       auto* demand_grid = &grid_row[j];
       slidingInstBetweenGrids(supply_grid, demand_grid, grid_area);
     }
-  }
+  });
 
   // // left to right
   // for (auto* grid_row : grid_manager->get_row_list()) {
@@ -72,13 +72,13 @@ void BinOpt::runBinOpt()
   _operator->updateGridManager();
 
   // right to left
-  for (auto& grid_row : grid_2d_list) {
+  runGridRowList(grid_2d_list, [this, grid_area](std::vector<Grid>& grid_row) {
     for (int32_t i = grid_row.size() - 1, j = i - 1; i >= 0 && j >= 0; i--, j--) {
       auto* supply_grid = &grid_row[i];
       auto* demand_grid = &grid_row[j];
       slidingInstBetweenGrids(supply_grid, demand_grid, grid_area);
     }
-  }
+  });
 
   // // right to left
   // for (auto* grid_row : grid_manager->get_row_list()) {
@@ -91,6 +91,39 @@ void BinOpt::runBinOpt()
   // }
 }
 
+int32_t BinOpt::obtainGridRowColorNum(std::vector<std::vector<Grid>>& grid_2d_list)
+{
+  // grid row i and grid row i + color_num must not share a placement row, the sliding of a grid row only touches the
+  // intervals in its own placement rows.
+  Utility utility;
+  std::vector<std::pair<int32_t, int32_t>> row_range_list;
+  for (auto& grid_row : grid_2d_list) {
+    if (grid_row.empty()) {
+      row_range_list.push_back(std::make_pair(0, 0));
+      continue;
+    }
+    auto& grid_shape = grid_row[0].shape;
+    row_range_list.push_back(utility.obtainMinMaxIdx(0, _row_height, grid_shape.get_ll_y(), grid_shape.get_ur_y()));
+  }
+
+  int32_t grid_row_num = grid_2d_list.size();
+  int32_t color_num = 2;
+  while (color_num < grid_row_num) {
+    bool is_disjoint = true;
+    for (int32_t i = 0; i + color_num < grid_row_num; i++) {
+      if (row_range_list[i].second > row_range_list[i + color_num].first) {
+        is_disjoint = false;
+        break;
+      }
+    }
+    if (is_disjoint) {
+      break;
+    }
+    color_num++;
+  }
+  return color_num;
+}
+
 void BinOpt::slidingInstBetweenGrids(Grid* supply_grid, Grid* demand_grid, int64_t grid_area)
 {
   int64_t target_area = static_cast<float>(grid_area) * supply_grid->available_ratio;
@@ -27,8 +27,10 @@
 #ifndef IPL_BINOPT_H
 #define IPL_BINOPT_H
 
-#include <string>
+#include <algorithm>
 #include <map>
+#include <string>
+#include <vector>
 
 #include "config/DetailPlacerConfig.hh"
 #include "database/DPDatabase.hh"
@@ -56,6 +58,9 @@ private:
     int32_t _row_height;
     int32_t _site_width;
 
+    template <typename Func>
+    void runGridRowList(std::vector<std::vector<Grid>>& grid_2d_list, Func&& func);
+    int32_t obtainGridRowColorNum(std::vector<std::vector<Grid>>& grid_2d_list);
     void slidingInstBetweenGrids(Grid* supply_grid, Grid* demand_grid, int64_t grid_area);
     int64_t calSlidingFlowValue(Grid* supply_grid, Grid* demand_grid, int64_t grid_area);
     DPCluster* obtainIntervalFirstCluster(DPInterval* interval);
@@ -70,5 +75,27 @@ private:
     DPCluster* createInstClusterForInterval(DPInstance* inst, DPInterval* interval);
 
 };
+
+template <typename Func>
+void BinOpt::runGridRowList(std::vector<std::vector<Grid>>& grid_2d_list, Func&& func)
+{
+    int32_t grid_row_num = grid_2d_list.size();
+    if (!_config->isEnableWindowParallel()) {
+        for (int32_t i = 0; i < grid_row_num; i++) {
+            func(grid_2d_list[i]);
+        }
+        return;
+    }
+
+    // the grid rows of one color are apart from each other, they run in parallel
+    int32_t color_num = obtainGridRowColorNum(grid_2d_list);
+    int32_t thread_num = std::max(1, _config->get_thread_num());
+    for (int32_t color = 0; color < color_num; color++) {
+#pragma omp parallel for num_threads(thread_num) schedule(dynamic, 1)
+        for (int32_t i = color; i < grid_row_num; i += color_num) {
+            func(grid_2d_list[i]);
+        }
+    }
+}
 }
 #endif
\ No newline at end of file
@@ -40,10 +40,27 @@ void InstanceSwap::runGlobalSwap()
     _operator->updateInstClustering();
   }
 
+  if (_config->isEnableWindowParallel()) {
+    auto* window_manager = _operator->get_window_manager();
+    window_manager->buildWindowList();
+    window_manager->runWindowList([this](DPWindow* window) {
+      std::vector<DPInstance*> inst_list;
+      window->obtainInstList(inst_list);
+      std::vector<DPInstance*> movable_inst_list;
+      sortInstBasedHPWLBenefit(inst_list, movable_inst_list, window);
+      globalSwapInstList(movable_inst_list, window);
+    });
+    return;
+  }
+
   // step 1: sort inst based on their hpwl benefit
   std::vector<DPInstance*> movable_inst_list;
-  sortInstBasedHPWLBenefit(movable_inst_list);
+  sortInstBasedHPWLBenefit(_database->get_design()->get_inst_list(), movable_inst_list, nullptr);
+  globalSwapInstList(movable_inst_list, nullptr);
+}
 
+int64_t InstanceSwap::globalSwapInstList(const std::vector<DPInstance*>& movable_inst_list, DPWindow* window)
+{
   int64_t total_benefit = 0;
 
   for (auto* inst : movable_inst_list) {
@@ -51,7 +68,7 @@ void InstanceSwap::runGlobalSwap()
 
     // step 2: select optimal region candidate
     std::vector<std::pair<Point<int32_t>, DPInstance*>> candidate_list;
-    searchCandidateCoordiList(optimal_region, inst, candidate_list);
+    searchCandidateCoordiList(optimal_region, inst, candidate_list, window);
 
     // step 3: trially place or swap, calculate the benefit
     std::pair<Point<int32_t>, DPInstance*> best_candidate;
@@ -87,6 +104,7 @@ void InstanceSwap::runGlobalSwap()
     total_benefit += best_benefit;
   }
   // LOG_INFO << "Expected Total HPWL Benefit: " << total_benefit;
+  return total_benefit;
 }
 
 void InstanceSwap::runVerticalSwap()
@@ -96,8 +114,24 @@ void InstanceSwap::runVerticalSwap()
     _operator->updateInstClustering();
   }
 
+  if (_config->isEnableWindowParallel()) {
+    auto* window_manager = _operator->get_window_manager();
+    window_manager->buildWindowList();
+    window_manager->runWindowList([this](DPWindow* window) {
+      std::vector<DPInstance*> inst_list;
+      window->obtainInstList(inst_list);
+      verticalSwapInstList(inst_list, window);
+    });
+    return;
+  }
+
+  verticalSwapInstList(_database->get_design()->get_inst_list(), nullptr);
+}
+
+int64_t InstanceSwap::verticalSwapInstList(const std::vector<DPInstance*>& inst_list, DPWindow* window)
+{
   int64_t total_benefit = 0;
-  for (auto* inst : _database->get_design()->get_inst_list()) {
+  for (auto* inst : inst_list) {
     if (inst->get_state() == DPINSTANCE_STATE::kFixed) {
       continue;
     }
@@ -105,7 +139,7 @@ void InstanceSwap::runVerticalSwap()
     // step 1: select optimal row candidate
     std::vector<std::pair<Point<int32_t>, DPInstance*>> candidate_list;
     std::pair<int32_t, int32_t> optimal_line = _operator->obtainOptimalYCoordiLine(inst);
-    searchImproveYCoordiList(optimal_line, inst, 1, candidate_list);
+    searchImproveYCoordiList(optimal_line, inst, 1, candidate_list, window);
 
     // step 2: trially place or swap, calculate the benefit
     std::pair<Point<int32_t>, DPInstance*> best_candidate;
@@ -143,19 +177,24 @@ void InstanceSwap::runVerticalSwap()
     total_benefit += best_benefit;
   }
   // LOG_INFO << "Expected Total HPWL Benefit: " << total_benefit;
+  return total_benefit;
 }
 
-void InstanceSwap::sortInstBasedHPWLBenefit(std::vector<DPInstance*>& movable_inst_list)
+void InstanceSwap::sortInstBasedHPWLBenefit(const std::vector<DPInstance*>& inst_list, std::vector<DPInstance*>& movable_inst_list,
+                                            DPWindow* window)
 {
   std::map<int64_t, std::vector<DPInstance*>, std::greater<int64_t>> inst_map;
 
-  for (auto* inst : _database->get_design()->get_inst_list()) {
+  for (auto* inst : inst_list) {
     if (inst->get_state() == DPINSTANCE_STATE::kFixed) {
       continue;
     }
 
     Rectangle<int32_t> optimal_region = std::move(_operator->obtainOptimalCoordiRegion(inst));
-    int64_t benefit = placeInstance(inst, optimal_region.get_ll_x(), optimal_region.get_ll_y(), true);
+    int64_t benefit = INT64_MIN;
+    if (checkInWindow(optimal_region, inst, window)) {
+      benefit = placeInstance(inst, optimal_region.get_ll_x(), optimal_region.get_ll_y(), true);
+    }
 
     auto it = inst_map.find(benefit);
     if (it != inst_map.end()) {
@@ -174,7 +213,7 @@ void InstanceSwap::sortInstBasedHPWLBenefit(std::vector<DPInstance*>& movable_in
 }
 
 void InstanceSwap::searchCandidateCoordiList(Rectangle<int32_t>& optimal_region, DPInstance* inst,
-                                             std::vector<std::pair<Point<int32_t>, DPInstance*>>& candidate_list)
+                                             std::vector<std::pair<Point<int32_t>, DPInstance*>>& candidate_list, DPWindow* window)
 {
   Utility utility;
   int32_t origin_x = inst->get_coordi().get_x();
@@ -230,8 +269,9 @@ void InstanceSwap::searchCandidateCoordiList(Rectangle<int32_t>& optimal_region,
         int32_t min_x = front_interval->get_max_x() - inst_width;
         int32_t max_x = interval->get_min_x();
         optimal_region.set_rectangle(min_x, optimal_region.get_ll_y(), max_x, optimal_region.get_ur_y());
-        fillIntervalCandidateList(front_interval, optimal_region.get_ll_x(), optimal_region.get_ur_x(), inst_width, candidate_list);
-        fillIntervalCandidateList(interval, optimal_region.get_ll_x(), optimal_region.get_ur_x(), inst_width, candidate_list);
+        fillIntervalCandidateList(front_interval, optimal_region.get_ll_x(), optimal_region.get_ur_x(), inst_width, candidate_list,
+                                  window);
+        fillIntervalCandidateList(interval, optimal_region.get_ll_x(), optimal_region.get_ur_x(), inst_width, candidate_list, window);
         case2_flag = false;
         break;
       }
@@ -239,7 +279,7 @@ void InstanceSwap::searchCandidateCoordiList(Rectangle<int32_t>& optimal_region,
       bool overlap_flag
           = _operator->checkOverlap(interval->get_min_x(), interval->get_max_x(), optimal_region.get_ll_x(), optimal_region.get_ur_x());
       if (overlap_flag) {
-        fillIntervalCandidateList(interval, optimal_region.get_ll_x(), optimal_region.get_ur_x(), inst_width, candidate_list);
+        fillIntervalCandidateList(interval, optimal_region.get_ll_x(), optimal_region.get_ur_x(), inst_width, candidate_list, window);
       }
 
       front_interval = interval;
@@ -253,7 +293,7 @@ void InstanceSwap::searchCandidateCoordiList(Rectangle<int32_t>& optimal_region,
 }
 
 void InstanceSwap::searchImproveYCoordiList(std::pair<int32_t, int32_t>& optimal_line, DPInstance* inst, int32_t row_range,
-                                            std::vector<std::pair<Point<int32_t>, DPInstance*>>& candidate_list)
+                                            std::vector<std::pair<Point<int32_t>, DPInstance*>>& candidate_list, DPWindow* window)
 {
   int32_t origin_y = inst->get_coordi().get_y();
   // already in optimal line
@@ -269,20 +309,25 @@ void InstanceSwap::searchImproveYCoordiList(std::pair<int32_t, int32_t>& optimal
 
   if (origin_y < optimal_line.first) {
     for (auto* interval : interval_2d_list[row_index + 1]) {
-      fillIntervalCandidateList(interval, inst_min_x, inst_max_x, inst_width, candidate_list);
+      fillIntervalCandidateList(interval, inst_min_x, inst_max_x, inst_width, candidate_list, window);
     }
   }
 
   if (origin_y > optimal_line.second) {
     for (auto* interval : interval_2d_list[row_index - 1]) {
-      fillIntervalCandidateList(interval, inst_min_x, inst_max_x, inst_width, candidate_list);
+      fillIntervalCandidateList(interval, inst_min_x, inst_max_x, inst_width, candidate_list, window);
     }
   }
 }
 
 void InstanceSwap::fillIntervalCandidateList(DPInterval* interval, int32_t query_min, int32_t query_max, int32_t inst_width,
-                                             std::vector<std::pair<Point<int32_t>, DPInstance*>>& candidate_list)
+                                             std::vector<std::pair<Point<int32_t>, DPInstance*>>& candidate_list, DPWindow* window)
 {
+  // the intervals of other windows may be changed by other threads
+  if (window && !window->isOwned(interval)) {
+    return;
+  }
+
   std::pair<int32_t, int32_t> overlap_range
       = _operator->obtainOverlapRange(interval->get_min_x(), interval->get_max_x(), query_min, query_max);
   int32_t coordi_y = interval->get_belong_row()->get_coordinate().get_y();
@@ -558,6 +603,19 @@ void InstanceSwap::updateAloneInstToInterval(DPInstance* inst, DPInterval* inter
   _database->get_design()->add_cluster(new_cluster);
 }
 
+bool InstanceSwap::checkInWindow(Rectangle<int32_t>& optimal_region, DPInstance* inst, DPWindow* window)
+{
+  if (!window) {
+    return true;
+  }
+
+  Rectangle<int32_t> trial_inst_shape(optimal_region.get_ll_x(), optimal_region.get_ll_y(),
+                                      optimal_region.get_ll_x() + inst->get_shape().get_width(),
+                                      optimal_region.get_ll_y() + inst->get_shape().get_height());
+  auto* trial_interval = obtainCorrespondingInterval(trial_inst_shape);
+  return !trial_interval || window->isOwned(trial_interval);
+}
+
 DPInterval* InstanceSwap::obtainCurrentInterval(DPInstance* inst)
 {
   DPInterval* target_interval = nullptr;
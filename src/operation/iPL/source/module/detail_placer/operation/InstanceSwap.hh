@@ -56,10 +56,14 @@ private:
     int32_t _row_height;
     int32_t _site_width;
 
-    void sortInstBasedHPWLBenefit(std::vector<DPInstance*>& movable_inst_list);
-    void searchCandidateCoordiList(Rectangle<int32_t>& optimal_region, DPInstance* inst, std::vector<std::pair<Point<int32_t>, DPInstance*>>& candidate_list);
-    void searchImproveYCoordiList(std::pair<int32_t, int32_t>& optimal_line, DPInstance* inst, int32_t row_range, std::vector<std::pair<Point<int32_t>, DPInstance*>>& candidate_list);
-    void fillIntervalCandidateList(DPInterval* interval, int32_t query_min, int32_t query_max, int32_t inst_width, std::vector<std::pair<Point<int32_t>, DPInstance*>>& candidate_list);
+    // window is nullptr in the serial mode, otherwise the candidates are limited to the intervals of the window
+    int64_t globalSwapInstList(const std::vector<DPInstance*>& movable_inst_list, DPWindow* window);
+    int64_t verticalSwapInstList(const std::vector<DPInstance*>& inst_list, DPWindow* window);
+    void sortInstBasedHPWLBenefit(const std::vector<DPInstance*>& inst_list, std::vector<DPInstance*>& movable_inst_list, DPWindow* window);
+    void searchCandidateCoordiList(Rectangle<int32_t>& optimal_region, DPInstance* inst, std::vector<std::pair<Point<int32_t>, DPInstance*>>& candidate_list, DPWindow* window);
+    void searchImproveYCoordiList(std::pair<int32_t, int32_t>& optimal_line, DPInstance* inst, int32_t row_range, std::vector<std::pair<Point<int32_t>, DPInstance*>>& candidate_list, DPWindow* window);
+    void fillIntervalCandidateList(DPInterval* interval, int32_t query_min, int32_t query_max, int32_t inst_width, std::vector<std::pair<Point<int32_t>, DPInstance*>>& candidate_list, DPWindow* window);
+    bool checkInWindow(Rectangle<int32_t>& optimal_region, DPInstance* inst, DPWindow* window);
 
     int64_t placeInstance(DPInstance* inst, int32_t x_coordi, int32_t y_coordi, bool is_trial);
     int64_t swapInstance(DPInstance* inst_1, DPInstance* inst_2, bool is_trial);
@@ -38,54 +38,71 @@ void LocalReorder::runLocalReorder(){
     }
 
     int64_t total_benefit = 0;
-    auto& interval_2d_list = _database->get_layout()->get_interval_2d_list();
 
-    // Debug
-    int32_t row_index = 0;
+    if(_config->isEnableWindowParallel()){
+        auto* window_manager = _operator->get_window_manager();
+        window_manager->buildWindowList();
+        std::vector<int64_t> window_benefit_list(window_manager->get_window_list().size(), 0);
+        window_manager->runWindowList([this, &window_benefit_list](DPWindow* window){
+            for(auto* interval : window->get_interval_list()){
+                window_benefit_list[window->get_window_id()] += reorderInterval(interval);
+            }
+        });
+        for(int64_t window_benefit : window_benefit_list){
+            total_benefit += window_benefit;
+        }
+        // LOG_INFO << "Expected HPWL Benefit: " << total_benefit;
+        return;
+    }
 
+    auto& interval_2d_list = _database->get_layout()->get_interval_2d_list();
     for(auto& interval_list : interval_2d_list){
         for(auto* interval : interval_list){
-
-            auto* cur_cluster = interval->get_cluster_root();
-            while(cur_cluster){
-                auto inst_list = cur_cluster->get_inst_list();
-                for(size_t i=0,j=i+1; i< inst_list.size() && j < inst_list.size(); i++,j++){
-                    auto* inst_1 = inst_list[i];
-                    auto* inst_2 = inst_list[j];
-                    int64_t origin_hpwl = _operator->calInstPairAffectiveHPWL(inst_1, inst_2);
-
-                    int32_t coordi_x = inst_1->get_coordi().get_x();
-                    int32_t coordi_y = inst_1->get_coordi().get_y();
-
-                    inst_2->updateCoordi(coordi_x, coordi_y);
-                    inst_1->updateCoordi(coordi_x + inst_2->get_shape().get_width(), coordi_y);
-                    int64_t modify_hpwl = _operator->calInstPairAffectiveHPWL(inst_1, inst_2);
-
-                    if(origin_hpwl > modify_hpwl){
-                        int32_t inst1_internal_id = inst_1->get_internal_id();
-                        int32_t inst2_internal_id = inst_2->get_internal_id();
-                        inst_1->set_internal_id(inst2_internal_id);
-                        inst_2->set_internal_id(inst1_internal_id);
-                        cur_cluster->replaceInstance(inst_2, inst1_internal_id);
-                        cur_cluster->replaceInstance(inst_1, inst2_internal_id);
-                        inst_list[i] = inst_2;
-                        inst_list[j] = inst_1;
-                        
-                        total_benefit += (origin_hpwl - modify_hpwl);
-                    }else{
-                        inst_1->updateCoordi(coordi_x, coordi_y);
-                        inst_2->updateCoordi(coordi_x + inst_1->get_shape().get_width(), coordi_y);
-                    }
-                }
-                cur_cluster = cur_cluster->get_back_cluster();
-            }
-
+            total_benefit += reorderInterval(interval);
         }
-        row_index += 1;
     }
 
     // LOG_INFO << "Expected HPWL Benefit: " << total_benefit;
 }
 
+int64_t LocalReorder::reorderInterval(DPInterval* interval){
+    int64_t total_benefit = 0;
+
+    auto* cur_cluster = interval->get_cluster_root();
+    while(cur_cluster){
+        auto inst_list = cur_cluster->get_inst_list();
+        for(size_t i=0,j=i+1; i< inst_list.size() && j < inst_list.size(); i++,j++){
+            auto* inst_1 = inst_list[i];
+            auto* inst_2 = inst_list[j];
+            int64_t origin_hpwl = _operator->calInstPairAffectiveHPWL(inst_1, inst_2);
+
+            int32_t coordi_x = inst_1->get_coordi().get_x();
+            int32_t coordi_y = inst_1->get_coordi().get_y();
+
+            inst_2->updateCoordi(coordi_x, coordi_y);
+            inst_1->updateCoordi(coordi_x + inst_2->get_shape().get_width(), coordi_y);
+            int64_t modify_hpwl = _operator->calInstPairAffectiveHPWL(inst_1, inst_2);
+
+            if(origin_hpwl > modify_hpwl){
+                int32_t inst1_internal_id = inst_1->get_internal_id();
+                int32_t inst2_internal_id = inst_2->get_internal_id();
+                inst_1->set_internal_id(inst2_internal_id);
+                inst_2->set_internal_id(inst1_internal_id);
+                cur_cluster->replaceInstance(inst_2, inst1_internal_id);
+                cur_cluster->replaceInstance(inst_1, inst2_internal_id);
+                inst_list[i] = inst_2;
+                inst_list[j] = inst_1;
+                
+                total_benefit += (origin_hpwl - modify_hpwl);
+            }else{
+                inst_1->updateCoordi(coordi_x, coordi_y);
+                inst_2->updateCoordi(coordi_x + inst_1->get_shape().get_width(), coordi_y);
+            }
+        }
+        cur_cluster = cur_cluster->get_back_cluster();
+    }
+
+    return total_benefit;
+}
 
 }
\ No newline at end of file
@@ -52,6 +52,8 @@ private:
     DPConfig* _config;
     DPDatabase* _database;
     DPOperator* _operator;
+
+    int64_t reorderInterval(DPInterval* interval);
 };
 }
 #endif
\ No newline at end of file
@@ -127,6 +127,9 @@ void RowOpt::generateClusterBounds(DPCluster* cluster, std::vector<int32_t>& bou
       std::pair<int32_t, int32_t> pin_offset = std::move(inst->calInstPinModifyOffest(inst_pin));
 
       auto* pin_net = inst_pin->get_net();
+      if (pin_net->isFrozen()) {
+        continue;
+      }
       DPPin* l_pin = nullptr;
       DPPin* r_pin = nullptr;
       int32_t max_x = INT32_MIN;
@@ -237,62 +240,75 @@ void RowOpt::correctOptimalLineInInterval(std::pair<int32_t, int32_t>& optimal_l
 
 void RowOpt::runRowOpt()
 {
-  int32_t interval_count = 0;
+  if (_config->isEnableWindowParallel()) {
+    auto* window_manager = _operator->get_window_manager();
+    window_manager->buildWindowList();
+    window_manager->runWindowList([this](DPWindow* window) {
+      for (auto* interval : window->get_interval_list()) {
+        auto it = _interval_to_root.find(interval);
+        if (it != _interval_to_root.end()) {
+          optimizeInterval(interval, it->second);
+        }
+      }
+    });
+    return;
+  }
+
   for (auto pair : _interval_to_root) {
-    DPInterval* interval = pair.first;
-    DPCluster* cluster_root = pair.second;
+    optimizeInterval(pair.first, pair.second);
+  }
+}
 
-    if (!cluster_root) {
-      continue;
-    }
+void RowOpt::optimizeInterval(DPInterval* interval, DPCluster* cluster_root)
+{
+  if (!cluster_root) {
+    return;
+  }
 
-    DPCluster* current_cluster = cluster_root;
+  DPCluster* current_cluster = cluster_root;
 
-    while (current_cluster) {
-      std::vector<int32_t> bound_list;
-      generateClusterBounds(current_cluster, bound_list);
-      current_cluster->add_bound_list(bound_list);
+  while (current_cluster) {
+    std::vector<int32_t> bound_list;
+    generateClusterBounds(current_cluster, bound_list);
+    current_cluster->add_bound_list(bound_list);
 
-      std::pair<int32_t, int32_t> optimal_line = std::move(current_cluster->obtainOptimalMinCoordiLine());
-
-      correctOptimalLineInInterval(optimal_line, interval, current_cluster->get_total_width());
-      auto* front_cluster = current_cluster->get_front_cluster();
-      auto* back_cluster = current_cluster->get_back_cluster();
-      if (front_cluster) {
-        int32_t front_max_x = front_cluster->get_max_x();
-        if (optimal_line.second >= front_max_x) {
-          int32_t optimal_x = optimal_line.first > front_max_x ? optimal_line.first : front_max_x;
-          current_cluster->set_min_x(obtainOptimalLegalCoordiX(optimal_x, optimal_line));
-        } else {  // overlap
-          current_cluster->set_min_x(optimal_line.second);
-          collapseClusters(front_cluster, current_cluster);
-        }
-      } else {
-        current_cluster->set_min_x(obtainOptimalLegalCoordiX(optimal_line.first, optimal_line));
-      }
-      current_cluster = back_cluster;
-    }
+    std::pair<int32_t, int32_t> optimal_line = std::move(current_cluster->obtainOptimalMinCoordiLine());
 
-    DPCluster* cluster_record = cluster_root;
-    int32_t coordi_y = interval->get_belong_row()->get_coordinate().get_y();
-    while (cluster_record) {
-      int32_t coordi_x = cluster_record->get_min_x();
-      int32_t internal_id = 0;
-      for (auto* inst : cluster_record->get_inst_list()) {
-        inst->set_belong_cluster(cluster_record);
-        inst->set_internal_id(internal_id++);
-        inst->updateCoordi(coordi_x, coordi_y);
-
-        int32_t inst_width = inst->get_shape().get_width();
-        coordi_x += inst_width;
-        interval->updateRemainLength(0 - inst_width);
+    correctOptimalLineInInterval(optimal_line, interval, current_cluster->get_total_width());
+    auto* front_cluster = current_cluster->get_front_cluster();
+    auto* back_cluster = current_cluster->get_back_cluster();
+    if (front_cluster) {
+      int32_t front_max_x = front_cluster->get_max_x();
+      if (optimal_line.second >= front_max_x) {
+        int32_t optimal_x = optimal_line.first > front_max_x ? optimal_line.first : front_max_x;
+        current_cluster->set_min_x(obtainOptimalLegalCoordiX(optimal_x, optimal_line));
+      } else {  // overlap
+        current_cluster->set_min_x(optimal_line.second);
+        collapseClusters(front_cluster, current_cluster);
       }
-      cluster_record = cluster_record->get_back_cluster();
+    } else {
+      current_cluster->set_min_x(obtainOptimalLegalCoordiX(optimal_line.first, optimal_line));
     }
-    interval->set_cluster_root(cluster_root);
+    current_cluster = back_cluster;
+  }
 
-    ++interval_count;
+  DPCluster* cluster_record = cluster_root;
+  int32_t coordi_y = interval->get_belong_row()->get_coordinate().get_y();
+  while (cluster_record) {
+    int32_t coordi_x = cluster_record->get_min_x();
+    int32_t internal_id = 0;
+    for (auto* inst : cluster_record->get_inst_list()) {
+      inst->set_belong_cluster(cluster_record);
+      inst->set_internal_id(internal_id++);
+      inst->updateCoordi(coordi_x, coordi_y);
+
+      int32_t inst_width = inst->get_shape().get_width();
+      coordi_x += inst_width;
+      interval->updateRemainLength(0 - inst_width);
+    }
+    cluster_record = cluster_record->get_back_cluster();
   }
+  interval->set_cluster_root(cluster_root);
 }
 
 void RowOpt::collapseClusters(DPCluster* dest_cluster, DPCluster* src_cluster)
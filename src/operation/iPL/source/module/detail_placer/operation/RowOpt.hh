@@ -63,6 +63,7 @@ private:
     void convertInstListToClusters(std::vector<DPInstance*>& movable_inst_list);
     void updateClusterBoundList();
     void generateClusterBounds(DPCluster* cluster, std::vector<int32_t>& bound_list);
+    void optimizeInterval(DPInterval* interval, DPCluster* cluster_root);
     void correctOptimalLineInInterval(std::pair<int32_t, int32_t>& optimal_line, DPInterval* interval, int32_t width);
 
     int32_t obtainOptimalLegalCoordiX(int32_t optimal_x, std::pair<int32_t, int32_t>& optimal_line);
@@ -0,0 +1,111 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+/**
+ * @file DPWindowTest.cc
+ * @brief compare the HPWL of the window parallel detail placement with the serial detail placement on the same
+ * legalized design. The design is given by IPL_TEST_DB_CONFIG and IPL_TEST_PL_CONFIG, for example the configs of
+ * scripts/design/sky130_gcd after the placement inputs are filled in.
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "DetailPlacer.hh"
+#include "PLAPI.hh"
+#include "PlacerDB.hh"
+#include "gtest/gtest.h"
+#include "idm.h"
+
+namespace ipl {
+
+class DPWindowTest : public testing::Test
+{
+ protected:
+  void SetUp() override
+  {
+    const char* db_config = std::getenv("IPL_TEST_DB_CONFIG");
+    const char* pl_config = std::getenv("IPL_TEST_PL_CONFIG");
+    if (!db_config || !pl_config) {
+      GTEST_SKIP() << "IPL_TEST_DB_CONFIG and IPL_TEST_PL_CONFIG are not set";
+    }
+    dmInst->init(db_config);
+    _pl_config = pl_config;
+  }
+  void TearDown() final {}
+
+  // the placement of every instance, so every detail placement starts from the same legalized design
+  void saveInstances()
+  {
+    _inst_state_list.clear();
+    for (auto* inst : PlacerDBInst.get_design()->get_instance_list()) {
+      _inst_state_list.emplace_back(inst->get_coordi(), inst->get_orient(), inst->get_instance_state());
+    }
+  }
+
+  void restoreInstances()
+  {
+    auto inst_list = PlacerDBInst.get_design()->get_instance_list();
+    for (size_t i = 0; i < inst_list.size(); i++) {
+      auto& [coordi, orient, state] = _inst_state_list[i];
+      inst_list[i]->set_orient(orient);
+      inst_list[i]->update_coordi(coordi);
+      inst_list[i]->set_instance_state(state);
+    }
+    PlacerDBInst.updateTopoManager();
+    PlacerDBInst.updateGridManager();
+  }
+
+  int64_t runDetailPlace(int32_t enable_window_parallel, int32_t thread_num)
+  {
+    restoreInstances();
+    auto& dp_config = PlacerDBInst.get_placer_config()->get_dp_config();
+    dp_config.set_enable_window_parallel(enable_window_parallel);
+    dp_config.set_thread_num(thread_num);
+
+    DetailPlacer detail_place(PlacerDBInst.get_placer_config(), &PlacerDBInst);
+    detail_place.runDetailPlace();
+    EXPECT_TRUE(detail_place.checkIsLegal());
+    return detail_place.calTotalHPWL();
+  }
+
+  std::string _pl_config;
+  std::vector<std::tuple<Point<int32_t>, Orient, INSTANCE_STATE>> _inst_state_list;
+};
+
+TEST_F(DPWindowTest, hpwl_match_serial)
+{
+  iPLAPIInst.initAPI(_pl_config, dmInst->get_idb_builder());
+  ASSERT_TRUE(iPLAPIInst.runLG());
+  saveInstances();
+
+  int64_t serial_hpwl = runDetailPlace(0, 8);
+  int64_t window_hpwl = runDetailPlace(1, 8);
+  int64_t window_single_thread_hpwl = runDetailPlace(1, 1);
+  std::cout << "Serial DP HPWL: " << serial_hpwl << ", Window DP HPWL: " << window_hpwl << std::endl;
+
+  // the windows of one color are independent, so the result does not depend on the thread num
+  EXPECT_EQ(window_hpwl, window_single_thread_hpwl);
+  // the nets over the degree limit are frozen while the windows run, allow 1% of the serial HPWL
+  EXPECT_LE(window_hpwl, serial_hpwl + serial_hpwl / 100);
+
+  iPLAPIInst.destoryInst();
+}
+
+}  // namespace ipl
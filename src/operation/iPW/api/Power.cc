@@ -26,6 +26,8 @@
 
 #include <array>
 #include <filesystem>
+#include <functional>
+#include <unordered_set>
 
 #include "ops/annotate_toggle_sp/AnnotateToggleSP.hh"
 #include "ops/build_graph/PwrBuildGraph.hh"
@@ -116,6 +118,28 @@ unsigned Power::readRustVCD(const char* vcd_path,
   return 1;
 }
 
+/**
+ * @brief read vcd in stream, the toggle and sp is accumulated in one pass
+ * without holding the waveform, the time windows is used for report the power
+ * of each window.
+ *
+ * @param vcd_path
+ * @param top_instance_name
+ * @param time_windows
+ * @return unsigned
+ */
+unsigned Power::readVCDStream(const char* vcd_path,
+                              const char* top_instance_name,
+                              std::vector<VcdTimeWindow>&& time_windows) {
+  LOG_INFO << "read vcd start";
+  _vcd_stream_reader.set_time_windows(std::move(time_windows));
+  unsigned is_ok = _vcd_stream_reader.readVcdFile(vcd_path, top_instance_name);
+  _is_stream_vcd = true;
+  LOG_INFO << "read vcd end";
+
+  return is_ok;
+}
+
 /**
  * @brief annotate vcd toggle sp to pwr vertex.
  *
@@ -123,10 +147,22 @@ unsigned Power::readRustVCD(const char* vcd_path,
  * @return unsigned
  */
 unsigned Power::annotateToggleSP() {
+  auto* annotate_db = _is_stream_vcd ? _vcd_stream_reader.get_annotate_db()
+                                     : _rust_vcd_wrapper.get_annotate_db();
+  return annotateToggleSP(annotate_db);
+}
+
+/**
+ * @brief annotate the toggle sp of the annotate db to pwr vertex.
+ *
+ * @param annotate_db
+ * @return unsigned
+ */
+unsigned Power::annotateToggleSP(AnnotateDB* annotate_db) {
   LOG_INFO << "annotate toggle sp start";
 
   AnnotateToggleSP annotate_toggle_SP;
-  annotate_toggle_SP.set_annotate_db(_rust_vcd_wrapper.get_annotate_db());
+  annotate_toggle_SP.set_annotate_db(annotate_db);
 
   unsigned is_ok = annotate_toggle_SP(&_power_graph);
   LOG_INFO << "annotate toggle sp end";
@@ -224,8 +260,14 @@ unsigned Power::propagateToggleSP() {
  */
 unsigned Power::calcLeakagePower() {
   PwrCalcLeakagePower calc_leakage_power;
+  calc_leakage_power.set_num_threads(_calc_num_threads);
   calc_leakage_power(&_power_graph);
   _leakage_powers = std::move(calc_leakage_power.takeLeakagePowers());
+
+  _inst_to_leakage_index.clear();
+  for (std::size_t i = 0; i < _leakage_powers.size(); ++i) {
+    _inst_to_leakage_index[_leakage_powers[i]->get_design_obj()] = i;
+  }
   return 1;
 }
 
@@ -236,8 +278,14 @@ unsigned Power::calcLeakagePower() {
  */
 unsigned Power::calcInternalPower() {
   PwrCalcInternalPower calc_internal_power;
+  calc_internal_power.set_num_threads(_calc_num_threads);
   calc_internal_power(&_power_graph);
   _internal_powers = std::move(calc_internal_power.takeInternalPowers());
+
+  _inst_to_internal_index.clear();
+  for (std::size_t i = 0; i < _internal_powers.size(); ++i) {
+    _inst_to_internal_index[_internal_powers[i]->get_design_obj()] = i;
+  }
   return 1;
 }
 
@@ -248,8 +296,14 @@ unsigned Power::calcInternalPower() {
  */
 unsigned Power::calcSwitchPower() {
   PwrCalcSwitchPower calc_switch_power;
+  calc_switch_power.set_num_threads(_calc_num_threads);
   calc_switch_power(&_power_graph);
   _switch_powers = std::move(calc_switch_power.takeSwitchPowers());
+
+  _net_to_switch_index.clear();
+  for (std::size_t i = 0; i < _switch_powers.size(); ++i) {
+    _net_to_switch_index[_switch_powers[i]->get_design_obj()] = i;
+  }
   return 1;
 }
 
@@ -280,6 +334,361 @@ unsigned Power::updatePower() {
   return 1;
 }
 
+/**
+ * @brief replace the power data of the design object, append it if the object
+ * is new, swap with the last one and remove it if the data is nullptr.
+ *
+ * @param power_datas
+ * @param obj_to_index
+ * @param design_obj
+ * @param power_data
+ * @return double the old power of the object, 0 if the object is new.
+ */
+template <typename PowerData>
+static double updatePowerData(
+    std::vector<std::unique_ptr<PowerData>>& power_datas,
+    std::unordered_map<DesignObject*, std::size_t>& obj_to_index,
+    DesignObject* design_obj, std::unique_ptr<PowerData> power_data) {
+  auto it = obj_to_index.find(design_obj);
+  if (it == obj_to_index.end()) {
+    if (power_data) {
+      obj_to_index[design_obj] = power_datas.size();
+      power_datas.emplace_back(std::move(power_data));
+    }
+    return 0.0;
+  }
+
+  std::size_t index = it->second;
+  double old_power = power_datas[index]->getPowerDataValue();
+  if (power_data) {
+    power_datas[index] = std::move(power_data);
+  } else {
+    obj_to_index.erase(it);
+    if (index != power_datas.size() - 1) {
+      power_datas[index] = std::move(power_datas.back());
+      obj_to_index[power_datas[index]->get_design_obj()] = index;
+    }
+    power_datas.pop_back();
+  }
+  return old_power;
+}
+
+/**
+ * @brief propagate the toggle and sp of the vertexes which are new or whose
+ * driver is changed, the fanout of them is not propagated again, which is
+ * right for the buffer insert or remove that keeps the logic.
+ *
+ * @param the_vertexes
+ * @return unsigned
+ */
+unsigned Power::incrPropagateToggleSP(
+    const std::vector<PwrVertex*>& the_vertexes) {
+  PwrPropagateToggleSP propagate_toggle_sp;
+  propagate_toggle_sp.set_the_pwr_graph(&_power_graph);
+  for (auto* the_vertex : the_vertexes) {
+    the_vertex->exec(propagate_toggle_sp);
+  }
+
+  // the vertex driven by the clock network is clock network too, the clock
+  // pin of register is the end.
+  std::unordered_set<PwrVertex*> unvisited_vertexes(the_vertexes.begin(),
+                                                    the_vertexes.end());
+  std::function<void(PwrVertex*)> propagate_clock =
+      [&propagate_clock, &unvisited_vertexes](PwrVertex* the_vertex) {
+        if (!unvisited_vertexes.erase(the_vertex)) {
+          return;
+        }
+
+        PwrVertex* clock_src_vertex = nullptr;
+        FOREACH_SNK_PWR_ARC(the_vertex, snk_arc) {
+          auto* src_vertex = snk_arc->get_src();
+          propagate_clock(src_vertex);
+          if (src_vertex->is_clock_network() &&
+              !src_vertex->get_sta_vertex()->is_clock()) {
+            clock_src_vertex = src_vertex;
+          }
+        }
+
+        if (clock_src_vertex) {
+          the_vertex->set_is_clock_network();
+          the_vertex->addData(
+              clock_src_vertex->getToggleData(PwrDataSource::kClockPropagation),
+              clock_src_vertex->getSPData(PwrDataSource::kClockPropagation),
+              PwrDataSource::kClockPropagation);
+        }
+      };
+
+  for (auto* the_vertex : the_vertexes) {
+    propagate_clock(the_vertex);
+  }
+
+  return 1;
+}
+
+/**
+ * @brief incremental update the power of the changed instances and nets, the
+ * timing graph should be updated before, include the inserted or removed
+ * buffers, the resized instances and the slew, load of them. The changed inst
+ * affect the power of its pin nets and the drivers of them, the changed net
+ * affect the power of its driver and load insts.
+ *
+ * The changed insts not in the power graph are inserted, the power graph of
+ * them and the net arcs of the changed nets are built. The removed insts and
+ * nets are removed from the power data, the group data and the power graph,
+ * they should be still alive until the power delta is reported. The
+ * sequential inst could not be inserted incrementally, rebuild the power
+ * graph for it.
+ *
+ * @param changed_insts
+ * @param changed_nets
+ * @param removed_insts
+ * @param removed_nets
+ * @return unsigned
+ */
+unsigned Power::incrUpdatePower(const std::vector<Instance*>& changed_insts,
+                                const std::vector<Net*>& changed_nets,
+                                const std::vector<Instance*>& removed_insts,
+                                const std::vector<Net*>& removed_nets) {
+  ieda::Stats stats;
+  LOG_INFO << "incremental power calculation start";
+
+  std::unordered_set<Instance*> removed_inst_set(removed_insts.begin(),
+                                                 removed_insts.end());
+  // the driver inst of net, which the switch power belong to.
+  auto get_driver_inst = [&removed_inst_set](Net* net) -> Instance* {
+    auto* driver_obj = net->getDriver();
+    auto* driver_inst = (driver_obj && driver_obj->isPin())
+                            ? driver_obj->get_own_instance()
+                            : nullptr;
+    return removed_inst_set.contains(driver_inst) ? nullptr : driver_inst;
+  };
+
+  std::vector<PwrInstPowerDelta> inst_power_deltas;
+  std::unordered_map<Instance*, std::size_t> inst_to_delta_index;
+  auto get_inst_delta = [&](Instance* inst) -> PwrInstPowerDelta& {
+    auto [it, is_new] =
+        inst_to_delta_index.emplace(inst, inst_power_deltas.size());
+    if (is_new) {
+      auto& inst_delta = inst_power_deltas.emplace_back();
+      inst_delta._inst = inst;
+    }
+    return inst_power_deltas[it->second];
+  };
+
+  // firstly remove the power of the removed objects, the new power is zero.
+  for (auto* inst : removed_insts) {
+    auto& inst_delta = get_inst_delta(inst);
+    inst_delta._old_leakage_power = updatePowerData<PwrLeakageData>(
+        _leakage_powers, _inst_to_leakage_index, inst, nullptr);
+    inst_delta._old_internal_power = updatePowerData<PwrInternalData>(
+        _internal_powers, _inst_to_internal_index, inst, nullptr);
+    removeGroupData(inst);
+  }
+
+  for (auto* net : removed_nets) {
+    double old_switch_power = updatePowerData<PwrSwitchData>(
+        _switch_powers, _net_to_switch_index, net, nullptr);
+    if (auto* driver_inst = get_driver_inst(net); driver_inst) {
+      get_inst_delta(driver_inst)._old_switch_power += old_switch_power;
+    }
+  }
+
+  // secondly update the power graph, the pin nets of the inserted insts are
+  // rewired too.
+  std::vector<Instance*> inserted_insts;
+  std::vector<Instance*> exist_insts;
+  std::vector<Net*> rewired_nets;
+  std::unordered_set<Net*> rewired_net_set;
+  auto add_rewired_net = [&](Net* net) {
+    if (net && rewired_net_set.insert(net).second) {
+      rewired_nets.emplace_back(net);
+    }
+  };
+  std::ranges::for_each(changed_nets, add_rewired_net);
+  std::ranges::for_each(removed_nets, add_rewired_net);
+  for (auto* inst : changed_insts) {
+    if (_power_graph.findCell(inst->get_name())) {
+      exist_insts.emplace_back(inst);
+    } else if (inst->get_inst_cell()->isSequentialCell()) {
+      LOG_ERROR << "sequential inst " << inst->get_name()
+                << " could not be inserted incrementally, skip it.";
+    } else {
+      inserted_insts.emplace_back(inst);
+      Pin* pin;
+      FOREACH_INSTANCE_PIN(inst, pin) { add_rewired_net(pin->get_net()); }
+    }
+  }
+
+  PwrBuildGraph build_graph(_power_graph);
+  build_graph.removeInsts(removed_insts);
+  build_graph.buildInsts(inserted_insts);
+  build_graph.annotateInstsPower(exist_insts);
+
+  auto* the_sta_graph = _power_graph.get_sta_graph();
+  // the driver vertex of the net pin vertexes before the net arcs are rebuilt.
+  std::vector<std::pair<PwrVertex*, PwrVertex*>> net_vertex_drivers;
+  for (auto* net : rewired_nets) {
+    DesignObject* pin_port;
+    FOREACH_NET_PIN(net, pin_port) {
+      auto sta_vertex = the_sta_graph->findVertex(pin_port);
+      auto* pwr_vertex =
+          sta_vertex ? _power_graph.staToPwrVertex(*sta_vertex) : nullptr;
+      if (pwr_vertex && pwr_vertex->is_toggle_sp_propagated()) {
+        auto& snk_arcs = pwr_vertex->get_snk_arcs();
+        net_vertex_drivers.emplace_back(
+            pwr_vertex, snk_arcs.empty() ? nullptr : snk_arcs.front()->get_src());
+      }
+    }
+  }
+
+  build_graph.rebuildNetArcs(rewired_nets);
+
+  // thirdly propagate the toggle and sp of the new vertexes and the vertexes
+  // driven by another vertex now, keep the annotated data.
+  std::vector<PwrVertex*> propagated_vertexes;
+  for (auto* inst : inserted_insts) {
+    auto& pin_vertexes =
+        _power_graph.getCell(inst->get_name())->get_pin_vertexes();
+    propagated_vertexes.insert(propagated_vertexes.end(),
+                               pin_vertexes.begin(), pin_vertexes.end());
+  }
+  for (auto& [pwr_vertex, old_driver_vertex] : net_vertex_drivers) {
+    auto& snk_arcs = pwr_vertex->get_snk_arcs();
+    auto* driver_vertex =
+        snk_arcs.empty() ? nullptr : snk_arcs.front()->get_src();
+    if (driver_vertex != old_driver_vertex &&
+        !pwr_vertex->getToggleBucket().frontData(PwrDataSource::kAnnotate)) {
+      pwr_vertex->resetToggleSPData();
+      propagated_vertexes.emplace_back(pwr_vertex);
+    }
+  }
+  incrPropagateToggleSP(propagated_vertexes);
+
+  // expand the changed objects to affected insts and nets, only the objects
+  // in the power graph could be updated incrementally.
+  std::vector<Instance*> affected_insts;
+  std::vector<Net*> affected_nets;
+  std::unordered_set<Instance*> inst_set;
+  std::unordered_set<Net*> net_set;
+  auto add_affected_inst = [&](Instance* inst) {
+    if (inst && !removed_inst_set.contains(inst) &&
+        _power_graph.findCell(inst->get_name()) &&
+        inst_set.insert(inst).second) {
+      affected_insts.emplace_back(inst);
+    }
+  };
+  auto add_affected_net = [&](Net* net) {
+    if (net && net_set.insert(net).second) {
+      affected_nets.emplace_back(net);
+    }
+  };
+
+  std::unordered_set<Net*> removed_net_set(removed_nets.begin(),
+                                           removed_nets.end());
+  auto add_net_pin_insts = [&](Net* net) {
+    if (!net || removed_net_set.contains(net)) {
+      return;
+    }
+    add_affected_net(net);
+    DesignObject* pin_port;
+    FOREACH_NET_PIN(net, pin_port) {
+      if (pin_port->isPin()) {
+        add_affected_inst(pin_port->get_own_instance());
+      }
+    }
+  };
+
+  for (auto* inst : changed_insts) {
+    add_affected_inst(inst);
+    // the pin cap of the resized inst change the load of the net drivers.
+    Pin* pin;
+    FOREACH_INSTANCE_PIN(inst, pin) {
+      auto* net = pin->get_net();
+      if (net && !removed_net_set.contains(net)) {
+        add_affected_net(net);
+        add_affected_inst(get_driver_inst(net));
+      }
+    }
+  }
+
+  for (auto* inst : inserted_insts) {
+    Pin* pin;
+    FOREACH_INSTANCE_PIN(inst, pin) { add_net_pin_insts(pin->get_net()); }
+  }
+
+  for (auto* net : changed_nets) {
+    add_net_pin_insts(net);
+  }
+
+  // recalc inst power in parallel.
+  PwrCalcLeakagePower calc_leakage_power;
+  calc_leakage_power.set_the_pwr_graph(&_power_graph);
+  calc_leakage_power.set_num_threads(_calc_num_threads);
+  auto leakage_datas = calc_leakage_power.calcInstsLeakagePower(affected_insts);
+
+  PwrCalcInternalPower calc_internal_power;
+  calc_internal_power.set_the_pwr_graph(&_power_graph);
+  calc_internal_power.set_num_threads(_calc_num_threads);
+  auto internal_datas =
+      calc_internal_power.calcInstsInternalPower(affected_insts);
+
+  for (std::size_t i = 0; i < affected_insts.size(); ++i) {
+    auto* inst = affected_insts[i];
+    auto& inst_delta = get_inst_delta(inst);
+
+    inst_delta._new_leakage_power = leakage_datas[i]->get_leakage_power();
+    inst_delta._old_leakage_power =
+        updatePowerData(_leakage_powers, _inst_to_leakage_index, inst,
+                        std::move(leakage_datas[i]));
+
+    inst_delta._new_internal_power = internal_datas[i]->get_internal_power();
+    inst_delta._old_internal_power =
+        updatePowerData(_internal_powers, _inst_to_internal_index, inst,
+                        std::move(internal_datas[i]));
+  }
+
+  // recalc net switch power in parallel.
+  PwrCalcSwitchPower calc_switch_power;
+  calc_switch_power.set_the_pwr_graph(&_power_graph);
+  calc_switch_power.set_num_threads(_calc_num_threads);
+  auto switch_datas = calc_switch_power.calcNetsSwitchPower(affected_nets);
+
+  for (std::size_t i = 0; i < affected_nets.size(); ++i) {
+    auto* net = affected_nets[i];
+    double new_switch_power =
+        switch_datas[i] ? switch_datas[i]->get_switch_power() : 0.0;
+    // the skipped net is removed.
+    double old_switch_power =
+        updatePowerData(_switch_powers, _net_to_switch_index, net,
+                        std::move(switch_datas[i]));
+
+    if (auto* driver_inst = get_driver_inst(net); driver_inst) {
+      auto& inst_delta = get_inst_delta(driver_inst);
+      inst_delta._old_switch_power += old_switch_power;
+      inst_delta._new_switch_power += new_switch_power;
+    }
+  }
+
+  _inst_power_deltas = std::move(inst_power_deltas);
+
+  incrUpdateGroupPower();
+
+  LOG_INFO << "incremental power update " << affected_insts.size()
+           << " insts and " << affected_nets.size() << " nets, insert "
+           << inserted_insts.size() << " insts, remove "
+           << removed_insts.size() << " insts and " << removed_nets.size()
+           << " nets";
+  LOG_INFO << "incremental power calculation end";
+  double memory_delta = stats.memoryDelta();
+  LOG_INFO << "incremental power calculation memory usage " << memory_delta
+           << "MB";
+  double time_delta = stats.elapsedRunTime();
+  LOG_INFO << "incremental power calculation time elapsed " << time_delta
+           << "s";
+
+  return 1;
+}
+
 /**
  * @brief analyze power by group.
  *
@@ -297,7 +706,9 @@ unsigned Power::analyzeGroupPower() {
       } else if (power_data->isInternalData()) {
         group_data->set_internal_power(power_data_value);
       } else {
-        group_data->set_switch_power(power_data_value);
+        // the switch power of the inst is the sum of the nets it drives.
+        group_data->set_switch_power(group_data->get_switch_power() +
+                                     power_data_value);
       }
       group_data->set_nom_voltage(power_data->get_nom_voltage());
     };
@@ -313,6 +724,11 @@ unsigned Power::analyzeGroupPower() {
     }
   };
 
+  // the switch power is accumulated, clear the last analysis.
+  for (auto& [design_obj, group_data] : _obj_to_datas) {
+    group_data->set_switch_power(0.0);
+  }
+
   PwrLeakageData* leakage_power_data;
   FOREACH_PWR_LEAKAGE_POWER(this, leakage_power_data) {
     auto* inst = dynamic_cast<Instance*>(leakage_power_data->get_design_obj());
@@ -375,6 +791,50 @@ unsigned Power::analyzeGroupPower() {
   return 1;
 }
 
+/**
+ * @brief update the group data of the insts changed by the last incremental
+ * power update, the old power of the inst is subtracted and the new one is
+ * added, so the cost is the num of changed insts instead of the design. The
+ * group data of the inserted inst is created, the removed one is removed
+ * before.
+ *
+ * @return unsigned
+ */
+unsigned Power::incrUpdateGroupPower() {
+  for (auto& inst_delta : _inst_power_deltas) {
+    auto* inst = inst_delta._inst;
+    auto it = _obj_to_datas.find(inst);
+    if (it == _obj_to_datas.end()) {
+      auto leakage_index = _inst_to_leakage_index.find(inst);
+      if (leakage_index == _inst_to_leakage_index.end()) {
+        // the removed inst.
+        continue;
+      }
+      auto group_type = getInstPowerGroup(inst);
+      if (!group_type) {
+        // the inst without group type is not in the report.
+        continue;
+      }
+      auto group_data = std::make_unique<PwrGroupData>(*group_type, inst);
+      group_data->set_nom_voltage(
+          _leakage_powers[leakage_index->second]->get_nom_voltage());
+      addGroupData(std::move(group_data));
+      it = _obj_to_datas.find(inst);
+    }
+    auto* group_data = it->second.get();
+    group_data->set_leakage_power(group_data->get_leakage_power() -
+                                  inst_delta._old_leakage_power +
+                                  inst_delta._new_leakage_power);
+    group_data->set_internal_power(group_data->get_internal_power() -
+                                   inst_delta._old_internal_power +
+                                   inst_delta._new_internal_power);
+    group_data->set_switch_power(group_data->get_switch_power() -
+                                 inst_delta._old_switch_power +
+                                 inst_delta._new_switch_power);
+  }
+  return 1;
+}
+
 /**
  * @brief report power
  *
@@ -568,6 +1028,154 @@ unsigned Power::reportInstancePowerCSV(const char* rpt_file_name) {
   return 1;
 }
 
+/**
+ * @brief report the inst power change of the last incremental update, sorted
+ * by the absolute delta power.
+ *
+ * @param rpt_file_name
+ * @return unsigned
+ */
+unsigned Power::reportInstancePowerDelta(const char* rpt_file_name) {
+  std::vector<PwrInstPowerDelta*> inst_power_deltas;
+  for (auto& inst_delta : _inst_power_deltas) {
+    inst_power_deltas.emplace_back(&inst_delta);
+  }
+  std::ranges::stable_sort(inst_power_deltas, [](auto* left, auto* right) {
+    return std::abs(left->getDeltaPower()) > std::abs(right->getDeltaPower());
+  });
+
+  std::ofstream csv_file(rpt_file_name);
+  csv_file << "Instance Name"
+           << ","
+           << "Old Power"
+           << ","
+           << "New Power"
+           << ","
+           << "Delta Power"
+           << ","
+           << "Delta Internal Power"
+           << ","
+           << "Delta Switch Power"
+           << ","
+           << "Delta Leakage Power"
+           << "\n";
+  auto data_str = [](double data) { return Str::printf("%.3e", data); };
+  for (auto* inst_delta : inst_power_deltas) {
+    csv_file << inst_delta->_inst->get_name() << ","
+             << data_str(inst_delta->getOldPower()) << ","
+             << data_str(inst_delta->getNewPower()) << ","
+             << data_str(inst_delta->getDeltaPower()) << ","
+             << data_str(inst_delta->_new_internal_power -
+                         inst_delta->_old_internal_power)
+             << ","
+             << data_str(inst_delta->_new_switch_power -
+                         inst_delta->_old_switch_power)
+             << ","
+             << data_str(inst_delta->_new_leakage_power -
+                         inst_delta->_old_leakage_power)
+             << "\n";
+  }
+  csv_file.close();
+  return 1;
+}
+
+/**
+ * @brief report the power of each vcd time window, the toggle sp of the window
+ * is annotated and propagated again, then restore the whole time power.
+ *
+ * @param rpt_file_name
+ * @return unsigned
+ */
+unsigned Power::reportTimeWindowPower(const char* rpt_file_name) {
+  auto& window_annotate_dbs = _vcd_stream_reader.get_window_annotate_dbs();
+  auto& time_windows = _vcd_stream_reader.get_time_windows();
+  if (!_is_stream_vcd || window_annotate_dbs.empty()) {
+    LOG_ERROR << "no vcd time window, please read vcd in stream with windows.";
+    return 0;
+  }
+
+  ieda::Stats stats;
+  LOG_INFO << "time window power report start";
+
+  auto propagate_window_toggle_sp = [this](AnnotateDB* annotate_db) {
+    PwrVertex* the_vertex;
+    FOREACH_PWR_VERTEX(&_power_graph, the_vertex) {
+      the_vertex->resetToggleSPData();
+    }
+    annotateToggleSP(annotate_db);
+
+    Vector<std::function<unsigned(PwrGraph*)>> prop_funcs = {
+        PwrPropagateToggleSP(), PwrPropagateClock()};
+    for (auto& func : prop_funcs) {
+      _power_graph.exec(func);
+    }
+  };
+
+  auto sum_power = [](auto& power_datas) {
+    double power_sum = 0.0;
+    for (auto& power_data : power_datas) {
+      power_sum += power_data->getPowerDataValue();
+    }
+    return power_sum;
+  };
+
+  std::ofstream csv_file(rpt_file_name);
+  csv_file << "Window Begin"
+           << ","
+           << "Window End"
+           << ","
+           << "Internal Power"
+           << ","
+           << "Switch Power"
+           << ","
+           << "Leakage Power"
+           << ","
+           << "Total Power"
+           << "\n";
+  auto data_str = [](double data) { return Str::printf("%.3e", data); };
+
+  std::optional<std::size_t> peak_window_index;
+  double peak_power = 0.0;
+  for (std::size_t i = 0; i < window_annotate_dbs.size(); ++i) {
+    propagate_window_toggle_sp(window_annotate_dbs[i].get());
+    calcLeakagePower();
+    calcInternalPower();
+    calcSwitchPower();
+
+    double internal_power = sum_power(_internal_powers);
+    double switch_power = sum_power(_switch_powers);
+    double leakage_power = sum_power(_leakage_powers);
+    double total_power = internal_power + switch_power + leakage_power;
+    if (!peak_window_index || total_power > peak_power) {
+      peak_window_index = i;
+      peak_power = total_power;
+    }
+
+    csv_file << time_windows[i]._begin_time << ","
+             << time_windows[i]._end_time << "," << data_str(internal_power)
+             << "," << data_str(switch_power) << ","
+             << data_str(leakage_power) << "," << data_str(total_power)
+             << "\n";
+  }
+  csv_file.close();
+
+  LOG_INFO << "peak power window [" << time_windows[*peak_window_index]._begin_time
+           << ", " << time_windows[*peak_window_index]._end_time
+           << ") total power " << peak_power << "W";
+
+  // restore the power of the whole simulation time.
+  propagate_window_toggle_sp(_vcd_stream_reader.get_annotate_db());
+  updatePower();
+
+  LOG_INFO << "time window power report end";
+  double memory_delta = stats.memoryDelta();
+  LOG_INFO << "time window power report memory usage " << memory_delta << "MB";
+  double time_delta = stats.elapsedRunTime();
+  LOG_INFO << "time window power report time elapsed " << time_delta << "s";
+
+  return 1;
+}
+
 /**
  * @brief init power graph data
  *
@@ -24,15 +24,44 @@
 
 #pragma once
 
+#include <unordered_map>
+#include <vector>
+
 #include "core/PwrAnalysisData.hh"
 #include "core/PwrGraph.hh"
 #include "core/PwrGroupData.hh"
 #include "core/PwrSeqGraph.hh"
 #include "include/PwrConfig.hh"
 #include "ops/read_vcd/RustVCDParserWrapper.hh"
+#include "ops/read_vcd/VcdStreamReader.hh"
 
 namespace ipower {
 
+/**
+ * @brief The power change of one instance after incremental power update, the
+ * switch power is the power of the nets driven by the instance, unit is W.
+ *
+ */
+struct PwrInstPowerDelta {
+  Instance* _inst = nullptr;
+  double _old_leakage_power = 0.0;
+  double _new_leakage_power = 0.0;
+  double _old_internal_power = 0.0;
+  double _new_internal_power = 0.0;
+  double _old_switch_power = 0.0;
+  double _new_switch_power = 0.0;
+
+  [[nodiscard]] double getOldPower() const {
+    return _old_leakage_power + _old_internal_power + _old_switch_power;
+  }
+  [[nodiscard]] double getNewPower() const {
+    return _new_leakage_power + _new_internal_power + _new_switch_power;
+  }
+  [[nodiscard]] double getDeltaPower() const {
+    return getNewPower() - getOldPower();
+  }
+};
+
 /**
  * @brief The top class of power analysis.
  *
@@ -46,6 +75,8 @@ class Power {
   static void destroyPower();
 
   void set_design_work_space(const char* design_work_space) { _design_work_space = design_work_space; }
+  void set_calc_num_threads(unsigned num_threads) { _calc_num_threads = num_threads; }
+  [[nodiscard]] unsigned get_calc_num_threads() const { return _calc_num_threads; }
   const char* get_design_work_space() { return _design_work_space.c_str(); }
 
   auto& get_fastest_clock() { return _power_graph.get_fastest_clock(); }
@@ -64,12 +95,15 @@ class Power {
   unsigned buildGraph();
   unsigned isBuildGraph() { return _power_graph.numVertex() > 0; }
   unsigned readRustVCD(const char* vcd_path, const char* top_instance_name);
+  unsigned readVCDStream(const char* vcd_path, const char* top_instance_name,
+                         std::vector<VcdTimeWindow>&& time_windows = {});
   unsigned dumpGraph();
   unsigned buildSeqGraph();
   unsigned dumpSeqGraphViz();
 
   unsigned setupClock(PwrClock&& fastest_clock, Vector<StaClock*>&& sta_clocks);
   unsigned annotateToggleSP();
+  unsigned annotateToggleSP(AnnotateDB* annotate_db);
 
   unsigned initPowerGraphData();
 
@@ -79,6 +113,7 @@ class Power {
   unsigned propagateClock();
   unsigned propagateConst();
   unsigned propagateToggleSP();
+  unsigned incrPropagateToggleSP(const std::vector<PwrVertex*>& the_vertexes);
 
   unsigned initToggleSPData();
 
@@ -86,13 +121,20 @@ class Power {
   unsigned calcInternalPower();
   unsigned calcSwitchPower();
   unsigned analyzeGroupPower();
+  unsigned incrUpdateGroupPower();
   unsigned updatePower();
+  unsigned incrUpdatePower(const std::vector<Instance*>& changed_insts,
+                           const std::vector<Net*>& changed_nets,
+                           const std::vector<Instance*>& removed_insts = {},
+                           const std::vector<Net*>& removed_nets = {});
 
   unsigned reportSummaryPower(const char* rpt_file_name,
                               PwrAnalysisMode pwr_analysis_mode);
   unsigned reportInstancePower(const char* rpt_file_name,
                                PwrAnalysisMode pwr_analysis_mode);
   unsigned reportInstancePowerCSV(const char* rpt_file_name);
+  unsigned reportInstancePowerDelta(const char* rpt_file_name);
+  unsigned reportTimeWindowPower(const char* rpt_file_name);
 
   unsigned reportPower(bool is_copy = true);
 
@@ -101,6 +143,7 @@ class Power {
   auto& get_leakage_powers() { return _leakage_powers; }
   auto& get_internal_powers() { return _internal_powers; }
   auto& get_switch_powers() { return _switch_powers; }
+  auto& get_inst_power_deltas() { return _inst_power_deltas; }
   auto& get_obj_to_datas() { return _obj_to_datas; }
   auto* getObjData(DesignObject* design_obj) {
     return _obj_to_datas.contains(design_obj) ? _obj_to_datas[design_obj].get()
@@ -116,14 +159,25 @@ class Power {
         group_data.get());
     _obj_to_datas[group_data->get_obj()] = std::move(group_data);
   }
+  void removeGroupData(DesignObject* design_obj) {
+    auto it = _obj_to_datas.find(design_obj);
+    if (it != _obj_to_datas.end()) {
+      std::erase(_type_to_group_data[it->second->get_group_type()],
+                 it->second.get());
+      _obj_to_datas.erase(it);
+    }
+  }
 
  private:
   std::string _design_work_space; // The power report work space.
+  unsigned _calc_num_threads = c_num_threads;  //!< The num of threads of power calculation.
 
   PwrGraph _power_graph;         //< The power graph, mapped to sta graph.
   PwrSeqGraph _power_seq_graph;  //!< The power sequential graph, vertex is
                                  //!< sequential inst.
   RustVcdParserWrapper _rust_vcd_wrapper;  //!< The rust vcd database.
+  VcdStreamReader _vcd_stream_reader;      //!< The streaming vcd database.
+  bool _is_stream_vcd = false;  //!< Whether the vcd is read by stream reader.
 
   std::vector<std::unique_ptr<PwrLeakageData>>
       _leakage_powers;  //!< The leakage power.
@@ -132,6 +186,15 @@ class Power {
   std::vector<std::unique_ptr<PwrSwitchData>>
       _switch_powers;  //!< The switch power.
 
+  std::unordered_map<DesignObject*, std::size_t>
+      _inst_to_leakage_index;  //!< The inst index of leakage powers.
+  std::unordered_map<DesignObject*, std::size_t>
+      _inst_to_internal_index;  //!< The inst index of internal powers.
+  std::unordered_map<DesignObject*, std::size_t>
+      _net_to_switch_index;  //!< The net index of switch powers.
+  std::vector<PwrInstPowerDelta>
+      _inst_power_deltas;  //!< The inst power change of last incr update.
+
   std::map<DesignObject*, std::unique_ptr<PwrGroupData>> _obj_to_datas;
   std::map<PwrGroupData::PwrGroupType, std::vector<PwrGroupData*>>
       _type_to_group_data;  //!< The mapping of type to group data.
@@ -24,11 +24,15 @@
  */
 #pragma once
 
+#include <vector>
+
 #include "include/PwrConfig.hh"
 #include "netlist/Instance.hh"
 
 namespace ipower {
 
+class PwrVertex;
+
 /**
  * @brief The power cell mapped to netlist instance.
  *
@@ -40,8 +44,16 @@ class PwrCell {
 
   auto* get_design_inst() { return _design_inst; }
 
+  void addPinVertex(PwrVertex* pin_vertex) {
+    _pin_vertexes.emplace_back(pin_vertex);
+  }
+  auto& get_pin_vertexes() { return _pin_vertexes; }
+
  private:
   Instance* _design_inst;
+  std::vector<PwrVertex*>
+      _pin_vertexes;  //!< The pin vertexes of the instance, used to remove
+                      //!< them after the sta vertexes are removed.
 };
 
 }  // namespace ipower
\ No newline at end of file
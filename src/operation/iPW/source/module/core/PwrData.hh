@@ -169,6 +169,11 @@ class PwrDataBucket {
     return !_data_list.empty() ? _data_list.front().get() : nullptr;
   }
   PwrData* frontData(PwrDataSource data_source);
+  void clear() {
+    _data_list.clear();
+    _count = 0;
+    _next.reset();
+  }
 
   void set_next(std::unique_ptr<PwrDataBucket>&& next_bucket) {
     _next = std::move(next_bucket);
@@ -57,4 +57,70 @@ PwrVertex* PwrGraph::getPowerVertex(DesignObject* obj) {
   return the_pwr_vertex;
 }
 
+/**
+ * @brief remove the power vertexes, the arcs of them should be removed before.
+ * The mapped sta vertexes may be removed already, so only the pointer of them
+ * is used.
+ *
+ * @param vertexes
+ */
+void PwrGraph::removePowerVertexes(
+    const std::unordered_set<PwrVertex*>& vertexes) {
+  if (vertexes.empty()) {
+    return;
+  }
+
+  for (auto* pwr_vertex : vertexes) {
+    LOG_FATAL_IF(!pwr_vertex->get_src_arcs().empty() ||
+                 !pwr_vertex->get_snk_arcs().empty())
+        << "the arcs of removed power vertex are not removed.";
+    if (auto it = _vertex_pwr_to_sta.find(pwr_vertex);
+        it != _vertex_pwr_to_sta.end()) {
+      _vertex_sta_to_pwr.erase(it->second);
+      _vertex_pwr_to_sta.erase(it);
+    }
+  }
+
+  std::erase_if(_vertexes, [&vertexes](auto& vertex) {
+    return vertexes.contains(vertex.get());
+  });
+}
+
+/**
+ * @brief remove the power arcs, and the arcs of the src and snk vertex.
+ *
+ * @param arcs
+ */
+void PwrGraph::removePowerArcs(const std::unordered_set<PwrArc*>& arcs) {
+  if (arcs.empty()) {
+    return;
+  }
+
+  for (auto* pwr_arc : arcs) {
+    pwr_arc->get_src()->removeSrcArc(pwr_arc);
+    pwr_arc->get_snk()->removeSnkArc(pwr_arc);
+  }
+
+  std::erase_if(_arcs,
+                [&arcs](auto& arc) { return arcs.contains(arc.get()); });
+}
+
+/**
+ * @brief remove the power cells, the instances of them should be still alive.
+ *
+ * @param cells
+ */
+void PwrGraph::removePowerCells(const std::unordered_set<PwrCell*>& cells) {
+  if (cells.empty()) {
+    return;
+  }
+
+  for (auto* pwr_cell : cells) {
+    _inst_name_to_pwr_cell.erase(pwr_cell->get_design_inst()->get_name());
+  }
+
+  std::erase_if(_cells,
+                [&cells](auto& cell) { return cells.contains(cell.get()); });
+}
+
 }  // namespace ipower
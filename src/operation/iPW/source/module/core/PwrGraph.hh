@@ -24,6 +24,7 @@
 #pragma once
 
 #include <memory>
+#include <unordered_set>
 #include <vector>
 
 #include "BTreeSet.hh"
@@ -83,18 +84,23 @@ class PwrGraph {
     _vertex_sta_to_pwr[sta_vertex] = pwr_vertex;
     _vertex_pwr_to_sta[pwr_vertex] = sta_vertex;
   }
+  // use find instead of operator[], the power calculation lookup in parallel.
   PwrVertex* staToPwrVertex(StaVertex* sta_vertex) {
-    return _vertex_sta_to_pwr[sta_vertex];
+    auto it = _vertex_sta_to_pwr.find(sta_vertex);
+    return it != _vertex_sta_to_pwr.end() ? it->second : nullptr;
   }
   StaVertex* pwrToStaVertex(PwrVertex* pwr_vertex) {
-    return _vertex_pwr_to_sta[pwr_vertex];
+    auto it = _vertex_pwr_to_sta.find(pwr_vertex);
+    return it != _vertex_pwr_to_sta.end() ? it->second : nullptr;
   }
+  void removePowerVertexes(const std::unordered_set<PwrVertex*>& vertexes);
 
   void addPowerArc(std::unique_ptr<PwrArc> arc) {
     _arcs.emplace_back(std::move(arc));
   }
   auto& get_arcs() { return _arcs; }
   auto numArc() { return _arcs.size(); }
+  void removePowerArcs(const std::unordered_set<PwrArc*>& arcs);
 
   void addPowerCell(std::unique_ptr<PwrCell> cell) {
     _inst_name_to_pwr_cell[cell->get_design_inst()->get_name()] = cell.get();
@@ -106,6 +112,11 @@ class PwrGraph {
         << inst_name << " is not found power cell.";
     return _inst_name_to_pwr_cell[inst_name];
   }
+  PwrCell* findCell(std::string_view inst_name) {
+    auto it = _inst_name_to_pwr_cell.find(inst_name);
+    return it != _inst_name_to_pwr_cell.end() ? it->second : nullptr;
+  }
+  void removePowerCells(const std::unordered_set<PwrCell*>& cells);
 
   PwrVertex* getDriverVertex(const std::string& net_name);
 
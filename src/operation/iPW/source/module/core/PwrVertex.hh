@@ -123,6 +123,14 @@ class PwrVertex {
 
   void addSrcArc(PwrArc* src_arc) { _src_arcs.emplace_back(src_arc); }
   void addSnkArc(PwrArc* snk_arc) { _snk_arcs.emplace_back(snk_arc); }
+  void removeSrcArc(PwrArc* src_arc) {
+    LOG_FATAL_IF(!std::erase_if(
+        _src_arcs, [src_arc](PwrArc* arc) { return arc == src_arc; }));
+  }
+  void removeSnkArc(PwrArc* snk_arc) {
+    LOG_FATAL_IF(!std::erase_if(
+        _snk_arcs, [snk_arc](PwrArc* arc) { return arc == snk_arc; }));
+  }
   auto& get_src_arcs() { return _src_arcs; }
   auto& get_snk_arcs() { return _snk_arcs; }
 
@@ -140,6 +148,11 @@ class PwrVertex {
 
   PwrDataBucket& getToggleBucket() { return _toggle_bucket; }
   PwrDataBucket& getSPBucket() { return _sp_bucket; }
+  void resetToggleSPData() {
+    _toggle_bucket.clear();
+    _sp_bucket.clear();
+    _is_toggle_sp_propagated = 0;
+  }
 
   double getToggleData(std::optional<PwrDataSource> data_source);
   double getSPData(std::optional<PwrDataSource> data_source);
@@ -54,6 +54,7 @@ static constexpr int g_mw2w = 1000;
 #define NW_TO_MW(power) ((power) / static_cast<double>(g_nw2mw))
 #define NW_TO_W(power) ((power) / static_cast<double>(g_nw2w))
 #define MW_TO_W(power) ((power) / static_cast<double>(g_mw2w))
+#define W_TO_MW(power) ((power) * static_cast<double>(g_mw2w))
 
 }  // namespace ipower
 
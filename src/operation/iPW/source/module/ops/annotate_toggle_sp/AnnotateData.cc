@@ -79,6 +79,8 @@ void AnnotateInstance::printAnnotateInstance(std::ostream& out) {
  * @param duration
  */
 void AnnotateInstance::calcInstancesTcSP(int64_t duration) {
+  // recalc may be called when annotate again.
+  _signals_tc_sp.clear();
   for (auto& [signal_name, signal] : _signals) {
     double tc_data;
     double sp_data;
@@ -81,7 +81,7 @@ class AnnotateToggle {
 
   void printAnnotateToggle(std::ostream& out);
   int64_t get_toggle() { return _TC.get_ui(); }
-  void set_TC(int tc) { _TC = tc; }
+  void set_TC(int64_t tc) { _TC = tc; }
 
  private:
   mpz_class _TC{0};  //!< The total number of transition.
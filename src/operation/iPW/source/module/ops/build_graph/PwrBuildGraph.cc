@@ -68,6 +68,87 @@ unsigned PwrBuildGraph::annotateInternalPower(PwrInstArc* inst_power_arc,
   return 1;
 }
 
+/**
+ * @brief build the power vertex of the sta vertex, and the assistant vertex of
+ * the bidirection vertex.
+ *
+ * @param sta_vertex
+ */
+void PwrBuildGraph::buildVertex(StaVertex* sta_vertex) {
+  auto power_vertex = std::make_unique<PwrVertex>(sta_vertex);
+  _power_graph.addStaAndPwrCrossRef(sta_vertex, power_vertex.get());
+  _power_graph.addPowerVertex(std::move(power_vertex));
+  if (sta_vertex->is_bidirection()) {
+    auto* sta_graph = _power_graph.get_sta_graph();
+    auto* assistant_vertex = sta_graph->getAssistant(sta_vertex);
+    LOG_FATAL_IF(!assistant_vertex) << "assistant is null.";
+
+    auto power_assistant_vertex = std::make_unique<PwrVertex>(assistant_vertex);
+    _power_graph.addStaAndPwrCrossRef(assistant_vertex,
+                                      power_assistant_vertex.get());
+    _power_graph.addPowerVertex(std::move(power_assistant_vertex));
+  }
+}
+
+/**
+ * @brief build the power arc of the sta arc, power arc only exist for delay
+ * inst arc and net arc.
+ *
+ * @param sta_arc
+ */
+void PwrBuildGraph::buildArc(StaArc* sta_arc) {
+  auto* sta_src_vertex = sta_arc->get_src();
+  auto* sta_snk_vertex = sta_arc->get_snk();
+  auto* pwr_src_vertex = _power_graph.staToPwrVertex(sta_src_vertex);
+  auto* pwr_snk_vertex = _power_graph.staToPwrVertex(sta_snk_vertex);
+
+  std::unique_ptr<PwrArc> power_arc;
+  // power arc only exist for delay arc.
+  if (sta_arc->isInstArc()) {
+    if (sta_arc->isDelayArc()) {
+      power_arc = std::make_unique<PwrInstArc>(pwr_src_vertex, pwr_snk_vertex);
+      // annoate the internal power to inst arc.
+      annotateInternalPower(dynamic_cast<PwrInstArc*>(power_arc.get()),
+                            dynamic_cast<StaInstArc*>(sta_arc)->get_inst());
+    }
+  } else {
+    // net arc
+    power_arc = std::make_unique<PwrNetArc>(pwr_src_vertex, pwr_snk_vertex);
+    dynamic_cast<PwrNetArc*>(power_arc.get())
+        ->set_net(dynamic_cast<StaNetArc*>(sta_arc)->get_net());
+  }
+
+  if (power_arc) {
+    pwr_src_vertex->addSrcArc(power_arc.get());
+    pwr_snk_vertex->addSnkArc(power_arc.get());
+    _power_graph.addPowerArc(std::move(power_arc));
+  }
+}
+
+/**
+ * @brief build the power cell of the instance, the pin vertexes should be
+ * built before.
+ *
+ * @param inst
+ */
+void PwrBuildGraph::buildCell(Instance* inst) {
+  auto* sta_graph = _power_graph.get_sta_graph();
+  auto power_cell = std::make_unique<PwrCell>(inst);
+  Pin* pin;
+  FOREACH_INSTANCE_PIN(inst, pin) {
+    auto sta_vertex = sta_graph->findVertex(pin);
+    if (!sta_vertex) {
+      continue;
+    }
+    power_cell->addPinVertex(_power_graph.staToPwrVertex(*sta_vertex));
+    if ((*sta_vertex)->is_bidirection()) {
+      power_cell->addPinVertex(
+          _power_graph.staToPwrVertex(sta_graph->getAssistant(*sta_vertex)));
+    }
+  }
+  _power_graph.addPowerCell(std::move(power_cell));
+}
+
 /**
  * @brief build power graph based on sta graph, annotate the interal power
  * information.
@@ -82,62 +163,16 @@ unsigned PwrBuildGraph::operator()(StaGraph* sta_graph) {
   _power_graph.set_sta_graph(sta_graph);
   // build power vertex based on sta vertex.
   StaVertex* sta_vertex;
-  FOREACH_VERTEX(sta_graph, sta_vertex) {
-    // build the power vertex.
-    auto power_vertex = std::make_unique<PwrVertex>(sta_vertex);
-    _power_graph.addStaAndPwrCrossRef(sta_vertex, power_vertex.get());
-    _power_graph.addPowerVertex(std::move(power_vertex));
-    if (sta_vertex->is_bidirection()) {
-      auto* assistant_vertex = sta_graph->getAssistant(sta_vertex);
-      LOG_FATAL_IF(!assistant_vertex) << "assistant is null.";
-
-      auto power_assistant_vertex =
-          std::make_unique<PwrVertex>(assistant_vertex);
-      _power_graph.addStaAndPwrCrossRef(assistant_vertex,
-                                        power_assistant_vertex.get());
-      _power_graph.addPowerVertex(std::move(power_assistant_vertex));
-    }
-  }
+  FOREACH_VERTEX(sta_graph, sta_vertex) { buildVertex(sta_vertex); }
 
   // build power arc based on sta arc.
   StaArc* sta_arc;
-  FOREACH_ARC(sta_graph, sta_arc) {
-    auto* sta_src_vertex = sta_arc->get_src();
-    auto* sta_snk_vertex = sta_arc->get_snk();
-    auto* pwr_src_vertex = _power_graph.staToPwrVertex(sta_src_vertex);
-    auto* pwr_snk_vertex = _power_graph.staToPwrVertex(sta_snk_vertex);
-
-    std::unique_ptr<PwrArc> power_arc;
-    // power arc only exist for delay arc.
-    if (sta_arc->isInstArc()) {
-      if (sta_arc->isDelayArc()) {
-        power_arc =
-            std::make_unique<PwrInstArc>(pwr_src_vertex, pwr_snk_vertex);
-        // annoate the internal power to inst arc.
-        annotateInternalPower(dynamic_cast<PwrInstArc*>(power_arc.get()),
-                              dynamic_cast<StaInstArc*>(sta_arc)->get_inst());
-      }
-    } else {
-      // net arc
-      power_arc = std::make_unique<PwrNetArc>(pwr_src_vertex, pwr_snk_vertex);
-      dynamic_cast<PwrNetArc*>(power_arc.get())
-          ->set_net(dynamic_cast<StaNetArc*>(sta_arc)->get_net());
-    }
-
-    if (power_arc) {
-      pwr_src_vertex->addSrcArc(power_arc.get());
-      pwr_snk_vertex->addSnkArc(power_arc.get());
-      _power_graph.addPowerArc(std::move(power_arc));
-    }
-  }
+  FOREACH_ARC(sta_graph, sta_arc) { buildArc(sta_arc); }
 
   // build power cell.
   auto* nl = sta_graph->get_nl();
   Instance* design_inst;
-  FOREACH_INSTANCE(nl, design_inst) {
-    auto power_cell = std::make_unique<PwrCell>(design_inst);
-    _power_graph.addPowerCell(std::move(power_cell));
-  }
+  FOREACH_INSTANCE(nl, design_inst) { buildCell(design_inst); }
 
   // set the port vertexes.
   StaVertex* vertex;
@@ -172,4 +207,166 @@ unsigned PwrBuildGraph::operator()(StaGraph* sta_graph) {
   return 1;
 }
 
+/**
+ * @brief build the power vertexes, inst arcs and cells of the instances
+ * inserted after the power graph is built, the sta vertexes and arcs of them
+ * should be built before, the net arcs are built by rebuildNetArcs.
+ *
+ * @param insts
+ * @return unsigned
+ */
+unsigned PwrBuildGraph::buildInsts(const std::vector<Instance*>& insts) {
+  auto* sta_graph = _power_graph.get_sta_graph();
+  for (auto* inst : insts) {
+    std::vector<StaVertex*> pin_sta_vertexes;
+    Pin* pin;
+    FOREACH_INSTANCE_PIN(inst, pin) {
+      auto sta_vertex = sta_graph->findVertex(pin);
+      LOG_FATAL_IF(!sta_vertex)
+          << "sta vertex " << pin->getFullName() << " is not found.";
+      buildVertex(*sta_vertex);
+      pin_sta_vertexes.emplace_back(*sta_vertex);
+      if ((*sta_vertex)->is_bidirection()) {
+        pin_sta_vertexes.emplace_back(sta_graph->getAssistant(*sta_vertex));
+      }
+    }
+
+    for (auto* pin_sta_vertex : pin_sta_vertexes) {
+      FOREACH_SRC_ARC(pin_sta_vertex, sta_arc) {
+        if (sta_arc->isInstArc()) {
+          buildArc(sta_arc);
+        }
+      }
+    }
+
+    buildCell(inst);
+  }
+
+  return 1;
+}
+
+/**
+ * @brief remove the power vertexes, arcs and cells of the instances removed
+ * from the sta graph, the instances should be still alive.
+ *
+ * @param insts
+ * @return unsigned
+ */
+unsigned PwrBuildGraph::removeInsts(const std::vector<Instance*>& insts) {
+  std::unordered_set<PwrArc*> removed_arcs;
+  std::unordered_set<PwrVertex*> removed_vertexes;
+  std::unordered_set<PwrCell*> removed_cells;
+  for (auto* inst : insts) {
+    auto* power_cell = _power_graph.findCell(inst->get_name());
+    if (!power_cell) {
+      continue;
+    }
+
+    for (auto* pin_vertex : power_cell->get_pin_vertexes()) {
+      removed_arcs.insert(pin_vertex->get_src_arcs().begin(),
+                          pin_vertex->get_src_arcs().end());
+      removed_arcs.insert(pin_vertex->get_snk_arcs().begin(),
+                          pin_vertex->get_snk_arcs().end());
+      removed_vertexes.insert(pin_vertex);
+    }
+    removed_cells.insert(power_cell);
+  }
+
+  _power_graph.removePowerArcs(removed_arcs);
+  _power_graph.removePowerVertexes(removed_vertexes);
+  _power_graph.removePowerCells(removed_cells);
+
+  return 1;
+}
+
+/**
+ * @brief annotate the internal power of the instances again, used after the
+ * instance is resized.
+ *
+ * @param insts
+ * @return unsigned
+ */
+unsigned PwrBuildGraph::annotateInstsPower(const std::vector<Instance*>& insts) {
+  for (auto* inst : insts) {
+    auto* power_cell = _power_graph.findCell(inst->get_name());
+    if (!power_cell) {
+      continue;
+    }
+
+    for (auto* pin_vertex : power_cell->get_pin_vertexes()) {
+      FOREACH_SRC_PWR_ARC(pin_vertex, src_arc) {
+        if (src_arc->isInstArc()) {
+          auto* inst_power_arc = dynamic_cast<PwrInstArc*>(src_arc);
+          inst_power_arc->set_power_arc_set(nullptr);
+          annotateInternalPower(inst_power_arc, inst);
+        }
+      }
+    }
+  }
+
+  return 1;
+}
+
+/**
+ * @brief rebuild the power net arcs of the nets from the sta net arcs, the
+ * net arcs of the net pins are removed first, so the arcs of the pins moved
+ * from other nets are removed too.
+ *
+ * @param nets
+ * @return unsigned
+ */
+unsigned PwrBuildGraph::rebuildNetArcs(const std::vector<Net*>& nets) {
+  auto* sta_graph = _power_graph.get_sta_graph();
+
+  std::vector<StaVertex*> net_sta_vertexes;
+  std::unordered_set<StaVertex*> visited_sta_vertexes;
+  auto add_net_sta_vertex = [&](StaVertex* sta_vertex) {
+    if (visited_sta_vertexes.insert(sta_vertex).second) {
+      net_sta_vertexes.emplace_back(sta_vertex);
+    }
+  };
+
+  for (auto* net : nets) {
+    DesignObject* pin_port;
+    FOREACH_NET_PIN(net, pin_port) {
+      auto sta_vertex = sta_graph->findVertex(pin_port);
+      if (!sta_vertex) {
+        continue;
+      }
+      add_net_sta_vertex(*sta_vertex);
+      if ((*sta_vertex)->is_bidirection()) {
+        add_net_sta_vertex(sta_graph->getAssistant(*sta_vertex));
+      }
+    }
+  }
+
+  std::unordered_set<PwrArc*> removed_arcs;
+  for (auto* sta_vertex : net_sta_vertexes) {
+    auto* pwr_vertex = _power_graph.staToPwrVertex(sta_vertex);
+    LOG_FATAL_IF(!pwr_vertex)
+        << "power vertex " << sta_vertex->getName() << " is not found.";
+    FOREACH_SRC_PWR_ARC(pwr_vertex, src_arc) {
+      if (src_arc->isNetArc()) {
+        removed_arcs.insert(src_arc);
+      }
+    }
+    FOREACH_SNK_PWR_ARC(pwr_vertex, snk_arc) {
+      if (snk_arc->isNetArc()) {
+        removed_arcs.insert(snk_arc);
+      }
+    }
+  }
+  _power_graph.removePowerArcs(removed_arcs);
+
+  for (auto* sta_vertex : net_sta_vertexes) {
+    FOREACH_SRC_ARC(sta_vertex, sta_arc) {
+      if (sta_arc->isNetArc()) {
+        buildArc(sta_arc);
+      }
+    }
+  }
+
+  return 1;
+}
+
 }  // namespace ipower
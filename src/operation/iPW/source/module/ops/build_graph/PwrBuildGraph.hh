@@ -24,6 +24,8 @@
  */
 #pragma once
 
+#include <vector>
+
 #include "core/PwrGraph.hh"
 #include "sta/StaFunc.hh"
 #include "sta/StaGraph.hh"
@@ -41,9 +43,17 @@ class PwrBuildGraph : public StaFunc {
   ~PwrBuildGraph() override = default;
   unsigned operator()(StaGraph* the_graph) override;
 
+  unsigned buildInsts(const std::vector<Instance*>& insts);
+  unsigned removeInsts(const std::vector<Instance*>& insts);
+  unsigned annotateInstsPower(const std::vector<Instance*>& insts);
+  unsigned rebuildNetArcs(const std::vector<Net*>& nets);
+
   auto& takePowerGraph() { return _power_graph; }
 
  private:
+  void buildVertex(StaVertex* sta_vertex);
+  void buildArc(StaArc* sta_arc);
+  void buildCell(Instance* inst);
   unsigned annotateInternalPower(PwrInstArc* inst_power_arc, Instance* inst);
 
   PwrGraph& _power_graph;  //!< The power graph to be build.
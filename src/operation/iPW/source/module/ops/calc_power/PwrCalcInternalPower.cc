@@ -24,7 +24,9 @@
 
 #include "PwrCalcInternalPower.hh"
 
+#include "PwrCalcParallel.hh"
 #include "PwrCalcSPData.hh"
+
 namespace ipower {
 using ieda::Stats;
 
@@ -536,7 +538,54 @@ void PwrCalcInternalPower::printInternalPower(std::ostream& out,
 }
 
 /**
- * @brief Calc internal power.
+ * @brief Calc internal power of the instance.
+ *
+ * @param design_inst
+ * @return std::unique_ptr<PwrInternalData>
+ */
+std::unique_ptr<PwrInternalData> PwrCalcInternalPower::calcInstInternalPower(
+    Instance* design_inst) {
+  auto* inst_cell = design_inst->get_inst_cell();
+
+  double inst_internal_power = 0;
+  if (inst_cell->isMacroCell()) {
+    // TODO
+  } else if (inst_cell->isSequentialCell()) {
+    /*Calc seq internal power.*/
+    inst_internal_power = calcSeqInternalPower(design_inst);
+  } else {
+    /*Calc comb internal power.*/
+    inst_internal_power = calcCombInternalPower(design_inst);
+  }
+
+  double nom_voltage = inst_cell->get_owner_lib()->get_nom_voltage();
+  auto internal_data = std::make_unique<PwrInternalData>(
+      design_inst, MW_TO_W(inst_internal_power));
+  internal_data->set_nom_voltage(nom_voltage);
+
+  VERBOSE_LOG(1) << "cell  " << design_inst->get_name()
+                 << "  internal power: " << inst_internal_power << "mW";
+  return internal_data;
+}
+
+/**
+ * @brief Calc internal power of the instances in parallel.
+ *
+ * @param design_insts
+ * @return std::vector<std::unique_ptr<PwrInternalData>>
+ */
+std::vector<std::unique_ptr<PwrInternalData>>
+PwrCalcInternalPower::calcInstsInternalPower(
+    const std::vector<Instance*>& design_insts) {
+  return CalcPowerParallel<PwrInternalData>(
+      design_insts, get_num_threads(),
+      [this](Instance* design_inst) {
+        return calcInstInternalPower(design_inst);
+      });
+}
+
+/**
+ * @brief Calc internal power of the power graph.
  *
  * @param the_graph
  * @return unsigned
@@ -547,33 +596,18 @@ unsigned PwrCalcInternalPower::operator()(PwrGraph* the_graph) {
 
   set_the_pwr_graph(the_graph);
 
-  double inst_internal_power = 0;
-
+  std::vector<Instance*> design_insts;
   PwrCell* cell;
   FOREACH_PWR_CELL(the_graph, cell) {
-    auto* design_inst = cell->get_design_inst();
-    auto* inst_cell = design_inst->get_inst_cell();
-
-    if (inst_cell->isMacroCell()) {
-      // TODO
-    } else if (inst_cell->isSequentialCell()) {
-      /*Calc seq internal power.*/
-      inst_internal_power = calcSeqInternalPower(design_inst);
-    } else {
-      /*Calc comb internal power.*/
-      inst_internal_power = calcCombInternalPower(design_inst);
-    }
+    design_insts.emplace_back(cell->get_design_inst());
+  }
 
-    double nom_voltage = inst_cell->get_owner_lib()->get_nom_voltage();
-    // add power analysis data.
-    auto internal_data =
-        std::make_unique<PwrInternalData>(design_inst, MW_TO_W(inst_internal_power));
-    internal_data->set_nom_voltage(nom_voltage);
+  auto internal_datas = calcInstsInternalPower(design_insts);
 
+  // add power analysis data in the cell order.
+  for (auto& internal_data : internal_datas) {
+    _internal_power_result += internal_data->get_internal_power();
     addInternalPower(std::move(internal_data));
-    VERBOSE_LOG(1) << "cell  " << design_inst->get_name()
-                   << "  internal power: " << inst_internal_power << "mW";
-    _internal_power_result += inst_internal_power;
   }
 
 // debug internal power
@@ -583,7 +617,8 @@ unsigned PwrCalcInternalPower::operator()(PwrGraph* the_graph) {
   out.close();
 #endif
 
-  LOG_INFO << "calc internal power result " << _internal_power_result << "mW";
+  LOG_INFO << "calc internal power result "
+           << W_TO_MW(_internal_power_result) << "mW";
 
   LOG_INFO << "calc internal power end";
   double memory_delta = stats.memoryDelta();
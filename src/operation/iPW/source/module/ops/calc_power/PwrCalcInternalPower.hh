@@ -43,6 +43,10 @@ class PwrCalcInternalPower : public PwrFunc {
   auto& takeInternalPowers() { return _internal_powers; }
   void printInternalPower(std::ostream& out, PwrGraph* the_graph);
 
+  std::unique_ptr<PwrInternalData> calcInstInternalPower(Instance* design_inst);
+  std::vector<std::unique_ptr<PwrInternalData>> calcInstsInternalPower(
+      const std::vector<Instance*>& design_insts);
+
  private:
   double getToggleData(Pin* pin);
   double calcSPByWhen(const char* when, Instance* inst);
@@ -68,7 +72,7 @@ class PwrCalcInternalPower : public PwrFunc {
   }
   std::vector<std::unique_ptr<PwrInternalData>>
       _internal_powers;               //!< The internal power.
-  double _internal_power_result = 0;  //!< the sum data of internal power.
+  double _internal_power_result = 0;  //!< the sum of internal power in W.
 };
 
 }  // namespace ipower
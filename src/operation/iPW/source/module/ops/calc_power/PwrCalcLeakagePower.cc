@@ -74,6 +74,49 @@ void PwrCalcLeakagePower::printLeakagePower(std::ostream& out) {
   }
 }
 
+/**
+ * @brief Calc leakage power of the instance.
+ *
+ * @param design_inst
+ * @return std::unique_ptr<PwrLeakageData>
+ */
+std::unique_ptr<PwrLeakageData> PwrCalcLeakagePower::calcInstLeakagePower(
+    Instance* design_inst) {
+  auto* inst_cell = design_inst->get_inst_cell();
+
+  LibLeakagePower* leakage_power;
+  double leakage_power_sum_data = 0;
+  FOREACH_LEAKAGE_POWER(inst_cell, leakage_power) {
+    double leakage_power_data = calcLeakagePower(leakage_power, design_inst);
+    leakage_power_sum_data += leakage_power_data;
+  }
+
+  double nom_voltage = inst_cell->get_owner_lib()->get_nom_voltage();
+  auto leakage_data = std::make_unique<PwrLeakageData>(
+      design_inst, NW_TO_W(leakage_power_sum_data));
+  leakage_data->set_nom_voltage(nom_voltage);
+
+  VERBOSE_LOG(2) << "cell  " << design_inst->get_name()
+                 << "  leakage power: " << leakage_power_sum_data << " nW";
+  return leakage_data;
+}
+
+/**
+ * @brief Calc leakage power of the instances in parallel.
+ *
+ * @param design_insts
+ * @return std::vector<std::unique_ptr<PwrLeakageData>>
+ */
+std::vector<std::unique_ptr<PwrLeakageData>>
+PwrCalcLeakagePower::calcInstsLeakagePower(
+    const std::vector<Instance*>& design_insts) {
+  return CalcPowerParallel<PwrLeakageData>(
+      design_insts, get_num_threads(),
+      [this](Instance* design_inst) {
+        return calcInstLeakagePower(design_inst);
+      });
+}
+
 /**
  * @brief Calc leakage power of the power vertex.
  *
@@ -86,29 +129,18 @@ unsigned PwrCalcLeakagePower::operator()(PwrGraph* the_graph) {
 
   set_the_pwr_graph(the_graph);
 
+  std::vector<Instance*> design_insts;
   PwrCell* cell;
   FOREACH_PWR_CELL(the_graph, cell) {
-    auto* design_inst = cell->get_design_inst();
-    auto* inst_cell = design_inst->get_inst_cell();
-
-    LibLeakagePower* leakage_power;
-    double leakage_power_sum_data = 0;
-    FOREACH_LEAKAGE_POWER(inst_cell, leakage_power) {
-      double leakage_power_data = calcLeakagePower(leakage_power, design_inst);
-      leakage_power_sum_data += leakage_power_data;
-    }
-
-    // add power analysis data.
-    double nom_voltage = inst_cell->get_owner_lib()->get_nom_voltage();
-    auto leakage_data =
-        std::make_unique<PwrLeakageData>(design_inst, NW_TO_W(leakage_power_sum_data));
-    leakage_data->set_nom_voltage(nom_voltage);
+    design_insts.emplace_back(cell->get_design_inst());
+  }
 
-    addLeakagePower(std::move(leakage_data));
-    VERBOSE_LOG(2) << "cell  " << design_inst->get_name()
-                   << "  leakage power: " << leakage_power_sum_data << " nW";
+  auto leakage_datas = calcInstsLeakagePower(design_insts);
 
-    _leakage_power_result += leakage_power_sum_data;
+  // add power analysis data in the cell order.
+  for (auto& leakage_data : leakage_datas) {
+    _leakage_power_result += leakage_data->get_leakage_power();
+    addLeakagePower(std::move(leakage_data));
   }
 
   // debug leakage power
@@ -116,7 +148,7 @@ unsigned PwrCalcLeakagePower::operator()(PwrGraph* the_graph) {
   // printLeakagePower(out);
   // out.close();
 
-  LOG_INFO << "calc leakage power result " << NW_TO_MW(_leakage_power_result)
+  LOG_INFO << "calc leakage power result " << W_TO_MW(_leakage_power_result)
            << "mw";
 
   LOG_INFO << "calc leakage power end";
@@ -27,6 +27,7 @@
 #include <fstream>
 #include <iostream>
 
+#include "PwrCalcParallel.hh"
 #include "PwrCalcSPData.hh"
 #include "core/PwrAnalysisData.hh"
 #include "core/PwrGraph.hh"
@@ -44,6 +45,10 @@ class PwrCalcLeakagePower : public PwrFunc {
   unsigned operator()(PwrGraph* the_graph) override;
   auto& takeLeakagePowers() { return _leakage_powers; }
 
+  std::unique_ptr<PwrLeakageData> calcInstLeakagePower(Instance* design_inst);
+  std::vector<std::unique_ptr<PwrLeakageData>> calcInstsLeakagePower(
+      const std::vector<Instance*>& design_insts);
+
  private:
   double calcLeakagePower(LibLeakagePower* leakage_power, Instance* inst);
 
@@ -55,6 +60,6 @@ class PwrCalcLeakagePower : public PwrFunc {
 
   std::vector<std::unique_ptr<PwrLeakageData>>
       _leakage_powers;               //!< The leakage power.
-  double _leakage_power_result = 0;  //!< the sum data of leakage power.
+  double _leakage_power_result = 0;  //!< the sum of leakage power in W.
 };
 }  // namespace ipower
\ No newline at end of file
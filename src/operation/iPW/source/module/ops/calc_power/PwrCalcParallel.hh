@@ -0,0 +1,86 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of
+// Sciences Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan
+// PSL v2. You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY
+// KIND, EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// NON-INFRINGEMENT, MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+/**
+ * @file PwrCalcParallel.hh
+ * @brief The helper of calc power data of design objects in parallel.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <future>
+#include <memory>
+#include <vector>
+
+#include "ThreadPool/ThreadPool.h"
+
+namespace ipower {
+
+constexpr std::size_t c_calc_power_chunk_size =
+    256;  //!< The num of objects calculated by one task.
+
+/**
+ * @brief Calc power data of the design objects in parallel, the calc func
+ * should only read the graph. The result is aligned with the objects index, the
+ * calc func could return nullptr for skipped object.
+ *
+ * @tparam PowerData
+ * @tparam DesignObj
+ * @tparam CalcFunc
+ * @param objs
+ * @param num_threads
+ * @param calc_func
+ * @return std::vector<std::unique_ptr<PowerData>>
+ */
+template <typename PowerData, typename DesignObj, typename CalcFunc>
+std::vector<std::unique_ptr<PowerData>> CalcPowerParallel(
+    const std::vector<DesignObj*>& objs, unsigned num_threads,
+    CalcFunc&& calc_func) {
+  std::vector<std::unique_ptr<PowerData>> power_datas(objs.size());
+
+  auto calc_chunk = [&objs, &power_datas, &calc_func](std::size_t begin,
+                                                      std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+      power_datas[i] = calc_func(objs[i]);
+    }
+  };
+
+  if (num_threads <= 1 || objs.size() <= c_calc_power_chunk_size) {
+    calc_chunk(0, objs.size());
+    return power_datas;
+  }
+
+  std::size_t num_chunks =
+      (objs.size() + c_calc_power_chunk_size - 1) / c_calc_power_chunk_size;
+  ThreadPool thread_pool(
+      std::min(static_cast<std::size_t>(num_threads), num_chunks));
+  std::vector<std::future<void>> futures;
+  futures.reserve(num_chunks);
+  for (std::size_t begin = 0; begin < objs.size();
+       begin += c_calc_power_chunk_size) {
+    std::size_t end = std::min(begin + c_calc_power_chunk_size, objs.size());
+    futures.emplace_back(thread_pool.enqueue(calc_chunk, begin, end));
+  }
+
+  for (auto& future : futures) {
+    future.get();
+  }
+
+  return power_datas;
+}
+
+}  // namespace ipower
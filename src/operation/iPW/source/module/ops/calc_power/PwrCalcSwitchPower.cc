@@ -23,6 +23,8 @@
  */
 
 #include "PwrCalcSwitchPower.hh"
+
+#include "PwrCalcParallel.hh"
 #include "core/PwrSeqGraph.hh"
 
 namespace ipower {
@@ -78,6 +80,77 @@ void PwrCalcSwitchPower::printSwitchPower(std::ostream& out,
   }
 }
 
+/**
+ * @brief Calc switch power of the net.
+ *
+ * @param net
+ * @return std::unique_ptr<PwrSwitchData> nullptr if the net is skipped.
+ */
+std::unique_ptr<PwrSwitchData> PwrCalcSwitchPower::calcNetSwitchPower(
+    Net* net) {
+  if (net->getLoads().empty()) {
+    return nullptr;
+  }
+
+  auto* driver_obj = net->getDriver();
+
+  if (driver_obj->isPort() &&
+      ((net->getLoads().size() == 1) && net->getLoads().front()->isPort())) {
+    return nullptr;
+  }
+
+  auto* the_pwr_graph = get_the_pwr_graph();
+  auto* the_sta_graph = the_pwr_graph->get_sta_graph();
+  auto driver_sta_vertex = the_sta_graph->findVertex(driver_obj);
+
+  PwrVertex* driver_pwr_vertex = nullptr;
+  if (driver_sta_vertex) {
+    driver_pwr_vertex = the_pwr_graph->staToPwrVertex(*driver_sta_vertex);
+  } else {
+    // LOG_FATAL << "not found driver sta vertex.";
+    LOG_ERROR << "not found driver sta vertex.";
+    return nullptr;
+  }
+
+  // get VDD
+  auto driver_voltage = driver_pwr_vertex->getDriveVoltage();
+  if (!driver_voltage) {
+    LOG_FATAL << "can not get driver voltage.";
+  }
+  double vdd = driver_voltage.value();
+
+  // get Capacitance
+  double cap = (*driver_sta_vertex)->getNetLoad();
+
+  // get Toggle
+  double toggle = driver_pwr_vertex->getToggleData(std::nullopt);
+
+  // calc swich power of the arc.
+  // swich_power = k*toggle*Cap*(VDD^2)
+  double arc_swich_power = c_switch_power_K * toggle * cap * vdd * vdd;
+  auto switch_data =
+      std::make_unique<PwrSwitchData>(net, MW_TO_W(arc_swich_power));
+  switch_data->set_nom_voltage(vdd);
+  VERBOSE_LOG(2) << "net  " << net->get_name()
+                 << "  switch power: " << arc_swich_power << "mW";
+
+  return switch_data;
+}
+
+/**
+ * @brief Calc switch power of the nets in parallel.
+ *
+ * @param nets
+ * @return std::vector<std::unique_ptr<PwrSwitchData>> the skipped net is
+ * nullptr.
+ */
+std::vector<std::unique_ptr<PwrSwitchData>>
+PwrCalcSwitchPower::calcNetsSwitchPower(const std::vector<Net*>& nets) {
+  return CalcPowerParallel<PwrSwitchData>(
+      nets, get_num_threads(),
+      [this](Net* net) { return calcNetSwitchPower(net); });
+}
+
 /**
  * @brief Calc switch power.
  *
@@ -92,67 +165,20 @@ unsigned PwrCalcSwitchPower::operator()(PwrGraph* the_graph) {
   auto* sta_graph = the_graph->get_sta_graph();
   auto* nl = sta_graph->get_nl();
 
+  std::vector<Net*> nets;
   Net* net;
-  /*Calc switch power for power net arc.*/
-  FOREACH_NET(nl, net) {
-    if (net->getLoads().empty()) {
-      continue;
-    }
+  FOREACH_NET(nl, net) { nets.emplace_back(net); }
 
-    auto* driver_obj = net->getDriver();
+  /*Calc switch power for power net arc.*/
+  auto switch_datas = calcNetsSwitchPower(nets);
 
-    if (driver_obj->isPort() &&
-        ((net->getLoads().size() == 1) && net->getLoads().front()->isPort())) {
+  // add power analysis data in the net order.
+  for (auto& switch_data : switch_datas) {
+    if (!switch_data) {
       continue;
     }
-
-    auto* the_sta_graph = the_graph->get_sta_graph();
-    auto driver_sta_vertex = the_sta_graph->findVertex(driver_obj);
-
-    PwrVertex* driver_pwr_vertex = nullptr;
-    if (driver_sta_vertex) {
-      driver_pwr_vertex = the_graph->staToPwrVertex(*driver_sta_vertex);
-    } else {
-      // LOG_FATAL << "not found driver sta vertex.";
-      LOG_ERROR << "not found driver sta vertex.";
-      continue;
-    }
-
-    // get VDD
-    auto driver_voltage = driver_pwr_vertex->getDriveVoltage();
-    if (!driver_voltage) {
-      LOG_FATAL << "can not get driver voltage.";
-    }
-    double vdd = driver_voltage.value();
-
-    // get Capacitance
-    double cap = (*driver_sta_vertex)->getNetLoad();
-
-    // get Toggle
-    double toggle = driver_pwr_vertex->getToggleData(std::nullopt);
-
-    // calc swich power of the arc.
-    // swich_power = k*toggle*Cap*(VDD^2)
-    double arc_swich_power = c_switch_power_K * toggle * cap * vdd * vdd;
-    auto switch_data = std::make_unique<PwrSwitchData>(net, MW_TO_W(arc_swich_power));
-    switch_data->set_nom_voltage(vdd);
-    // add power analysis data.
+    _switch_power_result += switch_data->get_switch_power();
     addSwitchPower(std::move(switch_data));
-    VERBOSE_LOG(2) << "net  " << net->get_name()
-                   << "  switch power: " << arc_swich_power << "mW";
-
-    // for debug
-    if (0) {
-      std::ofstream out_debug("switch_out.txt");
-
-      out_debug << "toggle :" << toggle;
-      out_debug << "\ncap :" << cap;
-      out_debug << "\nvdd :" << vdd;
-
-      out_debug.close();
-    }
-
-    _switch_power_result += arc_swich_power;
   }
 
 #if 0
@@ -162,7 +188,8 @@ unsigned PwrCalcSwitchPower::operator()(PwrGraph* the_graph) {
   out.close();
 #endif
 
-  LOG_INFO << "calc switch power result " << _switch_power_result << "mw";
+  LOG_INFO << "calc switch power result " << W_TO_MW(_switch_power_result)
+           << "mw";
 
   LOG_INFO << "calc switch power end";
   double memory_delta = stats.memoryDelta();
@@ -42,6 +42,10 @@ class PwrCalcSwitchPower : public PwrFunc {
   unsigned operator()(PwrGraph* the_graph) override;
   auto& takeSwitchPowers() { return _switch_powers; }
 
+  std::unique_ptr<PwrSwitchData> calcNetSwitchPower(Net* net);
+  std::vector<std::unique_ptr<PwrSwitchData>> calcNetsSwitchPower(
+      const std::vector<Net*>& nets);
+
   void printSwitchPower(std::ostream& out, PwrGraph* the_graph);
 
  private:
@@ -51,6 +55,6 @@ class PwrCalcSwitchPower : public PwrFunc {
 
   std::vector<std::unique_ptr<PwrSwitchData>>
       _switch_powers;               //!< The switch power.
-  double _switch_power_result = 0;  //!< the sum data of switch power.
+  double _switch_power_result = 0;  //!< the sum of switch power in W.
 };
 }  // namespace ipower
\ No newline at end of file
@@ -0,0 +1,527 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of
+// Sciences Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan
+// PSL v2. You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY
+// KIND, EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// NON-INFRINGEMENT, MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+/**
+ * @file VcdStreamReader.cc
+ * @brief The streaming vcd reader implemention.
+ */
+#include "VcdStreamReader.hh"
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstring>
+#include <functional>
+
+#include "usage/usage.hh"
+
+namespace ipower {
+using ieda::Stats;
+
+/**
+ * @brief Read more data to the buffer, the data from keep begin is kept in the
+ * front of the buffer.
+ *
+ * @param keep_begin
+ * @return true if read some data.
+ */
+bool VcdStreamReader::fillBuffer(std::size_t keep_begin) {
+  std::size_t keep_size = _buffer_end - keep_begin;
+  if (keep_size > 0 && keep_begin > 0) {
+    std::memmove(_buffer.data(), _buffer.data() + keep_begin, keep_size);
+  }
+  _buffer_pos -= keep_begin;
+  _buffer_end = keep_size;
+
+  _vcd_stream.read(_buffer.data() + keep_size, _buffer.size() - keep_size);
+  auto read_size = static_cast<std::size_t>(_vcd_stream.gcount());
+  _buffer_end += read_size;
+  return read_size > 0;
+}
+
+/**
+ * @brief Get the next white space separated token, the token is valid until
+ * the next call.
+ *
+ * @param token
+ * @return true if get one token.
+ */
+bool VcdStreamReader::nextToken(std::string_view& token) {
+  // skip the white space.
+  while (true) {
+    if (_buffer_pos == _buffer_end && !fillBuffer(_buffer_end)) {
+      return false;
+    }
+    if (!std::isspace(static_cast<unsigned char>(_buffer[_buffer_pos]))) {
+      break;
+    }
+    ++_buffer_pos;
+  }
+
+  std::size_t token_begin = _buffer_pos;
+  while (true) {
+    if (_buffer_pos == _buffer_end) {
+      LOG_FATAL_IF(token_begin == 0 && _buffer_end == _buffer.size())
+          << "vcd token is longer than the read buffer.";
+      bool is_read = fillBuffer(token_begin);
+      token_begin = 0;
+      if (!is_read) {
+        break;
+      }
+    }
+    if (std::isspace(static_cast<unsigned char>(_buffer[_buffer_pos]))) {
+      break;
+    }
+    ++_buffer_pos;
+  }
+
+  token = std::string_view(_buffer.data() + token_begin,
+                           _buffer_pos - token_begin);
+  return true;
+}
+
+/**
+ * @brief skip the tokens until $end.
+ *
+ */
+void VcdStreamReader::skipToEnd() {
+  std::string_view token;
+  while (nextToken(token) && token != "$end") {
+  }
+}
+
+/**
+ * @brief parse the $var, only the wire and reg under the top instance scope
+ * are recorded, the bus is split to bits.
+ *
+ */
+void VcdStreamReader::parseVar() {
+  std::string_view token;
+  nextToken(token);
+  bool is_signal = (token == "wire" || token == "reg");
+
+  nextToken(token);
+  unsigned width = 0;
+  std::from_chars(token.data(), token.data() + token.size(), width);
+
+  nextToken(token);
+  std::string id_code(token);
+
+  nextToken(token);
+  std::string signal_name(token);
+
+  // the optional bit select, such as [7:0] or [3].
+  std::optional<std::pair<int, int>> msb_lsb;
+  while (nextToken(token) && token != "$end") {
+    if (token.front() != '[') {
+      continue;
+    }
+    int msb = 0;
+    int lsb = 0;
+    auto colon_pos = token.find(':');
+    std::from_chars(token.data() + 1, token.data() + token.size(), msb);
+    lsb = msb;
+    if (colon_pos != std::string_view::npos) {
+      std::from_chars(token.data() + colon_pos + 1,
+                      token.data() + token.size(), lsb);
+    }
+    msb_lsb = {msb, lsb};
+  }
+
+  if (!is_signal || _scope_stack.empty() || width == 0) {
+    return;
+  }
+
+  std::size_t bit_begin = _bit_values.size();
+  auto& the_scope = _scopes[_scope_stack.back()];
+  if (width == 1 && (!msb_lsb || msb_lsb->first == msb_lsb->second)) {
+    // scalar signal
+    if (msb_lsb) {
+      signal_name += "[" + std::to_string(msb_lsb->first) + "]";
+    }
+    the_scope._signals.emplace_back(std::move(signal_name), bit_begin);
+  } else {
+    // bus signal, the bit index is from lsb.
+    auto [msb, lsb] = msb_lsb.value_or(
+        std::pair<int, int>{static_cast<int>(width) - 1, 0});
+    int step = (msb >= lsb) ? 1 : -1;
+    for (unsigned i = 0; i < width; ++i) {
+      int index = lsb + step * static_cast<int>(i);
+      the_scope._signals.emplace_back(
+          signal_name + "[" + std::to_string(index) + "]", bit_begin + i);
+    }
+  }
+
+  _id_to_vars[id_code].emplace_back(VcdVar{bit_begin, width});
+  _bit_values.resize(bit_begin + width, 'x');
+  _bit_change_times.resize(bit_begin + width, 0);
+  _bit_activities.resize(bit_begin + width);
+}
+
+/**
+ * @brief parse the vcd header until $enddefinitions.
+ *
+ * @param top_instance_name
+ */
+void VcdStreamReader::parseHeader(const char* top_instance_name) {
+  std::string_view token;
+  while (nextToken(token)) {
+    if (token == "$timescale") {
+      std::string time_scale;
+      while (nextToken(token) && token != "$end") {
+        time_scale += token;
+      }
+      auto* unit_begin = std::from_chars(time_scale.data(),
+                                         time_scale.data() + time_scale.size(),
+                                         _time_scale)
+                             .ptr;
+      std::string_view unit(unit_begin,
+                            time_scale.data() + time_scale.size() - unit_begin);
+      if (unit == "s") {
+        _time_unit = ScaleUnit::kSecond;
+      } else if (unit == "ms") {
+        _time_unit = ScaleUnit::kMS;
+      } else if (unit == "us") {
+        _time_unit = ScaleUnit::kUS;
+      } else if (unit == "ns") {
+        _time_unit = ScaleUnit::kNS;
+      } else if (unit == "ps") {
+        _time_unit = ScaleUnit::kPS;
+      } else if (unit == "fs") {
+        _time_unit = ScaleUnit::kFS;
+      } else {
+        LOG_ERROR << "unknown vcd time unit " << unit;
+      }
+    } else if (token == "$scope") {
+      nextToken(token);  // scope type
+      nextToken(token);
+      std::string scope_name(token);
+      skipToEnd();
+
+      if (!_scope_stack.empty()) {
+        std::size_t scope_index = _scopes.size();
+        _scopes[_scope_stack.back()]._children.emplace_back(scope_index);
+        _scopes.emplace_back(VcdScope{std::move(scope_name), {}, {}});
+        _scope_stack.emplace_back(scope_index);
+      } else if (!_is_top_found && scope_name == top_instance_name) {
+        _is_top_found = true;
+        _scopes.emplace_back(VcdScope{std::move(scope_name), {}, {}});
+        _scope_stack.emplace_back(0);
+      } else {
+        ++_outside_top_depth;
+      }
+    } else if (token == "$upscope") {
+      skipToEnd();
+      if (!_scope_stack.empty()) {
+        _scope_stack.pop_back();
+      } else {
+        --_outside_top_depth;
+      }
+    } else if (token == "$var") {
+      parseVar();
+    } else if (token == "$enddefinitions") {
+      skipToEnd();
+      return;
+    } else if (token.front() == '$') {
+      // $date, $version, $comment etc.
+      skipToEnd();
+    }
+  }
+}
+
+/**
+ * @brief accumulate the duration of the bit current value until the end time.
+ *
+ * @param bit_index
+ * @param end_time
+ */
+void VcdStreamReader::accumulateDuration(std::size_t bit_index,
+                                         int64_t end_time) {
+  int64_t begin_time = _bit_change_times[bit_index];
+  if (end_time <= begin_time) {
+    return;
+  }
+
+  auto add_duration = [value = _bit_values[bit_index]](
+                          VcdBitActivity& bit_activity, int64_t duration) {
+    switch (value) {
+      case '0':
+        bit_activity._t0 += duration;
+        break;
+      case '1':
+        bit_activity._t1 += duration;
+        break;
+      case 'z':
+        bit_activity._tz += duration;
+        break;
+      default:
+        bit_activity._tx += duration;
+        break;
+    }
+  };
+
+  add_duration(_bit_activities[bit_index], end_time - begin_time);
+  for (std::size_t i = 0; i < _time_windows.size(); ++i) {
+    auto& time_window = _time_windows[i];
+    int64_t overlap = std::min(end_time, time_window._end_time) -
+                      std::max(begin_time, time_window._begin_time);
+    if (overlap > 0) {
+      add_duration(_window_bit_activities[i][bit_index], overlap);
+    }
+  }
+
+  _bit_change_times[bit_index] = end_time;
+}
+
+/**
+ * @brief set the bit value at current time, count the 0-1 and 1-0 toggle.
+ *
+ * @param bit_index
+ * @param value
+ */
+void VcdStreamReader::setBitValue(std::size_t bit_index, char value) {
+  value = static_cast<char>(std::tolower(static_cast<unsigned char>(value)));
+  char old_value = _bit_values[bit_index];
+  if (old_value == value) {
+    return;
+  }
+
+  accumulateDuration(bit_index, _current_time);
+
+  if ((old_value == '0' && value == '1') ||
+      (old_value == '1' && value == '0')) {
+    ++_bit_activities[bit_index]._toggle;
+    for (std::size_t i = 0; i < _time_windows.size(); ++i) {
+      auto& time_window = _time_windows[i];
+      if (_current_time >= time_window._begin_time &&
+          _current_time < time_window._end_time) {
+        ++_window_bit_activities[i][bit_index]._toggle;
+      }
+    }
+  }
+
+  _bit_values[bit_index] = value;
+}
+
+/**
+ * @brief parse the value changes after the header.
+ *
+ */
+void VcdStreamReader::parseValueChanges() {
+  auto find_vars = [this](std::string_view id_code) -> std::vector<VcdVar>* {
+    auto found = _id_to_vars.find(id_code);
+    return found != _id_to_vars.end() ? &found->second : nullptr;
+  };
+
+  std::string_view token;
+  std::string vector_value;
+  while (nextToken(token)) {
+    char first_char = token.front();
+    switch (first_char) {
+      case '#': {
+        int64_t time = 0;
+        std::from_chars(token.data() + 1, token.data() + token.size(), time);
+        LOG_ERROR_IF(time < _current_time)
+            << "vcd time " << time << " is before " << _current_time;
+        _current_time = time;
+        break;
+      }
+      case '0':
+      case '1':
+      case 'x':
+      case 'X':
+      case 'z':
+      case 'Z': {
+        // scalar value change.
+        if (auto* vcd_vars = find_vars(token.substr(1)); vcd_vars) {
+          for (auto& vcd_var : *vcd_vars) {
+            setBitValue(vcd_var._bit_begin, first_char);
+          }
+        }
+        break;
+      }
+      case 'b':
+      case 'B': {
+        // vector value change, the value is msb first, left extended.
+        vector_value.assign(token.substr(1));
+        nextToken(token);
+        if (auto* vcd_vars = find_vars(token); vcd_vars) {
+          std::size_t value_size = vector_value.size();
+          char extend_value =
+              (vector_value.front() == '1') ? '0' : vector_value.front();
+          for (auto& vcd_var : *vcd_vars) {
+            for (unsigned i = 0; i < vcd_var._width; ++i) {
+              char bit_value =
+                  i < value_size ? vector_value[value_size - 1 - i] : extend_value;
+              setBitValue(vcd_var._bit_begin + i, bit_value);
+            }
+          }
+        }
+        break;
+      }
+      case 'r':
+      case 'R': {
+        // real value is not used for power.
+        nextToken(token);
+        break;
+      }
+      default: {
+        if (token == "$comment") {
+          skipToEnd();
+        }
+        // $dumpvars, $dumpall, $dumpon, $dumpoff and $end are skipped.
+        break;
+      }
+    }
+  }
+}
+
+/**
+ * @brief build the annotate database from the bit activities.
+ *
+ * @param annotate_db
+ * @param bit_activities
+ * @param duration
+ */
+void VcdStreamReader::buildAnnotateDB(
+    AnnotateDB& annotate_db, const std::vector<VcdBitActivity>& bit_activities,
+    int64_t duration) {
+  annotate_db.set_simulation_duration(duration);
+  annotate_db.set_timescale(_time_scale, static_cast<int8_t>(_time_unit));
+
+  std::function<std::unique_ptr<AnnotateInstance>(std::size_t)> build_instance =
+      [this, &bit_activities, &build_instance](std::size_t scope_index) {
+        auto& the_scope = _scopes[scope_index];
+        auto the_instance = std::make_unique<AnnotateInstance>(the_scope._name);
+        for (auto& [signal_name, bit_index] : the_scope._signals) {
+          auto& bit_activity = bit_activities[bit_index];
+          auto annotate_signal = std::make_unique<AnnotateSignal>(signal_name);
+          auto* record_data = annotate_signal->get_record_data();
+
+          AnnotateToggle annotate_toggle;
+          annotate_toggle.set_TC(bit_activity._toggle);
+          record_data->set_toggle_record(std::move(annotate_toggle));
+          record_data->set_time_record(
+              AnnotateTime(bit_activity._t0, bit_activity._t1,
+                           bit_activity._tx, bit_activity._tz));
+
+          the_instance->addSignal(std::move(annotate_signal));
+        }
+
+        for (auto child_index : the_scope._children) {
+          the_instance->addChildInstance(build_instance(child_index));
+        }
+        return the_instance;
+      };
+
+  annotate_db.set_top_instance(build_instance(0));
+}
+
+/**
+ * @brief clear the state of the last read, so the reader can be reused.
+ *
+ */
+void VcdStreamReader::reset() {
+  _vcd_stream.close();
+  _vcd_stream.clear();
+  _buffer_pos = 0;
+  _buffer_end = 0;
+
+  _scopes.clear();
+  _scope_stack.clear();
+  _outside_top_depth = 0;
+  _is_top_found = false;
+
+  _id_to_vars.clear();
+  _bit_values.clear();
+  _bit_change_times.clear();
+  _bit_activities.clear();
+  _window_bit_activities.clear();
+
+  _current_time = 0;
+  _time_scale = 1;
+  _time_unit = ScaleUnit::kNS;
+
+  _annotate_db.set_top_instance(nullptr);
+  _window_annotate_dbs.clear();
+}
+
+/**
+ * @brief read the vcd file in stream, the memory is bounded by the signal
+ * number and time window number, not the simulation length.
+ *
+ * @param vcd_file_path
+ * @param top_instance_name
+ * @return unsigned
+ */
+unsigned VcdStreamReader::readVcdFile(const char* vcd_file_path,
+                                      const char* top_instance_name) {
+  Stats stats;
+  LOG_INFO << "stream read vcd " << vcd_file_path << " start";
+
+  reset();
+  _vcd_stream.open(vcd_file_path, std::ios::in | std::ios::binary);
+  LOG_FATAL_IF(!_vcd_stream.is_open()) << "can not open vcd " << vcd_file_path;
+
+  _buffer.resize(c_vcd_stream_buffer_size);
+
+  parseHeader(top_instance_name);
+  LOG_FATAL_IF(!_is_top_found) << "not found the scope " << top_instance_name;
+
+  _window_bit_activities.assign(
+      _time_windows.size(), std::vector<VcdBitActivity>(_bit_values.size()));
+
+  parseValueChanges();
+  _vcd_stream.close();
+  std::vector<char>().swap(_buffer);
+
+  // the value lasts until the simulation end.
+  int64_t simulation_end_time = _current_time;
+  for (std::size_t bit_index = 0; bit_index < _bit_values.size(); ++bit_index) {
+    accumulateDuration(bit_index, simulation_end_time);
+  }
+
+  buildAnnotateDB(_annotate_db, _bit_activities, simulation_end_time);
+
+  _window_annotate_dbs.clear();
+  for (std::size_t i = 0; i < _time_windows.size(); ++i) {
+    auto& time_window = _time_windows[i];
+    int64_t duration =
+        std::min(time_window._end_time, simulation_end_time) -
+        time_window._begin_time;
+    LOG_ERROR_IF(duration <= 0)
+        << "time window [" << time_window._begin_time << ", "
+        << time_window._end_time << ") is out of simulation time.";
+
+    auto window_annotate_db = std::make_unique<AnnotateDB>();
+    buildAnnotateDB(*window_annotate_db, _window_bit_activities[i],
+                    std::max(duration, int64_t(1)));
+    _window_annotate_dbs.emplace_back(std::move(window_annotate_db));
+  }
+  _window_bit_activities.clear();
+
+  LOG_INFO << "stream read vcd " << _bit_values.size() << " signal bits, "
+           << _time_windows.size() << " time windows";
+  LOG_INFO << "stream read vcd end";
+  double memory_delta = stats.memoryDelta();
+  LOG_INFO << "stream read vcd memory usage " << memory_delta << "MB";
+  double time_delta = stats.elapsedRunTime();
+  LOG_INFO << "stream read vcd time elapsed " << time_delta << "s";
+
+  return 1;
+}
+
+}  // namespace ipower
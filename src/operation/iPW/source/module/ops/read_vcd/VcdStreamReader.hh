@@ -0,0 +1,157 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of
+// Sciences Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan
+// PSL v2. You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY
+// KIND, EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// NON-INFRINGEMENT, MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+/**
+ * @file VcdStreamReader.hh
+ * @brief The streaming vcd reader, accumulate toggle and duration of each
+ * signal in one pass with bounded memory, support time windows.
+ */
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "log/Log.hh"
+#include "ops/annotate_toggle_sp/AnnotateData.hh"
+
+namespace ipower {
+
+constexpr std::size_t c_vcd_stream_buffer_size =
+    1 << 20;  //!< The read buffer size of vcd stream.
+
+/**
+ * @brief The time window of vcd, the time is [begin, end) in vcd time unit.
+ *
+ */
+struct VcdTimeWindow {
+  int64_t _begin_time = 0;
+  int64_t _end_time = 0;
+};
+
+/**
+ * @brief The activity of one signal bit in the whole time or a window.
+ *
+ */
+struct VcdBitActivity {
+  int64_t _toggle = 0;
+  int64_t _t0 = 0;
+  int64_t _t1 = 0;
+  int64_t _tx = 0;
+  int64_t _tz = 0;
+};
+
+/**
+ * @brief The streaming vcd reader, the value change is not stored, only the
+ * toggle and the duration of each value is accumulated for the signals under
+ * the top instance scope.
+ *
+ */
+class VcdStreamReader {
+ public:
+  void set_time_windows(std::vector<VcdTimeWindow>&& time_windows) {
+    _time_windows = std::move(time_windows);
+  }
+  auto& get_time_windows() { return _time_windows; }
+
+  unsigned readVcdFile(const char* vcd_file_path,
+                       const char* top_instance_name);
+
+  auto* get_annotate_db() { return &_annotate_db; }
+  auto& get_window_annotate_dbs() { return _window_annotate_dbs; }
+
+ private:
+  /**
+   * @brief The vcd scope under the top instance.
+   *
+   */
+  struct VcdScope {
+    std::string _name;
+    std::vector<std::pair<std::string, std::size_t>>
+        _signals;                   //!< The signal bit name and bit index.
+    std::vector<std::size_t> _children;  //!< The children scope index.
+  };
+
+  /**
+   * @brief The vcd variable, one id code may be shared by some variables.
+   *
+   */
+  struct VcdVar {
+    std::size_t _bit_begin;  //!< The first bit index, lsb first.
+    unsigned _width;
+  };
+
+  void reset();
+  bool fillBuffer(std::size_t keep_begin);
+  bool nextToken(std::string_view& token);
+  void skipToEnd();
+  void parseHeader(const char* top_instance_name);
+  void parseVar();
+  void parseValueChanges();
+
+  void setBitValue(std::size_t bit_index, char value);
+  void accumulateDuration(std::size_t bit_index, int64_t end_time);
+  void buildAnnotateDB(AnnotateDB& annotate_db,
+                       const std::vector<VcdBitActivity>& bit_activities,
+                       int64_t duration);
+
+  std::ifstream _vcd_stream;
+  std::vector<char> _buffer;
+  std::size_t _buffer_pos = 0;
+  std::size_t _buffer_end = 0;
+
+  std::vector<VcdScope> _scopes;  //!< The top scope is the first one.
+  std::vector<std::size_t> _scope_stack;
+  int _outside_top_depth = 0;  //!< The scope depth outside the top scope.
+  bool _is_top_found = false;
+
+  /**
+   * @brief The id code hash, the value change is looked up by the string view
+   * of the token without building a string.
+   *
+   */
+  struct IdCodeHash {
+    using is_transparent = void;
+    std::size_t operator()(std::string_view id_code) const {
+      return std::hash<std::string_view>()(id_code);
+    }
+  };
+
+  std::unordered_map<std::string, std::vector<VcdVar>, IdCodeHash,
+                     std::equal_to<>>
+      _id_to_vars;
+  std::vector<char> _bit_values;
+  std::vector<int64_t> _bit_change_times;
+  std::vector<VcdBitActivity> _bit_activities;
+  std::vector<std::vector<VcdBitActivity>> _window_bit_activities;
+
+  int64_t _current_time = 0;
+  int64_t _time_scale = 1;
+  ScaleUnit _time_unit = ScaleUnit::kNS;
+
+  std::vector<VcdTimeWindow> _time_windows;
+  AnnotateDB _annotate_db;  //!< The annotate database of the whole time.
+  std::vector<std::unique_ptr<AnnotateDB>>
+      _window_annotate_dbs;  //!< The annotate database of each time window.
+};
+
+}  // namespace ipower
@@ -22,6 +22,8 @@
  * @date 2023-05-04
  */
 
+#include <sstream>
+
 #include "PowerShellCmd.hh"
 #include "sta/Sta.hh"
 
@@ -33,18 +35,55 @@ CmdReadVcd::CmdReadVcd(const char* cmd_name) : TclCmd(cmd_name) {
   auto* top_instance_name_option = new TclStringOption("-top_name", 0, nullptr);
   addOption(top_instance_name_option);
 
-  //   auto* begin_time_option = new TclIntOption("-begin_time", 0, 0);
-  //   addOption(begin_time_option);
+  // read the vcd in stream, the waveform is not held in memory.
+  auto* stream_option = new TclSwitchOption("-stream");
+  addOption(stream_option);
+
+  // the time windows {begin end begin end ...} in vcd time unit, the vcd is
+  // read in stream when it is set.
+  auto* time_windows_option =
+      new TclStringOption("-time_windows", 0, nullptr);
+  addOption(time_windows_option);
+}
 
-  //   auto* end_time_option = new TclIntOption("-end_time", 0, 0);
-  //   addOption(end_time_option);
+/**
+ * @brief parse the time windows {begin end begin end ...}, each window is
+ * [begin, end).
+ *
+ * @param time_windows_str
+ * @param time_windows
+ * @return true if the windows are legal.
+ */
+static bool parseTimeWindows(const char* time_windows_str,
+                             std::vector<VcdTimeWindow>& time_windows) {
+  std::istringstream time_stream(time_windows_str);
+  int64_t begin_time;
+  while (time_stream >> begin_time) {
+    int64_t end_time;
+    if (!(time_stream >> end_time) || begin_time < 0 ||
+        end_time <= begin_time) {
+      return false;
+    }
+    time_windows.emplace_back(VcdTimeWindow{begin_time, end_time});
+  }
+  return time_stream.eof() && !time_windows.empty();
 }
 
 unsigned CmdReadVcd::check() {
   TclOption* file_name_option = getOptionOrArg("file_name");
-  TclOption* top_instance_name_option = getOptionOrArg("top_instance_name");
+  TclOption* top_instance_name_option = getOptionOrArg("-top_name");
   LOG_FATAL_IF(!file_name_option);
   LOG_FATAL_IF(!top_instance_name_option);
+
+  TclOption* time_windows_option = getOptionOrArg("-time_windows");
+  if (time_windows_option->is_set_val()) {
+    std::vector<VcdTimeWindow> time_windows;
+    if (!parseTimeWindows(time_windows_option->getStringVal(),
+                          time_windows)) {
+      LOG_ERROR << "-time_windows should be {begin end ...} with begin < end.";
+      return 0;
+    }
+  }
   return 1;
 }
 
@@ -56,12 +95,23 @@ unsigned CmdReadVcd::exec() {
   TclOption* file_name_option = getOptionOrArg("file_name");
   auto vcd_file = file_name_option->getStringVal();
 
-  TclOption* top_instance_name_option = getOptionOrArg("top_instance_name");
+  TclOption* top_instance_name_option = getOptionOrArg("-top_name");
   auto top_instance_name = top_instance_name_option->getStringVal();
 
   Sta* ista = Sta::getOrCreateSta();
   Power* ipower = Power::getOrCreatePower(&(ista->get_graph()));
-  // TODO set begin end time
+
+  TclOption* stream_option = getOptionOrArg("-stream");
+  TclOption* time_windows_option = getOptionOrArg("-time_windows");
+  if (stream_option->is_set_val() || time_windows_option->is_set_val()) {
+    std::vector<VcdTimeWindow> time_windows;
+    if (time_windows_option->is_set_val()) {
+      parseTimeWindows(time_windows_option->getStringVal(), time_windows);
+    }
+    return ipower->readVCDStream(vcd_file, top_instance_name,
+                                 std::move(time_windows));
+  }
+
   return ipower->readRustVCD(vcd_file, top_instance_name);
 }
 
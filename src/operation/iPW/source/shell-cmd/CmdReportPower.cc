@@ -27,7 +27,12 @@
 
 namespace ipower {
 
-CmdReportPower::CmdReportPower(const char* cmd_name) : TclCmd(cmd_name) {}
+CmdReportPower::CmdReportPower(const char* cmd_name) : TclCmd(cmd_name) {
+  // report the power of each vcd time window to the csv file.
+  auto* time_window_file_option =
+      new TclStringOption("-time_window_file", 0, nullptr);
+  addOption(time_window_file_option);
+}
 
 unsigned CmdReportPower::check() { return 1; }
 
@@ -41,6 +46,12 @@ unsigned CmdReportPower::exec() {
 
   ipower->runCompleteFlow();
 
+  TclOption* time_window_file_option = getOptionOrArg("-time_window_file");
+  if (time_window_file_option->is_set_val()) {
+    return ipower->reportTimeWindowPower(
+        time_window_file_option->getStringVal());
+  }
+
   return 1;
 }
 
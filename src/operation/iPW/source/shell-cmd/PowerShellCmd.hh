@@ -33,6 +33,7 @@ using ieda::ScriptEngine;
 using ieda::TclCmd;
 using ieda::TclOption;
 using ieda::TclStringOption;
+using ieda::TclSwitchOption;
 
 /**
  * @brief set the design workspace.
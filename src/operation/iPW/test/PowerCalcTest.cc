@@ -0,0 +1,440 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of
+// Sciences Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan
+// PSL v2. You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY
+// KIND, EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// NON-INFRINGEMENT, MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "api/Power.hh"
+#include "api/TimingEngine.hh"
+#include "gtest/gtest.h"
+#include "log/Log.hh"
+#include "ops/calc_power/PwrCalcParallel.hh"
+
+using namespace ipower;
+using namespace ieda;
+
+namespace {
+
+/**
+ * @brief The power of each design object, leakage, internal and switch, by
+ * object name.
+ */
+using PowerDump = std::map<std::string, std::vector<double>>;
+
+PowerDump dumpAnalysisPower(Power* ipower) {
+  PowerDump power_dump;
+  PwrLeakageData* leakage_power;
+  FOREACH_PWR_LEAKAGE_POWER(ipower, leakage_power) {
+    power_dump[leakage_power->get_design_obj()->get_name()].push_back(
+        leakage_power->get_leakage_power());
+  }
+  PwrInternalData* internal_power;
+  FOREACH_PWR_INTERNAL_POWER(ipower, internal_power) {
+    power_dump[internal_power->get_design_obj()->get_name()].push_back(
+        internal_power->get_internal_power());
+  }
+  PwrSwitchData* switch_power;
+  FOREACH_PWR_SWITCH_POWER(ipower, switch_power) {
+    power_dump["net:" + std::string(switch_power->get_design_obj()->get_name())]
+        .push_back(switch_power->get_switch_power());
+  }
+  return power_dump;
+}
+
+PowerDump dumpGroupPower(Power* ipower) {
+  PowerDump power_dump;
+  PwrGroupData* group_data;
+  FOREACH_PWR_GROUP_DATA(ipower, group_data) {
+    power_dump[group_data->get_obj()->get_name()] = {
+        group_data->get_leakage_power(), group_data->get_internal_power(),
+        group_data->get_switch_power()};
+  }
+  return power_dump;
+}
+
+/**
+ * @brief The max slew and load of each pin or port, rise and fall.
+ */
+using TimingDump = std::map<DesignObject*, std::vector<double>>;
+
+TimingDump dumpPinTiming(StaGraph* sta_graph) {
+  TimingDump timing_dump;
+  StaVertex* vertex;
+  FOREACH_VERTEX(sta_graph, vertex) {
+    auto& pin_timing = timing_dump[vertex->get_design_obj()];
+    for (auto trans_type : {TransType::kRise, TransType::kFall}) {
+      pin_timing.push_back(
+          vertex->getSlewNs(AnalysisMode::kMax, trans_type).value_or(0.0));
+      pin_timing.push_back(vertex->getLoad(AnalysisMode::kMax, trans_type));
+    }
+  }
+  return timing_dump;
+}
+
+/**
+ * @brief add the insts and nets of the pins whose timing is changed or new.
+ */
+void addTimingChangedObjs(const TimingDump& origin_dump, const TimingDump& dump,
+                          std::set<Instance*>& changed_insts,
+                          std::set<Net*>& changed_nets) {
+  for (auto& [design_obj, pin_timing] : dump) {
+    auto it = origin_dump.find(design_obj);
+    if (it != origin_dump.end() && it->second == pin_timing) {
+      continue;
+    }
+    if (design_obj->isPin()) {
+      changed_insts.insert(design_obj->get_own_instance());
+    }
+    if (design_obj->get_net()) {
+      changed_nets.insert(design_obj->get_net());
+    }
+  }
+}
+
+void expectPowerNear(const PowerDump& expect_dump, const PowerDump& dump) {
+  ASSERT_EQ(expect_dump.size(), dump.size());
+  for (auto& [obj_name, expect_powers] : expect_dump) {
+    auto it = dump.find(obj_name);
+    ASSERT_NE(it, dump.end()) << obj_name;
+    ASSERT_EQ(expect_powers.size(), it->second.size()) << obj_name;
+    for (std::size_t i = 0; i < expect_powers.size(); ++i) {
+      EXPECT_NEAR(expect_powers[i], it->second[i],
+                  1e-9 * std::abs(expect_powers[i]) + 1e-18)
+          << obj_name;
+    }
+  }
+}
+
+TEST(PowerCalcParallelTest, parallel_match_serial) {
+  std::vector<int> values(10000);
+  std::vector<int*> objs;
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    values[i] = static_cast<int>(i);
+    objs.push_back(&values[i]);
+  }
+
+  // the odd objects are skipped.
+  auto calc_func = [](int* obj) -> std::unique_ptr<double> {
+    return (*obj % 2) ? nullptr : std::make_unique<double>(*obj * 0.5);
+  };
+  auto serial_datas = CalcPowerParallel<double>(objs, 1, calc_func);
+  auto parallel_datas = CalcPowerParallel<double>(objs, 8, calc_func);
+
+  ASSERT_EQ(serial_datas.size(), objs.size());
+  ASSERT_EQ(parallel_datas.size(), objs.size());
+  for (std::size_t i = 0; i < objs.size(); ++i) {
+    if (i % 2) {
+      EXPECT_EQ(serial_datas[i], nullptr);
+      EXPECT_EQ(parallel_datas[i], nullptr);
+    } else {
+      ASSERT_NE(parallel_datas[i], nullptr);
+      EXPECT_EQ(*serial_datas[i], i * 0.5);
+      EXPECT_EQ(*parallel_datas[i], *serial_datas[i]);
+    }
+  }
+}
+
+/**
+ * @brief The design is read from the liberty IPW_TEST_LIB, the verilog
+ * IPW_TEST_VERILOG with top module IPW_TEST_TOP, the sdc IPW_TEST_SDC and the
+ * spef IPW_TEST_SPEF. The tests are skipped when they are unset.
+ */
+class PowerCalcTest : public testing::Test {
+ protected:
+  void SetUp() final {
+    const char* lib_file = std::getenv("IPW_TEST_LIB");
+    const char* verilog_file = std::getenv("IPW_TEST_VERILOG");
+    const char* top_name = std::getenv("IPW_TEST_TOP");
+    const char* sdc_file = std::getenv("IPW_TEST_SDC");
+    const char* spef_file = std::getenv("IPW_TEST_SPEF");
+    if (!lib_file || !verilog_file || !top_name || !sdc_file || !spef_file) {
+      GTEST_SKIP() << "IPW_TEST_LIB, IPW_TEST_VERILOG, IPW_TEST_TOP, "
+                      "IPW_TEST_SDC or IPW_TEST_SPEF is not set.";
+    }
+
+    static bool is_init = false;
+    if (!is_init) {
+      char config[] = "test";
+      char* argv[] = {config};
+      Log::init(argv);
+
+      auto* timing_engine = TimingEngine::getOrCreateTimingEngine();
+      timing_engine->set_num_threads(8);
+      std::vector<const char*> lib_files{lib_file};
+      timing_engine->readLiberty(lib_files);
+      timing_engine->get_ista()->set_analysis_mode(
+          ista::AnalysisMode::kMaxMin);
+      timing_engine->get_ista()->set_top_module_name(top_name);
+      timing_engine->readDesign(verilog_file);
+      timing_engine->readSdc(sdc_file);
+      timing_engine->readSpef(spef_file);
+      timing_engine->buildGraph();
+      timing_engine->updateTiming();
+      is_init = true;
+    }
+
+    _ipower = createPower();
+  }
+
+  /**
+   * @brief create the power of the current timing graph, the graph and seq
+   * graph are built.
+   */
+  static std::unique_ptr<Power> createPower() {
+    auto* ista = TimingEngine::getOrCreateTimingEngine()->get_ista();
+    auto ipower = std::make_unique<Power>(&(ista->get_graph()));
+    auto* fastest_clock = ista->getFastestClock();
+    PwrClock pwr_fastest_clock(fastest_clock->get_clock_name(),
+                               fastest_clock->getPeriodNs());
+    auto clocks = ista->getClocks();
+    ipower->setupClock(std::move(pwr_fastest_clock), std::move(clocks));
+    ipower->buildGraph();
+    ipower->buildSeqGraph();
+    return ipower;
+  }
+
+  /**
+   * @brief expect the power equal to the power analyzed from scratch, which
+   * is the flow of runCompleteFlow without the vcd and the report.
+   */
+  void expectPowerMatchFull() {
+    auto full_power = createPower();
+    full_power->initToggleSPData();
+    full_power->updatePower();
+    expectPowerNear(dumpAnalysisPower(full_power.get()),
+                    dumpAnalysisPower(_ipower.get()));
+    expectPowerNear(dumpGroupPower(full_power.get()),
+                    dumpGroupPower(_ipower.get()));
+  }
+
+  /**
+   * @brief double the toggle of the driver of some nets, return the nets.
+   */
+  std::vector<Net*> changeNetsToggle(std::size_t net_num) {
+    std::vector<Net*> changed_nets;
+    auto& the_pwr_graph = _ipower->get_power_graph();
+    Netlist* design_nl =
+        TimingEngine::getOrCreateTimingEngine()->get_ista()->get_netlist();
+    Net* net;
+    FOREACH_NET(design_nl, net) {
+      if (changed_nets.size() == net_num) {
+        break;
+      }
+      auto* driver_obj = net->getDriver();
+      if (!driver_obj || !driver_obj->isPin() || net->getLoads().empty()) {
+        continue;
+      }
+      auto* driver_vertex = the_pwr_graph.getPowerVertex(driver_obj);
+      if (!driver_vertex || driver_vertex->is_const()) {
+        continue;
+      }
+      double toggle = driver_vertex->getToggleData(std::nullopt);
+      double sp = driver_vertex->getSPData(std::nullopt);
+      driver_vertex->resetToggleSPData();
+      driver_vertex->addData(toggle * 2, sp, PwrDataSource::kAnnotate,
+                             &the_pwr_graph.get_fastest_clock());
+      changed_nets.push_back(net);
+    }
+    return changed_nets;
+  }
+
+  std::unique_ptr<Power> _ipower;
+};
+
+TEST_F(PowerCalcTest, parallel_match_serial) {
+  _ipower->set_calc_num_threads(1);
+  _ipower->updatePower();
+  auto serial_power = dumpAnalysisPower(_ipower.get());
+  auto serial_group_power = dumpGroupPower(_ipower.get());
+
+  _ipower->set_calc_num_threads(48);
+  _ipower->updatePower();
+
+  EXPECT_FALSE(serial_power.empty());
+  expectPowerNear(serial_power, dumpAnalysisPower(_ipower.get()));
+  expectPowerNear(serial_group_power, dumpGroupPower(_ipower.get()));
+}
+
+TEST_F(PowerCalcTest, incr_match_full) {
+  _ipower->updatePower();
+  auto origin_group_power = dumpGroupPower(_ipower.get());
+
+  auto changed_nets = changeNetsToggle(20);
+  ASSERT_FALSE(changed_nets.empty());
+  _ipower->incrUpdatePower({}, changed_nets);
+  EXPECT_FALSE(_ipower->get_inst_power_deltas().empty());
+  auto incr_power = dumpAnalysisPower(_ipower.get());
+  auto incr_group_power = dumpGroupPower(_ipower.get());
+
+  _ipower->updatePower();
+  expectPowerNear(dumpAnalysisPower(_ipower.get()), incr_power);
+  expectPowerNear(dumpGroupPower(_ipower.get()), incr_group_power);
+  EXPECT_NE(origin_group_power, incr_group_power);
+}
+
+TEST_F(PowerCalcTest, report_inst_power_delta) {
+  _ipower->updatePower();
+  auto changed_nets = changeNetsToggle(20);
+  ASSERT_FALSE(changed_nets.empty());
+  _ipower->incrUpdatePower({}, changed_nets);
+
+  std::string rpt_file_name =
+      testing::TempDir() + "report_instance_power_delta.csv";
+  _ipower->reportInstancePowerDelta(rpt_file_name.c_str());
+
+  std::ifstream csv_file(rpt_file_name);
+  std::string line;
+  ASSERT_TRUE(std::getline(csv_file, line));
+  EXPECT_EQ(line,
+            "Instance Name,Old Power,New Power,Delta Power,Delta Internal "
+            "Power,Delta Switch Power,Delta Leakage Power");
+
+  // the rows are sorted by the abs of delta power.
+  std::size_t row_num = 0;
+  double last_delta = INFINITY;
+  while (std::getline(csv_file, line)) {
+    auto delta_begin = line.find(',', line.find(',', line.find(',') + 1) + 1);
+    ASSERT_NE(delta_begin, std::string::npos);
+    double delta = std::abs(std::stod(line.substr(delta_begin + 1)));
+    EXPECT_LE(delta, last_delta * (1 + 1e-3));
+    last_delta = delta;
+    ++row_num;
+  }
+  EXPECT_EQ(row_num, _ipower->get_inst_power_deltas().size());
+  std::remove(rpt_file_name.c_str());
+}
+
+TEST_F(PowerCalcTest, insert_remove_buffer_match_full) {
+  auto* timing_engine = TimingEngine::getOrCreateTimingEngine();
+  auto* ista = timing_engine->get_ista();
+  auto* design_nl = ista->get_netlist();
+  auto* sta_graph = &(ista->get_graph());
+  auto& the_pwr_graph = _ipower->get_power_graph();
+
+  _ipower->initToggleSPData();
+  _ipower->updatePower();
+
+  LibCell* buffer_cell = nullptr;
+  for (auto& lib : ista->getAllLib()) {
+    LibCell* lib_cell;
+    FOREACH_LIB_CELL(lib, lib_cell) {
+      if (lib_cell->isBuffer()) {
+        buffer_cell = lib_cell;
+        break;
+      }
+    }
+    if (buffer_cell) {
+      break;
+    }
+  }
+  ASSERT_NE(buffer_cell, nullptr);
+  LibPort* buffer_input;
+  LibPort* buffer_output;
+  buffer_cell->bufferPorts(buffer_input, buffer_output);
+
+  // the buffer drive one propagated load of a data net.
+  Net* source_net = nullptr;
+  Pin* load_pin = nullptr;
+  Net* net;
+  FOREACH_NET(design_nl, net) {
+    auto* driver_obj = net->getDriver();
+    if (!driver_obj || !driver_obj->isPin() || net->isClockNet()) {
+      continue;
+    }
+    auto* driver_vertex = the_pwr_graph.getPowerVertex(driver_obj);
+    if (driver_vertex->is_const() || driver_vertex->is_clock_network()) {
+      continue;
+    }
+    for (auto* load_obj : net->getLoads()) {
+      if (load_obj->isPin() &&
+          the_pwr_graph.getPowerVertex(load_obj)->is_toggle_sp_propagated()) {
+        load_pin = dynamic_cast<Pin*>(load_obj);
+        break;
+      }
+    }
+    if (load_pin) {
+      source_net = net;
+      break;
+    }
+  }
+  ASSERT_NE(load_pin, nullptr);
+
+  // insert the buffer.
+  auto origin_timing = dumpPinTiming(sta_graph);
+
+  Instance buffer_inst("ipw_test_buffer", buffer_cell);
+  LibPort* cell_port;
+  FOREACH_CELL_PORT(buffer_cell, cell_port) {
+    buffer_inst.addPin(cell_port->get_port_name(), cell_port);
+  }
+  auto* buffer = &(design_nl->addInstance(std::move(buffer_inst)));
+  auto* buffer_net = &(design_nl->addNet(Net("ipw_test_buffer_net")));
+  auto* buffer_in_pin = buffer->findPin(buffer_input);
+  auto* buffer_out_pin = buffer->findPin(buffer_output);
+
+  source_net->removePinPort(load_pin);
+  buffer_net->addPinPort(load_pin);
+  source_net->addPinPort(buffer_in_pin);
+  buffer_net->addPinPort(buffer_out_pin);
+  timing_engine->initRcTree(source_net);
+  timing_engine->initRcTree(buffer_net);
+  timing_engine->insertBuffer(buffer->get_name());
+  timing_engine->updateTiming();
+
+  std::set<Instance*> changed_insts{buffer};
+  std::set<Net*> changed_nets{source_net, buffer_net};
+  addTimingChangedObjs(origin_timing, dumpPinTiming(sta_graph), changed_insts,
+                       changed_nets);
+  _ipower->incrUpdatePower({changed_insts.begin(), changed_insts.end()},
+                           {changed_nets.begin(), changed_nets.end()});
+  EXPECT_NE(the_pwr_graph.findCell(buffer->get_name()), nullptr);
+  expectPowerMatchFull();
+
+  // remove the buffer, the removed objects are deleted after the power
+  // update.
+  origin_timing = dumpPinTiming(sta_graph);
+
+  timing_engine->removeBuffer(buffer->get_name());
+  buffer_net->removePinPort(load_pin);
+  source_net->addPinPort(load_pin);
+  source_net->removePinPort(buffer_in_pin);
+  buffer_net->removePinPort(buffer_out_pin);
+  timing_engine->initRcTree(source_net);
+  timing_engine->updateTiming();
+
+  changed_insts.clear();
+  changed_nets = {source_net};
+  addTimingChangedObjs(origin_timing, dumpPinTiming(sta_graph), changed_insts,
+                       changed_nets);
+  _ipower->incrUpdatePower({changed_insts.begin(), changed_insts.end()},
+                           {changed_nets.begin(), changed_nets.end()},
+                           {buffer}, {buffer_net});
+  EXPECT_EQ(the_pwr_graph.findCell(buffer->get_name()), nullptr);
+  EXPECT_EQ(_ipower->getObjData(buffer), nullptr);
+
+  design_nl->removeNet(buffer_net);
+  design_nl->removeInstance(buffer->get_name());
+  expectPowerMatchFull();
+}
+
+}  // namespace
@@ -14,9 +14,17 @@
 //
 // See the Mulan PSL v2 for more details.
 // ***************************************************************************************
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
 #include "gtest/gtest.h"
 #include "log/Log.hh"
 #include "ops/read_vcd/RustVCDParserWrapper.hh"
+#include "ops/read_vcd/VcdStreamReader.hh"
 
 using namespace ipower;
 using namespace ieda;
@@ -44,4 +52,62 @@ TEST_F(VCDParserWrapperTest, rust_reader) {
   vcd_reader.printAnnotateDB(std::cout);
 }
 
+TEST_F(VCDParserWrapperTest, stream_reader) {
+  std::string vcd_file_path = testing::TempDir() + "ipw_stream_reader_XXXXXX";
+  int vcd_fd = mkstemp(vcd_file_path.data());
+  ASSERT_NE(vcd_fd, -1);
+  close(vcd_fd);
+  {
+    std::ofstream vcd_file(vcd_file_path);
+    vcd_file << "$timescale 1ps $end\n"
+             << "$scope module tb $end\n"
+             << "$scope module top_i $end\n"
+             << "$var wire 1 ! clk $end\n"
+             << "$var wire 2 \" data [1:0] $end\n"
+             << "$var reg 1 # q $end\n"
+             << "$upscope $end\n"
+             << "$upscope $end\n"
+             << "$enddefinitions $end\n"
+             << "#0\n$dumpvars\n0!\nb00 \"\n0#\n$end\n"
+             << "#10\n1!\nb01 \"\n1#\n"
+             << "#20\n0!\n"
+             << "#30\n1!\nb10 \"\n0#\n"
+             << "#40\n0!\n";
+  }
+
+  auto get_tc_sp = [](AnnotateDB* annotate_db, const char* signal_name) {
+    auto* top_instance = annotate_db->get_top_instance();
+    return top_instance->get_signals()[signal_name]->get_signal_tc_sp();
+  };
+
+  ipower::VcdStreamReader vcd_reader;
+  vcd_reader.set_time_windows({{0, 20}, {20, 40}});
+
+  // the reader is reused, the second read should not accumulate the first.
+  for (int read_num = 0; read_num < 2; ++read_num) {
+    vcd_reader.readVcdFile(vcd_file_path.c_str(), "top_i");
+
+    auto* annotate_db = vcd_reader.get_annotate_db();
+    EXPECT_EQ(annotate_db->get_simulation_duration(), 40);
+    EXPECT_EQ(get_tc_sp(annotate_db, "clk").first, 4);
+    EXPECT_DOUBLE_EQ(get_tc_sp(annotate_db, "clk").second, 0.5);
+    EXPECT_EQ(get_tc_sp(annotate_db, "data[0]").first, 2);
+    EXPECT_EQ(get_tc_sp(annotate_db, "data[1]").first, 1);
+    EXPECT_DOUBLE_EQ(get_tc_sp(annotate_db, "data[1]").second, 0.25);
+    EXPECT_EQ(get_tc_sp(annotate_db, "q").first, 2);
+    EXPECT_DOUBLE_EQ(get_tc_sp(annotate_db, "q").second, 0.5);
+
+    auto& window_annotate_dbs = vcd_reader.get_window_annotate_dbs();
+    ASSERT_EQ(window_annotate_dbs.size(), 2);
+    EXPECT_EQ(get_tc_sp(window_annotate_dbs[0].get(), "data[0]").first, 1);
+    EXPECT_EQ(get_tc_sp(window_annotate_dbs[1].get(), "data[0]").first, 1);
+    EXPECT_EQ(get_tc_sp(window_annotate_dbs[1].get(), "clk").first, 2);
+    EXPECT_EQ(get_tc_sp(window_annotate_dbs[0].get(), "q").first, 1);
+    EXPECT_DOUBLE_EQ(get_tc_sp(window_annotate_dbs[0].get(), "data[1]").second,
+                     0.0);
+  }
+
+  std::remove(vcd_file_path.c_str());
+}
+
 }  // namespace
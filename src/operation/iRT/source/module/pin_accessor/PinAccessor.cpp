@@ -134,11 +134,38 @@ void PinAccessor::initAccessPointList(PAModel& pa_model)
       net_pin_pair_list.emplace_back(pa_net.get_net_idx(), &pa_pin);
     }
   }
+  // 形状相同的pin(同一master pin同一朝向)共享一个pattern,每个pin只需要做局部的障碍裁剪
+  std::vector<PAPinPattern> pin_pattern_list;
+  std::vector<std::pair<int32_t, PlanarCoord>> pattern_origin_pair_list;
+  {
+    std::map<std::vector<int32_t>, int32_t> key_pattern_idx_map;
+    for (std::pair<int32_t, PAPin*>& net_pin_pair : net_pin_pair_list) {
+      PlanarCoord origin = getPatternOrigin(net_pin_pair.second);
+      std::vector<LayerRect> shape_list = getPatternShapeList(net_pin_pair.second, origin);
+      std::vector<int32_t> pattern_key;
+      for (LayerRect& shape : shape_list) {
+        pattern_key.insert(pattern_key.end(), {shape.get_layer_idx(), shape.get_ll_x(), shape.get_ll_y(), shape.get_ur_x(), shape.get_ur_y()});
+      }
+      auto [iter, is_new] = key_pattern_idx_map.emplace(pattern_key, static_cast<int32_t>(pin_pattern_list.size()));
+      if (is_new) {
+        PAPinPattern pin_pattern;
+        pin_pattern.set_shape_list(shape_list);
+        pin_pattern_list.push_back(pin_pattern);
+      }
+      pattern_origin_pair_list.emplace_back(iter->second, origin);
+    }
+  }
+#pragma omp parallel for
+  for (PAPinPattern& pin_pattern : pin_pattern_list) {
+    buildPinPattern(pin_pattern);
+  }
 #pragma omp parallel for
-  for (std::pair<int32_t, PAPin*>& net_pin_pair : net_pin_pair_list) {
-    PAPin* pin = net_pin_pair.second;
-    std::vector<AccessPoint>& access_point_list = net_pin_pair.second->get_access_point_list();
-    std::vector<LayerRect> legal_shape_list = getLegalShapeList(pa_model, net_pin_pair.first, pin);
+  for (size_t pair_idx = 0; pair_idx < net_pin_pair_list.size(); pair_idx++) {
+    PAPin* pin = net_pin_pair_list[pair_idx].second;
+    PAPinPattern& pin_pattern = pin_pattern_list[pattern_origin_pair_list[pair_idx].first];
+    PlanarCoord& origin = pattern_origin_pair_list[pair_idx].second;
+    std::vector<AccessPoint>& access_point_list = pin->get_access_point_list();
+    std::vector<LayerRect> legal_shape_list = getLegalShapeList(pa_model, net_pin_pair_list[pair_idx].first, pin, pin_pattern, origin);
     for (AccessPoint& access_point : getAccessPointList(pin->get_pin_idx(), legal_shape_list)) {
       if (!RTUTIL.isInside(die_valid_rect, access_point.get_real_coord())) {
         continue;
@@ -173,18 +200,98 @@ void PinAccessor::initAccessPointList(PAModel& pa_model)
       RTLOG.error(Loc::current(), "No access point was generated!");
     }
   }
+  RTLOG.info(Loc::current(), "Built ", pin_pattern_list.size(), " pin patterns for ", net_pin_pair_list.size(), " pins");
   RTLOG.info(Loc::current(), "Completed", monitor.getStatsInfo());
 }
 
-std::vector<LayerRect> PinAccessor::getLegalShapeList(PAModel& pa_model, int32_t net_idx, Pin* pin)
+PlanarCoord PinAccessor::getPatternOrigin(Pin* pin)
 {
-  std::map<int32_t, std::vector<EXTLayerRect>> layer_pin_shape_list;
+  int32_t origin_x = INT32_MAX;
+  int32_t origin_y = INT32_MAX;
   for (EXTLayerRect& routing_shape : pin->get_routing_shape_list()) {
-    layer_pin_shape_list[routing_shape.get_layer_idx()].emplace_back(routing_shape);
+    origin_x = std::min(origin_x, routing_shape.get_real_ll_x());
+    origin_y = std::min(origin_y, routing_shape.get_real_ll_y());
+  }
+  if (origin_x == INT32_MAX || origin_y == INT32_MAX) {
+    return PlanarCoord(0, 0);
+  }
+  return PlanarCoord(origin_x, origin_y);
+}
+
+std::vector<LayerRect> PinAccessor::getPatternShapeList(Pin* pin, PlanarCoord& origin)
+{
+  std::vector<LayerRect> shape_list;
+  for (EXTLayerRect& routing_shape : pin->get_routing_shape_list()) {
+    PlanarRect shape = RTUTIL.getOffsetRect(routing_shape.get_real_rect(), PlanarCoord(-origin.get_x(), -origin.get_y()));
+    shape_list.emplace_back(shape, routing_shape.get_layer_idx());
+  }
+  std::sort(shape_list.begin(), shape_list.end(), CmpLayerRectByXASC());
+  return shape_list;
+}
+
+void PinAccessor::buildPinPattern(PAPinPattern& pin_pattern)
+{
+  std::vector<RoutingLayer>& routing_layer_list = RTDM.getDatabase().get_routing_layer_list();
+  std::map<int32_t, PlanarRect>& layer_enclosure_map = RTDM.getDatabase().get_layer_enclosure_map();
+
+  std::map<int32_t, std::vector<PlanarRect>> layer_shape_list_map;
+  for (LayerRect& shape : pin_pattern.get_shape_list()) {
+    layer_shape_list_map[shape.get_layer_idx()].push_back(shape);
+  }
+  std::map<int32_t, std::vector<PlanarRect>> layer_shrinked_rect_map;
+  std::map<int32_t, std::vector<PlanarRect>> layer_legal_rect_map;
+  for (auto& [curr_layer_idx, shape_list] : layer_shape_list_map) {
+    // 当前层缩小后的结果
+    PlanarRect& enclosure = layer_enclosure_map[curr_layer_idx];
+    int32_t enclosure_half_x_span = enclosure.getXSpan() / 2;
+    int32_t enclosure_half_y_span = enclosure.getYSpan() / 2;
+    int32_t half_min_width = routing_layer_list[curr_layer_idx].get_min_width() / 2;
+    int32_t shrinked_x_size = std::max(half_min_width, enclosure_half_x_span);
+    int32_t shrinked_y_size = std::max(half_min_width, enclosure_half_y_span);
+    std::vector<PlanarRect>& shrinked_rect_list = layer_shrinked_rect_map[curr_layer_idx];
+    shrinked_rect_list
+        = RTUTIL.getClosedShrinkedRectListByBoost(shape_list, shrinked_x_size, shrinked_y_size, shrinked_x_size, shrinked_y_size);
+    // 没有障碍时的合法形状
+    std::vector<PlanarRect>& legal_rect_list = layer_legal_rect_map[curr_layer_idx];
+    for (Direction direction : {Direction::kVertical, Direction::kHorizontal}) {
+      for (PlanarRect& legal_rect : RTUTIL.mergeRectListByBoost(shrinked_rect_list, direction)) {
+        legal_rect_list.push_back(legal_rect);
+      }
+    }
   }
+  pin_pattern.set_layer_shrinked_rect_map(layer_shrinked_rect_map);
+  pin_pattern.set_layer_legal_rect_map(layer_legal_rect_map);
+}
+
+std::vector<LayerRect> PinAccessor::getLegalShapeList(PAModel& pa_model, int32_t net_idx, Pin* pin, PAPinPattern& pin_pattern,
+                                                      PlanarCoord& origin)
+{
+  std::map<int32_t, std::vector<PlanarRect>>& layer_legal_rect_map = pin_pattern.get_layer_legal_rect_map();
+
   std::vector<LayerRect> legal_rect_list;
-  for (auto& [layer_idx, pin_shape_list] : layer_pin_shape_list) {
-    std::vector<PlanarRect> planar_legal_rect_list = getPlanarLegalRectList(pa_model, net_idx, pin_shape_list);
+  for (auto& [layer_idx, shrinked_rect_list] : pin_pattern.get_layer_shrinked_rect_map()) {
+    std::vector<PlanarRect> real_shrinked_rect_list;
+    for (PlanarRect& shrinked_rect : shrinked_rect_list) {
+      real_shrinked_rect_list.push_back(RTUTIL.getOffsetRect(shrinked_rect, origin));
+    }
+    std::vector<std::vector<PlanarRect>> routing_obs_shape_list_list
+        = getRoutingObsShapeListList(pa_model, net_idx, layer_idx, real_shrinked_rect_list);
+    if (routing_obs_shape_list_list.empty()) {
+      // 周围没有障碍,直接复用pattern的结果
+      for (const PlanarRect& legal_rect : layer_legal_rect_map.find(layer_idx)->second) {
+        legal_rect_list.emplace_back(RTUTIL.getOffsetRect(legal_rect, origin), layer_idx);
+      }
+      continue;
+    }
+    std::vector<PlanarRect> planar_legal_rect_list = real_shrinked_rect_list;
+    for (std::vector<PlanarRect>& routing_obs_shape_list : routing_obs_shape_list_list) {
+      std::vector<PlanarRect> legal_rect_list_temp = RTUTIL.getClosedCuttingRectListByBoost(planar_legal_rect_list, routing_obs_shape_list);
+      if (!legal_rect_list_temp.empty()) {
+        planar_legal_rect_list = legal_rect_list_temp;
+      } else {
+        break;
+      }
+    }
     for (PlanarRect planar_legal_rect : RTUTIL.mergeRectListByBoost(planar_legal_rect_list, Direction::kVertical)) {
       legal_rect_list.emplace_back(planar_legal_rect, layer_idx);
     }
@@ -201,45 +308,21 @@ std::vector<LayerRect> PinAccessor::getLegalShapeList(PAModel& pa_model, int32_t
   return legal_rect_list;
 }
 
-std::vector<PlanarRect> PinAccessor::getPlanarLegalRectList(PAModel& pa_model, int32_t curr_net_idx,
-                                                            std::vector<EXTLayerRect>& pin_shape_list)
+std::vector<std::vector<PlanarRect>> PinAccessor::getRoutingObsShapeListList(PAModel& pa_model, int32_t curr_net_idx, int32_t curr_layer_idx,
+                                                                             std::vector<PlanarRect>& shrinked_rect_list)
 {
   ScaleAxis& gcell_axis = RTDM.getDatabase().get_gcell_axis();
   std::vector<RoutingLayer>& routing_layer_list = RTDM.getDatabase().get_routing_layer_list();
   std::map<int32_t, PlanarRect>& layer_enclosure_map = RTDM.getDatabase().get_layer_enclosure_map();
 
-  int32_t curr_layer_idx;
-  {
-    for (EXTLayerRect& pin_shape : pin_shape_list) {
-      if (pin_shape_list.front().get_layer_idx() != pin_shape.get_layer_idx()) {
-        RTLOG.error(Loc::current(), "The pin_shape_list is not on the same layer!");
-      }
-    }
-    curr_layer_idx = pin_shape_list.front().get_layer_idx();
+  std::vector<EXTLayerRect> ext_shrinked_rect_list;
+  for (PlanarRect& real_rect : shrinked_rect_list) {
+    EXTLayerRect shrinked_rect;
+    shrinked_rect.set_real_rect(real_rect);
+    shrinked_rect.set_grid_rect(RTUTIL.getClosedGCellGridRect(shrinked_rect.get_real_rect(), gcell_axis));
+    shrinked_rect.set_layer_idx(curr_layer_idx);
+    ext_shrinked_rect_list.push_back(shrinked_rect);
   }
-  // 当前层缩小后的结果
-  std::vector<EXTLayerRect> shrinked_rect_list;
-  {
-    std::vector<PlanarRect> origin_pin_shape_list;
-    for (EXTLayerRect& pin_shape : pin_shape_list) {
-      origin_pin_shape_list.push_back(pin_shape.get_real_rect());
-    }
-    PlanarRect& enclosure = layer_enclosure_map[curr_layer_idx];
-    int32_t enclosure_half_x_span = enclosure.getXSpan() / 2;
-    int32_t enclosure_half_y_span = enclosure.getYSpan() / 2;
-    int32_t half_min_width = routing_layer_list[curr_layer_idx].get_min_width() / 2;
-    int32_t shrinked_x_size = std::max(half_min_width, enclosure_half_x_span);
-    int32_t shrinked_y_size = std::max(half_min_width, enclosure_half_y_span);
-    for (PlanarRect& real_rect : RTUTIL.getClosedShrinkedRectListByBoost(origin_pin_shape_list, shrinked_x_size, shrinked_y_size,
-                                                                         shrinked_x_size, shrinked_y_size)) {
-      EXTLayerRect shrinked_rect;
-      shrinked_rect.set_real_rect(real_rect);
-      shrinked_rect.set_grid_rect(RTUTIL.getClosedGCellGridRect(shrinked_rect.get_real_rect(), gcell_axis));
-      shrinked_rect.set_layer_idx(curr_layer_idx);
-      shrinked_rect_list.push_back(shrinked_rect);
-    }
-  }
-  // 要被剪裁的obstacle的集合 排序按照 本层 上层
   /**
    * 要被剪裁的obstacle的集合
    * 如果不是最顶层就往上取一层
@@ -259,7 +342,7 @@ std::vector<PlanarRect> PinAccessor::getPlanarLegalRectList(PAModel& pa_model, i
     int32_t enclosure_half_y_span = enclosure.getYSpan() / 2;
 
     std::vector<PlanarRect> routing_obs_shape_list;
-    for (EXTLayerRect& shrinked_rect : shrinked_rect_list) {
+    for (EXTLayerRect& shrinked_rect : ext_shrinked_rect_list) {
       for (auto& [is_routing, layer_net_fixed_rect_map] : RTDM.getTypeLayerNetFixedRectMap(shrinked_rect)) {
         if (!is_routing) {
           continue;
@@ -290,19 +373,7 @@ std::vector<PlanarRect> PinAccessor::getPlanarLegalRectList(PAModel& pa_model, i
       routing_obs_shape_list_list.push_back(routing_obs_shape_list);
     }
   }
-  std::vector<PlanarRect> legal_rect_list;
-  for (EXTLayerRect& shrinked_rect : shrinked_rect_list) {
-    legal_rect_list.push_back(shrinked_rect.get_real_rect());
-  }
-  for (std::vector<PlanarRect>& routing_obs_shape_list : routing_obs_shape_list_list) {
-    std::vector<PlanarRect> legal_rect_list_temp = RTUTIL.getClosedCuttingRectListByBoost(legal_rect_list, routing_obs_shape_list);
-    if (!legal_rect_list_temp.empty()) {
-      legal_rect_list = legal_rect_list_temp;
-    } else {
-      break;
-    }
-  }
-  return legal_rect_list;
+  return routing_obs_shape_list_list;
 }
 
 std::vector<AccessPoint> PinAccessor::getAccessPointList(int32_t pin_idx, std::vector<LayerRect>& legal_shape_list)
@@ -26,6 +26,7 @@
 #include "PANet.hpp"
 #include "PANode.hpp"
 #include "PAParameter.hpp"
+#include "PAPinPattern.hpp"
 #include "RTHeader.hpp"
 
 namespace irt {
@@ -40,6 +41,10 @@ class PinAccessor
   static void destroyInst();
   // function
   void access();
+  // pin pattern
+  PlanarCoord getPatternOrigin(Pin* pin);
+  std::vector<LayerRect> getPatternShapeList(Pin* pin, PlanarCoord& origin);
+  void buildPinPattern(PAPinPattern& pin_pattern);
 
  private:
   // self
@@ -56,8 +61,9 @@ class PinAccessor
   std::vector<PANet> convertToPANetList(std::vector<Net>& net_list);
   PANet convertToPANet(Net& net);
   void initAccessPointList(PAModel& pa_model);
-  std::vector<LayerRect> getLegalShapeList(PAModel& pa_model, int32_t net_idx, Pin* pin);
-  std::vector<PlanarRect> getPlanarLegalRectList(PAModel& pa_model, int32_t curr_net_idx, std::vector<EXTLayerRect>& pin_shape_list);
+  std::vector<LayerRect> getLegalShapeList(PAModel& pa_model, int32_t net_idx, Pin* pin, PAPinPattern& pin_pattern, PlanarCoord& origin);
+  std::vector<std::vector<PlanarRect>> getRoutingObsShapeListList(PAModel& pa_model, int32_t curr_net_idx, int32_t curr_layer_idx,
+                                                                  std::vector<PlanarRect>& shrinked_rect_list);
   std::vector<AccessPoint> getAccessPointList(int32_t pin_idx, std::vector<LayerRect>& legal_shape_list);
   void uploadAccessPointList(PAModel& pa_model);
   void buildNonConflictPoint(PAModel& pa_model);
@@ -0,0 +1,58 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+#pragma once
+
+#include "LayerRect.hpp"
+#include "RTHeader.hpp"
+
+namespace irt {
+
+/**
+ * 相同形状的pin(同一master pin同一朝向)共享一个pattern
+ * 所有矩形都是相对于pin形状左下角的坐标
+ */
+class PAPinPattern
+{
+ public:
+  PAPinPattern() = default;
+  ~PAPinPattern() = default;
+  // getter
+  std::vector<LayerRect>& get_shape_list() { return _shape_list; }
+  std::map<int32_t, std::vector<PlanarRect>>& get_layer_shrinked_rect_map() { return _layer_shrinked_rect_map; }
+  std::map<int32_t, std::vector<PlanarRect>>& get_layer_legal_rect_map() { return _layer_legal_rect_map; }
+  // setter
+  void set_shape_list(const std::vector<LayerRect>& shape_list) { _shape_list = shape_list; }
+  void set_layer_shrinked_rect_map(const std::map<int32_t, std::vector<PlanarRect>>& layer_shrinked_rect_map)
+  {
+    _layer_shrinked_rect_map = layer_shrinked_rect_map;
+  }
+  void set_layer_legal_rect_map(const std::map<int32_t, std::vector<PlanarRect>>& layer_legal_rect_map)
+  {
+    _layer_legal_rect_map = layer_legal_rect_map;
+  }
+  // function
+
+ private:
+  // pin的routing形状
+  std::vector<LayerRect> _shape_list;
+  // 每层缩小后的形状
+  std::map<int32_t, std::vector<PlanarRect>> _layer_shrinked_rect_map;
+  // 每层没有障碍时合并后的合法形状
+  std::map<int32_t, std::vector<PlanarRect>> _layer_legal_rect_map;
+};
+
+}  // namespace irt
@@ -0,0 +1,140 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+#include "DataManager.hpp"
+#include "PinAccessor.hpp"
+#include "Utility.hpp"
+#include "gtest/gtest.h"
+
+namespace irt {
+
+class PinPatternTest : public testing::Test
+{
+ protected:
+  void SetUp() override
+  {
+    DataManager::initInst();
+    PinAccessor::initInst();
+    std::vector<RoutingLayer>& routing_layer_list = RTDM.getDatabase().get_routing_layer_list();
+    std::map<int32_t, PlanarRect>& layer_enclosure_map = RTDM.getDatabase().get_layer_enclosure_map();
+    for (int32_t layer_idx : {0, 1}) {
+      RoutingLayer routing_layer;
+      routing_layer.set_layer_idx(layer_idx);
+      routing_layer.set_min_width(100 + 40 * layer_idx);
+      routing_layer_list.push_back(routing_layer);
+      layer_enclosure_map[layer_idx] = PlanarRect(0, 0, 160, 120 + 80 * layer_idx);
+    }
+  }
+
+  void TearDown() override
+  {
+    PinAccessor::destroyInst();
+    DataManager::destroyInst();
+  }
+
+  /**
+   * 以(x,y)为左下角放置的pin,包含M1上的L形和M2上的一个矩形
+   */
+  Pin createPin(int32_t x, int32_t y)
+  {
+    std::vector<EXTLayerRect> routing_shape_list;
+    for (LayerRect shape : {LayerRect(0, 0, 1000, 300, 0), LayerRect(700, 0, 1000, 1500, 0), LayerRect(200, 800, 1400, 1100, 1)}) {
+      EXTLayerRect routing_shape;
+      routing_shape.set_real_rect(RTUTIL.getOffsetRect(shape, PlanarCoord(x, y)));
+      routing_shape.set_layer_idx(shape.get_layer_idx());
+      routing_shape_list.push_back(routing_shape);
+    }
+    Pin pin;
+    pin.set_routing_shape_list(routing_shape_list);
+    return pin;
+  }
+
+  /**
+   * 不使用pattern时每个pin在真实坐标上缩小并合并得到的合法形状(周围没有障碍)
+   */
+  std::vector<LayerRect> getLegalShapeListByPin(Pin& pin)
+  {
+    std::vector<RoutingLayer>& routing_layer_list = RTDM.getDatabase().get_routing_layer_list();
+    std::map<int32_t, PlanarRect>& layer_enclosure_map = RTDM.getDatabase().get_layer_enclosure_map();
+
+    std::map<int32_t, std::vector<PlanarRect>> layer_pin_shape_list;
+    for (EXTLayerRect& routing_shape : pin.get_routing_shape_list()) {
+      layer_pin_shape_list[routing_shape.get_layer_idx()].push_back(routing_shape.get_real_rect());
+    }
+    std::vector<LayerRect> legal_rect_list;
+    for (auto& [layer_idx, pin_shape_list] : layer_pin_shape_list) {
+      PlanarRect& enclosure = layer_enclosure_map[layer_idx];
+      int32_t half_min_width = routing_layer_list[layer_idx].get_min_width() / 2;
+      int32_t shrinked_x_size = std::max(half_min_width, enclosure.getXSpan() / 2);
+      int32_t shrinked_y_size = std::max(half_min_width, enclosure.getYSpan() / 2);
+      std::vector<PlanarRect> planar_legal_rect_list
+          = RTUTIL.getClosedShrinkedRectListByBoost(pin_shape_list, shrinked_x_size, shrinked_y_size, shrinked_x_size, shrinked_y_size);
+      for (Direction direction : {Direction::kVertical, Direction::kHorizontal}) {
+        for (PlanarRect& planar_legal_rect : RTUTIL.mergeRectListByBoost(planar_legal_rect_list, direction)) {
+          legal_rect_list.emplace_back(planar_legal_rect, layer_idx);
+        }
+      }
+    }
+    return legal_rect_list;
+  }
+
+  /**
+   * 由pin的pattern平移回真实坐标得到的合法形状
+   */
+  std::vector<LayerRect> getLegalShapeListByPattern(Pin& pin)
+  {
+    PlanarCoord origin = RTPA.getPatternOrigin(&pin);
+    PAPinPattern pin_pattern;
+    pin_pattern.set_shape_list(RTPA.getPatternShapeList(&pin, origin));
+    RTPA.buildPinPattern(pin_pattern);
+
+    std::vector<LayerRect> legal_rect_list;
+    for (auto& [layer_idx, pattern_legal_rect_list] : pin_pattern.get_layer_legal_rect_map()) {
+      for (PlanarRect& legal_rect : pattern_legal_rect_list) {
+        legal_rect_list.emplace_back(RTUTIL.getOffsetRect(legal_rect, origin), layer_idx);
+      }
+    }
+    return legal_rect_list;
+  }
+};
+
+TEST_F(PinPatternTest, same_shape_share_pattern)
+{
+  Pin pin_a = createPin(0, 0);
+  Pin pin_b = createPin(12340, 5670);
+  PlanarCoord origin_a = RTPA.getPatternOrigin(&pin_a);
+  PlanarCoord origin_b = RTPA.getPatternOrigin(&pin_b);
+  EXPECT_EQ(origin_b, PlanarCoord(12340, 5670));
+  EXPECT_EQ(RTPA.getPatternShapeList(&pin_a, origin_a), RTPA.getPatternShapeList(&pin_b, origin_b));
+
+  // 形状不同的pin不能共享pattern
+  Pin pin_c = createPin(12340, 5670);
+  pin_c.get_routing_shape_list().pop_back();
+  PlanarCoord origin_c = RTPA.getPatternOrigin(&pin_c);
+  EXPECT_NE(RTPA.getPatternShapeList(&pin_b, origin_b), RTPA.getPatternShapeList(&pin_c, origin_c));
+}
+
+TEST_F(PinPatternTest, pattern_match_pin)
+{
+  for (PlanarCoord& coord : std::vector<PlanarCoord>{PlanarCoord(0, 0), PlanarCoord(12345, 678), PlanarCoord(-3000, 4100)}) {
+    Pin pin = createPin(coord.get_x(), coord.get_y());
+    std::vector<LayerRect> expect_legal_rect_list = getLegalShapeListByPin(pin);
+    ASSERT_FALSE(expect_legal_rect_list.empty());
+    EXPECT_EQ(getLegalShapeListByPattern(pin), expect_legal_rect_list);
+  }
+}
+
+}  // namespace irt
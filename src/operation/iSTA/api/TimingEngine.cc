@@ -362,7 +362,8 @@ RctNode* TimingEngine::makeOrFindRCTreeNode(Net* net, int id) {
   }
 
   auto* rc_tree = rc_net->rct();
-  std::string node_name = Str::printf("%s:%d", net->get_name(), id);
+  // not use Str::printf, its static buffer is shared between threads.
+  std::string node_name = std::string(net->get_name()) + ":" + std::to_string(id);
 
   auto* node = rc_tree->node(node_name);
   if (!node) {
@@ -767,7 +768,25 @@ void TimingEngine::removeBuffer(const char* instance_name) {
   StaVertex* buffer_driver_vertex = nullptr;
   Net* buffer_driver_net = nullptr;
 
+  /*remove buffer inst arc, the pin vertexes are removed below*/
   Pin* pin;
+  FOREACH_INSTANCE_PIN(instance, pin) {
+    if (!pin->isInput()) {
+      continue;
+    }
+    auto the_vertex = the_graph.findVertex(pin);
+    LOG_FATAL_IF(!the_vertex);
+
+    auto src_arcs = (*the_vertex)->get_src_arcs();
+    for (auto* src_arc : src_arcs) {
+      if (src_arc->isInstArc()) {
+        src_arc->get_src()->removeSrcArc(src_arc);
+        src_arc->get_snk()->removeSnkArc(src_arc);
+        the_graph.removeArc(src_arc);
+      }
+    }
+  }
+
   FOREACH_INSTANCE_PIN(instance, pin) {
     auto the_vertex = the_graph.findVertex(pin);
     LOG_FATAL_IF(!the_vertex);
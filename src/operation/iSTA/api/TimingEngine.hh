@@ -245,6 +245,12 @@ class TimingEngine {
                         is_copy);
     return *this;
   }
+  TimingEngine &reportKWorstPath(const char *rpt_file_name, unsigned n_worst,
+                                 unsigned max_paths,
+                                 StaKPathFormat format = StaKPathFormat::kText) {
+    _ista->reportKWorstPath(rpt_file_name, n_worst, max_paths, format);
+    return *this;
+  }
 
   std::vector<StaClock *> getClockList();
   void setPropagatedClock(const char *clock_name);
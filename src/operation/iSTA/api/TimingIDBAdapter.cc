@@ -24,14 +24,31 @@
 
 #include "TimingIDBAdapter.hh"
 
+#include <algorithm>
 #include <memory>
-#include <regex>
+#include <optional>
+#include <set>
+#include <utility>
+#include <vector>
 
+#include "ThreadPool/ThreadPool.h"
 // #include "idm.h"
 #include "log/Log.hh"
+#include "sta/StaBuildGraph.hh"
 
 namespace ista {
 
+/**
+ * @brief remove the escape backslash of the db name.
+ *
+ * @param db_name
+ * @return std::string
+ */
+static std::string removeBackslash(std::string db_name) {
+  std::erase(db_name, '\\');
+  return db_name;
+}
+
 bool TimingIDBAdapter::isPlaced(DesignObject* pin_or_port) {
   IdbPlacementStatus status = IdbPlacementStatus::kUnplaced;
   if (pin_or_port->isPin()) {
@@ -444,7 +461,7 @@ void TimingIDBAdapter::substituteCell(Instance* inst, LibCell* cell) {
 Pin* TimingIDBAdapter::attach(Instance* inst, const char* port_name, Net* net) {
   IdbNet* dnet = staToDb(net);
   if (!dnet) {
-    dnet = _idb_design->get_net_list()->find_net(net->get_name());
+    dnet = _idb_design->get_net_list()->find_net(net->get_name_id());
     if (!dnet) {
       std::string sta_net_name = net->get_name();
       std::string idb_net_name = changeStaBusNetNameToIdb(sta_net_name);
@@ -456,7 +473,7 @@ Pin* TimingIDBAdapter::attach(Instance* inst, const char* port_name, Net* net) {
   Pin* pin = nullptr;
   IdbInstance* dinst = staToDb(inst);
   if (!dinst) {
-    dinst = _idb_design->get_instance_list()->find_instance(inst->get_name());
+    dinst = _idb_design->get_instance_list()->find_instance(inst->get_name_id());
   }
   auto& dpin_list = dinst->get_pin_list()->get_pin_list();
   for (auto dpin : dpin_list) {
@@ -488,7 +505,7 @@ Pin* TimingIDBAdapter::attach(Instance* inst, const char* port_name, Net* net) {
 Port* TimingIDBAdapter::attach(Port* port, const char* port_name, Net* net) {
   IdbNet* dnet = staToDb(net);
   if (!dnet) {
-    dnet = _idb_design->get_net_list()->find_net(net->get_name());
+    dnet = _idb_design->get_net_list()->find_net(net->get_name_id());
   }
   // const char* port_name = port->get_port_name();
   IdbPin* dport = staToDb(port);
@@ -513,7 +530,7 @@ void TimingIDBAdapter::disattachPin(Pin* pin) {
   IdbPin* dpin = staToDb(pin);
 
   if (!dpin) {
-    auto* dnet = _idb_design->get_net_list()->find_net(sta_net->get_name());
+    auto* dnet = _idb_design->get_net_list()->find_net(sta_net->get_name_id());
     if (!dnet) {
       std::string sta_net_name = sta_net->get_name();
       std::string idb_net_name = changeStaBusNetNameToIdb(sta_net_name);
@@ -678,7 +695,7 @@ Net* TimingIDBAdapter::createNet(const char* name,
  */
 void TimingIDBAdapter::deleteNet(Net* sta_net) {
   IdbNetList* dbnet_list = _idb_design->get_net_list();
-  IdbNet* dnet = dbnet_list->find_net(sta_net->get_name());
+  IdbNet* dnet = dbnet_list->find_net(sta_net->get_name_id());
 
   auto* design_netlist = getNetlist();
   design_netlist->removeNet(sta_net);
@@ -703,6 +720,92 @@ void TimingIDBAdapter::configStaLinkCells() {
   _ista->addLinkCells(std::move(link_cells));
 }
 
+/**
+ * @brief build the sta inst of the db inst, the inst is not added to the
+ * netlist, the inst pin and the db pin are returned for cross reference.
+ *
+ * @param db_inst
+ * @param inst_pin_refs
+ * @return std::optional<Instance> nullopt if the liberty cell is not found.
+ */
+std::optional<Instance> TimingIDBAdapter::buildInstance(
+    IdbInstance* db_inst,
+    std::vector<std::pair<Pin*, IdbPin*>>& inst_pin_refs) {
+  std::string inst_name = removeBackslash(db_inst->get_name());
+
+  std::string liberty_cell_name = db_inst->get_cell_master()->get_name();
+  auto* inst_cell = _ista->findLibertyCell(liberty_cell_name.c_str());
+
+  if (!inst_cell) {
+    return std::nullopt;
+  }
+
+  std::optional<Instance> sta_inst;
+  sta_inst.emplace(inst_name.c_str(), inst_cell);
+
+  int dbu = _idb_design->get_units()->get_micron_dbu();
+  double x = db_inst->get_coordinate()->get_x() / static_cast<double>(dbu);
+  double y = db_inst->get_coordinate()->get_y() / static_cast<double>(dbu);
+
+  sta_inst->set_coordinate(x, y);
+
+  // build inst pin
+  auto db_inst_pin_list = db_inst->get_pin_list()->get_pin_list();
+  for (auto* db_inst_pin : db_inst_pin_list) {
+    if ((db_inst_pin->get_term()->get_type() == IdbConnectType::kPower) ||
+        (db_inst_pin->get_term()->get_type() == IdbConnectType::kGround)) {
+      continue;
+    }
+    std::string cell_port_name = db_inst_pin->get_term_name();
+    auto [port_base_name, index] = Str::matchBusName(cell_port_name.c_str());
+    auto* library_port_or_port_bus =
+        inst_cell->get_cell_port_or_port_bus(port_base_name.c_str());
+
+    LOG_INFO_IF(!library_port_or_port_bus)
+        << cell_port_name << " port is not found.";
+
+    std::unique_ptr<PinBus> pin_bus;
+    PinBus* found_pin_bus = nullptr;
+    if (library_port_or_port_bus) {
+      LibPort* library_port = nullptr;
+
+      if (!library_port_or_port_bus->isLibertyPortBus()) {
+        library_port = library_port_or_port_bus;
+      } else {
+        // port bus
+        auto* library_port_bus =
+            dynamic_cast<LibPortBus*>(library_port_or_port_bus);
+        library_port = (*library_port_bus)[index.value()];
+
+        found_pin_bus = sta_inst->findPinBus(port_base_name);
+
+        if (!found_pin_bus) {
+          auto bus_size =
+              dynamic_cast<LibPortBus*>(library_port_bus)->getBusSize();
+          LOG_FATAL_IF(!bus_size)
+              << library_port_bus->get_port_name() << " bus size is empty.";
+          pin_bus = std::make_unique<PinBus>(port_base_name.c_str(), bus_size,
+                                             0, bus_size);
+        }
+      }
+
+      auto* inst_pin = sta_inst->addPin(cell_port_name.c_str(), library_port);
+      // the pin is owned by unique ptr, so the pointer is kept after the
+      // inst is moved to the netlist.
+      inst_pin_refs.emplace_back(inst_pin, db_inst_pin);
+
+      if (pin_bus) {
+        pin_bus->addPin(index.value(), inst_pin);
+        sta_inst->addPinBus(std::move(pin_bus));
+      } else if (found_pin_bus) {
+        found_pin_bus->addPin(index.value(), inst_pin);
+      }
+    }
+  }
+
+  return sta_inst;
+}
+
 /**
  * @brief convert the idb to timing netlist.
  *
@@ -738,85 +841,54 @@ unsigned TimingIDBAdapter::convertDBToTimingNetlist(bool link_all_cell) {
   LOG_INFO << "core area width " << width << "um"
            << " height " << height << "um";
 
-  auto build_insts = [this, &design_netlist, dbu]() {
-    // build insts
+  auto build_insts = [this, &design_netlist]() {
+    // build insts, the sta inst is created in parallel, then added to the
+    // netlist in order, so the netlist order is the same with the db.
     auto db_inst_list = _idb_design->get_instance_list()->get_instance_list();
-    for (auto* db_inst : db_inst_list) {
-      std::string raw_name = db_inst->get_name();
-      std::regex re(R"(\\)");
-      std::string inst_name = std::regex_replace(raw_name, re, "");
-
-      std::string liberty_cell_name = db_inst->get_cell_master()->get_name();
-      auto* inst_cell = _ista->findLibertyCell(liberty_cell_name.c_str());
-
-      if (!inst_cell) {
-        LOG_INFO_FIRST_N(10)
-            << "liberty cell " << liberty_cell_name << " is not exist.";
-        continue;
+    std::vector<std::optional<Instance>> sta_insts(db_inst_list.size());
+    std::vector<std::vector<std::pair<Pin*, IdbPin*>>> inst_pin_refs(
+        db_inst_list.size());
+
+    auto build_one_inst = [this, &db_inst_list, &sta_insts,
+                           &inst_pin_refs](std::size_t inst_index) {
+      if (auto sta_inst = buildInstance(db_inst_list[inst_index],
+                                        inst_pin_refs[inst_index]);
+          sta_inst) {
+        sta_insts[inst_index].emplace(std::move(*sta_inst));
       }
-
-      Instance sta_inst(inst_name.c_str(), inst_cell);
-
-      double x = db_inst->get_coordinate()->get_x() / static_cast<double>(dbu);
-      double y = db_inst->get_coordinate()->get_y() / static_cast<double>(dbu);
-
-      sta_inst.set_coordinate(x, y);
-
-      // build inst pin
-      auto db_inst_pin_list = db_inst->get_pin_list()->get_pin_list();
-      for (auto* db_inst_pin : db_inst_pin_list) {
-        if ((db_inst_pin->get_term()->get_type() == IdbConnectType::kPower) ||
-            (db_inst_pin->get_term()->get_type() == IdbConnectType::kGround)) {
-          continue;
-        }
-        std::string cell_port_name = db_inst_pin->get_term_name();
-        auto [port_base_name, index] =
-            Str::matchBusName(cell_port_name.c_str());
-        auto* library_port_or_port_bus =
-            inst_cell->get_cell_port_or_port_bus(port_base_name.c_str());
-
-        LOG_INFO_IF(!library_port_or_port_bus)
-            << cell_port_name << " port is not found.";
-
-        std::unique_ptr<PinBus> pin_bus;
-        PinBus* found_pin_bus = nullptr;
-        if (library_port_or_port_bus) {
-          LibPort* library_port = nullptr;
-
-          if (!library_port_or_port_bus->isLibertyPortBus()) {
-            library_port = library_port_or_port_bus;
-          } else {
-            // port bus
-            auto* library_port_bus =
-                dynamic_cast<LibPortBus*>(library_port_or_port_bus);
-            library_port = (*library_port_bus)[index.value()];
-
-            found_pin_bus = sta_inst.findPinBus(port_base_name);
-
-            if (!found_pin_bus) {
-              auto bus_size =
-                  dynamic_cast<LibPortBus*>(library_port_bus)->getBusSize();
-              LOG_FATAL_IF(!bus_size)
-                  << library_port_bus->get_port_name() << " bus size is empty.";
-              pin_bus = std::make_unique<PinBus>(port_base_name.c_str(),
-                                                 bus_size, 0, bus_size);
-            }
+    };
+
+    {
+      ThreadPool pool(_ista->get_num_threads());
+      constexpr std::size_t c_chunk_size = 1024;
+      for (std::size_t start = 0; start < db_inst_list.size();
+           start += c_chunk_size) {
+        std::size_t end = std::min(db_inst_list.size(), start + c_chunk_size);
+        pool.enqueue([&build_one_inst, start, end]() {
+          for (std::size_t inst_index = start; inst_index < end; ++inst_index) {
+            build_one_inst(inst_index);
           }
+        });
+      }
+    }
 
-          auto* inst_pin =
-              sta_inst.addPin(cell_port_name.c_str(), library_port);
-          crossRef(inst_pin, db_inst_pin);
-
-          if (pin_bus) {
-            pin_bus->addPin(index.value(), inst_pin);
-            sta_inst.addPinBus(std::move(pin_bus));
-          } else if (found_pin_bus) {
-            found_pin_bus->addPin(index.value(), inst_pin);
-          }
-        }
+    // the netlist and the cross reference map are not thread safe.
+    for (std::size_t inst_index = 0; inst_index < db_inst_list.size();
+         ++inst_index) {
+      auto* db_inst = db_inst_list[inst_index];
+      if (!sta_insts[inst_index]) {
+        LOG_INFO_FIRST_N(10) << "liberty cell "
+                             << db_inst->get_cell_master()->get_name()
+                             << " is not exist.";
+        continue;
       }
-      auto& created_inst = design_netlist.addInstance(std::move(sta_inst));
+
+      auto& created_inst =
+          design_netlist.addInstance(std::move(*sta_insts[inst_index]));
       crossRef(&created_inst, db_inst);
+      for (auto [inst_pin, db_inst_pin] : inst_pin_refs[inst_index]) {
+        crossRef(inst_pin, db_inst_pin);
+      }
     }
   };
 
@@ -842,31 +914,23 @@ unsigned TimingIDBAdapter::convertDBToTimingNetlist(bool link_all_cell) {
         continue;
       }
 
-      std::string raw_name = db_net->get_net_name();
-
-      std::regex re(R"(\\)");
-      std::string net_name = std::regex_replace(raw_name, re, "");
+      std::string net_name = removeBackslash(db_net->get_net_name());
       Net* sta_net = design_netlist.findNet(net_name.c_str());
 
       auto instance_pin_list = db_net->get_instance_pin_list()->get_pin_list();
       for (auto* instance_pin : instance_pin_list) {
-        std::string cell_port_name = instance_pin->get_term_name();
-        auto* db_inst = instance_pin->get_instance();
-        std::string raw_name = db_inst->get_name();
-        std::regex re(R"(\\)");
-        std::string inst_name = std::regex_replace(raw_name, re, "");
-
-        auto* sta_inst = design_netlist.findInstance(inst_name.c_str());
-        auto inst_pin = sta_inst->getPin(cell_port_name.c_str());
-        LOG_FATAL_IF(!inst_pin);
+        // the inst pin is cross referenced when build insts.
+        auto* inst_pin = dbToStaPin(instance_pin);
+        LOG_FATAL_IF(!inst_pin) << instance_pin->get_term_name()
+                                << " pin is not found.";
 
         if (sta_net) {
-          sta_net->addPinPort(*inst_pin);
+          sta_net->addPinPort(inst_pin);
         } else {
           // DLOG_INFO << "create net " << net_name;
           auto& created_net = design_netlist.addNet(Net(net_name.c_str()));
 
-          created_net.addPinPort(*inst_pin);
+          created_net.addPinPort(inst_pin);
           sta_net = &created_net;
           crossRef(sta_net, db_net);
         }
@@ -899,6 +963,341 @@ unsigned TimingIDBAdapter::convertDBToTimingNetlist(bool link_all_cell) {
   return 1;
 }
 
+/**
+ * @brief sync the timing netlist with the idb changed by the other tools. The
+ * insts inserted, removed or resized and the nets rewired are updated in the
+ * netlist and the graph, the other insts and nets are kept. The inst is
+ * matched by name, the rc nets are reset as the full convert.
+ *
+ * @return unsigned 0 if the netlist is not converted or the design ports are
+ * changed, the netlist should be converted again.
+ */
+unsigned TimingIDBAdapter::incrConvertDBToTimingNetlist() {
+  Netlist& design_netlist = *(_ista->get_netlist());
+  if (design_netlist.getInstanceNum() == 0 ||
+      _ista->get_design_name() != _idb_design->get_design_name()) {
+    return 0;
+  }
+
+  // the ports are not synced.
+  auto db_ports = _idb_design->get_io_pin_list()->get_pin_list();
+  std::set<std::string> db_port_names;
+  for (auto* db_port : db_ports) {
+    db_port_names.insert(db_port->get_term_name());
+  }
+
+  std::size_t port_num = 0;
+  Port* port;
+  FOREACH_PORT(&design_netlist, port) {
+    if (!db_port_names.contains(port->get_name())) {
+      return 0;
+    }
+    ++port_num;
+  }
+  if (port_num != db_ports.size()) {
+    return 0;
+  }
+
+  // the rc net refers to the pins of the removed insts and the wire of the
+  // moved insts.
+  _ista->resetAllRcNet();
+
+  // the db objects removed by the other tools may be freed, the cross
+  // reference is made again.
+  _db2staInst.clear();
+  _sta2dbInst.clear();
+  _db2staPort.clear();
+  _sta2dbPort.clear();
+  _db2staNet.clear();
+  _sta2dbNet.clear();
+  _db2staPin.clear();
+  _sta2dbPin.clear();
+
+  for (auto* db_port : db_ports) {
+    crossRef(design_netlist.findPort(db_port->get_term_name().c_str()),
+             db_port);
+  }
+
+  // diff the insts, the inst whose cell is changed is built again.
+  int dbu = _idb_design->get_units()->get_micron_dbu();
+  FlatSet<Instance*> kept_insts;
+  std::vector<IdbInstance*> inserted_db_insts;
+  FlatSet<IdbInstance*> inserted_db_inst_set;
+  for (auto* db_inst : _idb_design->get_instance_list()->get_instance_list()) {
+    std::string liberty_cell_name = db_inst->get_cell_master()->get_name();
+    auto* inst_cell = _ista->findLibertyCell(liberty_cell_name.c_str());
+    if (!inst_cell) {
+      continue;
+    }
+
+    std::string inst_name = removeBackslash(db_inst->get_name());
+    auto* sta_inst = design_netlist.findInstance(inst_name.c_str());
+    if (!sta_inst || sta_inst->get_inst_cell() != inst_cell) {
+      inserted_db_insts.push_back(db_inst);
+      inserted_db_inst_set.insert(db_inst);
+      continue;
+    }
+
+    double x = db_inst->get_coordinate()->get_x() / static_cast<double>(dbu);
+    double y = db_inst->get_coordinate()->get_y() / static_cast<double>(dbu);
+    sta_inst->set_coordinate(x, y);
+
+    kept_insts.insert(sta_inst);
+    crossRef(sta_inst, db_inst);
+    for (auto* db_inst_pin : db_inst->get_pin_list()->get_pin_list()) {
+      if (auto inst_pin = sta_inst->getPin(db_inst_pin->get_term_name().c_str());
+          inst_pin) {
+        crossRef(*inst_pin, db_inst_pin);
+      }
+    }
+  }
+
+  std::vector<Instance*> removed_insts;
+  Instance* inst;
+  FOREACH_INSTANCE(&design_netlist, inst) {
+    if (!kept_insts.contains(inst)) {
+      removed_insts.push_back(inst);
+    }
+  }
+
+  // diff the nets, the net is rewired if its kept pins are changed or it
+  // connects an inserted inst.
+  std::vector<std::pair<IdbNet*, Net*>> rewired_nets;
+  FlatSet<Net*> kept_nets;  // the rewired nets are kept too.
+  for (auto* db_net : _idb_design->get_net_list()->get_net_list()) {
+    if ((db_net->get_connect_type() == IdbConnectType::kPower) ||
+        (db_net->get_connect_type() == IdbConnectType::kGround)) {
+      continue;
+    }
+
+    std::vector<DesignObject*> kept_pin_ports;
+    bool is_connect_inserted = false;
+    for (auto* instance_pin : db_net->get_instance_pin_list()->get_pin_list()) {
+      if (inserted_db_inst_set.contains(instance_pin->get_instance())) {
+        is_connect_inserted = true;
+      } else if (auto* inst_pin = dbToStaPin(instance_pin); inst_pin) {
+        kept_pin_ports.push_back(inst_pin);
+      }
+    }
+    for (auto* io_pin : db_net->get_io_pins()->get_pin_list()) {
+      if (auto* design_port = design_netlist.findPort(
+              io_pin->get_term_name().c_str());
+          design_port) {
+        kept_pin_ports.push_back(design_port);
+      }
+    }
+
+    // the net without pin is not built as the full convert.
+    if (!is_connect_inserted && kept_pin_ports.empty()) {
+      continue;
+    }
+
+    std::string net_name = removeBackslash(db_net->get_net_name());
+    Net* sta_net = design_netlist.findNet(net_name.c_str());
+    if (sta_net && !is_connect_inserted) {
+      std::vector<DesignObject*> pin_ports(sta_net->get_pin_ports().begin(),
+                                           sta_net->get_pin_ports().end());
+      std::ranges::sort(pin_ports);
+      std::ranges::sort(kept_pin_ports);
+      if (pin_ports == kept_pin_ports) {
+        kept_nets.insert(sta_net);
+        crossRef(sta_net, db_net);
+        continue;
+      }
+    }
+
+    rewired_nets.emplace_back(db_net, sta_net);
+    if (sta_net) {
+      kept_nets.insert(sta_net);
+    }
+  }
+
+  std::vector<Net*> removed_nets;
+  Net* net;
+  FOREACH_NET(&design_netlist, net) {
+    if (!kept_nets.contains(net)) {
+      removed_nets.push_back(net);
+    }
+  }
+
+  // the kept inst whose pin is rewired, the const pin of it is built again.
+  FlatSet<Instance*> rewired_insts;
+  auto record_rewired_inst = [&kept_insts,
+                              &rewired_insts](DesignObject* pin_port) {
+    if (!pin_port->isPin()) {
+      return;
+    }
+    auto* own_inst = pin_port->get_own_instance();
+    if (kept_insts.contains(own_inst)) {
+      rewired_insts.insert(own_inst);
+    }
+  };
+
+  // remove the graph of the removed insts and the changed nets before the
+  // pins are freed.
+  bool is_build_graph = _ista->isBuildGraph();
+  StaGraph& the_graph = _ista->get_graph();
+  if (is_build_graph) {
+    FlatSet<StaArc*> removed_arcs;
+    FlatSet<StaVertex*> removed_vertexes;
+    auto collect_arcs = [&the_graph, &removed_arcs](DesignObject* pin_port,
+                                                    bool is_net_arc_only) {
+      auto the_vertex = the_graph.findVertex(pin_port);
+      if (!the_vertex) {
+        return the_vertex;
+      }
+
+      std::vector<StaVertex*> vertexes{*the_vertex};
+      if (pin_port->isInout()) {
+        vertexes.push_back(the_graph.getAssistant(*the_vertex));
+      }
+
+      for (auto* vertex : vertexes) {
+        for (auto* src_arc : vertex->get_src_arcs()) {
+          if (!is_net_arc_only || src_arc->isNetArc()) {
+            removed_arcs.insert(src_arc);
+          }
+        }
+        for (auto* snk_arc : vertex->get_snk_arcs()) {
+          if (!is_net_arc_only || snk_arc->isNetArc()) {
+            removed_arcs.insert(snk_arc);
+          }
+        }
+      }
+      return the_vertex;
+    };
+
+    for (auto* removed_inst : removed_insts) {
+      Pin* pin;
+      FOREACH_INSTANCE_PIN(removed_inst, pin) {
+        if (auto the_vertex = collect_arcs(pin, false); the_vertex) {
+          removed_vertexes.insert(*the_vertex);
+        }
+      }
+    }
+
+    auto collect_net_arcs = [&collect_arcs](Net* the_net) {
+      DesignObject* pin_port;
+      FOREACH_NET_PIN(the_net, pin_port) { collect_arcs(pin_port, true); }
+    };
+    for (auto& [db_net, sta_net] : rewired_nets) {
+      if (sta_net) {
+        collect_net_arcs(sta_net);
+      }
+    }
+    for (auto* removed_net : removed_nets) {
+      collect_net_arcs(removed_net);
+    }
+
+    the_graph.removeArcs(removed_arcs);
+    the_graph.removeVertexes(removed_vertexes);
+  }
+
+  // update the netlist.
+  auto detach_pin_ports = [&record_rewired_inst](Net* the_net) {
+    std::vector<DesignObject*> pin_ports(the_net->get_pin_ports().begin(),
+                                         the_net->get_pin_ports().end());
+    for (auto* pin_port : pin_ports) {
+      record_rewired_inst(pin_port);
+      the_net->removePinPort(pin_port);
+    }
+  };
+
+  for (auto* removed_net : removed_nets) {
+    detach_pin_ports(removed_net);
+    design_netlist.removeNet(removed_net);
+  }
+
+  for (auto& [db_net, sta_net] : rewired_nets) {
+    if (sta_net) {
+      detach_pin_ports(sta_net);
+    }
+  }
+
+  for (auto* removed_inst : removed_insts) {
+    Pin* pin;
+    FOREACH_INSTANCE_PIN(removed_inst, pin) {
+      if (auto* the_net = pin->get_net(); the_net) {
+        the_net->removePinPort(pin);
+      }
+    }
+    design_netlist.removeInstance(removed_inst->get_name());
+  }
+
+  std::vector<Instance*> inserted_insts;
+  for (auto* db_inst : inserted_db_insts) {
+    std::vector<std::pair<Pin*, IdbPin*>> inst_pin_refs;
+    auto sta_inst = buildInstance(db_inst, inst_pin_refs);
+    auto& created_inst = design_netlist.addInstance(std::move(*sta_inst));
+    crossRef(&created_inst, db_inst);
+    for (auto [inst_pin, db_inst_pin] : inst_pin_refs) {
+      crossRef(inst_pin, db_inst_pin);
+    }
+    inserted_insts.push_back(&created_inst);
+  }
+
+  std::vector<Net*> connected_nets;
+  for (auto& [db_net, sta_net] : rewired_nets) {
+    if (!sta_net) {
+      std::string net_name = removeBackslash(db_net->get_net_name());
+      sta_net = &design_netlist.addNet(Net(net_name.c_str()));
+    }
+
+    for (auto* instance_pin : db_net->get_instance_pin_list()->get_pin_list()) {
+      if (auto* inst_pin = dbToStaPin(instance_pin); inst_pin) {
+        record_rewired_inst(inst_pin);
+        sta_net->addPinPort(inst_pin);
+      }
+    }
+    for (auto* io_pin : db_net->get_io_pins()->get_pin_list()) {
+      if (auto* design_port = design_netlist.findPort(
+              io_pin->get_term_name().c_str());
+          design_port) {
+        sta_net->addPinPort(design_port);
+      }
+    }
+
+    crossRef(sta_net, db_net);
+    connected_nets.push_back(sta_net);
+  }
+
+  // update the graph.
+  if (is_build_graph) {
+    StaBuildGraph build_graph;
+    for (auto* inserted_inst : inserted_insts) {
+      build_graph.buildInst(&the_graph, inserted_inst);
+    }
+
+    for (auto* connected_net : connected_nets) {
+      build_graph.buildNet(&the_graph, connected_net);
+    }
+
+    for (auto* rewired_inst : rewired_insts) {
+      Pin* pin;
+      FOREACH_INSTANCE_PIN(rewired_inst, pin) {
+        auto the_vertex = the_graph.findVertex(pin);
+        LOG_FATAL_IF(!the_vertex);
+        (*the_vertex)->reset_is_const();
+        (*the_vertex)->reset_is_const_vdd();
+        (*the_vertex)->reset_is_const_gnd();
+        the_graph.get_const_vertexes().erase(*the_vertex);
+      }
+      build_graph.buildConst(&the_graph, rewired_inst);
+    }
+
+    for (auto* inserted_inst : inserted_insts) {
+      build_graph.buildConst(&the_graph, inserted_inst);
+    }
+  }
+
+  LOG_INFO << "incr convert db to timing netlist, inserted inst "
+           << inserted_insts.size() << ", removed inst "
+           << removed_insts.size() << ", rewired net " << connected_nets.size()
+           << ", removed net " << removed_nets.size();
+
+  return 1;
+}
+
 /**
  * @brief sta bus net do not contain \[\], need change [] to match idb net
  * name.
@@ -24,7 +24,10 @@
 
 #pragma once
 
+#include <optional>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "IdbCellMaster.h"
 #include "IdbDesign.h"
@@ -189,8 +192,12 @@ class TimingIDBAdapter : public TimingDBAdapter {
 
   void configStaLinkCells();
   unsigned convertDBToTimingNetlist(bool link_all_cell = false) override;
+  unsigned incrConvertDBToTimingNetlist();
 
  private:
+  std::optional<Instance> buildInstance(
+      IdbInstance* db_inst,
+      std::vector<std::pair<Pin*, IdbPin*>>& inst_pin_refs);
   unsigned makeTopCell();  // to do
   std::string changeStaBusNetNameToIdb(std::string sta_net_name);
 
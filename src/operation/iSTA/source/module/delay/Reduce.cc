@@ -177,4 +177,73 @@ std::optional<MatrixXd> ArnoldiROM::orthogonalBasis(const MatrixXd& G,
   return v;
 }
 
-}  // namespace ista
\ No newline at end of file
+/**
+ * @brief factorize the shifted matrix (G + s0*C), G of the rc net is floating
+ * without ground, so the expansion point s0 should be positive.
+ *
+ * @param s0 the expansion point.
+ * @return true if the factorization success.
+ */
+bool SparseArnoldiROM::factorize(double s0) {
+  SparseMatrix<double> shift_matrix = _G;
+  for (Index i = 0; i < _C.size(); ++i) {
+    shift_matrix.coeffRef(i, i) += s0 * _C(i);
+  }
+
+  _solver.compute(shift_matrix);
+  if (_solver.info() != Success) {
+    LOG_ERROR << "factorize the shift conductance matrix failed.";
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief use arnoldi process to calculate the orthogonal basis of the krylov
+ * subspace span{r, A*r, ..., A^(q-1)*r}, A is (G + s0*C)_inv * C, r is
+ * (G + s0*C)_inv * B. The basis is reorthogonalized once for numerical
+ * stability, and the process stop early when the subspace is invariant.
+ *
+ * @param B the input vector.
+ * @param q the reduce order.
+ * @return std::optional<MatrixXd> n*q' basis, q' is not larger than q.
+ */
+std::optional<MatrixXd> SparseArnoldiROM::orthogonalBasis(const VectorXd& B,
+                                                          int q) {
+  constexpr double eplison = 1e-12;
+  auto size = _C.size();
+  q = std::min<int>(q, size);
+
+  VectorXd r = _solver.solve(B);
+  double r_norm = r.norm();
+  if (_solver.info() != Success || IsDoubleEqual(r_norm, 0.0, eplison)) {
+    LOG_ERROR << "solve the start vector of arnoldi failed.";
+    return std::nullopt;
+  }
+
+  MatrixXd v(size, q);
+  v.col(0) = r / r_norm;
+  int basis_num = 1;
+  for (int j = 1; j < q; ++j) {
+    VectorXd w = _solver.solve(_C.cwiseProduct(v.col(j - 1)));
+    double w_origin_norm = w.norm();
+    // modified gram-schmidt, twice is enough.
+    for (int pass = 0; pass < 2; ++pass) {
+      for (int i = 0; i < j; ++i) {
+        w -= v.col(i).dot(w) * v.col(i);
+      }
+    }
+
+    double w_norm = w.norm();
+    if (w_norm <= eplison * w_origin_norm) {
+      break;
+    }
+    v.col(j) = w / w_norm;
+    ++basis_num;
+  }
+
+  MatrixXd basis = v.leftCols(basis_num);
+  return basis;
+}
+
+}  // namespace ista
@@ -25,6 +25,8 @@
 
 #include <Eigen/Core>
 #include <Eigen/Dense>
+#include <Eigen/Sparse>
+#include <Eigen/SparseCholesky>
 
 #include "ElmoreDelayCalc.hh"
 
@@ -87,4 +89,39 @@ class ArnoldiROM {
   MatrixXd blockArnoldi(const MatrixXd& A, const MatrixXd& R, int q, int N);
 };
 
+/**
+ * @brief Sparse arnoldi reduce order model for the large rc net use PRIMA
+ * algorithm. The krylov subspace is expanded at s0, (G + s0*C) is factorized
+ * once and the factorization is reused by every arnoldi step, the C matrix is
+ * diagonal nodal cap.
+ *
+ */
+class SparseArnoldiROM {
+ public:
+  SparseArnoldiROM(const SparseMatrix<double>& G, const VectorXd& C)
+      : _G(G), _C(C) {}
+  ~SparseArnoldiROM() = default;
+
+  bool factorize(double s0);
+  std::optional<MatrixXd> orthogonalBasis(const VectorXd& B, int q);
+
+  // transform conductance matrix.
+  MatrixXd GTrans(const MatrixXd& v) const {
+    MatrixXd G_rom = v.transpose() * (_G * v);
+    return G_rom;
+  }
+
+  // transform capacitance matrix.
+  MatrixXd CTrans(const MatrixXd& v) const {
+    MatrixXd C_rom = v.transpose() * (_C.asDiagonal() * v);
+    return C_rom;
+  }
+
+ private:
+  const SparseMatrix<double>& _G;  //!< The sparse conductance matrix.
+  const VectorXd& _C;              //!< The diagonal of the cap matrix.
+  SimplicialLDLT<SparseMatrix<double>>
+      _solver;  //!< The factorization of (G + s0*C).
+};
+
 }  // namespace ista
\ No newline at end of file
@@ -238,28 +238,25 @@ void ArnoldiNet::updateRcTiming(RustSpefNet* spef_net) {
 
 /**
  * @brief Store the resistances of each segment and the capacitance of each
- * nodal in vector container.
+ * nodal in vector container, the conductance matrix is sparse, the dense
+ * matrix is only constructed when the net is not reduced.
  *
  * @param analysis_mode
  * @param trans_type
  */
 void ArnoldiNet::constructResistanceAndCapMatrix(AnalysisMode analysis_mode,
                                                  TransType trans_type) {
-  constexpr unsigned use_reduce_node_num = 10;
-
   auto& rct = std::get<RcTree>(_rct);
   auto node_num = rct.get_node_num();
 
   // reduce when node num beyond reduce node num.
-  if (node_num > use_reduce_node_num) {
-    // not use reduce now.
-    // set_is_reduce(true);
+  if (isReduceEnable() && node_num > c_arnoldi_reduce_node_num) {
+    set_is_reduce(true);
   }
 
-  // construct the matrix C and diagonal G.
+  // construct the matrix C and G.
   std::vector<double> nodal_caps(node_num);
-  MatrixXd conductances(node_num, node_num);
-  conductances.setZero();
+  std::vector<Triplet<double>> conductance_triplets;
 
   FOREACH_RCTREE_NODE(rct, name, rc_node) {
     // construct the matrix C.
@@ -272,8 +269,8 @@ void ArnoldiNet::constructResistanceAndCapMatrix(AnalysisMode analysis_mode,
     FOREACH_RCNODE_FANIN_EDGE(&rc_node, fanin_edge) {
       conductance += fanin_edge->getG(analysis_mode, trans_type);
     }
-    conductances(node_id, node_id) =
-        conductance;  // conductance is resistance inv.
+    conductance_triplets.emplace_back(
+        node_id, node_id, conductance);  // conductance is resistance inv.
   }
 
   set_nodal_caps(std::move(nodal_caps));
@@ -284,22 +281,26 @@ void ArnoldiNet::constructResistanceAndCapMatrix(AnalysisMode analysis_mode,
     FOREACH_RCNODE_FANOUT_EDGE(rc_node, fanout_edge) {
       auto& fanout_rc_node = fanout_edge->get_to();
       unsigned node_id = getNodeID(&fanout_rc_node);
-      conductances(i, node_id) = -(fanout_edge->getG(
-          analysis_mode, trans_type));  // get the opposite val.
+      conductance_triplets.emplace_back(
+          i, node_id,
+          -(fanout_edge->getG(analysis_mode,
+                              trans_type)));  // get the opposite val.
     }
   }
 
-  _conductances_matrix = conductances;
+  // the duplicate edge is overwrite as the dense matrix.
+  _sparse_conductances_matrix.resize(node_num, node_num);
+  _sparse_conductances_matrix.setFromTriplets(
+      conductance_triplets.begin(), conductance_triplets.end(),
+      [](const double&, const double& b) { return b; });
 
-  // consturct nodal cap matrix.
+  // consturct nodal cap vector.
   auto cap_size = _nodal_caps.size();
-  VectorXd nodal_vec(cap_size);
+  _nodal_cap_vec.resize(cap_size);
   for (decltype(cap_size) i = 0; i < cap_size; ++i) {
-    nodal_vec(i) = _nodal_caps[i];
+    _nodal_cap_vec(i) = _nodal_caps[i];
   }
 
-  _cap_matrix = nodal_vec.asDiagonal();
-
   // construct input vec.
   VectorXd input_vec(_nodal_caps.size());
   input_vec.setZero();
@@ -307,20 +308,38 @@ void ArnoldiNet::constructResistanceAndCapMatrix(AnalysisMode analysis_mode,
 
   _input_vec = input_vec;
 
-  DVERBOSE_VLOG(1) << "conductances\n" << _conductances_matrix;
-  DVERBOSE_VLOG(1) << "cap_matrix\n" << _cap_matrix;
+  if (!isReduce()) {
+    constructDenseMatrix();
+  }
+
+  DVERBOSE_VLOG(1) << "conductances\n" << _sparse_conductances_matrix;
+  DVERBOSE_VLOG(1) << "nodal_caps\n" << _nodal_cap_vec;
   DVERBOSE_VLOG(1) << "input_vec\n" << _input_vec;
 }
 
 /**
- * @brief construct arnoldi orthogonal basis use
+ * @brief Construct the dense conductance and cap matrix from the sparse
+ * matrix.
+ *
+ */
+void ArnoldiNet::constructDenseMatrix() {
+  _conductances_matrix = MatrixXd(_sparse_conductances_matrix);
+  _cap_matrix = _nodal_cap_vec.asDiagonal();
+}
+
+/**
+ * @brief construct arnoldi orthogonal basis use the sparse PRIMA reduce.
  *
+ * @param s0 The expansion point of the krylov subspace.
  */
-unsigned ArnoldiNet::constructArnoldiOrthogonalBasis() {
-  constexpr int arnoldi_reduce_order = 3;
-  ArnoldiROM arnoldi_rom;
-  auto arnoldi_basis = arnoldi_rom.orthogonalBasis(
-      _conductances_matrix, _cap_matrix, _input_vec, arnoldi_reduce_order);
+unsigned ArnoldiNet::constructArnoldiOrthogonalBasis(double s0) {
+  SparseArnoldiROM arnoldi_rom(_sparse_conductances_matrix, _nodal_cap_vec);
+  if (!arnoldi_rom.factorize(s0)) {
+    return 0;
+  }
+
+  auto arnoldi_basis =
+      arnoldi_rom.orthogonalBasis(_input_vec, c_arnoldi_reduce_order);
 
   if (!arnoldi_basis) {
     LOG_ERROR << "no suitable arnoldi basis.";
@@ -337,12 +356,11 @@ unsigned ArnoldiNet::constructArnoldiOrthogonalBasis() {
  *
  */
 void ArnoldiNet::reduceRCEquation() {
-  ArnoldiROM arnoldi_rom;
+  SparseArnoldiROM arnoldi_rom(_sparse_conductances_matrix, _nodal_cap_vec);
 
-  _reduce_conductances_matrix =
-      arnoldi_rom.GTrans(_arnoldi_basis, _conductances_matrix);
-  _reduce_cap_matrix = arnoldi_rom.CTrans(_arnoldi_basis, _cap_matrix);
-  _reduce_input_vec = arnoldi_rom.BTrans(_arnoldi_basis, _input_vec);
+  _reduce_conductances_matrix = arnoldi_rom.GTrans(_arnoldi_basis);
+  _reduce_cap_matrix = arnoldi_rom.CTrans(_arnoldi_basis);
+  _reduce_input_vec = _arnoldi_basis.transpose() * _input_vec;
 
   DVERBOSE_VLOG(1) << "reduce_conductances_matrix\n"
                    << _reduce_conductances_matrix;
@@ -417,7 +435,7 @@ std::vector<VectorXd> ArnoldiNet::solveRCEquation(
 
   auto F_derivative = [step_time, &diag]() -> MatrixXd {
     MatrixXd unit_vec(diag.diagonalSize(), diag.diagonalSize());
-    unit_vec.setOnes();
+    unit_vec.setIdentity();
 
     MatrixXd derivate = diag + (1 / step_time) * unit_vec;
 
@@ -493,12 +511,6 @@ VectorXd ArnoldiNet::getOutputVector(unsigned id) {
   VectorXd output_vec(_input_vec.rows());
   output_vec.setZero();
   output_vec(id) = 1.0;
-
-  // for reduce output vector.
-  if (isReduce()) {
-    ArnoldiROM arnoldi_rom;
-    output_vec = arnoldi_rom.LTrans(_arnoldi_basis, output_vec);
-  }
   return output_vec;
 }
 
@@ -517,30 +529,56 @@ MatrixXd ArnoldiNet::calcDelayAndSlew(
     AnalysisMode analysis_mode, TransType trans_type) {
   // HeapLeakChecker heap_checker("test_foo");
   {
-    if (!_diag_B_W) {
+    std::tuple<MatrixXd, MatrixXd, MatrixXd> diag_B_W;
+    MatrixXd arnoldi_basis;
+    bool is_reduce;
+    {
       std::lock_guard<std::mutex> lk(_calc_mutex);
 
-      if (!_diag_B_W) {
+      if (!_is_matrix_constructed) {
         constructResistanceAndCapMatrix(analysis_mode, trans_type);
-        if (!isReduce()) {
-          _diag_B_W = constructRCEquation(_cap_matrix, _conductances_matrix,
-                                          _input_vec);
-        } else {
-          if (constructArnoldiOrthogonalBasis()) {
-            reduceRCEquation();
-            _diag_B_W = constructRCEquation(_reduce_cap_matrix,
-                                            _reduce_conductances_matrix,
-                                            _reduce_input_vec);
-          } else {
-            set_is_reduce(false);
-            _diag_B_W = constructRCEquation(_cap_matrix, _conductances_matrix,
-                                            _input_vec);
+        _is_matrix_constructed = 1;
+      }
+
+      if (isReduce()) {
+        // expand the krylov subspace at the time scale of this simulation
+        // window, the basis is kept while the window stays in a factor of two.
+        double sim_time = (end_time - start_time) * 1e-9;
+        if (sim_time > 0.0) {
+          double s0 = 1.0 / sim_time;
+          if (!_diag_B_W || s0 > 2 * _reduce_s0 || s0 < 0.5 * _reduce_s0) {
+            if (constructArnoldiOrthogonalBasis(s0)) {
+              reduceRCEquation();
+              _diag_B_W = constructRCEquation(_reduce_cap_matrix,
+                                              _reduce_conductances_matrix,
+                                              _reduce_input_vec);
+              _reduce_s0 = s0;
+            } else {
+              set_is_reduce(false);
+              constructDenseMatrix();
+              _diag_B_W.reset();
+            }
           }
+        } else if (!_diag_B_W) {
+          // the empty window has no time scale to expand at.
+          set_is_reduce(false);
+          constructDenseMatrix();
         }
       }
+
+      if (!_diag_B_W) {
+        _diag_B_W = constructRCEquation(_cap_matrix, _conductances_matrix,
+                                        _input_vec);
+      }
+
+      diag_B_W = *_diag_B_W;
+      is_reduce = isReduce();
+      if (is_reduce) {
+        arnoldi_basis = _arnoldi_basis;
+      }
     }
 
-    auto [diag, B, W] = *_diag_B_W;
+    auto& [diag, B, W] = diag_B_W;
 
     DVERBOSE_VLOG(1) << "diag\n" << diag;
     DVERBOSE_VLOG(1) << "W\n" << W;
@@ -558,6 +596,11 @@ MatrixXd ArnoldiNet::calcDelayAndSlew(
           W * V;  // get the origin V, V is W_inv * origin V.
                   // every column is one time voltage of every point.
     }
+
+    // project the reduced voltage back to the rc node.
+    if (is_reduce) {
+      V_matrix = arnoldi_basis * V_matrix;
+    }
     DVERBOSE_VLOG(1) << "V Matrix \n" << V_matrix;
 
     return V_matrix;
@@ -25,6 +25,7 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <Eigen/Sparse>
 #include <algorithm>
 #include <mutex>
 #include <optional>
@@ -140,15 +141,22 @@ class ArnoldiNet : public RcNet {
   void set_is_reduce(bool is_reduce) { _is_reduce = is_reduce; }
   bool isReduce() const { return _is_reduce; }
 
- private:
+  void set_is_reduce_enable(bool is_reduce_enable) {
+    _is_reduce_enable = is_reduce_enable;
+  }
+  bool isReduceEnable() const { return _is_reduce_enable; }
+
   MatrixXd calcDelayAndSlew(
       std::function<std::vector<double>(double, double, int)>&& get_current,
       double start_time, double end_time, int num_sim_point,
       AnalysisMode analysis_mode, TransType trans_type);
 
+ private:
+
   void constructResistanceAndCapMatrix(AnalysisMode analysis_mode,
                                        TransType trans_type);
-  unsigned constructArnoldiOrthogonalBasis();
+  void constructDenseMatrix();
+  unsigned constructArnoldiOrthogonalBasis(double s0);
   void reduceRCEquation();
 
   auto constructRCEquation(const MatrixXd& cap_matrix,
@@ -178,6 +186,9 @@ class ArnoldiNet : public RcNet {
   LibArc* _lib_arc{nullptr};
 
   std::vector<double> _nodal_caps;  //!< The nodal cap matrix.
+  SparseMatrix<double>
+      _sparse_conductances_matrix;  //!< The sparse conductance matrix.
+  VectorXd _nodal_cap_vec;          //!< The diagonal of the cap matrix.
   MatrixXd _conductances_matrix;    //!< The conductance matrix.
   MatrixXd _cap_matrix;             //!< The cap matrix.
   VectorXd _input_vec;              //!< The current input vec.
@@ -189,12 +200,15 @@ class ArnoldiNet : public RcNet {
 
   std::optional<std::tuple<MatrixXd, MatrixXd, MatrixXd>>
       _diag_B_W;  // The RC equation matrix.
+  double _reduce_s0 = 0.0;  //!< The expansion point of the arnoldi basis.
 
   std::mutex _calc_mutex;
 
   unsigned _is_debug : 1 = 0;
   unsigned _is_reduce : 1 = 0;  // default reduce.
-  unsigned _reserved : 30 = 0;
+  unsigned _is_reduce_enable : 1 = 1;  // reduce the net beyond the node num.
+  unsigned _is_matrix_constructed : 1 = 0;
+  unsigned _reserved : 28 = 0;
 };
 
 }  // namespace ista
\ No newline at end of file
@@ -69,6 +69,11 @@ using ieda::Vector;
 constexpr unsigned c_vertex_slew_data_bucket_size = 1;
 constexpr unsigned c_vertex_path_delay_data_bucket_size = 1;
 
+// arnoldi reduce config, the rc net beyond the node num is reduced to the
+// order.
+constexpr unsigned c_arnoldi_reduce_node_num = 100;
+constexpr int c_arnoldi_reduce_order = 10;
+
 constexpr bool c_print_delay_yaml = false;
 constexpr bool c_print_net_yaml = false;
 
@@ -27,13 +27,14 @@
 
 namespace ista {
 
-DesignObject::DesignObject(const char* name) : _name(name) {}
+DesignObject::DesignObject(const char* name)
+    : _name(ieda::internName(name)) {}
 
 DesignObject::DesignObject(DesignObject&& other) noexcept
-    : _name(std::move(other._name)) {}
+    : _name(other._name) {}
 
 DesignObject& DesignObject::operator=(DesignObject&& rhs) noexcept {
-  _name = std::move(rhs._name);
+  _name = rhs._name;
 
   return *this;
 }
@@ -29,6 +29,7 @@
 
 #include "Type.hh"
 #include "log/Log.hh"
+#include "string/NamePool.hh"
 
 namespace ista {
 
@@ -72,9 +73,10 @@ class DesignObject {
   }
 
   const char* get_name() const { return _name.c_str(); }
-  void set_name(const char* name) { _name = name; }
+  void set_name(const char* name) { _name = ieda::internName(name); }
+  [[nodiscard]] ieda::Name get_name_id() const { return _name; }
 
-  std::string& getObjName() { return _name; }
+  const std::string& getObjName() const { return _name.str(); }
 
   virtual std::string getFullName() {
     LOG_FATAL << "The object do not have fullname.";
@@ -113,7 +115,7 @@ class DesignObject {
   }
 
  private:
-  std::string _name;
+  ieda::Name _name;  //!< The interned name shared with the design database.
 };
 
 }  // namespace ista
@@ -24,8 +24,6 @@
 
 #include "Netlist.hh"
 
-#include <regex>
-
 #include "NetlistWriter.hh"
 #include "log/Log.hh"
 
@@ -41,29 +39,42 @@ namespace ista {
  */
 std::vector<DesignObject*> Netlist::findPort(const char* pattern, bool regexp,
                                              bool nocase) {
-  std::vector<DesignObject*> match_ports;
-  Port* port;
-  if (!regexp && !nocase) {
-    FOREACH_PORT(this, port) {
-      if (Str::equal(port->get_name(), pattern)) {
-        match_ports.push_back(port);
-      }
+  if (NetlistPattern::isExact(pattern, regexp, nocase)) {
+    std::vector<DesignObject*> match_ports;
+    if (auto* the_port = findPort(pattern); the_port) {
+      match_ports.push_back(the_port);
     }
-  } else if (regexp) {
-    auto nocase_option = nocase ? std::regex::icase : std::regex::extended;
-    std::regex re(pattern, nocase_option);
-
-    FOREACH_PORT(this, port) {
-      if (std::regex_match(port->get_name(), re)) {
-        match_ports.push_back(port);
-      }
+    return match_ports;
+  }
+
+  return _pattern_cache->findOrMatch(
+      "port", pattern, regexp, nocase, [this, pattern, regexp, nocase]() {
+        return matchPort(NetlistPattern(pattern, regexp, nocase));
+      });
+}
+
+/**
+ * @brief find instance accord pattern, thas maybe regexp, wildcard, nocase.
+ *
+ * @param pattern The search pattern.
+ * @param regexp True, if the pattern is regexp.
+ * @param nocase True,  if the pattern do not care case.
+ * @return std::vector<DesignObject*> The found instance.
+ */
+std::vector<DesignObject*> Netlist::findInstance(const char* pattern,
+                                                 bool regexp, bool nocase) {
+  if (NetlistPattern::isExact(pattern, regexp, nocase)) {
+    std::vector<DesignObject*> match_instances;
+    if (auto* the_instance = findInstance(pattern); the_instance) {
+      match_instances.push_back(the_instance);
     }
-  } else {
-    // TODO(taosimin) fix wildcard.
-    LOG_FATAL << "not support yet";
+    return match_instances;
   }
 
-  return match_ports;
+  return _pattern_cache->findOrMatch(
+      "instance", pattern, regexp, nocase, [this, pattern, regexp, nocase]() {
+        return matchInstance(NetlistPattern(pattern, regexp, nocase));
+      });
 }
 
 /**
@@ -78,7 +89,7 @@ std::vector<DesignObject*> Netlist::findPin(const char* pattern, bool regexp,
                                             bool nocase) {
   std::vector<DesignObject*> match_pins;
   const char* sep = "/:";
-  if (!regexp && !nocase) {
+  if (NetlistPattern::isExact(pattern, regexp, nocase)) {
     auto [instance_name, pin_name] = Str::splitTwoPart(pattern, sep);
     if (pin_name.empty()) {
       // LOG_INFO << pattern << " pin name is empty.";
@@ -93,12 +104,52 @@ std::vector<DesignObject*> Netlist::findPin(const char* pattern, bool regexp,
                            << " is not exist of instance " << instance_name;
     match_pins.push_back(*the_pin);
 
-  } else {
-    // TODO
+    return match_pins;
   }
 
-  return match_pins;
+  // match the instance by the name index, then match the pin of the instance.
+  return _pattern_cache->findOrMatch(
+      "pin", pattern, regexp, nocase, [this, pattern, regexp, nocase, sep]() {
+        std::vector<DesignObject*> match_pins;
+        auto [instance_name, pin_name] = Str::splitTwoPart(pattern, sep);
+        if (pin_name.empty()) {
+          return match_pins;
+        }
+
+        NetlistPattern instance_pattern(instance_name.c_str(), regexp, nocase);
+        NetlistPattern pin_pattern(pin_name.c_str(), regexp, nocase);
+
+        std::vector<DesignObject*> match_instances;
+        if (instance_pattern.isExact()) {
+          if (auto* the_instance = findInstance(instance_name.c_str());
+              the_instance) {
+            match_instances.push_back(the_instance);
+          }
+        } else {
+          match_instances = matchInstance(instance_pattern);
+        }
+
+        for (auto* match_instance : match_instances) {
+          auto* the_instance = dynamic_cast<Instance*>(match_instance);
+          if (pin_pattern.isExact()) {
+            if (auto the_pin = the_instance->getPin(pin_name.c_str());
+                the_pin) {
+              match_pins.push_back(*the_pin);
+            }
+            continue;
+          }
+
+          Pin* pin;
+          FOREACH_INSTANCE_PIN(the_instance, pin) {
+            if (pin_pattern.match(pin->get_name())) {
+              match_pins.push_back(pin);
+            }
+          }
+        }
+        return match_pins;
+      });
 }
+
 /**
  * @brief find obj accord pattern, thas maybe regexp, wildcard, nocase.
  *
@@ -109,36 +160,72 @@ std::vector<DesignObject*> Netlist::findPin(const char* pattern, bool regexp,
  */
 std::vector<DesignObject*> Netlist::findObj(const char* pattern, bool regexp,
                                             bool nocase) {
-  std::vector<DesignObject*> match_objs;
-  if (!regexp && !nocase) {
-    auto match_ports = findPort(pattern, regexp, nocase);
-    std::move(match_ports.begin(), match_ports.end(),
-              std::back_inserter(match_objs));
-
-    if (match_objs.empty()) {
-      auto* match_instance =
-          findInstance(pattern);  // fixme, need support regexp for instance
-      if (match_instance) {
-        match_objs.emplace_back(match_instance);
-      }
-    }
+  auto match_objs = findPort(pattern, regexp, nocase);
 
-    if (match_objs.empty()) {
-      std::vector<DesignObject*> match_pins;
-      if (Str::contain(pattern, "/") || Str::contain(pattern, ":")) {
-        match_pins = findPin(pattern, regexp, nocase);
-      }
-      std::move(match_pins.begin(), match_pins.end(),
-                std::back_inserter(match_objs));
-    }
+  if (match_objs.empty()) {
+    match_objs = findInstance(pattern, regexp, nocase);
+  }
 
-  } else {
-    // TODO
+  if (match_objs.empty()) {
+    if (Str::contain(pattern, "/") || Str::contain(pattern, ":")) {
+      match_objs = findPin(pattern, regexp, nocase);
+    }
   }
 
   return match_objs;
 }
 
+/**
+ * @brief match port in the port name index, the index is built when first
+ * used, should be called in the pattern cache lock.
+ *
+ * @param port_pattern
+ * @return std::vector<DesignObject*>
+ */
+std::vector<DesignObject*> Netlist::matchPort(
+    const NetlistPattern& port_pattern) {
+  auto& port_index = _pattern_cache->get_port_index();
+  if (!port_index.isBuilt()) {
+    std::vector<std::pair<std::string_view, DesignObject*>> port_names;
+    Port* port;
+    FOREACH_PORT(this, port) { port_names.emplace_back(port->get_name(), port); }
+    port_index.build(std::move(port_names));
+  }
+
+  std::vector<DesignObject*> match_ports;
+  port_index.match(port_pattern, [&match_ports](DesignObject* the_port) {
+    match_ports.push_back(the_port);
+  });
+  return match_ports;
+}
+
+/**
+ * @brief match instance in the instance name index, the index is built when
+ * first used, should be called in the pattern cache lock.
+ *
+ * @param instance_pattern
+ * @return std::vector<DesignObject*>
+ */
+std::vector<DesignObject*> Netlist::matchInstance(
+    const NetlistPattern& instance_pattern) {
+  auto& instance_index = _pattern_cache->get_instance_index();
+  if (!instance_index.isBuilt()) {
+    std::vector<std::pair<std::string_view, DesignObject*>> instance_names;
+    Instance* instance;
+    FOREACH_INSTANCE(this, instance) {
+      instance_names.emplace_back(instance->get_name(), instance);
+    }
+    instance_index.build(std::move(instance_names));
+  }
+
+  std::vector<DesignObject*> match_instances;
+  instance_index.match(instance_pattern,
+                       [&match_instances](DesignObject* the_instance) {
+                         match_instances.push_back(the_instance);
+                       });
+  return match_instances;
+}
+
 /**
  * @brief clear netlist content.
  *
@@ -153,6 +240,8 @@ void Netlist::reset() {
   _str2net.clear();
   _instances.clear();
   _str2instance.clear();
+
+  resetPatternCache();
 }
 
 /**
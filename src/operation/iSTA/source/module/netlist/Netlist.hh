@@ -24,6 +24,8 @@
 #pragma once
 
 #include <list>
+#include <memory>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -31,9 +33,11 @@
 #include "FlatMap.hh"
 #include "Instance.hh"
 #include "Net.hh"
+#include "NetlistPattern.hh"
 #include "Pin.hh"
 #include "Port.hh"
 #include "Vector.hh"
+#include "string/NamePool.hh"
 #include "string/StrMap.hh"
 
 namespace ista {
@@ -79,6 +83,7 @@ class Netlist : public DesignObject {
     _ports.emplace_back(std::move(port));
     Port* the_port = &(_ports.back());
     _str2port[the_port->get_name()] = the_port;
+    resetPatternCache();
     return *the_port;
   }
 
@@ -120,14 +125,12 @@ class Netlist : public DesignObject {
   Net& addNet(Net&& net) {
     _nets.emplace_back(std::move(net));
     Net* the_net = &(_nets.back());
-    const char* net_name = the_net->get_name();
-    _str2net[net_name] = the_net;
+    _str2net[the_net->get_name_id()] = the_net;
     return *the_net;
   }
 
   void removeNet(Net* net) {
-    const char* net_name = net->get_name();
-    _str2net.erase(net_name);
+    _str2net.erase(net->get_name_id());
 
     auto it = std::find_if(_nets.begin(), _nets.end(),
                            [net](auto& the_net) { return net == &the_net; });
@@ -136,6 +139,12 @@ class Netlist : public DesignObject {
   }
 
   Net* findNet(const char* net_name) const {
+    // the name not interned is not the name of any net.
+    auto name = ieda::NamePool::getInstance().find(net_name);
+    return name.empty() ? nullptr : findNet(name);
+  }
+
+  Net* findNet(ieda::Name net_name) const {
     auto found_net = _str2net.find(net_name);
 
     if (found_net != _str2net.end()) {
@@ -148,14 +157,15 @@ class Netlist : public DesignObject {
     _instances.emplace_back(std::move(instance));
 
     Instance* the_instance = &(_instances.back());
-    const char* instance_name = the_instance->get_name();
-    _str2instance[instance_name] = the_instance;
+    _str2instance[the_instance->get_name_id()] = the_instance;
+    resetPatternCache();
 
     return *the_instance;
   }
 
   void removeInstance(const char* instance_name) {
-    auto found_instance = _str2instance.find(instance_name);
+    auto found_instance =
+        _str2instance.find(ieda::NamePool::getInstance().find(instance_name));
     LOG_FATAL_IF(found_instance == _str2instance.end());
     auto* the_instance = found_instance->second;
 
@@ -164,9 +174,15 @@ class Netlist : public DesignObject {
         [the_instance](auto& instance) { return the_instance == &instance; });
     _str2instance.erase(found_instance);
     _instances.erase(it);
+    resetPatternCache();
   }
 
   Instance* findInstance(const char* instance_name) const {
+    auto name = ieda::NamePool::getInstance().find(instance_name);
+    return name.empty() ? nullptr : findInstance(name);
+  }
+
+  Instance* findInstance(ieda::Name instance_name) const {
     auto found_instance = _str2instance.find(instance_name);
 
     if (found_instance != _str2instance.end()) {
@@ -175,12 +191,20 @@ class Netlist : public DesignObject {
     return nullptr;
   }
 
+  std::vector<DesignObject*> findInstance(const char* pattern, bool regexp,
+                                          bool nocase);
+
   auto& get_instances() { return _instances; }
 
   std::size_t getInstanceNum() { return _instances.size(); }
   std::size_t getNetNum() { return _nets.size(); }
 
   void reset();
+  void resetPatternCache() {
+    if (_pattern_cache) {
+      _pattern_cache->reset();
+    }
+  }
 
   void writeVerilog(const char* verilog_file_name,
                     std::set<std::string> exclude_cell_names);
@@ -192,12 +216,20 @@ class Netlist : public DesignObject {
   StrMap<PortBus*> _str2portbus;
 
   std::list<Net> _nets;
-  StrMap<Net*> _str2net;  //!< The net name to net for search.
+  std::unordered_map<ieda::Name, Net*, ieda::Name::Hash>
+      _str2net;  //!< The interned net name to net for search.
   std::list<Instance> _instances;
-  StrMap<Instance*> _str2instance;
+  std::unordered_map<ieda::Name, Instance*, ieda::Name::Hash>
+      _str2instance;  //!< The interned instance name to instance.
 
   std::optional<CoreSize>
       _core_size;  //!< The core size(width * weight) for FP.
+  std::unique_ptr<NetlistPatternCache> _pattern_cache =
+      std::make_unique<NetlistPatternCache>();  //!< The sdc query cache.
+
+  std::vector<DesignObject*> matchPort(const NetlistPattern& port_pattern);
+  std::vector<DesignObject*> matchInstance(
+      const NetlistPattern& instance_pattern);
 
   FORBIDDEN_COPY(Netlist);
 };
@@ -0,0 +1,246 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of
+// Sciences Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan
+// PSL v2. You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY
+// KIND, EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// NON-INFRINGEMENT, MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+/**
+ * @file NetlistPattern.cc
+ * @brief The implemention of the name pattern and the name index.
+ */
+
+#include "NetlistPattern.hh"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+namespace ista {
+
+NetlistPattern::NetlistPattern(const char* pattern, bool regexp, bool nocase)
+    : _pattern(pattern),
+      _regexp(regexp),
+      _nocase(nocase),
+      _is_exact(isExact(pattern, regexp, nocase)) {
+  if (_regexp) {
+    // the ECMAScript grammar is close to tcl regexp, such as the escaped bus
+    // bracket.
+    auto flags = std::regex::ECMAScript | std::regex::optimize;
+    if (_nocase) {
+      flags |= std::regex::icase;
+    }
+    _regex.emplace(_pattern, flags);
+  }
+
+  // the prefix is used to search the sorted name, which is case sensitive.
+  if (_nocase) {
+    return;
+  }
+
+  if (!_regexp) {
+    _literal_prefix = _pattern.substr(0, _pattern.find_first_of("*?"));
+    return;
+  }
+
+  // the alternation can not be the prefix.
+  if (_pattern.find('|') != std::string::npos) {
+    return;
+  }
+  std::size_t start_pos = (!_pattern.empty() && _pattern[0] == '^') ? 1 : 0;
+  std::size_t end_pos = _pattern.find_first_of(".[]()*+?{}|^$\\", start_pos);
+  if (end_pos == std::string::npos) {
+    end_pos = _pattern.size();
+  } else if ((end_pos > start_pos) &&
+             (_pattern[end_pos] == '*' || _pattern[end_pos] == '?' ||
+              _pattern[end_pos] == '{')) {
+    // the last literal char is optional.
+    --end_pos;
+  }
+  _literal_prefix = _pattern.substr(start_pos, end_pos - start_pos);
+}
+
+/**
+ * @brief judge whether the pattern could be found by name directly.
+ *
+ * @param pattern
+ * @param regexp
+ * @param nocase
+ * @return true if no wildcard and regexp.
+ */
+bool NetlistPattern::isExact(const char* pattern, bool regexp, bool nocase) {
+  return !regexp && !nocase && !std::strpbrk(pattern, "*?");
+}
+
+bool NetlistPattern::charEqual(char lhs, char rhs) const {
+  if (_nocase) {
+    return std::tolower(static_cast<unsigned char>(lhs)) ==
+           std::tolower(static_cast<unsigned char>(rhs));
+  }
+  return lhs == rhs;
+}
+
+/**
+ * @brief match the wildcard, the '*' is backtracked to the last star only, so
+ * the match is linear for most pattern.
+ *
+ * @param name
+ * @return true if matched.
+ */
+bool NetlistPattern::globMatch(const char* name) const {
+  const char* p = _pattern.c_str();
+  const char* s = name;
+  const char* star_p = nullptr;
+  const char* star_s = nullptr;
+
+  while (*s) {
+    if (*p == '*') {
+      star_p = p++;
+      star_s = s;
+    } else if (*p == '?' || (*p && charEqual(*p, *s))) {
+      ++p;
+      ++s;
+    } else if (star_p) {
+      p = star_p + 1;
+      s = ++star_s;
+    } else {
+      return false;
+    }
+  }
+
+  while (*p == '*') {
+    ++p;
+  }
+  return *p == '\0';
+}
+
+/**
+ * @brief match the whole name.
+ *
+ * @param name
+ * @return true if matched.
+ */
+bool NetlistPattern::match(const char* name) const {
+  if (_regexp) {
+    return std::regex_match(name, *_regex);
+  }
+  if (_is_exact) {
+    return std::strcmp(name, _pattern.c_str()) == 0;
+  }
+  return globMatch(name);
+}
+
+/**
+ * @brief build the index, the name should be kept alive by the object.
+ *
+ * @param names
+ */
+void NetlistNameIndex::build(
+    std::vector<std::pair<std::string_view, DesignObject*>>&& names) {
+  _sorted_names = std::move(names);
+  std::sort(_sorted_names.begin(), _sorted_names.end(),
+            [](auto& lhs, auto& rhs) { return lhs.first < rhs.first; });
+  _is_built = true;
+}
+
+void NetlistNameIndex::reset() {
+  _sorted_names.clear();
+  _is_built = false;
+}
+
+/**
+ * @brief match the pattern in the range of the literal prefix.
+ *
+ * @param pattern
+ * @param match_func
+ */
+void NetlistNameIndex::match(
+    const NetlistPattern& pattern,
+    const std::function<void(DesignObject*)>& match_func) const {
+  std::string_view prefix = pattern.get_literal_prefix();
+  auto it = std::lower_bound(
+      _sorted_names.begin(), _sorted_names.end(), prefix,
+      [](auto& name_obj, std::string_view value) {
+        return name_obj.first < value;
+      });
+
+  for (; it != _sorted_names.end(); ++it) {
+    auto& [name, obj] = *it;
+    if (name.substr(0, prefix.size()) != prefix) {
+      break;
+    }
+    // the name view is the whole c string of the object name.
+    if (pattern.match(name.data())) {
+      match_func(obj);
+    }
+  }
+}
+
+/**
+ * @brief find the matched objects in the memo, or else match and memo it.
+ *
+ * @param obj_type The object type of the query, such as "port".
+ * @param pattern
+ * @param regexp
+ * @param nocase
+ * @param match_func The match function called when the memo is missed.
+ * @return std::vector<DesignObject*>
+ */
+std::vector<DesignObject*> NetlistPatternCache::findOrMatch(
+    const char* obj_type, const char* pattern, bool regexp, bool nocase,
+    const std::function<std::vector<DesignObject*>()>& match_func) {
+  std::string key = obj_type;
+  key += regexp ? ":r" : ":g";
+  key += nocase ? "i:" : "c:";
+  key += pattern;
+
+  std::lock_guard<std::mutex> lk(_mt);
+  if (auto found = _pattern_to_objs.find(key);
+      found != _pattern_to_objs.end()) {
+    return found->second;
+  }
+
+  auto match_objs = match_func();
+  // too large result is not memoized, evict the earliest pattern until the
+  // memo can hold the result.
+  if (match_objs.size() > c_max_memo_obj_num) {
+    return match_objs;
+  }
+  while (!_memo_order.empty() &&
+         (_memo_order.size() >= c_max_memo_pattern_num ||
+          _memo_obj_num + match_objs.size() > c_max_memo_obj_num)) {
+    auto evicted = _pattern_to_objs.find(_memo_order.front());
+    _memo_obj_num -= evicted->second.size();
+    _pattern_to_objs.erase(evicted);
+    _memo_order.pop_front();
+  }
+
+  _memo_obj_num += match_objs.size();
+  _memo_order.push_back(key);
+  _pattern_to_objs[key] = match_objs;
+  return match_objs;
+}
+
+/**
+ * @brief reset the index and memo when the netlist is changed.
+ *
+ */
+void NetlistPatternCache::reset() {
+  std::lock_guard<std::mutex> lk(_mt);
+  _port_index.reset();
+  _instance_index.reset();
+  _pattern_to_objs.clear();
+  _memo_order.clear();
+  _memo_obj_num = 0;
+}
+
+}  // namespace ista
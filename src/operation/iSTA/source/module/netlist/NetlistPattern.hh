@@ -0,0 +1,134 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of
+// Sciences Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan
+// PSL v2. You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY
+// KIND, EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// NON-INFRINGEMENT, MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+/**
+ * @file NetlistPattern.hh
+ * @brief The compiled name pattern and the name index for sdc object query.
+ */
+#pragma once
+
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <regex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace ista {
+
+class DesignObject;
+
+/**
+ * @brief The compiled pattern of the object name, that maybe regexp, wildcard
+ * or nocase, the wildcard support '*' and '?'.
+ *
+ */
+class NetlistPattern {
+ public:
+  NetlistPattern(const char* pattern, bool regexp, bool nocase);
+  ~NetlistPattern() = default;
+
+  static bool isExact(const char* pattern, bool regexp, bool nocase);
+
+  [[nodiscard]] const std::string& get_pattern() const { return _pattern; }
+  [[nodiscard]] const std::string& get_literal_prefix() const {
+    return _literal_prefix;
+  }
+  [[nodiscard]] bool isExact() const { return _is_exact; }
+
+  bool match(const char* name) const;
+
+ private:
+  bool globMatch(const char* name) const;
+  bool charEqual(char lhs, char rhs) const;
+
+  std::string _pattern;
+  std::string _literal_prefix;  //!< The matched name must start with it.
+  bool _regexp;
+  bool _nocase;
+  bool _is_exact;
+  std::optional<std::regex> _regex;
+};
+
+/**
+ * @brief The object name index sorted by name, the matched objects of the
+ * pattern are only searched in the range of the pattern literal prefix.
+ *
+ */
+class NetlistNameIndex {
+ public:
+  NetlistNameIndex() = default;
+  ~NetlistNameIndex() = default;
+
+  [[nodiscard]] bool isBuilt() const { return _is_built; }
+  void build(std::vector<std::pair<std::string_view, DesignObject*>>&& names);
+  void reset();
+
+  void match(const NetlistPattern& pattern,
+             const std::function<void(DesignObject*)>& match_func) const;
+
+ private:
+  std::vector<std::pair<std::string_view, DesignObject*>> _sorted_names;
+  bool _is_built = false;
+};
+
+/**
+ * @brief The pattern query cache of the netlist, include the port/instance name
+ * index and the matched result of the queried pattern, the cache should be
+ * reset when the netlist is changed. The memo is bounded by the pattern num and
+ * the memoized object num, the earliest queried pattern is evicted first.
+ *
+ */
+class NetlistPatternCache {
+ public:
+  NetlistPatternCache() = default;
+  ~NetlistPatternCache() = default;
+
+  NetlistNameIndex& get_port_index() { return _port_index; }
+  NetlistNameIndex& get_instance_index() { return _instance_index; }
+
+  std::vector<DesignObject*> findOrMatch(
+      const char* obj_type, const char* pattern, bool regexp, bool nocase,
+      const std::function<std::vector<DesignObject*>()>& match_func);
+  void reset();
+
+  [[nodiscard]] std::size_t get_memo_pattern_num() {
+    std::lock_guard<std::mutex> lk(_mt);
+    return _pattern_to_objs.size();
+  }
+  [[nodiscard]] std::size_t get_memo_obj_num() {
+    std::lock_guard<std::mutex> lk(_mt);
+    return _memo_obj_num;
+  }
+
+  static constexpr std::size_t c_max_memo_pattern_num = 1024;
+  static constexpr std::size_t c_max_memo_obj_num = 1 << 20;
+
+ private:
+  std::mutex _mt;
+  NetlistNameIndex _port_index;
+  NetlistNameIndex _instance_index;
+  std::map<std::string, std::vector<DesignObject*>>
+      _pattern_to_objs;  //!< The memo of the queried pattern.
+  std::deque<std::string> _memo_order;  //!< The memoized pattern in query order.
+  std::size_t _memo_obj_num = 0;        //!< The object num of the memo.
+};
+
+}  // namespace ista
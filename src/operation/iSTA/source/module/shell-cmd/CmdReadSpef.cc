@@ -28,6 +28,8 @@ namespace ista {
 CmdReadSpef::CmdReadSpef(const char* cmd_name) : TclCmd(cmd_name) {
   auto* file_name_option = new TclStringOption("file_name", 1, nullptr);
   addOption(file_name_option);
+  auto* stream_option = new TclSwitchOption("-stream");
+  addOption(stream_option);
 }
 
 unsigned CmdReadSpef::check() {
@@ -45,8 +47,15 @@ unsigned CmdReadSpef::exec() {
   auto spef_file = file_name_option->getStringVal();
 
   Sta* ista = Sta::getOrCreateSta();
-  return ista->readSpef(spef_file);
 
-  return 1;
+  // the stream mode is only for this read, the mode set before is restored.
+  TclOption* stream_option = getOptionOrArg("-stream");
+  bool is_stream_read = ista->isSpefStreamRead();
+  ista->set_spef_stream_read(stream_option->is_set_val());
+
+  unsigned is_ok = ista->readSpef(spef_file);
+  ista->set_spef_stream_read(is_stream_read);
+
+  return is_ok;
 }
 }  // namespace ista
\ No newline at end of file
@@ -21,6 +21,8 @@
  * @version 0.1
  * @date 2021-10-12
  */
+#include <algorithm>
+
 #include "ShellCmd.hh"
 #include "json/json.hpp"
 #include "sta/Sta.hh"
@@ -40,9 +42,29 @@ CmdReportTiming::CmdReportTiming(const char* cmd_name) : TclCmd(cmd_name) {
   addOption(is_clock_cap_option);
   auto* is_snappot_option = new TclSwitchOption("-is_not_bak_rpt");
   addOption(is_snappot_option);
+  auto* n_worst_option = new TclIntOption("-nworst", 0, 1);
+  addOption(n_worst_option);
+  auto* max_paths_option = new TclIntOption("-max_paths", 0, 0);
+  addOption(max_paths_option);
+  auto* format_option = new TclStringOption("-format", 0, nullptr);
+  addOption(format_option);
+  auto* max_candidates_option = new TclIntOption("-max_candidates", 0, 0);
+  addOption(max_candidates_option);
 }
 
-unsigned CmdReportTiming::check() { return 1; }
+unsigned CmdReportTiming::check() {
+  TclOption* format_option = getOptionOrArg("-format");
+  if (format_option->is_set_val()) {
+    const char* format_str = format_option->getStringVal();
+    if (!Str::equal(format_str, "text") && !Str::equal(format_str, "json") &&
+        !Str::equal(format_str, "yaml")) {
+      LOG_ERROR << "unknown -format " << format_str
+                << ", the format should be text, json or yaml.";
+      return 0;
+    }
+  }
+  return 1;
+}
 
 unsigned CmdReportTiming::exec() {
   if (!check()) {
@@ -94,6 +116,42 @@ unsigned CmdReportTiming::exec() {
   ista->updateTiming();
   ista->reportTiming(std::move(new_exclude_cell_names), is_derate, is_clock_cap,
                      is_not_bak_rpt);
+
+  // report the k worst path when -nworst or -max_paths is set, the path num
+  // of the path group is not limited without -max_paths.
+  TclOption* n_worst_option = getOptionOrArg("-nworst");
+  TclOption* max_paths_option = getOptionOrArg("-max_paths");
+  if (n_worst_option->is_set_val() || max_paths_option->is_set_val()) {
+    unsigned n_worst = std::max(1, n_worst_option->getIntVal());
+    unsigned max_paths = std::max(0, max_paths_option->getIntVal());
+
+    StaKPathFormat format = StaKPathFormat::kText;
+    const char* file_suffix = "kpath";
+    TclOption* format_option = getOptionOrArg("-format");
+    if (format_option->is_set_val()) {
+      const char* format_str = format_option->getStringVal();
+      if (Str::equal(format_str, "json")) {
+        format = StaKPathFormat::kJson;
+        file_suffix = "kpath.json";
+      } else if (Str::equal(format_str, "yaml")) {
+        format = StaKPathFormat::kYaml;
+        file_suffix = "kpath.yml";
+      }
+    }
+
+    // the candidate path cap of one endpoint with -through.
+    TclOption* max_candidates_option = getOptionOrArg("-max_candidates");
+    if (max_candidates_option->is_set_val() &&
+        max_candidates_option->getIntVal() > 0) {
+      ista->set_k_path_max_candidates(max_candidates_option->getIntVal());
+    }
+
+    std::string k_path_file_name =
+        Str::printf("%s/%s.%s", ista->get_design_work_space(),
+                    ista->get_design_name().c_str(), file_suffix);
+    ista->reportKWorstPath(k_path_file_name.c_str(), n_worst, max_paths,
+                           format);
+  }
   // ista->dumpNetlistData();
   return 1;
 }
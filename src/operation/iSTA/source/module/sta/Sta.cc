@@ -1420,6 +1420,93 @@ unsigned Sta::reportPath(const char *rpt_file_name, bool is_derate /*=true*/) {
   return 1;
 }
 
+/**
+ * @brief Report the k worst path of each path group, the paths of the
+ * endpoints are enumerated in parallel and streamed to the report file.
+ *
+ * @param rpt_file_name The report file name.
+ * @param n_worst The max path num of each endpoint.
+ * @param max_paths The max path num of each path group, 0 is no limit.
+ * @param format The report format, text/json/yaml.
+ * @return unsigned 1 if success, 0 else fail.
+ */
+unsigned Sta::reportKWorstPath(const char *rpt_file_name, unsigned n_worst,
+                               unsigned max_paths,
+                               StaKPathFormat format /*=kText*/) {
+  auto path_writer = StaKPathWriter::createWriter(rpt_file_name, format);
+  if (!path_writer->isOpen()) {
+    return 0;
+  }
+  path_writer->set_significant_digits(get_significant_digits());
+  path_writer->writeHead();
+
+  // the through points of the report spec, the path should pass one vertex
+  // of every through list.
+  std::vector<std::set<StaVertex *>> through_vertexes;
+  if (_report_spec) {
+    for (auto &prop_throughs : _report_spec->get_prop_throughs()) {
+      std::set<StaVertex *> vertexes;
+      for (auto &prop_through : prop_throughs) {
+        auto objs = _netlist.findObj(prop_through.c_str(), false, false);
+        for (auto *obj : objs) {
+          if (auto the_vertex = _graph.findVertex(obj); the_vertex) {
+            vertexes.insert(*the_vertex);
+          }
+        }
+      }
+      through_vertexes.emplace_back(std::move(vertexes));
+    }
+  }
+
+  // the path is written once it is merged into the path group.
+  unsigned path_id = 0;
+  auto report_path_group = [&path_writer, &path_id](
+                               StaKWorstPath &k_worst_path,
+                               StaSeqPathGroup *seq_path_group) {
+    k_worst_path(seq_path_group, [&path_writer, &path_id](StaKPath &&path) {
+      path_writer->writePath(path, ++path_id);
+    });
+  };
+
+  auto report_path_of_mode = [this, &report_path_group, &through_vertexes,
+                              n_worst, max_paths](AnalysisMode mode) {
+    if ((get_analysis_mode() != mode) &&
+        (get_analysis_mode() != AnalysisMode::kMaxMin)) {
+      return;
+    }
+
+    StaKWorstPath k_worst_path(mode, n_worst, max_paths, get_num_threads());
+    k_worst_path.set_max_candidates(get_k_path_max_candidates());
+    k_worst_path.set_through_vertexes(
+        std::vector<std::set<StaVertex *>>(through_vertexes));
+    auto path_group = get_path_group();  // specify path group.
+    for (auto &&[capture_clock, seq_path_group] : _clock_groups) {
+      if (!path_group ||
+          path_group.value() == capture_clock->get_clock_name()) {
+        report_path_group(k_worst_path, seq_path_group.get());
+      }
+    }
+
+    if (_clock_gate_group) {
+      report_path_group(k_worst_path, _clock_gate_group.get());
+    }
+
+    LOG_WARNING_IF(k_worst_path.is_candidates_capped())
+        << "the k worst path candidates of some endpoints exceed "
+        << k_worst_path.get_max_candidates()
+        << ", the paths through the points may be missed.";
+  };
+
+  report_path_of_mode(AnalysisMode::kMax);
+  report_path_of_mode(AnalysisMode::kMin);
+
+  path_writer->writeTail();
+
+  LOG_INFO << "report " << path_id << " k worst paths to " << rpt_file_name;
+
+  return 1;
+}
+
 /**
  * @brief report trans slack.
  *
@@ -36,6 +36,7 @@
 #include "StaClock.hh"
 #include "StaClockTree.hh"
 #include "StaGraph.hh"
+#include "StaKWorstPath.hh"
 #include "StaPathData.hh"
 #include "StaReport.hh"
 #include "Type.hh"
@@ -183,6 +184,18 @@ class Sta {
     return _n_worst_path_per_endpoint;
   }
 
+  void set_k_path_max_candidates(std::size_t max_candidates) {
+    _k_path_max_candidates = max_candidates;
+  }
+  [[nodiscard]] std::size_t get_k_path_max_candidates() const {
+    return _k_path_max_candidates;
+  }
+
+  void set_spef_stream_read(bool is_stream_read) {
+    _is_spef_stream_read = is_stream_read;
+  }
+  [[nodiscard]] bool isSpefStreamRead() const { return _is_spef_stream_read; }
+
   void set_path_group(std::string&& path_group) {
     _path_group = std::move(path_group);
   }
@@ -403,6 +416,9 @@ class Sta {
   auto& get_report_spec() { return _report_spec; }
 
   unsigned reportPath(const char* rpt_file_name, bool is_derate = true);
+  unsigned reportKWorstPath(const char* rpt_file_name, unsigned n_worst,
+                            unsigned max_paths,
+                            StaKPathFormat format = StaKPathFormat::kText);
   unsigned reportTrans(const char* rpt_file_name);
   unsigned reportCap(const char* rpt_file_name, bool is_clock_cap);
   unsigned reportFanout(const char* rpt_file_name);
@@ -519,6 +535,11 @@ class Sta {
       3;  //!< The top n worst path config for each clock.
   unsigned _n_worst_path_per_endpoint = 1;    //!< The top n worst path
                                               //!< config for each endpoint.
+  std::size_t _k_path_max_candidates =
+      c_k_path_max_candidates;  //!< The candidate path cap of one endpoint
+                                //!< for the k worst path with -through.
+  bool _is_spef_stream_read = false;  //!< Whether read spef by stream, which
+                                      //!< overlap parse and rc reduction.
   std::optional<std::string> _path_group;     //!< The path group.
   std::unique_ptr<SdcConstrain> _constrains;  //!< The sdc constrain.
   RustVerilogReader _rust_verilog_reader;
@@ -23,10 +23,37 @@
  */
 #include "StaBuildGraph.hh"
 
+#include <algorithm>
+#include <functional>
+#include <unordered_map>
+
+#include "ThreadPool/ThreadPool.h"
 #include "netlist/Netlist.hh"
 
 namespace ista {
 
+/**
+ * @brief Run the func of the index in [0, num) in the thread pool, the index
+ * is split to chunk to reduce the task overhead.
+ *
+ * @param num_threads
+ * @param num
+ * @param func
+ */
+static void parallelFor(unsigned num_threads, std::size_t num,
+                        const std::function<void(std::size_t)>& func) {
+  constexpr std::size_t c_chunk_size = 1024;
+  ThreadPool pool(num_threads);
+  for (std::size_t start = 0; start < num; start += c_chunk_size) {
+    std::size_t end = std::min(num, start + c_chunk_size);
+    pool.enqueue([&func, start, end]() {
+      for (std::size_t index = start; index < end; ++index) {
+        func(index);
+      }
+    });
+  }
+}
+
 /**
  * @brief Build the port into graph port vertex.
  *
@@ -68,6 +95,65 @@ unsigned StaBuildGraph::buildPort(StaGraph* the_graph, Port* port) {
   return 1;
 }
 
+/**
+ * @brief Expand the cell arc to the src and snk port name, the port bus is
+ * expanded to the bus bit.
+ *
+ * @param lib_cell
+ * @return StaBuildGraph::CellArcPorts
+ */
+StaBuildGraph::CellArcPorts StaBuildGraph::expandCellArcPorts(
+    LibCell* lib_cell) {
+  CellArcPorts cell_arc_ports;
+  for (auto& cell_arc_set : lib_cell->get_cell_arcs()) {
+    auto* cell_arc = cell_arc_set->front();
+    const char* src_port_name = cell_arc->get_src_port();
+    const char* snk_port_name = cell_arc->get_snk_port();
+
+    auto* src_port = lib_cell->get_cell_port_or_port_bus(src_port_name);
+    LOG_FATAL_IF(!src_port) << "src port " << src_port_name << " is not found.";
+    auto* snk_port = lib_cell->get_cell_port_or_port_bus(snk_port_name);
+    LOG_FATAL_IF(!snk_port) << "snk port " << snk_port_name << " is not found.";
+
+    std::vector<std::string> src_ports;
+    std::vector<std::string> snk_ports;
+
+    if (src_port->isLibertyPortBus()) {
+      auto src_port_bus_size =
+          dynamic_cast<LibPortBus*>(src_port)->getBusSize();
+      for (unsigned src_index = 0; src_index < src_port_bus_size; ++src_index) {
+        std::string one_src_port =
+            Str::printf("%s[%d]", src_port_name, src_index);
+        src_ports.emplace_back(std::move(one_src_port));
+      }
+    } else {
+      src_ports.emplace_back(std::string(src_port_name));
+    }
+
+    if (snk_port->isLibertyPortBus()) {
+      auto snk_port_bus_size =
+          dynamic_cast<LibPortBus*>(snk_port)->getBusSize();
+
+      for (unsigned snk_index = 0; snk_index < snk_port_bus_size; ++snk_index) {
+        std::string one_snk_port =
+            Str::printf("%s[%d]", snk_port_name, snk_index);
+        snk_ports.emplace_back(std::move(one_snk_port));
+      }
+    } else {
+      snk_ports.emplace_back(std::string(snk_port_name));
+    }
+
+    for (auto& one_src_port_name : src_ports) {
+      for (auto& one_snk_port_name : snk_ports) {
+        cell_arc_ports.emplace_back(one_src_port_name, one_snk_port_name,
+                                    cell_arc);
+      }
+    }
+  }
+
+  return cell_arc_ports;
+}
+
 /**
  * @brief Build the inst into graph vertex and cell arc.
  *
@@ -129,69 +215,33 @@ unsigned StaBuildGraph::buildInst(StaGraph* the_graph, Instance* inst) {
   };
 
   // build inst timing arc
-  LibCell* lib_cell = inst->get_inst_cell();
-  for (auto& cell_arc_set : lib_cell->get_cell_arcs()) {
-    auto* cell_arc = cell_arc_set->front();
-    const char* src_port_name = cell_arc->get_src_port();
-    const char* snk_port_name = cell_arc->get_snk_port();
-
-    auto* src_port = lib_cell->get_cell_port_or_port_bus(src_port_name);
-    LOG_FATAL_IF(!src_port) << "src port " << src_port_name << " is not found.";
-    auto* snk_port = lib_cell->get_cell_port_or_port_bus(snk_port_name);
-    LOG_FATAL_IF(!snk_port) << "snk port " << snk_port_name << " is not found.";
-
-    std::vector<std::string> src_ports;
-    std::vector<std::string> snk_ports;
-
-    if (src_port->isLibertyPortBus()) {
-      auto src_port_bus_size =
-          dynamic_cast<LibPortBus*>(src_port)->getBusSize();
-      for (unsigned src_index = 0; src_index < src_port_bus_size; ++src_index) {
-        std::string one_src_port =
-            Str::printf("%s[%d]", src_port_name, src_index);
-        src_ports.emplace_back(std::move(one_src_port));
-      }
-    } else {
-      src_ports.emplace_back(std::string(src_port_name));
-    }
-
-    if (snk_port->isLibertyPortBus()) {
-      auto snk_port_bus_size =
-          dynamic_cast<LibPortBus*>(snk_port)->getBusSize();
-
-      for (unsigned snk_index = 0; snk_index < snk_port_bus_size; ++snk_index) {
-        std::string one_snk_port =
-            Str::printf("%s[%d]", snk_port_name, snk_index);
-        snk_ports.emplace_back(std::move(one_snk_port));
-      }
-    } else {
-      snk_ports.emplace_back(std::string(snk_port_name));
+  for (auto& [src_port_name, snk_port_name, cell_arc] :
+       expandCellArcPorts(inst->get_inst_cell())) {
+    auto src_pin = inst->getPin(src_port_name.c_str());
+    auto snk_pin = inst->getPin(snk_port_name.c_str());
+    if (!src_pin || !snk_pin) {
+      continue;
     }
 
-    for (auto& one_src_port_name : src_ports) {
-      for (auto& one_snk_port_name : snk_ports) {
-        auto src_pin = inst->getPin(one_src_port_name.c_str());
-        auto snk_pin = inst->getPin(one_snk_port_name.c_str());
-        if (!src_pin || !snk_pin) {
-          continue;
-        }
-
-        build_inst_arc(*src_pin, *snk_pin, cell_arc);
-      }
-    }
+    build_inst_arc(*src_pin, *snk_pin, cell_arc);
   }
 
   return 1;
 }
 
 /**
- * @brief Build the net into graph net arc.
+ * @brief Build the net arc of the net, the arc is not added to the graph, so
+ * that different net can be built in parallel, the net only modify the arc list
+ * of the own vertexes.
  *
  * @param the_graph
  * @param net
- * @return unsigned
+ * @param net_arcs
+ * @return StaVertex* the const driver vertex, nullptr if not const.
  */
-unsigned StaBuildGraph::buildNet(StaGraph* the_graph, Net* net) {
+StaVertex* StaBuildGraph::buildNetArcs(
+    StaGraph* the_graph, Net* net,
+    std::vector<std::unique_ptr<StaArc>>& net_arcs) {
   DesignObject* pin_port;
   DesignObject* driver = net->getDriver();
   auto driver_vertex = the_graph->findVertex(driver);
@@ -210,17 +260,12 @@ unsigned StaBuildGraph::buildNet(StaGraph* the_graph, Net* net) {
 
   if (!driver_vertex) {
     DLOG_INFO << "net " << net->get_name() << " has no driver.";
-    return 1;
+    return nullptr;
   }
 
-  if (driver_vertex && driver->isPin() && driver->isConst()) {
-    the_graph->addConstVertex(*driver_vertex);
-  } else if (!driver_vertex) {
-    auto const_vertex = std::make_unique<StaVertex>(nullptr);
-    const_vertex->set_is_const();
-    (*driver_vertex) = const_vertex.get();
-    the_graph->addConstVertex(*driver_vertex);
-    the_graph->addVertex(std::move(const_vertex));
+  StaVertex* const_vertex = nullptr;
+  if (driver->isPin() && driver->isConst()) {
+    const_vertex = *driver_vertex;
   }
 
   // lambda function to create net arc.
@@ -260,7 +305,7 @@ unsigned StaBuildGraph::buildNet(StaGraph* the_graph, Net* net) {
       }
     }
 
-    the_graph->addArc(std::move(net_arc));
+    net_arcs.emplace_back(std::move(net_arc));
   }
 
   // for inout vertex, we need build another director net arc.
@@ -268,10 +313,31 @@ unsigned StaBuildGraph::buildNet(StaGraph* the_graph, Net* net) {
     for (auto* another_driver_vertex : inout_pair.second) {
       auto net_arc =
           create_net_arc(another_driver_vertex, another_load_vertex, net);
-      the_graph->addArc(std::move(net_arc));
+      net_arcs.emplace_back(std::move(net_arc));
     }
   }
 
+  return const_vertex;
+}
+
+/**
+ * @brief Build the net into graph net arc.
+ *
+ * @param the_graph
+ * @param net
+ * @return unsigned
+ */
+unsigned StaBuildGraph::buildNet(StaGraph* the_graph, Net* net) {
+  std::vector<std::unique_ptr<StaArc>> net_arcs;
+  if (auto* const_vertex = buildNetArcs(the_graph, net, net_arcs);
+      const_vertex) {
+    the_graph->addConstVertex(const_vertex);
+  }
+
+  for (auto& net_arc : net_arcs) {
+    the_graph->addArc(std::move(net_arc));
+  }
+
   return 1;
 }
 
@@ -306,6 +372,192 @@ unsigned StaBuildGraph::buildConst(StaGraph* the_graph, Instance* inst) {
   return 1;
 }
 
+/**
+ * @brief Build the inst list into graph vertex and cell arc in parallel, the
+ * vertex and arc are put in the same order with the serial buildInst.
+ *
+ * @param the_graph
+ * @param insts
+ * @return unsigned
+ */
+unsigned StaBuildGraph::buildInstList(StaGraph* the_graph,
+                                      std::vector<Instance*>& insts) {
+  unsigned num_threads = getNumThreads();
+
+  // expand the arc port of each liberty cell once.
+  std::unordered_map<LibCell*, CellArcPorts> cell_arc_ports;
+  for (auto* inst : insts) {
+    auto* lib_cell = inst->get_inst_cell();
+    if (!cell_arc_ports.contains(lib_cell)) {
+      cell_arc_ports[lib_cell] = expandCellArcPorts(lib_cell);
+    }
+  }
+
+  // first phase, count the pin vertex and resolve the arc pin of each inst.
+  std::vector<std::vector<Pin*>> inst_pins(insts.size());
+  std::vector<std::vector<std::tuple<unsigned, unsigned, LibArc*>>> inst_arcs(
+      insts.size());
+  parallelFor(num_threads, insts.size(), [&](std::size_t index) {
+    auto* inst = insts[index];
+    auto& pins = inst_pins[index];
+    Pin* pin;
+    FOREACH_INSTANCE_PIN(inst, pin) { pins.emplace_back(pin); }
+
+    auto get_pin_index = [&pins](Pin* the_pin) -> unsigned {
+      return std::find(pins.begin(), pins.end(), the_pin) - pins.begin();
+    };
+
+    for (auto& [src_port_name, snk_port_name, cell_arc] :
+         cell_arc_ports.find(inst->get_inst_cell())->second) {
+      auto src_pin = inst->getPin(src_port_name.c_str());
+      auto snk_pin = inst->getPin(snk_port_name.c_str());
+      if (!src_pin || !snk_pin) {
+        continue;
+      }
+
+      inst_arcs[index].emplace_back(get_pin_index(*src_pin),
+                                    get_pin_index(*snk_pin), cell_arc);
+    }
+  });
+
+  // allocate the vertex and arc slot of each inst by prefix sum.
+  std::vector<std::size_t> vertex_offsets(insts.size() + 1, 0);
+  std::vector<std::size_t> arc_offsets(insts.size() + 1, 0);
+  for (std::size_t index = 0; index < insts.size(); ++index) {
+    vertex_offsets[index + 1] = vertex_offsets[index] + inst_pins[index].size();
+    arc_offsets[index + 1] = arc_offsets[index] + inst_arcs[index].size();
+  }
+
+  auto& vertexes = the_graph->get_vertexes();
+  std::size_t vertex_start = vertexes.size();
+  vertexes.resize(vertex_start + vertex_offsets.back());
+  auto& arcs = the_graph->get_arcs();
+  std::size_t arc_start = arcs.size();
+  arcs.resize(arc_start + arc_offsets.back());
+
+  std::vector<std::unique_ptr<StaVertex>> assistant_vertexes(
+      vertex_offsets.back());
+  std::vector<std::vector<StaVertex*>> inst_end_vertexes(insts.size());
+
+  // second phase, fill the slot, the inst arc only connect the vertexes of the
+  // own inst, so the inst is independent.
+  parallelFor(num_threads, insts.size(), [&](std::size_t index) {
+    auto* inst = insts[index];
+    auto& pins = inst_pins[index];
+    std::size_t vertex_offset = vertex_offsets[index];
+
+    for (std::size_t pin_index = 0; pin_index < pins.size(); ++pin_index) {
+      auto the_vertex = std::make_unique<StaVertex>(pins[pin_index]);
+
+      if (pins[pin_index]->isInout()) {
+        // for inout pin, we set input as main, output as assistant.
+        auto assistant_vertex = std::make_unique<StaVertex>(pins[pin_index]);
+        the_vertex->set_is_bidirection();
+        assistant_vertex->set_is_bidirection();
+        assistant_vertex->set_is_assistant();
+        assistant_vertexes[vertex_offset + pin_index] =
+            std::move(assistant_vertex);
+      }
+
+      vertexes[vertex_start + vertex_offset + pin_index] =
+          std::move(the_vertex);
+    }
+
+    std::size_t arc_index = arc_start + arc_offsets[index];
+    for (auto& [src_pin_index, snk_pin_index, cell_arc] : inst_arcs[index]) {
+      auto* src_vertex =
+          vertexes[vertex_start + vertex_offset + src_pin_index].get();
+      // for inout pin, the assistant node is output.
+      auto* snk_vertex =
+          pins[snk_pin_index]->isInout()
+              ? assistant_vertexes[vertex_offset + snk_pin_index].get()
+              : vertexes[vertex_start + vertex_offset + snk_pin_index].get();
+
+      auto inst_arc =
+          std::make_unique<StaInstArc>(src_vertex, snk_vertex, cell_arc, inst);
+      src_vertex->addSrcArc(inst_arc.get());
+      snk_vertex->addSnkArc(inst_arc.get());
+
+      if (cell_arc->isCheckArc()) {
+        inst_end_vertexes[index].emplace_back(snk_vertex);
+        src_vertex->set_is_clock();
+      }
+
+      // add clock gating check arc
+      if (cell_arc->isClockGateCheckArc()) {
+        snk_vertex->set_is_clock_gate_end();
+        src_vertex->set_is_clock_gate_clock();
+      }
+
+      arcs[arc_index++] = std::move(inst_arc);
+    }
+  });
+
+  // the graph map and set are not thread safe, add them in order.
+  for (std::size_t index = 0; index < insts.size(); ++index) {
+    auto& pins = inst_pins[index];
+    for (std::size_t pin_index = 0; pin_index < pins.size(); ++pin_index) {
+      std::size_t slot = vertex_offsets[index] + pin_index;
+      auto* the_vertex = vertexes[vertex_start + slot].get();
+      the_graph->addCrossReference(pins[pin_index], the_vertex);
+      if (assistant_vertexes[slot]) {
+        the_graph->addMainAssistantCrossReference(
+            the_vertex, std::move(assistant_vertexes[slot]));
+      }
+    }
+
+    for (auto* end_vertex : inst_end_vertexes[index]) {
+      the_graph->addEndVertex(end_vertex);
+    }
+  }
+
+  return 1;
+}
+
+/**
+ * @brief Build the net list into graph net arc in parallel, the arc are put in
+ * the same order with the serial buildNet.
+ *
+ * @param the_graph
+ * @param nets
+ * @return unsigned
+ */
+unsigned StaBuildGraph::buildNetList(StaGraph* the_graph,
+                                     std::vector<Net*>& nets) {
+  unsigned num_threads = getNumThreads();
+
+  // first phase, the pin vertex belong to only one net, so the net arc can be
+  // built in parallel, the graph map is only read.
+  std::vector<std::vector<std::unique_ptr<StaArc>>> net_arcs(nets.size());
+  std::vector<StaVertex*> const_vertexes(nets.size(), nullptr);
+  parallelFor(num_threads, nets.size(), [&](std::size_t index) {
+    const_vertexes[index] =
+        buildNetArcs(the_graph, nets[index], net_arcs[index]);
+  });
+
+  // second phase, allocate the arc slot by prefix sum and move the arc in.
+  std::vector<std::size_t> arc_offsets(nets.size() + 1, 0);
+  for (std::size_t index = 0; index < nets.size(); ++index) {
+    arc_offsets[index + 1] = arc_offsets[index] + net_arcs[index].size();
+  }
+
+  auto& arcs = the_graph->get_arcs();
+  std::size_t arc_start = arcs.size();
+  arcs.resize(arc_start + arc_offsets.back());
+  parallelFor(num_threads, nets.size(), [&](std::size_t index) {
+    std::move(net_arcs[index].begin(), net_arcs[index].end(),
+              arcs.begin() + arc_start + arc_offsets[index]);
+  });
+
+  for (auto* const_vertex : const_vertexes) {
+    if (const_vertex) {
+      the_graph->addConstVertex(const_vertex);
+    }
+  }
+
+  return 1;
+}
+
 unsigned StaBuildGraph::operator()(StaGraph* the_graph) {
   LOG_INFO << "build graph start";
 
@@ -315,14 +567,21 @@ unsigned StaBuildGraph::operator()(StaGraph* the_graph) {
   // build port vertex
   FOREACH_PORT(nl, port) { buildPort(the_graph, port); }
 
+  // build inst vertex and inst arc
+  std::vector<Instance*> insts;
   Instance* inst;
-  FOREACH_INSTANCE(nl, inst) { buildInst(the_graph, inst); }
+  FOREACH_INSTANCE(nl, inst) { insts.emplace_back(inst); }
+  buildInstList(the_graph, insts);
 
   // build net arc
+  std::vector<Net*> nets;
   Net* net;
-  FOREACH_NET(nl, net) { buildNet(the_graph, net); }
+  FOREACH_NET(nl, net) { nets.emplace_back(net); }
+  buildNetList(the_graph, nets);
 
-  FOREACH_INSTANCE(nl, inst) { buildConst(the_graph, inst); }
+  for (auto* inst : insts) {
+    buildConst(the_graph, inst);
+  }
 
   LOG_INFO << "build graph end";
 
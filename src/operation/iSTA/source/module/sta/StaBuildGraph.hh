@@ -24,23 +24,40 @@
 
 #pragma once
 
+#include <string>
+#include <tuple>
+#include <vector>
+
 #include "StaFunc.hh"
 #include "StaGraph.hh"
 
 namespace ista {
 
 /**
- * @brief The functor of build graph.
+ * @brief The functor of build graph, the instance and net are built in
+ * parallel by two phase, first count the vertex and arc of each object and
+ * allocate the slot, then fill the slot, so the vertex and arc id are the same
+ * with the serial build.
  *
  */
 class StaBuildGraph : public StaFunc {
  public:
+  using CellArcPorts = std::vector<std::tuple<std::string, std::string, LibArc*>>;
+
   unsigned buildPort(StaGraph* the_graph, Port* port);
   unsigned buildInst(StaGraph* the_graph, Instance* inst);
   unsigned buildNet(StaGraph* the_graph, Net* net);
   unsigned buildConst(StaGraph* the_graph, Instance* inst);
 
+  unsigned buildInstList(StaGraph* the_graph, std::vector<Instance*>& insts);
+  unsigned buildNetList(StaGraph* the_graph, std::vector<Net*>& nets);
+
   unsigned operator()(StaGraph* the_graph) override;
+
+ private:
+  CellArcPorts expandCellArcPorts(LibCell* lib_cell);
+  StaVertex* buildNetArcs(StaGraph* the_graph, Net* net,
+                          std::vector<std::unique_ptr<StaArc>>& net_arcs);
 };
 
 }  // namespace ista
@@ -25,6 +25,9 @@
 
 #include "StaBuildRCTree.hh"
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 #include <string>
 #include <utility>
 
@@ -60,6 +63,19 @@ std::unique_ptr<RcNet> StaBuildRCTree::createRcNet(Net* net) {
   return rc_net;
 }
 
+/**
+ * @brief Create the rc net of all design nets.
+ *
+ * @param design_nl
+ */
+void StaBuildRCTree::createAllRcNet(Netlist* design_nl) {
+  Net* net;
+  FOREACH_NET(design_nl, net) {
+    auto rc_net = createRcNet(net);
+    getSta()->addRcNet(net, std::move(rc_net));
+  }
+}
+
 /**
  * @brief Build the net rc tree connected to the vertex.
  *
@@ -67,6 +83,10 @@ std::unique_ptr<RcNet> StaBuildRCTree::createRcNet(Net* net) {
  * @return unsigned
  */
 unsigned StaBuildRCTree::operator()(StaGraph* the_graph) {
+  if (getSta()->isSpefStreamRead()) {
+    return buildRcTreeByStream(the_graph);
+  }
+
   LOG_INFO << "build rc tree start";
 
   LOG_INFO << "read spef " << _spef_file_name << " start";
@@ -90,13 +110,7 @@ unsigned StaBuildRCTree::operator()(StaGraph* the_graph) {
 
   // build rc net
   Netlist* design_nl = the_graph->get_nl();
-  Net* net;
-  FOREACH_NET(design_nl, net) {
-    auto rc_net = createRcNet(net);
-
-    // DLOG_INFO << net->get_name() << "build rc tree";
-    getSta()->addRcNet(net, std::move(rc_net));
-  }
+  createAllRcNet(design_nl);
 
   // rc net update timing information.
   std::atomic<unsigned> max_node = 0;
@@ -175,6 +189,121 @@ unsigned StaBuildRCTree::operator()(StaGraph* the_graph) {
   return is_ok;
 }
 
+/**
+ * @brief Build the net rc tree by stream reading the spef file, the parser
+ * read the nets chunk by chunk and the rc tree workers consume the chunks, the
+ * chunks in flight are bounded, so parse and rc reduction are overlapped and
+ * only a few chunks are hold in memory.
+ *
+ * @param the_graph
+ * @return unsigned
+ */
+unsigned StaBuildRCTree::buildRcTreeByStream(StaGraph* the_graph) {
+  LOG_INFO << "build rc tree by stream start";
+
+  SpefRustStreamReader spef_stream;
+  if (!spef_stream.open(_spef_file_name)) {
+    LOG_FATAL << "Open the spef file " << _spef_file_name << " error.";
+    return 0;
+  }
+
+  auto rc_net_common_info = std::make_unique<RCNetCommonInfo>();
+  rc_net_common_info->set_spef_cap_unit(spef_stream.getSpefCapUnit());
+  rc_net_common_info->set_spef_resistance_unit(spef_stream.getSpefResUnit());
+  RcNet::set_rc_net_common_info(std::move(rc_net_common_info));
+
+  Netlist* design_nl = the_graph->get_nl();
+  createAllRcNet(design_nl);
+
+  unsigned num_threads = getNumThreads();
+  // the parser wait when the chunks in flight reach the limit.
+  const unsigned max_chunk_in_flight = 2 * num_threads;
+  unsigned num_chunk_in_flight = 0;
+  std::mutex chunk_mutex;
+  std::condition_variable chunk_cv;
+
+  // the max node net of each chunk, merged after all chunks are done, the
+  // deque keep the element address stable when the parser append new chunk.
+  std::deque<std::pair<unsigned, std::string>> chunk_max_nodes;
+
+  auto update_chunk_rc_timing = [design_nl, this](
+                                    void* spef_chunk,
+                                    std::pair<unsigned, std::string>&
+                                        chunk_max_node) {
+    RustVec chunk_nets = SpefRustStreamReader::getChunkNets(spef_chunk);
+    void* spef_net;
+    FOREACH_VEC_ELEM(&chunk_nets, void, spef_net) {
+      auto* rust_spef_net =
+          static_cast<RustSpefNet*>(rust_convert_spef_net(spef_net));
+
+      if (rust_spef_net->_caps.len > chunk_max_node.first) {
+        chunk_max_node.first = rust_spef_net->_caps.len;
+        chunk_max_node.second = rust_spef_net->_name;
+      }
+
+      auto* design_net = design_nl->findNet(rust_spef_net->_name);
+      if (design_net) {
+        auto* rc_net = getSta()->getRcNet(design_net);
+        rc_net->updateRcTiming(rust_spef_net);
+      } else {
+        LOG_FATAL << "build rc tree not found design net "
+                  << rust_spef_net->_name;
+        rust_free_spef_net(rust_spef_net);
+      }
+    }
+
+    SpefRustStreamReader::freeChunk(spef_chunk);
+  };
+
+  {
+    ThreadPool pool(num_threads);
+    while (true) {
+      {
+        std::unique_lock lk(chunk_mutex);
+        chunk_cv.wait(lk, [&num_chunk_in_flight, max_chunk_in_flight] {
+          return num_chunk_in_flight < max_chunk_in_flight;
+        });
+        ++num_chunk_in_flight;
+      }
+
+      void* spef_chunk = spef_stream.nextChunk(c_stream_chunk_net_num);
+      if (!spef_chunk) {
+        break;
+      }
+
+      auto& chunk_max_node = chunk_max_nodes.emplace_back(0, "");
+      pool.enqueue([&update_chunk_rc_timing, &num_chunk_in_flight,
+                    &chunk_mutex, &chunk_cv, &chunk_max_node, spef_chunk]() {
+        update_chunk_rc_timing(spef_chunk, chunk_max_node);
+        {
+          std::lock_guard lk(chunk_mutex);
+          --num_chunk_in_flight;
+        }
+        chunk_cv.notify_one();
+      });
+    }
+  }
+
+  if (spef_stream.hasError()) {
+    LOG_ERROR << "Read the spef file " << _spef_file_name << " error.";
+    return 0;
+  }
+
+  unsigned max_node = 0;
+  std::string net_name;
+  for (auto& [chunk_max_node, chunk_net_name] : chunk_max_nodes) {
+    if (chunk_max_node > max_node) {
+      max_node = chunk_max_node;
+      net_name = std::move(chunk_net_name);
+    }
+  }
+
+  LOG_INFO << "net name " << net_name << " max node " << max_node;
+  LOG_INFO << "build rc tree by stream end";
+
+  return 1;
+}
+
 /**
  * @brief print rc tree in yaml format.
  *
@@ -44,6 +44,7 @@ class StaBuildRCTree : public StaFunc {
   ~StaBuildRCTree() override = default;
 
   unsigned operator()(StaGraph* the_graph) override;
+  unsigned buildRcTreeByStream(StaGraph* the_graph);
 
   std::unique_ptr<RcNet> createRcNet(Net* net);
   DelayCalcMethod get_calc_method() { return _calc_method; }
@@ -52,6 +53,11 @@ class StaBuildRCTree : public StaFunc {
   void printYamlText(const char* file_name);
 
  private:
+  void createAllRcNet(Netlist* design_nl);
+
+  static constexpr unsigned c_stream_chunk_net_num =
+      512;  //!< The net num of one spef stream chunk.
+
   std::string _spef_file_name;
   DelayCalcMethod _calc_method =
       DelayCalcMethod::kElmore;  //!< The delay calc method selected.
@@ -78,6 +78,66 @@ void StaGraph::addConstVertex(StaVertex* const_vertex) {
   _const_vertexes.insert(const_vertex);
 }
 
+/**
+ * @brief Remove the arcs, the arcs are detached from the src and snk vertex.
+ *
+ * @param the_arcs
+ */
+void StaGraph::removeArcs(const FlatSet<StaArc*>& the_arcs) {
+  if (the_arcs.empty()) {
+    return;
+  }
+
+  for (auto* the_arc : the_arcs) {
+    the_arc->get_src()->removeSrcArc(the_arc);
+    the_arc->get_snk()->removeSnkArc(the_arc);
+  }
+
+  std::erase_if(_arcs, [&the_arcs](std::unique_ptr<StaArc>& arc) {
+    return the_arcs.contains(arc.get());
+  });
+}
+
+/**
+ * @brief Remove the main vertexes and their assistant, the arcs of the
+ * vertexes should be removed before.
+ *
+ * @param the_vertexes
+ */
+void StaGraph::removeVertexes(const FlatSet<StaVertex*>& the_vertexes) {
+  if (the_vertexes.empty()) {
+    return;
+  }
+
+  auto remove_vertex_ref = [this](StaVertex* the_vertex) {
+    LOG_FATAL_IF(!the_vertex->get_src_arcs().empty() ||
+                 !the_vertex->get_snk_arcs().empty())
+        << "vertex " << the_vertex->getName() << " has arc.";
+    _port_vertexes.erase(the_vertex);
+    _start_vertexes.erase(the_vertex);
+    _end_vertexes.erase(the_vertex);
+    _const_vertexes.erase(the_vertex);
+  };
+
+  for (auto* the_vertex : the_vertexes) {
+    remove_vertex_ref(the_vertex);
+    if (auto obj = findObj(the_vertex); obj) {
+      removeCrossReference(*obj, the_vertex);
+    }
+
+    if (auto it = _main2assistant.find(the_vertex);
+        it != _main2assistant.end()) {
+      remove_vertex_ref(it->second.get());
+      _assistant2main.erase(it->second.get());
+      _main2assistant.erase(it);
+    }
+  }
+
+  std::erase_if(_vertexes, [&the_vertexes](std::unique_ptr<StaVertex>& vertex) {
+    return the_vertexes.contains(vertex.get());
+  });
+}
+
 /**
  * @brief Init the all vertex state in the graph.
  *
@@ -120,6 +120,9 @@ class StaGraph {
     }));
   }
 
+  void removeArcs(const FlatSet<StaArc*>& the_arcs);
+  void removeVertexes(const FlatSet<StaVertex*>& the_vertexes);
+
   BTreeSet<StaVertex*>& get_start_vertexes() { return _start_vertexes; }
   BTreeSet<StaVertex*>& get_end_vertexes() { return _end_vertexes; }
   BTreeSet<StaVertex*>& get_const_vertexes() { return _const_vertexes; }
@@ -0,0 +1,697 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of
+// Sciences Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan
+// PSL v2. You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY
+// KIND, EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// NON-INFRINGEMENT, MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+/**
+ * @file StaKWorstPath.cc
+ * @brief The implemention of the k worst timing path enumeration.
+ */
+#include "StaKWorstPath.hh"
+
+#include <yaml-cpp/yaml.h>
+
+#include <algorithm>
+#include <future>
+#include <iterator>
+#include <limits>
+#include <set>
+#include <tuple>
+#include <utility>
+
+#include "StaArc.hh"
+#include "StaClock.hh"
+#include "StaCppr.hh"
+#include "StaReport.hh"
+#include "StaVertex.hh"
+#include "ThreadPool/ThreadPool.h"
+#include "json/json.hpp"
+#include "log/Log.hh"
+#include "time/Time.hh"
+
+namespace ista {
+
+/**
+ * @brief Get the data from which the path can be deviated, the deviation is
+ * only allowed upstream the last deviation, so that every path is enumerated
+ * only once.
+ *
+ * @return StaPathDelayData*
+ */
+StaPathDelayData* StaKPath::getExpandStartData() const {
+  return _deviations.empty() ? _seq_path_data->get_delay_data()
+                             : _deviations.back().get_to();
+}
+
+/**
+ * @brief Get the launch clock data of the path, which is decided by the
+ * start of the path.
+ *
+ * @return StaClockData*
+ */
+StaClockData* StaKPath::getLaunchClockData() const {
+  return getExpandStartData()->get_launch_clock_data();
+}
+
+/**
+ * @brief Generate the path points from the start to the end.
+ *
+ * @return std::vector<StaKPathPoint>
+ */
+std::vector<StaKPathPoint> StaKPath::getPathPoints() const {
+  // collect the data from the end to the start, record the arrive time change
+  // of the deviation data.
+  std::vector<std::pair<StaPathDelayData*, int64_t>> path_datas;
+  auto* path_data = _seq_path_data->get_delay_data();
+  std::size_t deviation_index = 0;
+  while (path_data) {
+    if (deviation_index < _deviations.size() &&
+        _deviations[deviation_index].get_at() == path_data) {
+      auto& deviation = _deviations[deviation_index++];
+      path_datas.emplace_back(path_data, deviation.get_incr_arrive_time());
+      path_data = deviation.get_to();
+    } else {
+      path_datas.emplace_back(path_data, 0);
+      path_data = dynamic_cast<StaPathDelayData*>(path_data->get_bwd());
+    }
+  }
+
+  int64_t launch_time = getLaunchClockData()->get_arrive_time() +
+                        _seq_path_data->getLaunchEdge();
+
+  std::vector<StaKPathPoint> path_points;
+  path_points.reserve(path_datas.size());
+  int64_t shift_time = 0;
+  int64_t last_arrive_time = launch_time;
+  for (auto it = path_datas.rbegin(); it != path_datas.rend(); ++it) {
+    auto [delay_data, incr_arrive_time] = *it;
+    shift_time += incr_arrive_time;
+    int64_t arrive_time =
+        delay_data->get_arrive_time() + shift_time + launch_time;
+    path_points.emplace_back(delay_data->get_own_vertex(),
+                             delay_data->get_trans_type(), arrive_time,
+                             arrive_time - last_arrive_time);
+    last_arrive_time = arrive_time;
+  }
+
+  return path_points;
+}
+
+StaKPathWriter::StaKPathWriter(const char* rpt_file_name)
+    : _fp(std::fopen(rpt_file_name, "w")) {
+  LOG_ERROR_IF(!_fp) << "open the report file " << rpt_file_name << " failed.";
+}
+
+StaKPathWriter::~StaKPathWriter() {
+  if (_fp) {
+    std::fclose(_fp);
+  }
+}
+
+/**
+ * @brief Create the writer of the report format.
+ *
+ * @param rpt_file_name
+ * @param format
+ * @return std::unique_ptr<StaKPathWriter>
+ */
+std::unique_ptr<StaKPathWriter> StaKPathWriter::createWriter(
+    const char* rpt_file_name, StaKPathFormat format) {
+  switch (format) {
+    case StaKPathFormat::kJson:
+      return std::make_unique<StaKPathJsonWriter>(rpt_file_name);
+    case StaKPathFormat::kYaml:
+      return std::make_unique<StaKPathYamlWriter>(rpt_file_name);
+    default:
+      return std::make_unique<StaKPathTextWriter>(rpt_file_name);
+  }
+}
+
+unsigned StaKPathTextWriter::writeHead() {
+  std::fprintf(_fp, "Generate the k worst path report at %s.\n",
+               Time::getNowWallTime());
+  return 1;
+}
+
+/**
+ * @brief Write the path in text table.
+ *
+ * @param path
+ * @param path_id
+ * @return unsigned
+ */
+unsigned StaKPathTextWriter::writePath(const StaKPath& path, unsigned path_id) {
+  std::string fix_str = "%." + std::to_string(get_significant_digits()) + "f";
+  auto fix_point_str = [&fix_str](double data) {
+    return Str::printf(fix_str.c_str(), data);
+  };
+
+  auto* seq_path_data = path.get_seq_path_data();
+  auto path_points = path.getPathPoints();
+  auto* launch_clock = path.getLaunchClockData()->get_prop_clock();
+  auto* capture_clock = seq_path_data->get_capture_clock();
+  const char* delay_type_str =
+      seq_path_data->getDelayType() == AnalysisMode::kMax ? "max" : "min";
+
+  std::fprintf(_fp, "\nPath %u\n", path_id);
+  std::fprintf(_fp, "Startpoint: %s\n",
+               path_points.front().get_own_vertex()->getName().c_str());
+  std::fprintf(_fp, "Endpoint: %s\n",
+               path_points.back().get_own_vertex()->getName().c_str());
+  std::fprintf(_fp, "Launch clock: %s, Capture clock: %s, Delay type: %s\n",
+               launch_clock->get_clock_name(),
+               capture_clock ? capture_clock->get_clock_name() : "NA",
+               delay_type_str);
+
+  StaReportTable report_tbl("k_worst_path");
+  report_tbl << TABLE_HEAD;
+  report_tbl[0][0] = "Point";
+  report_tbl[0][1] = "Incr";
+  report_tbl[0][2] = "Path";
+  report_tbl << TABLE_ENDLINE;
+
+  for (auto& path_point : path_points) {
+    const char* trans_type_str =
+        (path_point.get_trans_type() == TransType::kRise) ? "r" : "f";
+    report_tbl << path_point.get_own_vertex()->getNameWithCellName()
+               << fix_point_str(FS_TO_NS(path_point.get_incr_time()))
+               << std::string(fix_point_str(
+                      FS_TO_NS(path_point.get_arrive_time()))) +
+                      trans_type_str
+               << TABLE_ENDLINE;
+  }
+
+  int64_t arrive_time = path_points.back().get_arrive_time();
+  report_tbl << "data arrival time" << TABLE_SKIP
+             << fix_point_str(FS_TO_NS(arrive_time)) << TABLE_ENDLINE;
+  report_tbl << "data require time" << TABLE_SKIP
+             << fix_point_str(FS_TO_NS(path.get_require_time()))
+             << TABLE_ENDLINE;
+  report_tbl << "slack" << TABLE_SKIP
+             << fix_point_str(FS_TO_NS(path.get_slack())) << TABLE_ENDLINE;
+
+  std::fprintf(_fp, "%s", report_tbl.c_str());
+  return 1;
+}
+
+unsigned StaKPathJsonWriter::writeHead() {
+  std::fprintf(_fp, "[");
+  return 1;
+}
+
+/**
+ * @brief Write the path as one json object of the array.
+ *
+ * @param path
+ * @param path_id
+ * @return unsigned
+ */
+unsigned StaKPathJsonWriter::writePath(const StaKPath& path, unsigned path_id) {
+  auto* seq_path_data = path.get_seq_path_data();
+  auto path_points = path.getPathPoints();
+  auto* capture_clock = seq_path_data->get_capture_clock();
+
+  nlohmann::json path_json = nlohmann::json::object();
+  path_json["id"] = path_id;
+  path_json["startpoint"] = path_points.front().get_own_vertex()->getName();
+  path_json["endpoint"] = path_points.back().get_own_vertex()->getName();
+  path_json["launch_clock"] =
+      path.getLaunchClockData()->get_prop_clock()->get_clock_name();
+  path_json["capture_clock"] =
+      capture_clock ? capture_clock->get_clock_name() : "NA";
+  path_json["delay_type"] =
+      seq_path_data->getDelayType() == AnalysisMode::kMax ? "max" : "min";
+  path_json["arrive_time"] = FS_TO_NS(path_points.back().get_arrive_time());
+  path_json["require_time"] = FS_TO_NS(path.get_require_time());
+  path_json["slack"] = FS_TO_NS(path.get_slack());
+
+  nlohmann::json points_json = nlohmann::json::array();
+  for (auto& path_point : path_points) {
+    nlohmann::json point_json = nlohmann::json::object();
+    point_json["pin"] = path_point.get_own_vertex()->getName();
+    point_json["trans"] =
+        (path_point.get_trans_type() == TransType::kRise) ? "r" : "f";
+    point_json["incr"] = FS_TO_NS(path_point.get_incr_time());
+    point_json["arrive_time"] = FS_TO_NS(path_point.get_arrive_time());
+    points_json.push_back(std::move(point_json));
+  }
+  path_json["points"] = std::move(points_json);
+
+  std::fprintf(_fp, "%s\n%s", _is_first_path ? "" : ",",
+               path_json.dump().c_str());
+  _is_first_path = false;
+  return 1;
+}
+
+unsigned StaKPathJsonWriter::writeTail() {
+  std::fprintf(_fp, "\n]\n");
+  return 1;
+}
+
+/**
+ * @brief Write the path as one yaml document of the stream.
+ *
+ * @param path
+ * @param path_id
+ * @return unsigned
+ */
+unsigned StaKPathYamlWriter::writePath(const StaKPath& path, unsigned path_id) {
+  auto* seq_path_data = path.get_seq_path_data();
+  auto path_points = path.getPathPoints();
+  auto* capture_clock = seq_path_data->get_capture_clock();
+
+  YAML::Node path_node;
+  path_node["id"] = path_id;
+  path_node["startpoint"] = path_points.front().get_own_vertex()->getName();
+  path_node["endpoint"] = path_points.back().get_own_vertex()->getName();
+  path_node["launch_clock"] =
+      path.getLaunchClockData()->get_prop_clock()->get_clock_name();
+  path_node["capture_clock"] =
+      capture_clock ? capture_clock->get_clock_name() : "NA";
+  path_node["delay_type"] =
+      seq_path_data->getDelayType() == AnalysisMode::kMax ? "max" : "min";
+  path_node["arrive_time"] = FS_TO_NS(path_points.back().get_arrive_time());
+  path_node["require_time"] = FS_TO_NS(path.get_require_time());
+  path_node["slack"] = FS_TO_NS(path.get_slack());
+
+  for (auto& path_point : path_points) {
+    YAML::Node point_node;
+    point_node["pin"] = path_point.get_own_vertex()->getName();
+    point_node["trans"] =
+        (path_point.get_trans_type() == TransType::kRise) ? "r" : "f";
+    point_node["incr"] = FS_TO_NS(path_point.get_incr_time());
+    point_node["arrive_time"] = FS_TO_NS(path_point.get_arrive_time());
+    path_node["points"].push_back(point_node);
+  }
+
+  YAML::Emitter emitter;
+  emitter << path_node;
+  std::fprintf(_fp, "---\n%s\n", emitter.c_str());
+  return 1;
+}
+
+StaKWorstPath::StaKWorstPath(AnalysisMode analysis_mode, unsigned n_worst,
+                             unsigned max_paths, unsigned num_threads)
+    : _analysis_mode(analysis_mode),
+      _n_worst(n_worst),
+      _max_paths(max_paths == 0 ? std::numeric_limits<unsigned>::max()
+                                : max_paths),
+      _num_threads(num_threads) {}
+
+/**
+ * @brief Judge whether the src data could propagate to the snk data through
+ * the snk arc, the rule is the same as the data propagation.
+ *
+ * @param snk_arc
+ * @param src_data
+ * @param snk_data
+ * @return true
+ * @return false
+ */
+bool StaKWorstPath::isFaninData(StaArc* snk_arc, StaData* src_data,
+                                StaPathDelayData* snk_data) {
+  if (src_data->get_delay_type() != snk_data->get_delay_type()) {
+    return false;
+  }
+
+  auto src_trans_type = src_data->get_trans_type();
+  if (snk_arc->isNegativeArc()) {
+    src_trans_type = FLIP_TRANS(src_trans_type);
+  }
+
+  // the non-unate arc propagate both trans, but for clock to q not need
+  // consider.
+  bool is_non_unate =
+      !snk_arc->isUnateArc() && !snk_arc->get_src()->is_clock();
+  if (!is_non_unate && src_trans_type != snk_data->get_trans_type()) {
+    return false;
+  }
+
+  // the launch clock should be the same clock edge, so the launch edge and
+  // the require time of the path do not change.
+  auto* src_launch_clock_data =
+      dynamic_cast<StaPathDelayData*>(src_data)->get_launch_clock_data();
+  auto* snk_launch_clock_data = snk_data->get_launch_clock_data();
+  return (src_launch_clock_data->get_prop_clock() ==
+          snk_launch_clock_data->get_prop_clock()) &&
+         (src_launch_clock_data->get_clock_wave_type() ==
+          snk_launch_clock_data->get_clock_wave_type());
+}
+
+/**
+ * @brief Judge whether the path pass a vertex of every through list of the
+ * report spec.
+ *
+ * @param path
+ * @return true
+ * @return false
+ */
+bool StaKWorstPath::isThroughPath(const StaKPath& path) {
+  if (_through_vertexes.empty()) {
+    return true;
+  }
+
+  auto path_points = path.getPathPoints();
+  return std::all_of(
+      _through_vertexes.begin(), _through_vertexes.end(),
+      [&path_points](const std::set<StaVertex*>& through_vertexes) {
+        return std::any_of(path_points.begin(), path_points.end(),
+                           [&through_vertexes](const StaKPathPoint& point) {
+                             return through_vertexes.contains(
+                                 point.get_own_vertex());
+                           });
+      });
+}
+
+/**
+ * @brief Get the require time of the path launched by the launch clock data,
+ * the clock edge is the same as the worst path, but the launch clock path may
+ * differ, so the cppr is found again.
+ *
+ * @param seq_path_data The worst path of the endpoint.
+ * @param launch_clock_data The launch clock data of the path.
+ * @param require_times The require time found before.
+ * @return int64_t
+ */
+int64_t StaKWorstPath::getRequireTime(StaSeqPathData* seq_path_data,
+                                      StaClockData* launch_clock_data,
+                                      RequireTimeCache& require_times) {
+  if (launch_clock_data == seq_path_data->get_launch_clock_data()) {
+    return seq_path_data->getRequireTime();
+  }
+
+  auto key = std::make_pair(seq_path_data, launch_clock_data);
+  if (auto found = require_times.find(key); found != require_times.end()) {
+    return found->second;
+  }
+
+  auto* capture_clock_data = seq_path_data->get_capture_clock_data();
+  auto* capture_clock = capture_clock_data->get_prop_clock();
+  int64_t cppr = 0;
+  if (launch_clock_data->get_prop_clock() == capture_clock) {
+    StaCppr find_cppr(launch_clock_data, capture_clock_data);
+    if (capture_clock->exec(find_cppr)) {
+      cppr = find_cppr.get_cppr();
+    }
+  }
+
+  int64_t incr_cppr = cppr - seq_path_data->get_cppr().value_or(0);
+  int64_t require_time = (_analysis_mode == AnalysisMode::kMax)
+                             ? seq_path_data->getRequireTime() + incr_cppr
+                             : seq_path_data->getRequireTime() - incr_cppr;
+  require_times.emplace(key, require_time);
+  return require_time;
+}
+
+/**
+ * @brief Generate the child path of the path, each child path has one more
+ * deviation upstream the last deviation.
+ *
+ * @param path
+ * @param require_times
+ * @param add_path
+ */
+void StaKWorstPath::expandPath(
+    const StaKPath& path, RequireTimeCache& require_times,
+    const std::function<void(StaKPath&&)>& add_path) {
+  auto* seq_path_data = path.get_seq_path_data();
+  auto* launch_clock_data = path.getLaunchClockData();
+  auto* path_data = path.getExpandStartData();
+  while (path_data) {
+    auto* bwd_data = dynamic_cast<StaPathDelayData*>(path_data->get_bwd());
+    if (!bwd_data) {
+      break;
+    }
+
+    auto* own_vertex = path_data->get_own_vertex();
+    auto delay_type = path_data->get_delay_type();
+    auto trans_type = path_data->get_trans_type();
+    auto derate = path_data->get_derate();
+
+    FOREACH_SNK_ARC(own_vertex, snk_arc) {
+      if (!snk_arc->isDelayArc() || snk_arc->is_loop_disable()) {
+        continue;
+      }
+
+      auto* src_vertex = snk_arc->get_src();
+      if (!src_vertex->get_prop_tag().is_prop()) {
+        continue;
+      }
+
+      int64_t arc_delay = snk_arc->get_arc_delay(delay_type, trans_type);
+      if (derate) {
+        arc_delay *= derate.value();
+      }
+
+      StaData* src_data;
+      FOREACH_DELAY_DATA(src_vertex, src_data) {
+        if (src_data == bwd_data || !isFaninData(snk_arc, src_data, path_data)) {
+          continue;
+        }
+
+        auto* fanin_data = dynamic_cast<StaPathDelayData*>(src_data);
+        auto* fanin_launch_clock_data = fanin_data->get_launch_clock_data();
+        int64_t incr_arrive_time = fanin_data->get_arrive_time() + arc_delay -
+                                   path_data->get_arrive_time();
+        int64_t incr_launch_time = fanin_launch_clock_data->get_arrive_time() -
+                                   launch_clock_data->get_arrive_time();
+
+        int64_t arrive_time =
+            path.get_arrive_time() + incr_arrive_time + incr_launch_time;
+        int64_t require_time = getRequireTime(
+            seq_path_data, fanin_launch_clock_data, require_times);
+        int64_t slack = (_analysis_mode == AnalysisMode::kMax)
+                            ? require_time - arrive_time
+                            : arrive_time - require_time;
+        if (_max_slack && slack > _max_slack.value()) {
+          continue;
+        }
+
+        StaKPath child_path(path);
+        child_path.addDeviation(StaPathDeviation(path_data, fanin_data,
+                                                 snk_arc, incr_arrive_time));
+        child_path.set_arrive_time(arrive_time);
+        child_path.set_require_time(require_time);
+        add_path(std::move(child_path));
+      }
+    }
+
+    path_data = bwd_data;
+  }
+}
+
+/**
+ * @brief Enumerate the n worst path of one endpoint, the candidate path is
+ * kept in a bounded set, the set size is not larger than the path num still
+ * needed. With the through filter a popped path may not be reported, so the
+ * candidates and the popped paths are capped by max_candidates instead, the
+ * path through the points may be missed when the cap is hit.
+ *
+ * @param seq_path_datas The worst path data of the endpoint.
+ * @return std::vector<StaKPath>
+ */
+std::vector<StaKPath> StaKWorstPath::enumeratePathEnd(
+    const std::vector<StaSeqPathData*>& seq_path_datas) {
+  std::size_t n_worst = std::min(_n_worst, _max_paths);
+  if (n_worst == 0) {
+    return {};
+  }
+
+  auto cmp = [](const StaKPath& left, const StaKPath& right) -> bool {
+    return left.get_slack() < right.get_slack();
+  };
+  std::multiset<StaKPath, decltype(cmp)> candidate_paths(cmp);
+
+  bool is_through_filter = !_through_vertexes.empty();
+  bool is_capped = false;
+  auto add_candidate_path = [&candidate_paths, &is_capped, is_through_filter](
+                                StaKPath&& path, std::size_t bound) {
+    if (candidate_paths.size() >= bound &&
+        path.get_slack() >= std::prev(candidate_paths.end())->get_slack()) {
+      is_capped = is_capped || is_through_filter;
+      return;
+    }
+    candidate_paths.insert(std::move(path));
+    if (candidate_paths.size() > bound) {
+      candidate_paths.erase(std::prev(candidate_paths.end()));
+      is_capped = is_capped || is_through_filter;
+    }
+  };
+
+  auto get_bound = [this, n_worst, is_through_filter](std::size_t path_num) {
+    return is_through_filter ? _max_candidates : n_worst - path_num;
+  };
+
+  for (auto* seq_path_data : seq_path_datas) {
+    StaKPath path(seq_path_data, seq_path_data->getArriveTime(),
+                  seq_path_data->getRequireTime());
+    if (_max_slack && path.get_slack() > _max_slack.value()) {
+      continue;
+    }
+    add_candidate_path(std::move(path), get_bound(0));
+  }
+
+  RequireTimeCache require_times;
+  std::vector<StaKPath> paths;
+  std::size_t popped_num = 0;
+  while (!candidate_paths.empty() && paths.size() < n_worst) {
+    if (is_through_filter && popped_num++ == _max_candidates) {
+      is_capped = true;
+      break;
+    }
+
+    auto path_node = candidate_paths.extract(candidate_paths.begin());
+    StaKPath& path = path_node.value();
+
+    std::size_t bound = get_bound(paths.size() + 1);
+    if (bound > 0) {
+      expandPath(path, require_times,
+                 [&add_candidate_path, bound](StaKPath&& child_path) {
+                   add_candidate_path(std::move(child_path), bound);
+                 });
+    }
+
+    if (isThroughPath(path)) {
+      paths.emplace_back(std::move(path));
+    }
+  }
+
+  if (is_capped) {
+    _is_candidates_capped = true;
+  }
+
+  return paths;
+}
+
+/**
+ * @brief Enumerate the k worst path of the path group and write them by slack.
+ * The endpoints are sorted by the slack of their worst path, which no path of
+ * the endpoint is worse than. They are enumerated in parallel round by round,
+ * a merged path is written once it is not worse than the worst path of the
+ * next endpoint, so only the paths not written yet are kept, at most
+ * max_paths, and the enumeration stops when max_paths paths are written.
+ *
+ * @param seq_path_group
+ * @param write_path The path is moved to it in slack order.
+ * @return unsigned The written path num.
+ */
+unsigned StaKWorstPath::operator()(
+    StaSeqPathGroup* seq_path_group,
+    const std::function<void(StaKPath&&)>& write_path) {
+  struct KPathEnd {
+    std::vector<StaSeqPathData*> _seq_path_datas;
+    int64_t _worst_slack;
+  };
+  std::vector<KPathEnd> path_ends;
+  StaPathEnd* path_end;
+  StaPathData* path_data;
+  AnalysisMode analysis_mode = _analysis_mode;
+  FOREACH_PATH_GROUP_END(seq_path_group, path_end) {
+    KPathEnd k_path_end{{}, std::numeric_limits<int64_t>::max()};
+    FOREACH_PATH_END_DATA(path_end, analysis_mode, path_data) {
+      auto* seq_path_data = dynamic_cast<StaSeqPathData*>(path_data);
+      StaKPath path(seq_path_data, seq_path_data->getArriveTime(),
+                    seq_path_data->getRequireTime());
+      k_path_end._worst_slack =
+          std::min(k_path_end._worst_slack, path.get_slack());
+      k_path_end._seq_path_datas.emplace_back(seq_path_data);
+    }
+    if (!k_path_end._seq_path_datas.empty()) {
+      path_ends.emplace_back(std::move(k_path_end));
+    }
+  }
+  std::stable_sort(path_ends.begin(), path_ends.end(),
+                   [](const KPathEnd& left, const KPathEnd& right) {
+                     return left._worst_slack < right._worst_slack;
+                   });
+
+  // the path is ordered by slack, then by the endpoint and the rank in the
+  // endpoint, so the written paths do not depend on the thread scheduling.
+  struct GroupPath {
+    StaKPath _path;
+    std::size_t _end_index;
+    std::size_t _rank;
+  };
+  auto cmp = [](const GroupPath& left, const GroupPath& right) -> bool {
+    return std::make_tuple(left._path.get_slack(), left._end_index,
+                           left._rank) <
+           std::make_tuple(right._path.get_slack(), right._end_index,
+                           right._rank);
+  };
+  std::multiset<GroupPath, decltype(cmp)> pending_paths(cmp);
+
+  unsigned path_num = 0;
+  auto add_pending_path = [this, &pending_paths, &path_num,
+                           &cmp](GroupPath&& group_path) {
+    std::size_t bound = _max_paths - path_num;
+    if (pending_paths.size() >= bound &&
+        !cmp(group_path, *std::prev(pending_paths.end()))) {
+      return;
+    }
+    pending_paths.insert(std::move(group_path));
+    if (pending_paths.size() > bound) {
+      pending_paths.erase(std::prev(pending_paths.end()));
+    }
+  };
+
+  // write the pending paths not worse than the next endpoint, all the paths
+  // are written at the last.
+  auto write_pending_paths = [this, &pending_paths, &path_num, &write_path](
+                                 std::optional<int64_t> next_worst_slack) {
+    while (!pending_paths.empty() && path_num < _max_paths) {
+      if (next_worst_slack && pending_paths.begin()->_path.get_slack() >
+                                  next_worst_slack.value()) {
+        break;
+      }
+      auto path_node = pending_paths.extract(pending_paths.begin());
+      write_path(std::move(path_node.value()._path));
+      ++path_num;
+    }
+  };
+
+  unsigned num_threads = std::max(_num_threads, 1U);
+  ThreadPool pool(num_threads);
+  std::size_t round_size = num_threads * c_k_path_ends_per_thread;
+  for (std::size_t begin = 0; begin < path_ends.size() && path_num < _max_paths;
+       begin += round_size) {
+    if (_max_slack && path_ends[begin]._worst_slack > _max_slack.value()) {
+      break;
+    }
+
+    std::size_t end = std::min(begin + round_size, path_ends.size());
+    std::vector<std::future<std::vector<StaKPath>>> futures;
+    futures.reserve(end - begin);
+    for (std::size_t i = begin; i < end; ++i) {
+      futures.emplace_back(pool.enqueue([this, i, &path_ends]() {
+        return enumeratePathEnd(path_ends[i]._seq_path_datas);
+      }));
+    }
+
+    for (std::size_t i = begin; i < end; ++i) {
+      auto end_paths = futures[i - begin].get();
+      for (std::size_t rank = 0; rank < end_paths.size(); ++rank) {
+        add_pending_path(GroupPath{std::move(end_paths[rank]), i, rank});
+      }
+    }
+
+    write_pending_paths(end < path_ends.size()
+                            ? std::optional<int64_t>(path_ends[end]._worst_slack)
+                            : std::nullopt);
+  }
+  write_pending_paths(std::nullopt);
+
+  return path_num;
+}
+
+}  // namespace ista
@@ -0,0 +1,304 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of
+// Sciences Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan
+// PSL v2. You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY
+// KIND, EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// NON-INFRINGEMENT, MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+/**
+ * @file StaKWorstPath.hh
+ * @brief The k worst timing path enumeration of the endpoints, the path is
+ * enumerated by deviation from the worst path of the endpoint.
+ */
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "StaPathData.hh"
+
+namespace ista {
+
+class StaArc;
+class StaVertex;
+
+/**
+ * @brief The report format of the k worst path.
+ *
+ */
+enum class StaKPathFormat : int { kText = 0, kJson = 1, kYaml = 2 };
+
+constexpr std::size_t c_k_path_max_candidates =
+    100000;  //!< The default candidate path cap of one endpoint.
+constexpr std::size_t c_k_path_ends_per_thread =
+    4;  //!< The endpoints enumerated by one thread in a merge round.
+
+/**
+ * @brief The path leave the parent path at the data _at, and go to the fanin
+ * data _to through the snk arc of _at.
+ *
+ */
+class StaPathDeviation {
+ public:
+  StaPathDeviation(StaPathDelayData* at, StaPathDelayData* to, StaArc* arc,
+                   int64_t incr_arrive_time)
+      : _at(at), _to(to), _arc(arc), _incr_arrive_time(incr_arrive_time) {}
+  ~StaPathDeviation() = default;
+
+  [[nodiscard]] StaPathDelayData* get_at() const { return _at; }
+  [[nodiscard]] StaPathDelayData* get_to() const { return _to; }
+  [[nodiscard]] StaArc* get_arc() const { return _arc; }
+  [[nodiscard]] int64_t get_incr_arrive_time() const {
+    return _incr_arrive_time;
+  }
+
+ private:
+  StaPathDelayData* _at;      //!< The data on the parent path.
+  StaPathDelayData* _to;      //!< The fanin data of the new path.
+  StaArc* _arc;               //!< The arc from _to to _at.
+  int64_t _incr_arrive_time;  //!< The data arrive time change at _at, unit fs.
+};
+
+/**
+ * @brief The point of the k worst path.
+ *
+ */
+class StaKPathPoint {
+ public:
+  StaKPathPoint(StaVertex* own_vertex, TransType trans_type,
+                int64_t arrive_time, int64_t incr_time)
+      : _own_vertex(own_vertex),
+        _trans_type(trans_type),
+        _arrive_time(arrive_time),
+        _incr_time(incr_time) {}
+  ~StaKPathPoint() = default;
+
+  [[nodiscard]] StaVertex* get_own_vertex() const { return _own_vertex; }
+  [[nodiscard]] TransType get_trans_type() const { return _trans_type; }
+  [[nodiscard]] int64_t get_arrive_time() const { return _arrive_time; }
+  [[nodiscard]] int64_t get_incr_time() const { return _incr_time; }
+
+ private:
+  StaVertex* _own_vertex;
+  TransType _trans_type;
+  int64_t _arrive_time;  //!< The arrive time include launch clock, unit fs.
+  int64_t _incr_time;    //!< The delay from the last point, unit fs.
+};
+
+/**
+ * @brief The k worst path, which is the worst path of the endpoint with a list
+ * of deviation, the path points are only generated when reported, so the
+ * enumeration memory is bounded by the deviation list.
+ *
+ */
+class StaKPath {
+ public:
+  StaKPath(StaSeqPathData* seq_path_data, int64_t arrive_time,
+           int64_t require_time)
+      : _seq_path_data(seq_path_data),
+        _arrive_time(arrive_time),
+        _require_time(require_time) {}
+  ~StaKPath() = default;
+  StaKPath(const StaKPath& orig) = default;
+  StaKPath& operator=(const StaKPath& rhs) = default;
+  StaKPath(StaKPath&& other) noexcept = default;
+  StaKPath& operator=(StaKPath&& rhs) noexcept = default;
+
+  [[nodiscard]] StaSeqPathData* get_seq_path_data() const {
+    return _seq_path_data;
+  }
+  [[nodiscard]] int64_t get_arrive_time() const { return _arrive_time; }
+  [[nodiscard]] int64_t get_require_time() const { return _require_time; }
+  void set_arrive_time(int64_t arrive_time) { _arrive_time = arrive_time; }
+  void set_require_time(int64_t require_time) { _require_time = require_time; }
+  [[nodiscard]] int64_t get_slack() const {
+    return _seq_path_data->getDelayType() == AnalysisMode::kMax
+               ? _require_time - _arrive_time
+               : _arrive_time - _require_time;
+  }
+
+  void addDeviation(StaPathDeviation&& deviation) {
+    _deviations.emplace_back(std::move(deviation));
+  }
+  auto& get_deviations() const { return _deviations; }
+
+  StaPathDelayData* getExpandStartData() const;
+  StaClockData* getLaunchClockData() const;
+  std::vector<StaKPathPoint> getPathPoints() const;
+
+ private:
+  StaSeqPathData* _seq_path_data;  //!< The worst path of the endpoint.
+  std::vector<StaPathDeviation>
+      _deviations;        //!< The deviation from the endpoint to the start.
+  int64_t _arrive_time;   //!< The data arrive time of the endpoint, unit fs.
+  int64_t _require_time;  //!< The require time with the cppr of the path
+                          //!< launch clock, unit fs.
+};
+
+/**
+ * @brief The k worst path writer base class, the path is written once it is
+ * generated.
+ *
+ */
+class StaKPathWriter {
+ public:
+  explicit StaKPathWriter(const char* rpt_file_name);
+  virtual ~StaKPathWriter();
+
+  [[nodiscard]] bool isOpen() const { return _fp != nullptr; }
+  [[nodiscard]] unsigned get_significant_digits() const {
+    return _significant_digits;
+  }
+  void set_significant_digits(unsigned significant_digits) {
+    _significant_digits = significant_digits;
+  }
+
+  virtual unsigned writeHead() { return 1; }
+  virtual unsigned writePath(const StaKPath& path, unsigned path_id) = 0;
+  virtual unsigned writeTail() { return 1; }
+
+  static std::unique_ptr<StaKPathWriter> createWriter(
+      const char* rpt_file_name, StaKPathFormat format);
+
+ protected:
+  std::FILE* _fp;
+  unsigned _significant_digits = 3;  //!< The significant digits.
+};
+
+/**
+ * @brief Write the k worst path in text table.
+ *
+ */
+class StaKPathTextWriter : public StaKPathWriter {
+ public:
+  explicit StaKPathTextWriter(const char* rpt_file_name)
+      : StaKPathWriter(rpt_file_name) {}
+  ~StaKPathTextWriter() override = default;
+
+  unsigned writeHead() override;
+  unsigned writePath(const StaKPath& path, unsigned path_id) override;
+};
+
+/**
+ * @brief Write the k worst path in json array, one path one object.
+ *
+ */
+class StaKPathJsonWriter : public StaKPathWriter {
+ public:
+  explicit StaKPathJsonWriter(const char* rpt_file_name)
+      : StaKPathWriter(rpt_file_name) {}
+  ~StaKPathJsonWriter() override = default;
+
+  unsigned writeHead() override;
+  unsigned writePath(const StaKPath& path, unsigned path_id) override;
+  unsigned writeTail() override;
+
+ private:
+  bool _is_first_path = true;
+};
+
+/**
+ * @brief Write the k worst path in yaml stream, one path one document.
+ *
+ */
+class StaKPathYamlWriter : public StaKPathWriter {
+ public:
+  explicit StaKPathYamlWriter(const char* rpt_file_name)
+      : StaKPathWriter(rpt_file_name) {}
+  ~StaKPathYamlWriter() override = default;
+
+  unsigned writePath(const StaKPath& path, unsigned path_id) override;
+};
+
+/**
+ * @brief Enumerate the k worst path of the path group, the endpoints are
+ * enumerated in parallel in the order of their worst slack, each endpoint keep
+ * at most n_worst path, and the group write at most max_paths path. A merged
+ * path is written once no endpoint left could have a worse path. When the
+ * report spec has through points, only the path through a point of every
+ * through list is kept, and the candidate paths of one endpoint are capped by
+ * max_candidates.
+ *
+ */
+class StaKWorstPath {
+ public:
+  StaKWorstPath(AnalysisMode analysis_mode, unsigned n_worst,
+                unsigned max_paths, unsigned num_threads);
+  ~StaKWorstPath() = default;
+
+  [[nodiscard]] AnalysisMode get_analysis_mode() const {
+    return _analysis_mode;
+  }
+  [[nodiscard]] unsigned get_n_worst() const { return _n_worst; }
+  [[nodiscard]] unsigned get_max_paths() const { return _max_paths; }
+
+  void set_max_slack(int64_t max_slack) { _max_slack = max_slack; }
+  auto& get_max_slack() const { return _max_slack; }
+
+  void set_max_candidates(std::size_t max_candidates) {
+    _max_candidates = std::max<std::size_t>(max_candidates, 1);
+  }
+  [[nodiscard]] std::size_t get_max_candidates() const {
+    return _max_candidates;
+  }
+  [[nodiscard]] bool is_candidates_capped() const {
+    return _is_candidates_capped;
+  }
+
+  void set_through_vertexes(
+      std::vector<std::set<StaVertex*>>&& through_vertexes) {
+    _through_vertexes = std::move(through_vertexes);
+  }
+  auto& get_through_vertexes() const { return _through_vertexes; }
+
+  std::vector<StaKPath> enumeratePathEnd(
+      const std::vector<StaSeqPathData*>& seq_path_datas);
+  unsigned operator()(StaSeqPathGroup* seq_path_group,
+                      const std::function<void(StaKPath&&)>& write_path);
+
+ private:
+  using RequireTimeCache =
+      std::map<std::pair<StaSeqPathData*, StaClockData*>, int64_t>;
+
+  bool isFaninData(StaArc* snk_arc, StaData* src_data,
+                   StaPathDelayData* snk_data);
+  bool isThroughPath(const StaKPath& path);
+  int64_t getRequireTime(StaSeqPathData* seq_path_data,
+                         StaClockData* launch_clock_data,
+                         RequireTimeCache& require_times);
+  void expandPath(const StaKPath& path, RequireTimeCache& require_times,
+                  const std::function<void(StaKPath&&)>& add_path);
+
+  AnalysisMode _analysis_mode;  //!< The max/min analysis mode.
+  unsigned _n_worst;            //!< The path num per endpoint.
+  unsigned _max_paths;          //!< The path num per path group, 0 is no limit.
+  unsigned _num_threads;
+  std::optional<int64_t>
+      _max_slack;  //!< The path slack larger than it is not reported.
+  std::vector<std::set<StaVertex*>>
+      _through_vertexes;  //!< The path should pass every through list.
+  std::size_t _max_candidates =
+      c_k_path_max_candidates;  //!< The candidate and popped path num cap of
+                                //!< one endpoint with through filter.
+  std::atomic<bool> _is_candidates_capped =
+      false;  //!< Whether some endpoint hit the candidate cap.
+};
+
+}  // namespace ista
@@ -186,12 +186,15 @@ class StaVertex {
 
   unsigned is_const() const { return _is_const; }
   void set_is_const() { _is_const = 1; }
+  void reset_is_const() { _is_const = 0; }
 
   unsigned is_const_vdd() const { return _is_const_vdd; }
   void set_is_const_vdd() { _is_const_vdd = 1; }
+  void reset_is_const_vdd() { _is_const_vdd = 0; }
 
   unsigned is_const_gnd() const { return _is_const_gnd; }
   void set_is_const_gnd() { _is_const_gnd = 1; }
+  void reset_is_const_gnd() { _is_const_gnd = 0; }
 
   unsigned is_slew_prop() const { return _is_slew_prop; }
   void set_is_slew_prop() { _is_slew_prop = 1; }
@@ -18,12 +18,14 @@
 #include <Eigen/Core>
 #include <Eigen/Dense>
 #include <iostream>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "Type.hh"
 #include "delay/ElmoreDelayCalc.hh"
+#include "delay/Reduce.hh"
 #include "delay/ReduceDelayCal.hh"
 #include "gtest/gtest.h"
 #include "liberty/Lib.hh"
@@ -42,6 +44,7 @@ using ista::NetIterator;
 using ista::Netlist;
 using ista::NetPinIterator;
 using ista::RcNet;
+using ista::SparseArnoldiROM;
 using ista::Sta;
 
 namespace {
@@ -55,4 +58,153 @@ class ArnoldiCal : public testing::Test {
   void TearDown() { Log::end(); }
 };
 
+TEST_F(ArnoldiCal, sparse_prima_match_moment) {
+  // floating rc chain, node 0 is the driver.
+  const int node_num = 200;
+  const double res = 10.0;
+  const double cap = 1e-15;
+  std::vector<Eigen::Triplet<double>> triplets;
+  for (int i = 0; i + 1 < node_num; ++i) {
+    triplets.emplace_back(i, i, 1 / res);
+    triplets.emplace_back(i + 1, i + 1, 1 / res);
+    triplets.emplace_back(i, i + 1, -1 / res);
+    triplets.emplace_back(i + 1, i, -1 / res);
+  }
+  Eigen::SparseMatrix<double> G(node_num, node_num);
+  G.setFromTriplets(triplets.begin(), triplets.end());
+  Eigen::VectorXd C = Eigen::VectorXd::Constant(node_num, cap);
+  Eigen::VectorXd B = Eigen::VectorXd::Zero(node_num);
+  B(0) = 1.0;
+
+  double s0 = 1e9;
+  SparseArnoldiROM arnoldi_rom(G, C);
+  EXPECT_TRUE(arnoldi_rom.factorize(s0));
+  auto basis = arnoldi_rom.orthogonalBasis(B, 8);
+  EXPECT_TRUE(basis);
+
+  auto& V = *basis;
+  Eigen::MatrixXd identity = V.transpose() * V;
+  EXPECT_TRUE(identity.isIdentity(1e-8));
+
+  // the reduced transfer function match the origin at s0.
+  Eigen::MatrixXd G_rom = arnoldi_rom.GTrans(V);
+  Eigen::MatrixXd C_rom = arnoldi_rom.CTrans(V);
+  Eigen::VectorXd B_rom = V.transpose() * B;
+  Eigen::VectorXd L = Eigen::VectorXd::Zero(node_num);
+  L(node_num - 1) = 1.0;
+  Eigen::VectorXd L_rom = V.transpose() * L;
+
+  Eigen::SparseMatrix<double> shift_matrix = G;
+  for (int i = 0; i < node_num; ++i) {
+    shift_matrix.coeffRef(i, i) += s0 * cap;
+  }
+  Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> solver(shift_matrix);
+  double origin_h = L.dot(solver.solve(B));
+  double reduce_h = L_rom.dot((G_rom + s0 * C_rom).lu().solve(B_rom));
+  EXPECT_NEAR(origin_h, reduce_h, 1e-6 * std::abs(origin_h));
+}
+
+TEST_F(ArnoldiCal, reduce_match_dense) {
+  // rc chain with a side branch, node 0 is the driver, the total cap is
+  // charged to 1V by a 1.5ns current pulse.
+  const int chain_num = 100;
+  const int branch_num = 30;
+  const double res = 5.0;
+  const double cap = 0.01;  // pF
+  auto make_net = [&](bool is_reduce_enable) {
+    auto arnoldi_net = std::make_unique<ArnoldiNet>(nullptr);
+    arnoldi_net->set_is_reduce_enable(is_reduce_enable);
+    arnoldi_net->makeRct();
+    auto* rct = arnoldi_net->rct();
+    rct->set_root(rct->insertNode("n0", cap));
+    for (int i = 1; i < chain_num; ++i) {
+      rct->insertNode("n" + std::to_string(i), cap);
+      rct->insertSegment("n" + std::to_string(i - 1), "n" + std::to_string(i),
+                         res);
+    }
+    std::string last_node = "n" + std::to_string(chain_num / 2);
+    for (int i = 0; i < branch_num; ++i) {
+      std::string node = "b" + std::to_string(i);
+      rct->insertNode(node, cap);
+      rct->insertSegment(last_node, node, res);
+      last_node = node;
+    }
+    arnoldi_net->assignRcNodeID();
+    return arnoldi_net;
+  };
+
+  const double total_cap = (chain_num + branch_num) * cap * 1e-12;
+  const double pulse_time = 1.5;  // ns
+  auto get_current = [total_cap, pulse_time](double start_time,
+                                             double end_time,
+                                             int num_sim_point) {
+    double step_time = (end_time - start_time) / (num_sim_point - 1);
+    double current = total_cap / (pulse_time * 1e-9) * 1e3;  // mA
+    std::vector<double> currents;
+    for (int i = 0; i < num_sim_point; ++i) {
+      currents.push_back(start_time + i * step_time < pulse_time ? current
+                                                                  : 0.0);
+    }
+    return currents;
+  };
+
+  const double start_time = 0.0;
+  const double end_time = 4.0;
+  const int num_sim_point = 200;
+  const double step_time = (end_time - start_time) / (num_sim_point - 1);
+  auto cross_time = [step_time](const Eigen::VectorXd& waveform,
+                                double threshold) {
+    for (int i = 1; i < waveform.size(); ++i) {
+      if (waveform(i) >= threshold) {
+        return (i - 1 + (threshold - waveform(i - 1)) /
+                            (waveform(i) - waveform(i - 1))) *
+               step_time;
+      }
+    }
+    return -1.0;
+  };
+
+  auto dense_net = make_net(false);
+  auto reduce_net = make_net(true);
+  Eigen::MatrixXd dense_V = dense_net->calcDelayAndSlew(
+      get_current, start_time, end_time, num_sim_point,
+      ista::AnalysisMode::kMax, ista::TransType::kRise);
+  Eigen::MatrixXd reduce_V = reduce_net->calcDelayAndSlew(
+      get_current, start_time, end_time, num_sim_point,
+      ista::AnalysisMode::kMax, ista::TransType::kRise);
+  EXPECT_FALSE(dense_net->isReduce());
+  EXPECT_TRUE(reduce_net->isReduce());
+  ASSERT_EQ(dense_V.rows(), reduce_V.rows());
+
+  // the delay from the driver and the slew of every load agree within 2%.
+  for (auto load_id : {chain_num - 1, chain_num + branch_num - 1}) {
+    Eigen::VectorXd dense_driver = dense_V.row(0);
+    Eigen::VectorXd reduce_driver = reduce_V.row(0);
+    Eigen::VectorXd dense_load = dense_V.row(load_id);
+    Eigen::VectorXd reduce_load = reduce_V.row(load_id);
+
+    double dense_delay =
+        cross_time(dense_load, 0.5) - cross_time(dense_driver, 0.5);
+    double reduce_delay =
+        cross_time(reduce_load, 0.5) - cross_time(reduce_driver, 0.5);
+    double dense_slew =
+        cross_time(dense_load, 0.8) - cross_time(dense_load, 0.2);
+    double reduce_slew =
+        cross_time(reduce_load, 0.8) - cross_time(reduce_load, 0.2);
+
+    EXPECT_GT(dense_delay, 0.0);
+    EXPECT_GT(dense_slew, 0.0);
+    EXPECT_NEAR(reduce_delay, dense_delay, 0.02 * dense_delay);
+    EXPECT_NEAR(reduce_slew, dense_slew, 0.02 * dense_slew);
+  }
+
+  // the zero simulation window does not divide by zero, the net is simulated
+  // unreduced.
+  auto empty_window_net = make_net(true);
+  empty_window_net->calcDelayAndSlew(get_current, start_time, start_time,
+                                     num_sim_point, ista::AnalysisMode::kMax,
+                                     ista::TransType::kRise);
+  EXPECT_FALSE(empty_window_net->isReduce());
+}
+
 }  // namespace
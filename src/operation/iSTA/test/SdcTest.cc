@@ -17,6 +17,8 @@
 #include "gtest/gtest.h"
 #include "liberty/Lib.hh"
 #include "log/Log.hh"
+#include "netlist/Netlist.hh"
+#include "netlist/NetlistPattern.hh"
 #include "sdc-cmd/Cmd.hh"
 #include "sta/Sta.hh"
 #include "sta/StaApplySdc.hh"
@@ -231,4 +233,98 @@ TEST_F(SdcTest, zx_test) {
       R"(set_min_delay 1.0 -from [get_ports clk1] -to [get_ports out])");
 }
 
+TEST(SdcPatternTest, find_port_pattern) {
+  Netlist nl;
+  nl.addPort(Port("clk1", PortDir::kIn));
+  nl.addPort(Port("data_in[0]", PortDir::kIn));
+  nl.addPort(Port("data_in[1]", PortDir::kIn));
+  nl.addPort(Port("data_out", PortDir::kOut));
+
+  EXPECT_EQ(nl.findPort("clk1", false, false).size(), 1);
+  EXPECT_EQ(nl.findPort("data_in*", false, false).size(), 2);
+  EXPECT_EQ(nl.findPort("data_???", false, false).size(), 1);
+  EXPECT_EQ(nl.findPort("DATA*", false, true).size(), 3);
+  EXPECT_EQ(nl.findPort("data_in\\[[0-9]\\]", true, false).size(), 2);
+
+  // the memo is reset when the netlist is changed.
+  nl.addPort(Port("data_in[2]", PortDir::kIn));
+  EXPECT_EQ(nl.findPort("data_in*", false, false).size(), 3);
+}
+
+TEST(SdcPatternTest, find_instance_pattern) {
+  Netlist nl;
+  for (const char* instance_name : {"u_core/reg_0", "u_core/reg_1",
+                                    "u_core/REG_10", "u_io/buf_0"}) {
+    nl.addInstance(Instance(instance_name, nullptr));
+  }
+
+  EXPECT_EQ(nl.findInstance("u_io/buf_0", false, false).size(), 1);
+  EXPECT_EQ(nl.findInstance("u_core/*", false, false).size(), 3);
+  EXPECT_EQ(nl.findInstance("u_core/reg_?", false, false).size(), 2);
+  EXPECT_EQ(nl.findInstance("U_CORE/REG_*", false, true).size(), 3);
+  EXPECT_EQ(nl.findInstance("u_core/reg_[0-9]+", true, false).size(), 2);
+  EXPECT_EQ(nl.findInstance("u_.*/(reg|buf)_0", true, false).size(), 2);
+  EXPECT_EQ(nl.findInstance("u_.*/reg_1.*", true, true).size(), 2);
+  EXPECT_TRUE(nl.findInstance("u_mem/*", false, false).empty());
+
+  nl.addInstance(Instance("u_core/reg_2", nullptr));
+  EXPECT_EQ(nl.findInstance("u_core/reg_?", false, false).size(), 3);
+}
+
+TEST(SdcPatternTest, find_pin_pattern) {
+  Netlist nl;
+  for (const char* instance_name : {"u_core/reg_0", "u_core/reg_1", "u_io"}) {
+    auto& instance = nl.addInstance(Instance(instance_name, nullptr));
+    for (const char* pin_name : {"D", "Q", "QN", "CK"}) {
+      instance.addPin(pin_name, nullptr);
+    }
+  }
+
+  EXPECT_EQ(nl.findPin("u_io:Q", false, false).size(), 1);
+  EXPECT_EQ(nl.findPin("u_core/reg_0/*", false, false).size(), 4);
+  EXPECT_EQ(nl.findPin("u_core/reg_?/Q*", false, false).size(), 4);
+  EXPECT_EQ(nl.findPin("*/Q", false, false).size(), 3);
+  EXPECT_EQ(nl.findPin("u_io/?", false, false).size(), 2);
+  EXPECT_EQ(nl.findPin("U_CORE/REG_1/ck", false, true).size(), 1);
+  EXPECT_EQ(nl.findPin("u_core/reg_[01]/QN", true, false).size(), 2);
+  EXPECT_EQ(nl.findPin("u_io/(D|CK)", true, false).size(), 2);
+  EXPECT_EQ(nl.findPin("u_core/reg_0/q.*", true, true).size(), 2);
+  EXPECT_TRUE(nl.findPin("u_mem/*", false, false).empty());
+}
+
+TEST(SdcPatternTest, pattern_memo_bound) {
+  NetlistPatternCache pattern_cache;
+  std::vector<DesignObject*> match_objs(16, nullptr);
+  int match_num = 0;
+  auto match_func = [&match_objs, &match_num]() {
+    ++match_num;
+    return match_objs;
+  };
+
+  pattern_cache.findOrMatch("port", "a*", false, false, match_func);
+  pattern_cache.findOrMatch("port", "a*", false, false, match_func);
+  EXPECT_EQ(match_num, 1);
+
+  for (std::size_t i = 0; i < 2 * NetlistPatternCache::c_max_memo_pattern_num;
+       ++i) {
+    auto pattern = "p" + std::to_string(i) + "*";
+    pattern_cache.findOrMatch("port", pattern.c_str(), false, false,
+                              match_func);
+  }
+  EXPECT_EQ(pattern_cache.get_memo_pattern_num(),
+            NetlistPatternCache::c_max_memo_pattern_num);
+  EXPECT_EQ(pattern_cache.get_memo_obj_num(),
+            NetlistPatternCache::c_max_memo_pattern_num * match_objs.size());
+
+  // the earliest pattern is evicted and matched again.
+  pattern_cache.findOrMatch("port", "a*", false, false, match_func);
+  EXPECT_EQ(match_num, 2 + 2 * NetlistPatternCache::c_max_memo_pattern_num);
+
+  // the too large result is not memoized.
+  match_objs.resize(NetlistPatternCache::c_max_memo_obj_num + 1);
+  pattern_cache.findOrMatch("port", "b*", false, false, match_func);
+  EXPECT_LE(pattern_cache.get_memo_obj_num(),
+            NetlistPatternCache::c_max_memo_obj_num);
+}
+
 }  // namespace
\ No newline at end of file
@@ -14,11 +14,18 @@
 //
 // See the Mulan PSL v2 for more details.
 // ***************************************************************************************
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
 #include <iostream>
+#include <string>
+#include <vector>
 
 #include "api/TimingEngine.hh"
 #include "api/TimingIDBAdapter.hh"
 #include "gtest/gtest.h"
+#include "json/json.hpp"
 #include "liberty/Lib.hh"
 #include "log/Log.hh"
 #include "netlist/Netlist.hh"
@@ -34,6 +41,7 @@
 #include "sta/StaDump.hh"
 #include "sta/StaGraph.hh"
 #include "sta/StaSlewPropagation.hh"
+#include "string/Str.hh"
 #include "tcl/ScriptEngine.hh"
 #include "usage/usage.hh"
 
@@ -116,4 +124,368 @@ TEST_F(StaTest, read_error_file) {
   }
 }
 
+/**
+ * @brief The netlist converted from the db and the graph built by multi thread
+ * should be the same with the single thread and the serial build. The design is
+ * given by ISTA_TEST_LIB, ISTA_TEST_LEF(separated by ',') and ISTA_TEST_DEF.
+ *
+ */
+TEST_F(StaTest, parallel_build_match_serial) {
+  const char* lib_file = std::getenv("ISTA_TEST_LIB");
+  const char* lef_files = std::getenv("ISTA_TEST_LEF");
+  const char* def_file = std::getenv("ISTA_TEST_DEF");
+  if (!lib_file || !lef_files || !def_file) {
+    GTEST_SKIP() << "ISTA_TEST_LIB, ISTA_TEST_LEF or ISTA_TEST_DEF is not set.";
+  }
+
+  idb::IdbBuilder idb_builder;
+  auto lef_file_list = Str::split(lef_files, ",");
+  idb_builder.buildLef(lef_file_list);
+  idb_builder.buildDef(def_file);
+
+  Sta* ista = Sta::getOrCreateSta();
+  ista->readLiberty(lib_file);
+
+  // the netlist in order, include the inst pin and the net pin.
+  auto dump_netlist = [](Netlist* nl) {
+    std::vector<std::string> netlist_objs;
+    Instance* inst;
+    FOREACH_INSTANCE(nl, inst) {
+      netlist_objs.emplace_back(inst->getFullName() + " " +
+                                inst->get_inst_cell()->get_cell_name());
+      Pin* pin;
+      FOREACH_INSTANCE_PIN(inst, pin) {
+        netlist_objs.emplace_back(pin->getFullName());
+      }
+    }
+
+    Net* net;
+    FOREACH_NET(nl, net) {
+      netlist_objs.emplace_back(net->getFullName());
+      DesignObject* pin_port;
+      FOREACH_NET_PIN(net, pin_port) {
+        netlist_objs.emplace_back(pin_port->getFullName());
+      }
+    }
+    return netlist_objs;
+  };
+
+  // the graph vertex and arc in order, that decide the vertex and arc id.
+  auto dump_graph = [](StaGraph& the_graph) {
+    std::vector<std::string> graph_objs;
+    for (auto& the_vertex : the_graph.get_vertexes()) {
+      graph_objs.emplace_back(the_vertex->getName());
+    }
+    for (auto& the_arc : the_graph.get_arcs()) {
+      graph_objs.emplace_back(the_arc->get_src()->getName() + " -> " +
+                              the_arc->get_snk()->getName() +
+                              (the_arc->isNetArc() ? " net" : " inst"));
+    }
+    graph_objs.emplace_back(
+        std::to_string(the_graph.get_start_vertexes().size()) + " " +
+        std::to_string(the_graph.get_end_vertexes().size()) + " " +
+        std::to_string(the_graph.get_const_vertexes().size()));
+    return graph_objs;
+  };
+
+  auto build_netlist = [ista, &idb_builder](unsigned num_threads) {
+    ista->set_num_threads(num_threads);
+    TimingIDBAdapter db_adapter(ista);
+    db_adapter.set_idb(&idb_builder);
+    db_adapter.convertDBToTimingNetlist(true);
+  };
+
+  build_netlist(1);
+  auto serial_netlist = dump_netlist(ista->get_netlist());
+
+  // build the graph by object one by one.
+  std::vector<std::string> serial_graph_objs;
+  {
+    StaGraph serial_graph(ista->get_netlist());
+    StaBuildGraph build_graph;
+    Netlist* nl = ista->get_netlist();
+    Port* port;
+    FOREACH_PORT(nl, port) { build_graph.buildPort(&serial_graph, port); }
+    Instance* inst;
+    FOREACH_INSTANCE(nl, inst) { build_graph.buildInst(&serial_graph, inst); }
+    Net* net;
+    FOREACH_NET(nl, net) { build_graph.buildNet(&serial_graph, net); }
+    FOREACH_INSTANCE(nl, inst) { build_graph.buildConst(&serial_graph, inst); }
+    serial_graph_objs = dump_graph(serial_graph);
+  }
+
+  build_netlist(8);
+  EXPECT_EQ(dump_netlist(ista->get_netlist()), serial_netlist);
+
+  StaGraph parallel_graph(ista->get_netlist());
+  StaBuildGraph build_graph;
+  parallel_graph.exec(build_graph);
+  EXPECT_EQ(dump_graph(parallel_graph), serial_graph_objs);
+  EXPECT_GT(serial_graph_objs.size(), 1);
+}
+
+/**
+ * @brief The small design of the k worst path test, r1 launch to r2 through
+ * the short branch u1 and the long branch u2 u3, and to r3 through u5.
+ *
+ */
+const char* k_path_lib = R"lib(library (k_path_lib) {
+  delay_model : table_lookup;
+  time_unit : "1ns";
+  voltage_unit : "1V";
+  current_unit : "1mA";
+  pulling_resistance_unit : "1kohm";
+  leakage_power_unit : "1nW";
+  capacitive_load_unit (1,pf);
+  nom_process : 1.0;
+  nom_temperature : 25.0;
+  nom_voltage : 1.1;
+  input_threshold_pct_rise : 50;
+  input_threshold_pct_fall : 50;
+  output_threshold_pct_rise : 50;
+  output_threshold_pct_fall : 50;
+  slew_lower_threshold_pct_rise : 20;
+  slew_lower_threshold_pct_fall : 20;
+  slew_upper_threshold_pct_rise : 80;
+  slew_upper_threshold_pct_fall : 80;
+  default_max_transition : 1.0;
+  lu_table_template (delay_template) {
+    variable_1 : input_net_transition;
+    variable_2 : total_output_net_capacitance;
+    index_1 ("0.01, 1.0");
+    index_2 ("0.001, 1.0");
+  }
+  lu_table_template (constraint_template) {
+    variable_1 : related_pin_transition;
+    variable_2 : constrained_pin_transition;
+    index_1 ("0.01, 1.0");
+    index_2 ("0.01, 1.0");
+  }
+  cell (BUF_X1) {
+    area : 1.0;
+    pin (A) {
+      direction : input;
+      capacitance : 0.001;
+    }
+    pin (Z) {
+      direction : output;
+      function : "A";
+      max_capacitance : 1.0;
+      timing () {
+        related_pin : "A";
+        timing_sense : positive_unate;
+        cell_rise (delay_template) { values ("0.1, 0.1", "0.1, 0.1"); }
+        cell_fall (delay_template) { values ("0.08, 0.08", "0.08, 0.08"); }
+        rise_transition (delay_template) { values ("0.02, 0.02", "0.02, 0.02"); }
+        fall_transition (delay_template) { values ("0.02, 0.02", "0.02, 0.02"); }
+      }
+    }
+  }
+  cell (AND2_X1) {
+    area : 1.0;
+    pin (A1) {
+      direction : input;
+      capacitance : 0.001;
+    }
+    pin (A2) {
+      direction : input;
+      capacitance : 0.001;
+    }
+    pin (Z) {
+      direction : output;
+      function : "(A1 & A2)";
+      max_capacitance : 1.0;
+      timing () {
+        related_pin : "A1";
+        timing_sense : positive_unate;
+        cell_rise (delay_template) { values ("0.15, 0.15", "0.15, 0.15"); }
+        cell_fall (delay_template) { values ("0.12, 0.12", "0.12, 0.12"); }
+        rise_transition (delay_template) { values ("0.02, 0.02", "0.02, 0.02"); }
+        fall_transition (delay_template) { values ("0.02, 0.02", "0.02, 0.02"); }
+      }
+      timing () {
+        related_pin : "A2";
+        timing_sense : positive_unate;
+        cell_rise (delay_template) { values ("0.15, 0.15", "0.15, 0.15"); }
+        cell_fall (delay_template) { values ("0.12, 0.12", "0.12, 0.12"); }
+        rise_transition (delay_template) { values ("0.02, 0.02", "0.02, 0.02"); }
+        fall_transition (delay_template) { values ("0.02, 0.02", "0.02, 0.02"); }
+      }
+    }
+  }
+  cell (DFF_X1) {
+    area : 4.0;
+    ff (IQ, IQN) {
+      next_state : "D";
+      clocked_on : "CK";
+    }
+    pin (D) {
+      direction : input;
+      capacitance : 0.001;
+      timing () {
+        related_pin : "CK";
+        timing_type : setup_rising;
+        rise_constraint (constraint_template) { values ("0.05, 0.05", "0.05, 0.05"); }
+        fall_constraint (constraint_template) { values ("0.05, 0.05", "0.05, 0.05"); }
+      }
+      timing () {
+        related_pin : "CK";
+        timing_type : hold_rising;
+        rise_constraint (constraint_template) { values ("0.02, 0.02", "0.02, 0.02"); }
+        fall_constraint (constraint_template) { values ("0.02, 0.02", "0.02, 0.02"); }
+      }
+    }
+    pin (CK) {
+      direction : input;
+      capacitance : 0.001;
+      clock : true;
+    }
+    pin (Q) {
+      direction : output;
+      function : "IQ";
+      max_capacitance : 1.0;
+      timing () {
+        related_pin : "CK";
+        timing_sense : non_unate;
+        timing_type : rising_edge;
+        cell_rise (delay_template) { values ("0.2, 0.2", "0.2, 0.2"); }
+        cell_fall (delay_template) { values ("0.18, 0.18", "0.18, 0.18"); }
+        rise_transition (delay_template) { values ("0.02, 0.02", "0.02, 0.02"); }
+        fall_transition (delay_template) { values ("0.02, 0.02", "0.02, 0.02"); }
+      }
+    }
+  }
+}
+)lib";
+
+const char* k_path_verilog = R"(module k_path (clk, in1, out1);
+  input clk, in1;
+  output out1;
+  wire r1q, n1, n2, n3, n4, n5, r2q;
+  DFF_X1 r1 (.D(in1), .CK(clk), .Q(r1q));
+  BUF_X1 u1 (.A(r1q), .Z(n1));
+  BUF_X1 u2 (.A(r1q), .Z(n2));
+  BUF_X1 u3 (.A(n2), .Z(n3));
+  AND2_X1 u4 (.A1(n1), .A2(n3), .Z(n4));
+  DFF_X1 r2 (.D(n4), .CK(clk), .Q(r2q));
+  BUF_X1 u5 (.A(r1q), .Z(n5));
+  DFF_X1 r3 (.D(n5), .CK(clk), .Q(out1));
+endmodule
+)";
+
+const char* k_path_sdc = R"(create_clock -name clk -period 1 [get_ports clk]
+set_input_delay 0 -clock clk [get_ports in1]
+)";
+
+/**
+ * @brief Read the k worst path json report.
+ */
+std::vector<nlohmann::json> reportKPaths(Sta* ista, const std::string& rpt_file,
+                                         unsigned n_worst, unsigned max_paths) {
+  EXPECT_EQ(ista->reportKWorstPath(rpt_file.c_str(), n_worst, max_paths,
+                                   StaKPathFormat::kJson),
+            1U);
+  std::ifstream rpt_stream(rpt_file);
+  auto paths_json = nlohmann::json::parse(rpt_stream);
+  EXPECT_TRUE(paths_json.is_array());
+  return std::vector<nlohmann::json>(paths_json.begin(), paths_json.end());
+}
+
+TEST_F(StaTest, k_worst_path) {
+  std::string work_space = testing::TempDir();
+  auto write_file = [&work_space](const char* file_name, const char* content) {
+    std::string file_path = work_space + file_name;
+    std::ofstream(file_path) << content;
+    return file_path;
+  };
+  auto lib_file = write_file("k_path.lib", k_path_lib);
+  auto verilog_file = write_file("k_path.v", k_path_verilog);
+  auto sdc_file = write_file("k_path.sdc", k_path_sdc);
+  std::string rpt_file = work_space + "k_path.kpath.json";
+
+  Sta::destroySta();
+  Sta* ista = Sta::getOrCreateSta();
+  ista->set_num_threads(4);
+  ista->set_design_work_space(work_space.c_str());
+  ista->readLiberty(lib_file.c_str());
+  ista->set_top_module_name("k_path");
+  ista->readDesignWithRustParser(verilog_file.c_str());
+  ista->readSdc(sdc_file.c_str());
+  ista->set_analysis_mode(AnalysisMode::kMax);
+  ista->buildGraph();
+  ista->updateTiming();
+
+  auto has_pin = [](const nlohmann::json& path, const std::string& pin_name) {
+    auto& points = path["points"];
+    return std::any_of(points.begin(), points.end(), [&pin_name](auto& point) {
+      return point["pin"] == pin_name;
+    });
+  };
+  auto count_endpoint = [](const std::vector<nlohmann::json>& paths,
+                           const std::string& endpoint) {
+    return std::count_if(paths.begin(), paths.end(), [&endpoint](auto& path) {
+      return path["endpoint"] == endpoint;
+    });
+  };
+
+  // the paths are ordered by slack, r2 has the rise and fall path of both
+  // branches, the long branch is the worst.
+  auto all_paths = reportKPaths(ista, rpt_file, 4, 0);
+  ASSERT_FALSE(all_paths.empty());
+  for (std::size_t i = 0; i < all_paths.size(); ++i) {
+    auto& path = all_paths[i];
+    EXPECT_EQ(path["id"], i + 1);
+    EXPECT_EQ(path["delay_type"], "max");
+    EXPECT_EQ(path["points"].back()["pin"], path["endpoint"]);
+    EXPECT_NEAR(path["slack"].get<double>(),
+                path["require_time"].get<double>() -
+                    path["arrive_time"].get<double>(),
+                1e-6);
+    if (i > 0) {
+      EXPECT_LE(all_paths[i - 1]["slack"].get<double>(),
+                path["slack"].get<double>());
+    }
+  }
+  EXPECT_EQ(count_endpoint(all_paths, "r2:D"), 4);
+  EXPECT_EQ(all_paths.front()["endpoint"], "r2:D");
+  EXPECT_TRUE(has_pin(all_paths.front(), "u3:A"));
+
+  // the endpoint keeps its n worst paths.
+  auto n_worst_paths = reportKPaths(ista, rpt_file, 2, 0);
+  EXPECT_EQ(count_endpoint(n_worst_paths, "r2:D"), 2);
+  for (auto& path : n_worst_paths) {
+    if (path["endpoint"] == "r2:D") {
+      EXPECT_TRUE(has_pin(path, "u3:A"));
+    }
+  }
+
+  // the group keeps its max_paths worst paths.
+  auto max_paths = reportKPaths(ista, rpt_file, 4, 2);
+  ASSERT_EQ(max_paths.size(), 2);
+  for (std::size_t i = 0; i < max_paths.size(); ++i) {
+    EXPECT_EQ(max_paths[i]["endpoint"], all_paths[i]["endpoint"]);
+    EXPECT_EQ(max_paths[i]["slack"], all_paths[i]["slack"]);
+  }
+
+  // only the paths through u1 are kept.
+  ista->setReportSpec({}, {{"u1:A"}}, {});
+  ista->set_k_path_max_candidates(c_k_path_max_candidates);
+  auto through_paths = reportKPaths(ista, rpt_file, 4, 0);
+  EXPECT_EQ(through_paths.size(), 2);
+  for (auto& path : through_paths) {
+    EXPECT_EQ(path["endpoint"], "r2:D");
+    EXPECT_TRUE(has_pin(path, "u1:A"));
+    EXPECT_FALSE(has_pin(path, "u3:A"));
+  }
+
+  // the worst path of r2 is not through u1, the cap stops before the path
+  // through u1 is popped.
+  ista->set_k_path_max_candidates(1);
+  EXPECT_TRUE(reportKPaths(ista, rpt_file, 4, 0).empty());
+
+  ista->get_report_spec().reset();
+  ista->set_k_path_max_candidates(c_k_path_max_candidates);
+  std::remove(rpt_file.c_str());
+}
+
 }  // namespace
\ No newline at end of file
@@ -106,6 +106,11 @@ void ToApi::resetConfigSdc(std::string& path)
   toConfig->set_sdc_file(path);
 }
 
+void ToApi::resetConfigReuseTimingEngine(bool reuse)
+{
+  toConfig->set_reuse_timing_engine(reuse);
+}
+
 void ToApi::reportTiming()
 {
   timingEngine->get_sta_engine()->reportTiming();
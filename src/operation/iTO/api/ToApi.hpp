@@ -65,6 +65,7 @@ class ToApi
 
   void resetConfigLibs(std::vector<std::string>& paths);
   void resetConfigSdc(std::string& path);
+  void resetConfigReuseTimingEngine(bool reuse);
 
   void reportTiming();
 
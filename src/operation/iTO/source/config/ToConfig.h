@@ -86,6 +86,8 @@ class ToConfig {
   void set_setup_buffer_prefix(const string& prefix) { _setup_buffer_prefix = prefix;}
   void set_setup_net_prefix(const string& prefix) { _setup_net_prefix = prefix;}
 
+  void set_reuse_timing_engine(bool reuse) { _reuse_timing_engine = reuse; }
+
   // getter
   const vector<string> &get_lef_files() const { return _lef_files_path; }
   const string         &get_def_file() const { return _def_file_path; }
@@ -125,6 +127,8 @@ class ToConfig {
   string get_setup_buffer_prefix() const { return _setup_buffer_prefix;}
   string get_setup_net_prefix() const { return _setup_net_prefix;}
 
+  bool get_reuse_timing_engine() const { return _reuse_timing_engine; }
+
  private:
   static ToConfig *_instance;
 
@@ -163,6 +167,10 @@ class ToConfig {
   int _min_divide_fanout = 8; // Nets with low fanout don't need to divide loads.
   float _optimize_endpoints_percent = 1.0; // Nets with low fanout don't need to divide loads.
 
+  // reuse the existing timing engine and sync its netlist and graph with the changed idb,
+  // set by the flow when the timing engine is kept between stages.
+  bool _reuse_timing_engine = false;
+
   // output
   string _out_def_path;
   string _report_path;
@@ -17,12 +17,16 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <cassert>
+#include <climits>
 #include <iomanip>
 #include <iostream>
+#include <map>
+#include <mutex>
+#include <optional>
 #include <set>
 #include <vector>
-#include <array>
 
 namespace ito {
 class UsedSpace;
@@ -47,274 +51,190 @@ class UsedSpace {
   }
   ~UsedSpace() = default;
 
-  int begin() { return _begin; }
-  int end() { return _end; }
+  int begin() const { return _begin; }
+  int end() const { return _end; }
 
-  int length() { return _length; }
-
-  bool operator==(UsedSpace *used) {
-    return this->_begin == used->begin() && this->_end == used->end();
-  }
+  int length() const { return _length; }
 
   /**
-   * @brief space "used" inside the space -> true
+   * @brief space [begin, end] inside the space -> true
    */
-  bool isOverlaps(UsedSpace *used) {
-    return this->_begin <= used->begin() && this->_end >= used->end();
-  }
-
-  /**
-   * @brief space "used" inside the space -> true
-   */
-  bool isOverlaps(int begin, int end) {
+  bool isOverlaps(int begin, int end) const {
     return this->_begin <= begin && this->_end >= end;
   }
 
-  bool antiOverlaps(UsedSpace *used) { return used->isOverlaps(this); }
-
-  bool antiOverlaps(int begin, int end) {
-    return this->_begin >= begin && this->_end <= end;
-  }
-
-  /**
-   * @brief space "used" not inside the space, but there is an intersection between them
-   */
-  bool isCross(UsedSpace *used) {
-    if (this->isOverlaps(used)) {
-      return false;
-    }
-    return (used->end() > this->_begin && used->begin() < this->_begin) ||
-           (used->begin() < this->_end && used->end() > this->_end);
-    // return isOverlaps(used->begin(), used->end());
-  }
-
-  /**
-   * @brief space "used" not inside the space, but there is an intersection between them
-   */
-  bool isCross(int begin, int end) {
-    if (this->isOverlaps(begin, end)) {
-      return false;
-    }
-    return (end > this->_begin && begin < this->_begin) ||
-           (begin < this->_end && end > this->_end);
-    //  return (end > this->_begin && end < this->_end) ||
-    //  (begin > this->_begin && begin < this->_end);
-  }
-
  private:
   int _begin = 0;
   int _end = 0;
   int _length = 0;
 };
 
-class CompareSpace {
- public:
-  bool operator()(UsedSpace *u1, UsedSpace *u2) { return u1->begin() < u2->begin(); }
-};
-
+/**
+ * @brief The free segments of one row, the segments are disjoint and indexed by
+ * the begin in a balanced tree, the lengths are kept in a multiset to skip the
+ * row without enough space. The row is locked when updated or searched, so
+ * different threads can insert into the rows at the same time.
+ */
 class RowSpacing {
  public:
   RowSpacing() = default;
   RowSpacing(int begin, int end) : _begin(begin), _end(end) {
-    UsedSpace *unused = new UsedSpace(begin, end);
-    _unused_space.push_back(unused);
+    addFreeSpace(begin, end);
   }
   ~RowSpacing() = default;
 
-  inline void addUsedSpace(UsedSpace *used);
   inline void addUsedSpace(int begin, int end);
+  inline void addUsedSpaceList(vector<pair<int, int>> &used_list);
 
-  inline vector<UsedSpace *> searchFeasiblePlace(int begin, int end, int find_num);
+  inline std::optional<UsedSpace> findNearestFreeSpace(int begin, int length,
+                                                       int site_origin,
+                                                       int site_width);
 
-  void printUsed() {
-    for (auto u : _used_space) {
-      cout << u->begin() << "  " << u->end() << endl;
-    }
+  int get_max_free_length() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _free_lengths.empty() ? 0 : *_free_lengths.rbegin();
+  }
+
+  /**
+   * @brief the free segments [begin, end) sorted by begin.
+   */
+  vector<pair<int, int>> get_free_space_list() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return vector<pair<int, int>>(_free_space.begin(), _free_space.end());
   }
+
   void printUnused() {
+    std::lock_guard<std::mutex> lock(_mutex);
     cout << "unused " << endl;
-    for (auto u : _unused_space) {
-      cout << u->begin() << "  " << u->end() << endl;
+    for (auto &[begin, end] : _free_space) {
+      cout << begin << "  " << end << endl;
     }
   }
 
  private:
-  inline bool isLegalSpace(int expect_space_length, UsedSpace *space,
-                           vector<UsedSpace *> &unused);
-
-  int                 _begin = 0;
-  int                 _end = 0;
-  vector<UsedSpace *> _used_space = {};
-  vector<UsedSpace *> _unused_space = {};
+  inline void addFreeSpace(int begin, int end);
+  inline void removeFreeSpace(std::map<int, int>::iterator iter);
+  inline void carveUsedSpace(int begin, int end);
+
+  int                _begin = 0;
+  int                _end = 0;
+  std::map<int, int> _free_space;    // begin -> end of the free segment
+  std::multiset<int> _free_lengths;  // length of the free segments
+  std::mutex         _mutex;
 };
 
-inline void RowSpacing::addUsedSpace(UsedSpace *used) {
-  _used_space.push_back(used);
-  // change the unused space
-  // case 1:
-  // for (auto unuse : _unused_space) {
-  for (int i = 0; i < (int)_unused_space.size(); i++) {
-    auto unuse = _unused_space[i];
-    if (unuse->isOverlaps(used)) {
-      // 1. remove
-      auto iter = std::remove(_unused_space.begin(), _unused_space.end(), unuse);
-      _unused_space.erase(iter, _unused_space.end());
-
-      if (unuse == used) {
-        break;
-      }
+inline void RowSpacing::addFreeSpace(int begin, int end) {
+  if (end > begin) {
+    _free_space.emplace(begin, end);
+    _free_lengths.insert(end - begin);
+  }
+}
 
-      // 2. update
-      if (unuse->begin() < used->begin()) {
-        UsedSpace *unused1 = new UsedSpace(unuse->begin(), used->begin());
-        // _unused_space.push_back(unused1);
-        _unused_space.insert(std::upper_bound(_unused_space.begin(), _unused_space.end(),
-                                              unused1, CompareSpace()),
-                             unused1);
-      }
-      if (used->end() < unuse->end()) {
-        UsedSpace *unused2 = new UsedSpace(used->end(), unuse->end());
-        // _unused_space.push_back(unused2);
-        _unused_space.insert(std::upper_bound(_unused_space.begin(), _unused_space.end(),
-                                              unused2, CompareSpace()),
-                             unused2);
-      }
-      break;
-    }
-    // case 2:  "usedSpace" occupy multiple "unusedSpaces"
-    else if (unuse->isCross(used)) {
-      auto last_unuse = unuse;
-      int  occupy_num = 0;
-      bool end_point_in_used_space = false;
-      for (int j = 0; j < (int)_unused_space.size() - i; j++) {
-        if (used->end() < _unused_space[i + j]->end()) {
-          last_unuse = _unused_space[i + j];
-          if (used->end() < _unused_space[i + j]->begin()) {
-            end_point_in_used_space = true;
-            occupy_num = j - 1;
-            break;
-          }
-          occupy_num = j;
-          break;
-        }
-      }
+inline void RowSpacing::removeFreeSpace(std::map<int, int>::iterator iter) {
+  _free_lengths.erase(_free_lengths.find(iter->second - iter->first));
+  _free_space.erase(iter);
+}
 
-      // 1. remove
-      for (int earse = 0; earse < occupy_num + 1; earse++) {
-        auto iter =
-            std::remove(_unused_space.begin(), _unused_space.end(), _unused_space[i]);
-        _unused_space.erase(iter, _unused_space.end());
-      }
+/**
+ * @brief remove [begin, end] from the free segments it intersects.
+ */
+inline void RowSpacing::carveUsedSpace(int begin, int end) {
+  if (end <= begin) {
+    return;
+  }
+  auto iter = _free_space.upper_bound(begin);
+  if (iter != _free_space.begin() && std::prev(iter)->second > begin) {
+    --iter;
+  }
 
-      // 2. update
-      if (unuse->begin() < used->begin()) {
-        UsedSpace *unused1 = new UsedSpace(unuse->begin(), used->begin());
-        // _unused_space.push_back(unused1);
-        _unused_space.insert(std::upper_bound(_unused_space.begin(), _unused_space.end(),
-                                              unused1, CompareSpace()),
-                             unused1);
-      }
-      if (used->end() < last_unuse->end() && !end_point_in_used_space) {
-        UsedSpace *unused2 = new UsedSpace(used->end(), last_unuse->end());
-        // _unused_space.push_back(unused2);
-        _unused_space.insert(std::upper_bound(_unused_space.begin(), _unused_space.end(),
-                                              unused2, CompareSpace()),
-                             unused2);
-      }
-      break;
+  while (iter != _free_space.end() && iter->first < end) {
+    auto [free_begin, free_end] = *iter;
+    auto next_iter = std::next(iter);
+    removeFreeSpace(iter);
+    if (free_begin < begin) {
+      addFreeSpace(free_begin, begin);
+    }
+    if (end < free_end) {
+      addFreeSpace(end, free_end);
     }
+    iter = next_iter;
   }
 }
 
 inline void RowSpacing::addUsedSpace(int begin, int end) {
-  UsedSpace *used = new UsedSpace(begin, end);
-  _used_space.push_back(used);
-  addUsedSpace(used);
+  std::lock_guard<std::mutex> lock(_mutex);
+  carveUsedSpace(begin, end);
 }
 
 /**
- * @brief find nearly feasible place
- *
- * @param begin
- * @param end
- * @param find_num The number you want to search
- * @return vector<UsedSpace *>
+ * @brief add a batch of used space, the row is locked once.
  */
-inline vector<UsedSpace *> RowSpacing::searchFeasiblePlace(int begin, int end,
-                                                           int find_num) {
-  assert(end >= begin);
-  sort(_unused_space.begin(), _unused_space.end(),
-       [](UsedSpace *u1, UsedSpace *u2) { return u1->begin() < u2->begin(); });
-
-  int  unused_num = _unused_space.size();
-  int  search_end = _unused_space.size() - 1;
-  int  search_begin = 0;
-  int  search_mid = 0;
-  bool excute = true;
-
-  vector<UsedSpace *> unused;
+inline void RowSpacing::addUsedSpaceList(vector<pair<int, int>> &used_list) {
+  std::sort(used_list.begin(), used_list.end());
+  std::lock_guard<std::mutex> lock(_mutex);
+  for (auto &[begin, end] : used_list) {
+    carveUsedSpace(begin, end);
+  }
+}
 
-  int expect_space_length = abs(end - begin);
-  if (search_end <= 3) {
-    for (auto u : _unused_space) {
-      if (u->length() >= expect_space_length) {
-        unused.push_back(u);
-      }
-    }
-    return unused;
+/**
+ * @brief find the site aligned place of the length nearest to begin in the free
+ * segments, the search goes to both sides of begin and stops when the segment
+ * is farther than the best place.
+ *
+ * @param begin expected begin of the place
+ * @param length
+ * @return the place, std::nullopt if no free segment is long enough.
+ */
+inline std::optional<UsedSpace> RowSpacing::findNearestFreeSpace(
+    int begin, int length, int site_origin, int site_width) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (_free_lengths.empty() || *_free_lengths.rbegin() < length) {
+    return std::nullopt;
   }
 
-  int find_count = 0;
-  while (excute) {
-    search_mid = (search_begin + search_end) / 2;
-    if (_unused_space[search_mid]->begin() <= begin &&
-        _unused_space[search_mid + 1]->begin() >= begin) {
-      excute = false;
-      if (_unused_space[search_mid]->isOverlaps(begin, end)) {
-        unused.push_back(_unused_space[search_mid]);
-        // case
-        return unused;
-      }
-      break;
+  std::optional<UsedSpace> best_place;
+  long long                best_dist = LLONG_MAX;
+  auto try_place = [&](int free_begin, int free_end) {
+    if (free_end - free_begin < length) {
+      return;
     }
-
-    if (_unused_space[search_mid]->begin() > begin) {
-      search_end = search_mid;
-    } else {
-      search_begin = search_mid;
+    int place_x = std::clamp(begin, free_begin, free_end - length);
+    // align with site
+    int site_num = (place_x - site_origin + site_width / 2) / site_width;
+    place_x = site_origin + site_num * site_width;
+    if (place_x < free_begin) {
+      place_x += site_width;
     }
-
-    if (search_begin >= search_end || search_end - search_begin == 1) {
-      break;
+    if (place_x + length > free_end) {
+      place_x -= site_width;
     }
-  }
-
-  int find = 1;
-  while (find_num > find_count) {
-    if (search_mid + find < unused_num) {
-      if (isLegalSpace(expect_space_length, _unused_space[search_mid + find], unused)) {
-        find_count++;
-      }
+    if (place_x < free_begin || place_x + length > free_end) {
+      return;
     }
-    if (search_mid - find >= 0) {
-      if (isLegalSpace(expect_space_length, _unused_space[search_mid - find], unused)) {
-        find_count++;
-      }
+    long long dist = std::abs((long long)place_x - begin);
+    if (dist < best_dist) {
+      best_dist = dist;
+      best_place = UsedSpace(place_x, place_x + length);
     }
-    if (search_mid - find < 0 && search_mid + find >= unused_num) {
+  };
+
+  auto right_iter = _free_space.upper_bound(begin);
+  // left side, including the segment containing begin
+  for (auto left_iter = std::make_reverse_iterator(right_iter);
+       left_iter != _free_space.rend(); ++left_iter) {
+    if ((long long)begin - left_iter->second + length >= best_dist) {
       break;
     }
-    find++;
+    try_place(left_iter->first, left_iter->second);
   }
-  return unused;
-}
-
-inline bool RowSpacing::isLegalSpace(int expect_space_length, UsedSpace *space,
-                                     vector<UsedSpace *> &unused) {
-  if (space->length() >= expect_space_length) {
-    unused.push_back(space);
-    return true;
+  // right side
+  for (; right_iter != _free_space.end(); ++right_iter) {
+    if ((long long)right_iter->first - begin >= best_dist) {
+      break;
+    }
+    try_place(right_iter->first, right_iter->second);
   }
-  return false;
+  return best_place;
 }
-} // namespace ito
\ No newline at end of file
+} // namespace ito
@@ -16,7 +16,10 @@
 // ***************************************************************************************
 #include "data_manager.h"
 
+#include <algorithm>
+
 #include "Reporter.h"
+#include "ThreadPool/ThreadPool.h"
 #include "ToConfig.h"
 #include "Utility.h"
 #include "idm.h"
@@ -89,7 +92,7 @@ int ToDataManager::get_site_height()
   return rows->get_row_list()[0]->get_site()->get_height();
 }
 
-std::vector<RowSpacing*> ToDataManager::init_placer()
+std::vector<RowSpacing*> ToDataManager::init_placer(unsigned num_threads)
 {
   std::vector<RowSpacing*> row_space;
   IdbLayout* idb_layout = dmInst->get_idb_layout();
@@ -108,6 +111,8 @@ std::vector<RowSpacing*> ToDataManager::init_placer()
     row_space.push_back(row_init);
   }
   row_space.resize(row_count);
+  // the used space of each row, they are inserted to the rows in batch.
+  std::vector<std::vector<std::pair<int, int>>> row_used_space(row_count);
 
   // Traverse over all instances and update the each row spacing
   IdbDesign* idb_design = dmInst->get_idb_design();
@@ -135,7 +140,7 @@ std::vector<RowSpacing*> ToDataManager::init_placer()
 
     // update row space
     for (int i = 0; i != occupied_row_num; i++) {
-      row_space[row_index + i]->addUsedSpace(begin, end);
+      row_used_space[row_index + i].emplace_back(begin, end);
     }
   }
 
@@ -179,11 +184,19 @@ std::vector<RowSpacing*> ToDataManager::init_placer()
     // update row space
     for (int i = 0; i != occupied_row_num; i++) {
       if (row_index + i < (int) row_space.size() - 1) {
-        row_space[row_index + i]->addUsedSpace(begin, end);
+        row_used_space[row_index + i].emplace_back(begin, end);
       }
     }
   }
 
+  // the rows are independent, update them concurrently.
+  {
+    ThreadPool pool(std::max(1U, num_threads));
+    for (unsigned i = 0; i < row_count; i++) {
+      pool.enqueue([&row_space, &row_used_space, i]() { row_space[i]->addUsedSpaceList(row_used_space[i]); });
+    }
+  }
+
   return row_space;
 }
 
@@ -68,7 +68,7 @@ class ToDataManager
   }
 
   /// init operation
-  std::vector<RowSpacing*> init_placer();
+  std::vector<RowSpacing*> init_placer(unsigned num_threads);
 
   /// calculate
   double calculateDesignArea(Layout* layout, int dbu);
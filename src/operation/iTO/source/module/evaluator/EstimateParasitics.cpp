@@ -17,6 +17,7 @@
 
 #include "EstimateParasitics.h"
 
+#include "ThreadPool/ThreadPool.h"
 #include "ToConfig.h"
 #include "api/TimingEngine.hh"
 #include "api/TimingIDBAdapter.hh"
@@ -60,15 +61,13 @@ EstimateParasitics::EstimateParasitics()
 void EstimateParasitics::excuteParasiticsEstimate()
 {
   if (_have_estimated_parasitics) {
+    std::vector<Net*> nets;
     for (Net* net : _parasitics_invalid_nets) {
-      DesignObject* driver = net->getDriver();
-      if (driver) {
-        if (timingEngine->get_sta_engine()->get_ista()->getRcNet(net)) {
-          timingEngine->get_sta_engine()->resetRcTree(net);
-        }
-        excuteWireParasitic(net);
+      if (net->getDriver()) {
+        nets.push_back(net);
       }
     }
+    estimateNetsParasitics(nets);
     _parasitics_invalid_nets.clear();
   } else {
     estimateAllNetParasitics();
@@ -83,16 +82,55 @@ void EstimateParasitics::estimateAllNetParasitics()
 {
   LOG_INFO << "estimate all net parasitics start";
   Netlist* design_nl = timingEngine->get_sta_engine()->get_netlist();
+  std::vector<Net*> nets;
   Net* net;
   FOREACH_NET(design_nl, net)
   {
-    estimateNetParasitics(net);
+    nets.push_back(net);
   }
+  estimateNetsParasitics(nets);
   _have_estimated_parasitics = true;
   _parasitics_invalid_nets.clear();
   LOG_INFO << "estimate all net parasitics end";
 }
 
+/**
+ * @brief update rc tree for the nets concurrently. The rc nets are created
+ * serially at first, so each worker only touches the rc tree of its own net.
+ * The flute LUT is read only after Flute::readLUT(), it is shared by workers.
+ *
+ * @param nets
+ */
+void EstimateParasitics::estimateNetsParasitics(const std::vector<Net*>& nets)
+{
+  auto* sta_engine = timingEngine->get_sta_engine();
+  auto* ista = sta_engine->get_ista();
+  for (auto* net : nets) {
+    sta_engine->resetRcTree(net);
+    sta_engine->initRcTree(net);
+  }
+
+  std::vector<char> is_estimated(nets.size(), 0);
+  {
+    ThreadPool pool(std::max(1U, ista->get_num_threads()));
+    for (size_t begin = 0; begin < nets.size(); begin += c_estimate_chunk_net_num) {
+      size_t end = std::min(begin + c_estimate_chunk_net_num, nets.size());
+      pool.enqueue([this, &nets, &is_estimated, begin, end]() {
+        for (size_t i = begin; i < end; ++i) {
+          is_estimated[i] = excuteWireParasitic(nets[i]);
+        }
+      });
+    }
+  }
+
+  // keep the same as before, no rc net for the net without routing tree.
+  for (size_t i = 0; i < nets.size(); ++i) {
+    if (!is_estimated[i]) {
+      sta_engine->resetRcTree(nets[i]);
+    }
+  }
+}
+
 /**
  * @brief update rc for special net
  *
@@ -125,12 +163,13 @@ void EstimateParasitics::estimateInvalidNetParasitics(Net* net, DesignObject* dr
   }
 }
 
-void EstimateParasitics::excuteWireParasitic(Net* curr_net)
+bool EstimateParasitics::excuteWireParasitic(Net* curr_net)
 {
   TreeBuild* tree = new TreeBuild();
   bool make_tree = tree->makeRoutingTree(curr_net, toConfig->get_routing_tree());
   if (!make_tree) {
-    return;
+    delete tree;
+    return false;
   }
   // cout << tree;
 
@@ -150,6 +189,7 @@ void EstimateParasitics::excuteWireParasitic(Net* curr_net)
   timingEngine->get_sta_engine()->updateRCTreeInfo(curr_net);
 
   delete tree;
+  return true;
 }
 
 void EstimateParasitics::updateParastic(Net* curr_net, int index1, int index2, int length_per_wire, TreeBuild* tree)
@@ -204,4 +244,14 @@ void EstimateParasitics::invalidNetRC(Net* net)
   _parasitics_invalid_nets.insert(net);
 }
 
+/**
+ * @brief The rc nets are reset when the timing netlist is converted again, so all the nets are estimated next time.
+ *
+ */
+void EstimateParasitics::invalidAllNetRC()
+{
+  _have_estimated_parasitics = false;
+  _parasitics_invalid_nets.clear();
+}
+
 }  // namespace ito
\ No newline at end of file
@@ -40,8 +40,9 @@ class EstimateParasitics
   void estimateAllNetParasitics();
   void estimateNetParasitics(Net* net);
   void invalidNetRC(Net* net);
+  void invalidAllNetRC();
   void estimateInvalidNetParasitics(Net* net, DesignObject* driver_pin_port);
-  void excuteWireParasitic(Net* curr_net);
+  bool excuteWireParasitic(Net* curr_net);
   std::unordered_set<ista::Net*> get_parasitics_invalid_net() { return _parasitics_invalid_nets; }
 
  private:
@@ -49,9 +50,13 @@ class EstimateParasitics
   bool _have_estimated_parasitics = false;
   std::unordered_set<ista::Net*> _parasitics_invalid_nets;
 
+  static constexpr size_t c_estimate_chunk_net_num = 256;
+
   EstimateParasitics();
   ~EstimateParasitics() = default;
 
+  void estimateNetsParasitics(const std::vector<Net*>& nets);
+
   void RctNodeConnectPins(int index1, RctNode* node1, int index2, RctNode* node2, Net* net, TreeBuild* tree);
   void updateParastic(Net* curr_net, int index1, int index2, int length_per_wire, TreeBuild* tree);
 };
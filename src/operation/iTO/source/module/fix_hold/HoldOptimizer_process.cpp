@@ -40,7 +40,7 @@ void HoldOptimizer::process()
                               << " buffer. \nCurrent worst hold slack is " << worst_timing_slack_hold
                               << "\n>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\n";
     if (number_insert_buffer > 0) {
-      toEvalInst->estimateAllNetParasitics();
+      toEvalInst->excuteParasiticsEstimate();
       timingEngine->get_sta_engine()->updateTiming();
     } else {
       // break optimization iteration if no buffer inserted.
@@ -132,8 +132,7 @@ int HoldOptimizer::performOptimizationProcess()
       break;
     }
 
-    toEvalInst->excuteParasiticsEstimate();
-    timingEngine->get_sta_engine()->updateTiming();
+    timingEngine->incrUpdateRCAndTiming();
 
     exit_vioaltion = checkAndFindVioaltion();
 
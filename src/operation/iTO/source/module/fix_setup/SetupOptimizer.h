@@ -68,7 +68,6 @@ class SetupOptimizer
   int getFanoutNumber(Pin* pin);
   bool netConnectToOutputPort(Net* net);
   bool netConnectToPort(Net* net);
-  void incrUpdateRCAndTiming();
   bool checkSlackDecrease(TOSlack& current_slack, TOSlack& last_slack, int& number_of_decreasing_slack_iter);
 
   // gate sizing function
@@ -83,6 +82,7 @@ class SetupOptimizer
   bool performBufferingIfNecessary(Pin* driver_pin, int fanout);
   // for VG style buffer insertion
   void performVGBuffering(Pin* pin, int& num_insert_buf);
+  BufferedOption* findBestVGSolution(const BufferedOptionSeq& buf_solutions);
   void implementVGSolution(BufferedOption* buf_opt, Net* net);
 
   /// report
@@ -52,21 +52,14 @@ void SetupOptimizer::performVGBuffering(Pin* pin, int& num_insert_buf)
   TreeBuild* tree = new TreeBuild();
   bool make_tree = tree->makeRoutingTree(net, toConfig->get_routing_tree());
   if (!make_tree) {
+    delete tree;
     return;
   }
 
   VGBuffer vg_buffer(_available_lib_cell_sizes);
   BufferedOptionSeq buf_solotions = vg_buffer.VGBuffering(tree);
 
-  TORequired best_slack = -kInf;
-  BufferedOption* best_option = nullptr;
-  for (BufferedOption* opt : buf_solotions) {
-    TOSlack slack = opt->get_required_arrival_time();
-    if (slack > best_slack) {
-      best_slack = slack;
-      best_option = opt;
-    }
-  }
+  BufferedOption* best_option = findBestVGSolution(buf_solotions);
   if (best_option) {
     // for DEBUG
     // best_option->printBuffered(0);
@@ -78,6 +71,20 @@ void SetupOptimizer::performVGBuffering(Pin* pin, int& num_insert_buf)
   delete tree;
 }
 
+BufferedOption* SetupOptimizer::findBestVGSolution(const BufferedOptionSeq& buf_solutions)
+{
+  TORequired best_slack = -kInf;
+  BufferedOption* best_option = nullptr;
+  for (BufferedOption* opt : buf_solutions) {
+    TOSlack slack = opt->get_required_arrival_time();
+    if (slack > best_slack) {
+      best_slack = slack;
+      best_option = opt;
+    }
+  }
+  return best_option;
+}
+
 void SetupOptimizer::implementVGSolution(BufferedOption* buf_opt, Net* net)
 {
   if (!buf_opt) {
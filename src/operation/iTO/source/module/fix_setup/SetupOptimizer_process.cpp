@@ -59,7 +59,7 @@ void SetupOptimizer::optimizeViolationProcess(TOVertexSeq& end_pts_setup_violati
     while (worst_slack < toConfig->get_setup_target_slack()) {
       optimizeSetupViolation(node, true, false);
 
-      incrUpdateRCAndTiming();
+      timingEngine->incrUpdateRCAndTiming();
 
       auto worst_slack_exist = timingEngine->getNodeWorstSlack(node);
       if (worst_slack_exist == std::nullopt) {
@@ -78,22 +78,6 @@ void SetupOptimizer::optimizeViolationProcess(TOVertexSeq& end_pts_setup_violati
   timingEngine->get_sta_engine()->updateTiming();
 }
 
-void SetupOptimizer::incrUpdateRCAndTiming() {
-  auto nets_for_update = toEvalInst->get_parasitics_invalid_net();
-  for (auto net_up : nets_for_update) {
-    auto net_pins = net_up->get_pin_ports();
-    for (auto pin_port : net_pins) {
-      if (pin_port->isPort()) {
-        continue;
-      }
-      auto inst_name = pin_port->get_own_instance()->getFullName();
-      timingEngine->get_sta_engine()->moveInstance(inst_name.c_str(), 20);
-    }
-  }
-  toEvalInst->excuteParasiticsEstimate();
-  timingEngine->get_sta_engine()->incrUpdateTiming();
-}
-
 bool SetupOptimizer::checkSlackDecrease(TOSlack& current_slack, TOSlack& last_slack, int& number_of_decreasing_slack_iter)
 {
   if (approximatelyLessEqual(current_slack, last_slack)) {
@@ -20,6 +20,7 @@
 #include "builder.h"
 #include "data_manager.h"
 #include "idm.h"
+#include "timing_engine.h"
 
 using namespace std;
 
@@ -33,6 +34,9 @@ Placer::Placer()
 
 Placer::~Placer()
 {
+  for (auto* row_space : _row_space) {
+    delete row_space;
+  }
 }
 
 Placer* Placer::get_instance()
@@ -57,10 +61,16 @@ void Placer::destroy_instance()
 
 void Placer::initRow()
 {
-  _row_space = toDmInst->init_placer();
+  // the row space is built by the thread num of the timing engine.
+  auto* sta_engine = timingEngine->get_sta_engine();
+  unsigned num_threads = sta_engine ? sta_engine->get_ista()->get_num_threads() : 1;
+  _row_space = toDmInst->init_placer(num_threads);
   _row_height = toDmInst->get_site_height();
   _site_width = toDmInst->get_site_width();
-  int a = 0;
+
+  for (auto* row : dmInst->get_idb_layout()->get_rows()->get_row_list()) {
+    _y_to_row.emplace(row->get_bounding_box()->get_low_y(), row);
+  }
 }
 
 /**
@@ -76,7 +86,7 @@ std::pair<int, int> Placer::findNearestSpace(unsigned int master_width, int loc_
   // Which "rows" to search for
   int row_idx = (loc_y - toDmInst->get_core().get_y_min()) / _row_height;
 
-  UsedSpace* best_opt = nullptr;
+  std::optional<UsedSpace> best_opt;
   int best_dist = INT_MAX;
   int update_loc_x = loc_x;
   int update_loc_y = loc_y;
@@ -85,9 +95,9 @@ std::pair<int, int> Placer::findNearestSpace(unsigned int master_width, int loc_
   while ((find_row * _row_height) < best_dist && find_row < 40) {
     if (row_idx + find_row < (int) _row_space.size() - 1) {
       auto opt_up = findNearestRowLegalSpace(row_idx + find_row, master_width, loc_x, loc_y);
-      if (opt_up.first && opt_up.second < best_dist) {
-        best_opt = opt_up.first;
-        best_dist = opt_up.second;
+      if (opt_up && opt_up->second < best_dist) {
+        best_opt = opt_up->first;
+        best_dist = opt_up->second;
         update_loc_y = ((row_idx + find_row) * _row_height) + toDmInst->get_core().get_y_min();
       }
     }
@@ -95,9 +105,9 @@ std::pair<int, int> Placer::findNearestSpace(unsigned int master_width, int loc_
     if (row_idx - find_row > 0 && find_row != 0) {
       auto opt_down = findNearestRowLegalSpace(row_idx - find_row, master_width, loc_x, loc_y);
       // Choose the option that moves the least distance
-      if (opt_down.first && opt_down.second < best_dist) {
-        best_opt = opt_down.first;
-        best_dist = opt_down.second;
+      if (opt_down && opt_down->second < best_dist) {
+        best_opt = opt_down->first;
+        best_dist = opt_down->second;
         update_loc_y = ((row_idx - find_row) * _row_height) + toDmInst->get_core().get_y_min();
       }
     }
@@ -115,67 +125,10 @@ std::pair<int, int> Placer::findNearestSpace(unsigned int master_width, int loc_
   return make_pair(update_loc_x, update_loc_y);
 }
 
-std::pair<UsedSpace*, int> Placer::findNearestSpace(std::vector<UsedSpace*> options, int begin, int end, int dis_margin)
-{
-  int best_dist = INT_MAX;
-  UsedSpace* best_opt = nullptr;
-  for (UsedSpace* opt : options) {
-    if (opt->isOverlaps(begin, end)) {
-      // best_opt = new UsedSpace(begin, end);
-      // return make_pair(best_opt, 0 + dis_margin);
-      int placed_x = placeAlignWithSite(UsedSpace(begin, end));
-      int x_dis = abs(placed_x - begin);
-      best_opt = new UsedSpace(placed_x, placed_x + (end - begin));
-      return make_pair(best_opt, x_dis + dis_margin);
-    }
-
-    // since "begin - end" is always less than or equal to opt->length()
-    assert(opt->length() >= end - begin);
-    // int dis;
-    if (begin < opt->begin()) {
-      int dis = opt->begin() - begin;
-      if (dis < best_dist) {
-        best_dist = dis;
-        best_opt = new UsedSpace(opt->begin(), end + dis);
-      }
-    } else {
-      int dis = end - opt->end();
-      if (dis < best_dist) {
-        best_dist = dis;
-        best_opt = new UsedSpace(begin - dis, opt->end());
-      }
-    }
-  }
-  return make_pair(best_opt, best_dist + dis_margin);
-}
-
-int Placer::placeAlignWithSite(UsedSpace option)
-{
-  int begin = option.begin();
-  int core_min_x = toDmInst->get_core().get_x_min();
-  int site_num = (begin - core_min_x) / _site_width;
-  int placed_x1 = (site_num * _site_width) + core_min_x;
-  int placed_x2 = ((site_num + 1) * _site_width) + core_min_x;
-  int placed_x;
-  if (abs(placed_x1 - begin) < abs(placed_x2 - begin)) {
-    placed_x = placed_x1;
-  } else {
-    placed_x = placed_x2;
-  }
-  return placed_x;
-}
-
 IdbRow* Placer::findRow(int loc_y)
 {
-  IdbLayout* idb_layout = dmInst->get_idb_layout();
-  IdbRows* rows = idb_layout->get_rows();
-
-  for (auto row : rows->get_row_list()) {
-    if (row->get_bounding_box()->get_low_y() == loc_y) {
-      return row;
-    }
-  }
-  return nullptr;
+  auto iter = _y_to_row.find(loc_y);
+  return iter != _y_to_row.end() ? iter->second : nullptr;
 }
 
 /**
@@ -191,14 +144,21 @@ void Placer::updateRow(unsigned int master_width, int loc_x, int loc_y)
   _row_space[row_idx]->addUsedSpace(loc_x, loc_x + master_width);
 }
 
-std::pair<UsedSpace*, int> Placer::findNearestRowLegalSpace(int row_idx, unsigned int master_width, int loc_x, int loc_y)
+/**
+ * @brief find the nearest site aligned space in the row
+ *
+ * @return the space and the distance moved, std::nullopt if the row has no enough space
+ */
+std::optional<std::pair<UsedSpace, int>> Placer::findNearestRowLegalSpace(int row_idx, unsigned int master_width, int loc_x, int loc_y)
 {
-  std::vector<UsedSpace*> alter_option = _row_space[row_idx]->searchFeasiblePlace(loc_x, loc_x + master_width, 3);
+  auto space = _row_space[row_idx]->findNearestFreeSpace(loc_x, master_width, toDmInst->get_core().get_x_min(), _site_width);
+  if (!space) {
+    return std::nullopt;
+  }
   int row_height1 = (row_idx * _row_height) + toDmInst->get_core().get_y_min();
   // The distance needed to move to the row
   int dis_margin1 = abs(row_height1 - loc_y);
-  std::pair<UsedSpace*, int> opt = findNearestSpace(alter_option, loc_x, loc_x + master_width, dis_margin1);
-  return opt;
+  return std::make_pair(*space, abs(space->begin() - loc_x) + dis_margin1);
 }
 
 }  // namespace ito
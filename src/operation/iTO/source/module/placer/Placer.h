@@ -16,6 +16,8 @@
 // ***************************************************************************************
 #pragma once
 
+#include <optional>
+#include <unordered_map>
 #include <vector>
 
 #include "../../data/Rects.h"
@@ -49,13 +51,11 @@ class Placer
   ~Placer();
   void initRow();
 
-  std::pair<UsedSpace*, int> findNearestSpace(std::vector<UsedSpace*> options, int begin, int end, int dis_margin);
-
-  int placeAlignWithSite(UsedSpace option);
-
-  std::pair<UsedSpace*, int> findNearestRowLegalSpace(int row_idx, unsigned int master_width, int loc_x, int loc_y);
+  std::optional<std::pair<UsedSpace, int>> findNearestRowLegalSpace(int row_idx, unsigned int master_width, int loc_x, int loc_y);
 
   std::vector<RowSpacing*> _row_space;
+  // row low y -> row
+  std::unordered_map<int, idb::IdbRow*> _y_to_row;
   int _row_height;
   int _site_width;
 };
@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <deque>
+
 #include "DbInterface.h"
 #include "Point.h"
 #include "define.h"
@@ -56,12 +58,15 @@ class BufferedOption {
   LibCell* get_lib_cell_size() const { return _lib_cell_size; }
   void set_lib_cell_size(LibCell* cell) { _lib_cell_size = cell; }
 
+  double get_area() const { return _area; }
+  void set_area(double area) { _area = area; }
+
   Pin* get_pin_loaded() const { return _pin_loaded; }
   void set_pin_loaded(Pin* pin) { _pin_loaded = pin; }
   BufferedOption* get_left() const { return _left; }
   void set_left(BufferedOption* left) { _left = left; }
 
-  BufferedOption* get_right() const { return _left; }
+  BufferedOption* get_right() const { return _right; }
   void set_right(BufferedOption* right) { _right = right; }
 
   void printBuffered(int level);
@@ -82,6 +87,28 @@ class BufferedOption {
   BufferedOption *_right = nullptr;
 
   double _req = 0.0;
+  // the area of the inserted buffers in the subtree.
+  double _area = 0.0;
+};
+
+/**
+ * @brief The buffered options of one net are allocated from the arena, the
+ * options are released together with the arena.
+ */
+class BufferedOptionArena {
+ public:
+  BufferedOptionArena() = default;
+  ~BufferedOptionArena() = default;
+  BufferedOptionArena(const BufferedOptionArena&) = delete;
+  BufferedOptionArena& operator=(const BufferedOptionArena&) = delete;
+
+  BufferedOption* create(BufferedOptionType option_type) { return &_options.emplace_back(option_type); }
+  size_t size() const { return _options.size(); }
+  void clear() { _options.clear(); }
+
+ private:
+  // deque keeps the address of the created option.
+  std::deque<BufferedOption> _options;
 };
 
 } // namespace ito
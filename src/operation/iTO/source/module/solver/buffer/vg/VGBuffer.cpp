@@ -17,18 +17,30 @@
 
 #include "VGBuffer.h"
 
+#include <algorithm>
+
 #include "data_manager.h"
 
 namespace ito {
 
 BufferedOptionSeq VGBuffer::VGBuffering(TreeBuild* tree) {
   LOG_ERROR_IF(_available_lib_cell_sizes.empty()) << "No buffer cell sizes available for VGBuffering";
+  return bufferNet(createArena(), tree);
+}
+
+BufferedOptionArena* VGBuffer::createArena()
+{
+  return _arenas.emplace_back(std::make_unique<BufferedOptionArena>()).get();
+}
+
+BufferedOptionSeq VGBuffer::bufferNet(BufferedOptionArena* arena, TreeBuild* tree)
+{
   int driver_id = tree->get_root()->get_id();
   tree->updateBranch();
-  return findBufferSolution(tree, tree->left(driver_id), driver_id);
+  return findBufferSolution(arena, tree, tree->left(driver_id), driver_id);
 }
 
-BufferedOptionSeq VGBuffer::findBufferSolution(TreeBuild* tree, int curr_id, int prev_id)
+BufferedOptionSeq VGBuffer::findBufferSolution(BufferedOptionArena* arena, TreeBuild* tree, int curr_id, int prev_id)
 {
   if (curr_id == TreeBuild::_null_pt) {
     return {};
@@ -41,7 +53,7 @@ BufferedOptionSeq VGBuffer::findBufferSolution(TreeBuild* tree, int curr_id, int
     auto* pin = dynamic_cast<Pin*>(obj_pin);
 
     if (timingEngine->get_sta_engine()->isLoad(pin->getFullName().c_str())) {
-      BufferedOption* buffered_option = new BufferedOption(BufferedOptionType::kSink);
+      BufferedOption* buffered_option = arena->create(BufferedOptionType::kSink);
       StaVertex* vertex = timingEngine->get_sta_engine()->findVertex(pin->getFullName().c_str());
       auto req_ns_r = vertex->getReqTimeNs(AnalysisMode::kMax, TransType::kRise);
       double req_r = req_ns_r ? *req_ns_r : 0.0;
@@ -56,84 +68,129 @@ BufferedOptionSeq VGBuffer::findBufferSolution(TreeBuild* tree, int curr_id, int
       buffered_option->set_req(req);
       buf_option_seq.emplace_back(buffered_option);
 
-      buf_option_seq = addWire(buf_option_seq, curr_loc, prev_loc);
+      buf_option_seq = addWire(arena, buf_option_seq, curr_loc, prev_loc);
       // Determine if a buffer needs to be inserted after adding wire
       if (!buf_option_seq.empty()) {
-        BufferedOptionSeq buf_options = addBuffer(buf_option_seq, prev_loc);
-        for (BufferedOption* buf_opt : buf_options) {
-          buf_option_seq.push_back(buf_opt);
-        }
+        BufferedOptionSeq buf_options = addBuffer(arena, buf_option_seq, prev_loc);
         buf_option_seq.insert(buf_option_seq.end(), buf_options.begin(), buf_options.end());
       }
+      pruneOptions(buf_option_seq);
       return buf_option_seq;
     }
   }
   // curr -> steiner point
   else if (obj_pin == nullptr) {
-    BufferedOptionSeq buf_opt_left = findBufferSolution(tree, tree->left(curr_id), curr_id);
-    BufferedOptionSeq buf_opt_mid = findBufferSolution(tree, tree->middle(curr_id), curr_id);
+    BufferedOptionSeq buf_opt_left = findBufferSolution(arena, tree, tree->left(curr_id), curr_id);
+    BufferedOptionSeq buf_opt_mid = findBufferSolution(arena, tree, tree->middle(curr_id), curr_id);
 
-    BufferedOptionSeq buf_opt_merger = mergeBranch(buf_opt_left, buf_opt_mid, curr_loc);
+    BufferedOptionSeq buf_opt_merger = mergeBranch(arena, buf_opt_left, buf_opt_mid, curr_loc);
 
-    buf_opt_merger = addWire(buf_opt_merger, curr_loc, prev_loc);
+    buf_opt_merger = addWire(arena, buf_opt_merger, curr_loc, prev_loc);
     // Determine if a buffer needs to be inserted after adding wire
     if (!buf_opt_merger.empty()) {
-      BufferedOptionSeq buf_options = addBuffer(buf_opt_merger, prev_loc);
+      BufferedOptionSeq buf_options = addBuffer(arena, buf_opt_merger, prev_loc);
       buf_opt_merger.insert(buf_opt_merger.end(), buf_options.begin(), buf_options.end());
     }
+    pruneOptions(buf_opt_merger);
     return buf_opt_merger;
   }
 
   return {};
 }
 
-BufferedOptionSeq VGBuffer::mergeBranch(BufferedOptionSeq buf_opt_left, BufferedOptionSeq buf_opt_right, Point curr_loc)
+/**
+ * @brief sort the options by cap, and remove the option dominated by another one, an option is dominated if
+ * another option has less cap and larger required time (and less buffer area if area is considered). The pruned
+ * options are in cap increasing order, and the required time is increasing too.
+ */
+void VGBuffer::pruneOptions(BufferedOptionSeq& buf_opt_seq)
 {
-  BufferedOptionSeq buf_opt_merger;
-  for (auto left : buf_opt_left) {
-    for (auto right : buf_opt_right) {
-      BufferedOption* buffered_option = new BufferedOption(BufferedOptionType::kBranch);
-      TORequired left_req = left->get_required_arrival_time();
-      float left_cap = left->get_cap();
-      TORequired right_req = right->get_required_arrival_time();
-      float right_cap = right->get_cap();
-
-      BufferedOption* min_opt = approximatelyLess(left_req, right_req) ? left : right;
+  std::sort(buf_opt_seq.begin(), buf_opt_seq.end(), [](BufferedOption* opt1, BufferedOption* opt2) {
+    if (opt1->get_cap() != opt2->get_cap()) {
+      return opt1->get_cap() < opt2->get_cap();
+    }
+    if (opt1->get_required_arrival_time() != opt2->get_required_arrival_time()) {
+      return opt1->get_required_arrival_time() > opt2->get_required_arrival_time();
+    }
+    return opt1->get_area() < opt2->get_area();
+  });
 
-      buffered_option->set_location(curr_loc);
-      buffered_option->set_cap(left_cap + right_cap);
-      buffered_option->set_delay_required(min_opt->get_delay_required());
-      buffered_option->set_left(left);
-      buffered_option->set_right(right);
-      buffered_option->set_req(min_opt->get_req());
-      buf_opt_merger.emplace_back(buffered_option);
+  BufferedOptionSeq pruned_options;
+  for (BufferedOption* option : buf_opt_seq) {
+    TORequired req = option->get_required_arrival_time();
+    if (!_consider_area) {
+      // the kept option has less cap, so only compare with the largest required time.
+      if (pruned_options.empty() || approximatelyGreater(req, pruned_options.back()->get_required_arrival_time())) {
+        pruned_options.push_back(option);
+      }
+    } else if (std::none_of(pruned_options.begin(), pruned_options.end(), [option, req](BufferedOption* kept_option) {
+                 return approximatelyGreaterEqual(kept_option->get_required_arrival_time(), req)
+                        && kept_option->get_area() <= option->get_area();
+               })) {
+      pruned_options.push_back(option);
     }
   }
-  sort(buf_opt_merger.begin(), buf_opt_merger.end(), [=](BufferedOption* opt1, BufferedOption* opt2) {
-    return approximatelyGreater(opt1->get_required_arrival_time(), opt2->get_required_arrival_time());
-  });
-  size_t i = 0;
-  while (i < buf_opt_merger.size()) {
-    BufferedOption* buffer_option_1 = buf_opt_merger[i];
-    float buffer_option_1_cap = buffer_option_1->get_cap();
-    size_t j = i + 1;
-
-    while (j < buf_opt_merger.size()) {
-      BufferedOption* buffer_option_2 = buf_opt_merger[j];
-      float buffer_option_2_cap = buffer_option_2->get_cap();
-
-      if (approximatelyLess(buffer_option_2_cap, buffer_option_1_cap)) {
-        j++;
-      } else {
-        buf_opt_merger.erase(buf_opt_merger.begin() + j);
+  buf_opt_seq.swap(pruned_options);
+}
+
+BufferedOption* VGBuffer::createBranch(BufferedOptionArena* arena, BufferedOption* left, BufferedOption* right, Point curr_loc)
+{
+  BufferedOption* buffered_option = arena->create(BufferedOptionType::kBranch);
+  BufferedOption* min_opt = approximatelyLess(left->get_required_arrival_time(), right->get_required_arrival_time()) ? left : right;
+
+  buffered_option->set_location(curr_loc);
+  buffered_option->set_cap(left->get_cap() + right->get_cap());
+  buffered_option->set_delay_required(min_opt->get_delay_required());
+  buffered_option->set_left(left);
+  buffered_option->set_right(right);
+  buffered_option->set_req(min_opt->get_req());
+  buffered_option->set_area(left->get_area() + right->get_area());
+  return buffered_option;
+}
+
+/**
+ * @brief merge the pruned options of the two branch. The required time of the merged option is decided by the
+ * critical branch, so only the critical branch moves to the next option with larger cap and larger required time,
+ * the merged options are at most the sum of the two branch options.
+ */
+BufferedOptionSeq VGBuffer::mergeBranch(BufferedOptionArena* arena, const BufferedOptionSeq& buf_opt_left,
+                                        const BufferedOptionSeq& buf_opt_right, Point curr_loc)
+{
+  BufferedOptionSeq buf_opt_merger;
+  if (_consider_area) {
+    // the area is not monotone with the cap, all the combination are considered.
+    for (auto* left : buf_opt_left) {
+      for (auto* right : buf_opt_right) {
+        buf_opt_merger.push_back(createBranch(arena, left, right, curr_loc));
       }
     }
-    i++;
+    pruneOptions(buf_opt_merger);
+    return buf_opt_merger;
+  }
+
+  size_t left_index = 0;
+  size_t right_index = 0;
+  while (left_index < buf_opt_left.size() && right_index < buf_opt_right.size()) {
+    BufferedOption* left = buf_opt_left[left_index];
+    BufferedOption* right = buf_opt_right[right_index];
+    buf_opt_merger.push_back(createBranch(arena, left, right, curr_loc));
+
+    TORequired left_req = left->get_required_arrival_time();
+    TORequired right_req = right->get_required_arrival_time();
+    if (approximatelyLess(left_req, right_req)) {
+      ++left_index;
+    } else if (approximatelyLess(right_req, left_req)) {
+      ++right_index;
+    } else {
+      ++left_index;
+      ++right_index;
+    }
   }
+  pruneOptions(buf_opt_merger);
   return buf_opt_merger;
 }
 
-BufferedOptionSeq VGBuffer::addWire(BufferedOptionSeq buf_opt_seq, Point curr_loc, Point prev_loc)
+BufferedOptionSeq VGBuffer::addWire(BufferedOptionArena* arena, const BufferedOptionSeq& buf_opt_seq, Point curr_loc, Point prev_loc)
 {
   int wire_length = abs(curr_loc.get_x() - prev_loc.get_x()) + abs(curr_loc.get_y() - prev_loc.get_y());
   std::optional<double> width = std::nullopt;
@@ -143,7 +200,7 @@ BufferedOptionSeq VGBuffer::addWire(BufferedOptionSeq buf_opt_seq, Point curr_lo
 
   BufferedOptionSeq buf_option_seq;
   for (BufferedOption* buf_opt : buf_opt_seq) {
-    BufferedOption* buffered_option = new BufferedOption(BufferedOptionType::kWire);
+    BufferedOption* buffered_option = arena->create(BufferedOptionType::kWire);
     double wire_delay = wire_length_res * (wire_length_cap / 2 + buf_opt->get_cap());
 
     float update_cap = buf_opt->get_cap() + wire_length_cap;
@@ -154,13 +211,14 @@ BufferedOptionSeq VGBuffer::addWire(BufferedOptionSeq buf_opt_seq, Point curr_lo
     buffered_option->set_delay_required(update_req_delay);
     buffered_option->set_left(buf_opt);
     buffered_option->set_req(buf_opt->get_req());
+    buffered_option->set_area(buf_opt->get_area());
 
     buf_option_seq.push_back(buffered_option);
   }
   return buf_option_seq;
 }
 
-BufferedOptionSeq VGBuffer::addBuffer(BufferedOptionSeq buf_opt_seq, Point prev_loc)
+BufferedOptionSeq VGBuffer::addBuffer(BufferedOptionArena* arena, const BufferedOptionSeq& buf_opt_seq, Point prev_loc)
 {
   BufferedOptionSeq new_options;
 
@@ -189,13 +247,14 @@ BufferedOptionSeq VGBuffer::addBuffer(BufferedOptionSeq buf_opt_seq, Point prev_
             return option->get_cap() <= input_buffer_port_cap && option->get_required_arrival_time() >= req_time;
           })) {
         TODelay updated_req_delay = best_option->get_delay_required() + delay;
-        auto buffered_option = new BufferedOption(BufferedOptionType::kBuffer);
+        auto buffered_option = arena->create(BufferedOptionType::kBuffer);
         buffered_option->set_location(prev_loc);
         buffered_option->set_cap(input_buffer_port_cap);
         buffered_option->set_delay_required(updated_req_delay);
         buffered_option->set_lib_cell_size(buffer_cell);
         buffered_option->set_left(best_option);
         buffered_option->set_req(best_option->get_req());
+        buffered_option->set_area(best_option->get_area() + buffer_cell->get_cell_area());
         new_options.push_back(buffered_option);
       }
     }
@@ -18,26 +18,47 @@
 #pragma once
 
 #include <iostream>
+#include <memory>
+#include <vector>
 
 #include "BufferedOption.h"
 #include "TreeBuild.h"
 
 namespace ito {
+/**
+ * @brief van Ginneken buffering, the options of the subtree are kept sorted by
+ * cap and pruned by dominance, so the branch merge is linear. Each net owns an
+ * option arena, the options are alive until the VGBuffer is destroyed.
+ */
 class VGBuffer
 {
  public:
   VGBuffer() = default;
-  VGBuffer(TOLibertyCellSeq cells) : _available_lib_cell_sizes(cells){}
+  VGBuffer(TOLibertyCellSeq cells, bool consider_area = false)
+      : _available_lib_cell_sizes(cells), _consider_area(consider_area)
+  {
+  }
   ~VGBuffer() = default;
 
   BufferedOptionSeq VGBuffering(TreeBuild* tree);
 
  private:
+  friend class VGBufferTest;
+
   TOLibertyCellSeq _available_lib_cell_sizes;
-  BufferedOptionSeq findBufferSolution(TreeBuild* tree, int curr_id, int prev_id);
-  BufferedOptionSeq mergeBranch(BufferedOptionSeq buf_opt_left, BufferedOptionSeq buf_opt_right, Point curr_loc);
-  BufferedOptionSeq addWire(BufferedOptionSeq buf_opt_seq, Point curr_loc, Point prev_loc);
-  BufferedOptionSeq addBuffer(BufferedOptionSeq buf_opt_seq, Point prev_loc);
+  // keep the option with larger cap and larger required time if it uses less buffer area.
+  bool _consider_area = false;
+  std::vector<std::unique_ptr<BufferedOptionArena>> _arenas;
+
+  BufferedOptionArena* createArena();
+  BufferedOptionSeq bufferNet(BufferedOptionArena* arena, TreeBuild* tree);
+  BufferedOptionSeq findBufferSolution(BufferedOptionArena* arena, TreeBuild* tree, int curr_id, int prev_id);
+  BufferedOptionSeq mergeBranch(BufferedOptionArena* arena, const BufferedOptionSeq& buf_opt_left,
+                                const BufferedOptionSeq& buf_opt_right, Point curr_loc);
+  BufferedOption* createBranch(BufferedOptionArena* arena, BufferedOption* left, BufferedOption* right, Point curr_loc);
+  BufferedOptionSeq addWire(BufferedOptionArena* arena, const BufferedOptionSeq& buf_opt_seq, Point curr_loc, Point prev_loc);
+  BufferedOptionSeq addBuffer(BufferedOptionArena* arena, const BufferedOptionSeq& buf_opt_seq, Point prev_loc);
+  void pruneOptions(BufferedOptionSeq& buf_opt_seq);
 };
 
 }  // namespace ito
@@ -17,6 +17,7 @@
 
 #include "timing_engine.h"
 
+#include "EstimateParasitics.h"
 #include "ToConfig.h"
 #include "data_manager.h"
 #include "timing_engine_builder.h"
@@ -128,4 +129,26 @@ void ToTimingEngine::refineRes(RctNode* node1, RctNode* node2, Net* net, double
   }
 }
 
+/**
+ * @brief re-estimate the rc of the changed nets (buffering, resizing or moving),
+ * and propagate timing from the instances on them instead of a full update.
+ *
+ */
+void ToTimingEngine::incrUpdateRCAndTiming()
+{
+  auto nets_for_update = toEvalInst->get_parasitics_invalid_net();
+  for (auto* net_up : nets_for_update) {
+    auto net_pins = net_up->get_pin_ports();
+    for (auto* pin_port : net_pins) {
+      if (pin_port->isPort()) {
+        continue;
+      }
+      auto inst_name = pin_port->get_own_instance()->getFullName();
+      _timing_engine->moveInstance(inst_name.c_str(), 20);
+    }
+  }
+  toEvalInst->excuteParasiticsEstimate();
+  _timing_engine->incrUpdateTiming();
+}
+
 }  // namespace ito
\ No newline at end of file
@@ -110,6 +110,9 @@ class ToTimingEngine
 
   void refineRes(RctNode* node1, RctNode* node2, Net* net, double res = 1.0e-3, bool b_incre = false, double incre_cap = 0.0);
 
+  /// incremental update
+  void incrUpdateRCAndTiming();
+
  private:
   static ToTimingEngine* _instance;
   ista::TimingEngine* _timing_engine = nullptr;
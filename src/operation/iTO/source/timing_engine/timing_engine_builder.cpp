@@ -17,7 +17,11 @@
 
 #include "timing_engine_builder.h"
 
+#include <set>
+#include <string>
+
 #include "../data_manager/data_manager.h"
+#include "EstimateParasitics.h"
 #include "ToConfig.h"
 #include "api/TimingEngine.hh"
 #include "api/TimingIDBAdapter.hh"
@@ -61,6 +65,13 @@ void TimingEngineBuilder::findEquivLibCells()
 
 void TimingEngineBuilder::initISTA()
 {
+  // the rc nets are reset by the netlist convert below, all the nets are estimated again.
+  toEvalInst->invalidAllNetRC();
+
+  if (toConfig->get_reuse_timing_engine() && refreshISTA()) {
+    return;
+  }
+
   ista::TimingEngine::destroyTimingEngine();
 
   auto timing_engine = ista::TimingEngine::getOrCreateTimingEngine();
@@ -93,8 +104,69 @@ void TimingEngineBuilder::initISTA()
   timingEngine->set_sta_engine(timing_engine);
 }
 
+/**
+ * @brief reuse the existing timing engine with the configured liberty. Its netlist and graph are synced with the idb
+ * changed by the former stages, only the inserted, removed or resized insts and the rewired nets are rebuilt. If the
+ * sync is not supported, e.g. the design ports are changed, the netlist and the graph are built again with the liberty.
+ *
+ * @return false if there is no timing engine with the configured liberty loaded, the engine has to be built from scratch.
+ */
+bool TimingEngineBuilder::refreshISTA()
+{
+  auto timing_engine = ista::TimingEngine::getOrCreateTimingEngine();
+  auto& all_libs = timing_engine->getAllLib();
+  if (all_libs.empty()) {
+    return false;
+  }
+
+  std::set<std::string> loaded_lib_files;
+  for (auto& lib : all_libs) {
+    loaded_lib_files.insert(lib->get_file_name());
+  }
+  std::set<std::string> lib_files(toConfig->get_lib_files().begin(), toConfig->get_lib_files().end());
+  if (loaded_lib_files != lib_files) {
+    return false;
+  }
+
+  timing_engine->set_num_threads(50);
+  timing_engine->set_design_work_space(toConfig->get_design_work_space().c_str());
+
+  timing_engine->resetPathData();
+
+  bool is_synced = false;
+  auto* idb_adapter = dynamic_cast<TimingIDBAdapter*>(timing_engine->get_db_adapter());
+  if (idb_adapter && timing_engine->isBuildGraph()) {
+    idb_adapter->set_idb(dmInst->get_idb_builder());
+    is_synced = idb_adapter->incrConvertDBToTimingNetlist();
+  }
+
+  if (!is_synced) {
+    auto new_idb_adapter = std::make_unique<TimingIDBAdapter>(timing_engine->get_ista());
+    new_idb_adapter->set_idb(dmInst->get_idb_builder());
+
+    timing_engine->resetGraph();
+    new_idb_adapter->convertDBToTimingNetlist(true);
+    timing_engine->set_db_adapter(std::move(new_idb_adapter));
+  }
+
+  // the constraint may refer to the removed pins, it is read again.
+  if (!toConfig->get_sdc_file().empty()) {
+    timing_engine->readSdc(toConfig->get_sdc_file().c_str());
+  }
+
+  if (!is_synced) {
+    timing_engine->buildGraph();
+  }
+  timing_engine->updateTiming();
+
+  timingEngine->set_sta_engine(timing_engine);
+  return true;
+}
+
 void TimingEngineBuilder::findDrvrVertices()
 {
+  timingEngine->get_driver_vertices().clear();
+
   Netlist* design_nl = timingEngine->get_sta_engine()->get_netlist();
   Net* net;
   FOREACH_NET(design_nl, net)
@@ -116,6 +188,7 @@ void TimingEngineBuilder::findDrvrVertices()
 void TimingEngineBuilder::findBufferCells()
 {
   timingEngine->set_buf_lowest_driver_res(nullptr);
+  timingEngine->get_buffer_cells().clear();
   float low_drive = -kInf;
 
   auto& all_libs = timingEngine->get_sta_engine()->getAllLib();
@@ -43,6 +43,7 @@ class TimingEngineBuilder
 
   /////////init engine
   void initISTA();
+  bool refreshISTA();
   void findEquivLibCells();
   void findDrvrVertices();
   void findBufferCells();
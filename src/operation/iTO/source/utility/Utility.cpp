@@ -16,6 +16,8 @@
 // ***************************************************************************************
 #include "Utility.h"
 
+#include <cmath>
+
 namespace ito {
 
 constexpr static float float_equal_tolerance = 1E-15F;
@@ -34,11 +36,11 @@ bool approximatelyEqual(float f1, float f2) {
   if (f1 == f2) {
     return true;
   } else if (f1 == 0.0) {
-    return abs(f2) < float_equal_tolerance;
+    return std::abs(f2) < float_equal_tolerance;
   } else if (f2 == 0.0) {
-    return abs(f1) < float_equal_tolerance;
+    return std::abs(f1) < float_equal_tolerance;
   } else {
-    return abs(f1 - f2) < 1E-6F * max(abs(f1), abs(f2));
+    return std::abs(f1 - f2) < 1E-6F * max(std::abs(f1), std::abs(f2));
   }
 }
 
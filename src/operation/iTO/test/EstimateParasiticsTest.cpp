@@ -0,0 +1,166 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "EstimateParasitics.h"
+#include "IdbInstance.h"
+#include "ToApi.hpp"
+#include "gtest/gtest.h"
+#include "idm.h"
+#include "timing_engine.h"
+
+namespace ito {
+
+/**
+ * @brief The design is read by the idb config ITO_TEST_DB_CONFIG, the liberty and the sdc come from the iTO config
+ * ITO_TEST_CONFIG. The tests are skipped when they are unset.
+ */
+class EstimateParasiticsTest : public testing::Test
+{
+ protected:
+  void SetUp() override
+  {
+    const char* db_config = std::getenv("ITO_TEST_DB_CONFIG");
+    const char* to_config = std::getenv("ITO_TEST_CONFIG");
+    if (!db_config || !to_config) {
+      GTEST_SKIP() << "ITO_TEST_DB_CONFIG or ITO_TEST_CONFIG is not set.";
+    }
+
+    static bool is_init = false;
+    if (!is_init) {
+      ASSERT_TRUE(dmInst->init(db_config));
+      ToApiInst.init(to_config);
+      ToApiInst.initEngine();
+      is_init = true;
+    }
+  }
+
+  /**
+   * @brief the rc tree of every net, the nodes with their cap and the edges with their res, by net name.
+   */
+  static std::map<std::string, std::vector<std::string>> dumpParasitics()
+  {
+    std::map<std::string, std::vector<std::string>> net_parasitics;
+    auto* ista = timingEngine->get_sta_engine()->get_ista();
+    Netlist* design_nl = timingEngine->get_sta_engine()->get_netlist();
+    Net* net;
+    FOREACH_NET(design_nl, net)
+    {
+      auto& parasitics = net_parasitics[net->getFullName()];
+      auto* rc_net = ista->getRcNet(net);
+      auto* rc_tree = rc_net ? rc_net->rct() : nullptr;
+      if (rc_tree == nullptr) {
+        continue;
+      }
+
+      char value[32];
+      for (auto& [node_name, node] : rc_tree->get_nodes()) {
+        std::snprintf(value, sizeof(value), "%.9g", node.get_cap());
+        parasitics.push_back(node_name + " " + value);
+      }
+      for (auto& edge : rc_tree->get_edges()) {
+        std::snprintf(value, sizeof(value), "%.9g", edge.get_res());
+        parasitics.push_back(edge.get_from().get_name() + " -> " + edge.get_to().get_name() + " " + value);
+      }
+      std::sort(parasitics.begin(), parasitics.end());
+    }
+    return net_parasitics;
+  }
+};
+
+TEST_F(EstimateParasiticsTest, parallel_match_serial)
+{
+  auto* sta_engine = timingEngine->get_sta_engine();
+
+  sta_engine->set_num_threads(1);
+  toEvalInst->estimateAllNetParasitics();
+  auto serial_parasitics = dumpParasitics();
+
+  sta_engine->set_num_threads(8);
+  toEvalInst->estimateAllNetParasitics();
+  auto parallel_parasitics = dumpParasitics();
+
+  EXPECT_FALSE(serial_parasitics.empty());
+  EXPECT_EQ(serial_parasitics, parallel_parasitics);
+}
+
+TEST_F(EstimateParasiticsTest, dirty_nets_match_full)
+{
+  auto* sta_engine = timingEngine->get_sta_engine();
+  sta_engine->set_num_threads(8);
+  toEvalInst->estimateAllNetParasitics();
+  auto origin_parasitics = dumpParasitics();
+
+  // move some instances whose nets all have a driver, and mark their nets dirty
+  const int32_t offset = 2000;
+  std::vector<idb::IdbInstance*> moved_insts;
+  Netlist* design_nl = sta_engine->get_netlist();
+  for (auto* idb_inst : dmInst->get_idb_design()->get_instance_list()->get_instance_list()) {
+    if (moved_insts.size() == 10) {
+      break;
+    }
+    Instance* inst = design_nl->findInstance(idb_inst->get_name().c_str());
+    if (inst == nullptr || idb_inst->is_fixed()) {
+      continue;
+    }
+    std::vector<Net*> nets;
+    bool is_driven = true;
+    Pin* pin;
+    FOREACH_INSTANCE_PIN(inst, pin)
+    {
+      if (pin->get_net() != nullptr) {
+        nets.push_back(pin->get_net());
+        is_driven = is_driven && pin->get_net()->getDriver() != nullptr;
+      }
+    }
+    if (nets.empty() || !is_driven) {
+      continue;
+    }
+
+    auto* coord = idb_inst->get_coordinate();
+    idb_inst->set_coodinate(coord->get_x() + offset, coord->get_y());
+    for (auto* net : nets) {
+      toEvalInst->invalidNetRC(net);
+    }
+    moved_insts.push_back(idb_inst);
+  }
+  ASSERT_FALSE(moved_insts.empty());
+
+  toEvalInst->excuteParasiticsEstimate();
+  EXPECT_TRUE(toEvalInst->get_parasitics_invalid_net().empty());
+  auto dirty_parasitics = dumpParasitics();
+
+  toEvalInst->estimateAllNetParasitics();
+  auto full_parasitics = dumpParasitics();
+
+  EXPECT_EQ(dirty_parasitics, full_parasitics);
+  EXPECT_NE(full_parasitics, origin_parasitics);
+
+  for (auto* idb_inst : moved_insts) {
+    auto* coord = idb_inst->get_coordinate();
+    idb_inst->set_coodinate(coord->get_x() - offset, coord->get_y());
+  }
+  toEvalInst->estimateAllNetParasitics();
+  EXPECT_EQ(dumpParasitics(), origin_parasitics);
+}
+
+}  // namespace ito
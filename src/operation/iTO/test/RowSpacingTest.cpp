@@ -0,0 +1,222 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+#include <climits>
+#include <cstdlib>
+#include <optional>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "RowSpacing.h"
+#include "gtest/gtest.h"
+
+namespace ito {
+
+using Segments = vector<pair<int, int>>;
+
+/**
+ * @brief the free segments of the row [0, row_end) by a linear scan of the used sites.
+ */
+static Segments freeSegments(const vector<bool>& used, int row_end)
+{
+  Segments segments;
+  int begin = -1;
+  for (int x = 0; x <= row_end; ++x) {
+    bool is_free = x < row_end && !used[x];
+    if (is_free && begin < 0) {
+      begin = x;
+    } else if (!is_free && begin >= 0) {
+      segments.emplace_back(begin, x);
+      begin = -1;
+    }
+  }
+  return segments;
+}
+
+/**
+ * @brief the distance of the nearest site aligned free place by checking every site, -1 if none.
+ */
+static long long nearestDistance(const vector<bool>& used, int row_end, int begin, int length, int site_origin, int site_width)
+{
+  long long best_dist = -1;
+  for (int x = site_origin; x + length <= row_end; x += site_width) {
+    bool is_free = true;
+    for (int i = x; i < x + length && is_free; ++i) {
+      is_free = !used[i];
+    }
+    long long dist = std::abs((long long) x - begin);
+    if (is_free && (best_dist < 0 || dist < best_dist)) {
+      best_dist = dist;
+    }
+  }
+  return best_dist;
+}
+
+TEST(RowSpacingTest, carve_overlap)
+{
+  RowSpacing row(0, 100);
+  row.addUsedSpace(10, 20);
+  row.addUsedSpace(15, 30);
+  EXPECT_EQ(row.get_free_space_list(), Segments({{0, 10}, {30, 100}}));
+
+  // inside a used space
+  row.addUsedSpace(12, 18);
+  EXPECT_EQ(row.get_free_space_list(), Segments({{0, 10}, {30, 100}}));
+  EXPECT_EQ(row.get_max_free_length(), 70);
+}
+
+TEST(RowSpacingTest, carve_adjacent)
+{
+  RowSpacing row(0, 100);
+  row.addUsedSpace(10, 20);
+  row.addUsedSpace(20, 30);
+  row.addUsedSpace(0, 10);
+  EXPECT_EQ(row.get_free_space_list(), Segments({{30, 100}}));
+
+  // touch the free segment end
+  row.addUsedSpace(90, 100);
+  EXPECT_EQ(row.get_free_space_list(), Segments({{30, 90}}));
+
+  // an empty space changes nothing
+  row.addUsedSpace(50, 50);
+  EXPECT_EQ(row.get_free_space_list(), Segments({{30, 90}}));
+}
+
+TEST(RowSpacingTest, carve_span_segments)
+{
+  RowSpacing row(0, 100);
+  row.addUsedSpace(20, 30);
+  row.addUsedSpace(50, 60);
+  row.addUsedSpace(80, 90);
+  EXPECT_EQ(row.get_free_space_list(), Segments({{0, 20}, {30, 50}, {60, 80}, {90, 100}}));
+
+  row.addUsedSpace(10, 85);
+  EXPECT_EQ(row.get_free_space_list(), Segments({{0, 10}, {90, 100}}));
+  EXPECT_EQ(row.get_max_free_length(), 10);
+
+  row.addUsedSpace(-10, 200);
+  EXPECT_TRUE(row.get_free_space_list().empty());
+  EXPECT_EQ(row.get_max_free_length(), 0);
+}
+
+TEST(RowSpacingTest, nearest_left_and_right)
+{
+  RowSpacing row(0, 100);
+  row.addUsedSpace(20, 60);
+
+  // [10, 20) is 20 away on the left, [60, 70) is 30 away on the right
+  auto left_place = row.findNearestFreeSpace(30, 10, 0, 5);
+  ASSERT_TRUE(left_place.has_value());
+  EXPECT_EQ(left_place->begin(), 10);
+  EXPECT_EQ(left_place->end(), 20);
+
+  // [10, 20) is 35 away on the left, [60, 70) is 15 away on the right
+  auto right_place = row.findNearestFreeSpace(45, 10, 0, 5);
+  ASSERT_TRUE(right_place.has_value());
+  EXPECT_EQ(right_place->begin(), 60);
+
+  // inside a free segment, aligned to the nearest site
+  auto inside_place = row.findNearestFreeSpace(72, 10, 0, 5);
+  ASSERT_TRUE(inside_place.has_value());
+  EXPECT_EQ(inside_place->begin(), 70);
+
+  // the site origin shifts the aligned place
+  auto shifted_place = row.findNearestFreeSpace(72, 10, 2, 5);
+  ASSERT_TRUE(shifted_place.has_value());
+  EXPECT_EQ(shifted_place->begin(), 72);
+}
+
+TEST(RowSpacingTest, nearest_none)
+{
+  RowSpacing row(0, 100);
+  row.addUsedSpace(40, 60);
+  EXPECT_FALSE(row.findNearestFreeSpace(50, 41, 0, 1).has_value());
+
+  // long enough but no site aligned place fits
+  RowSpacing short_row(1, 9);
+  EXPECT_FALSE(short_row.findNearestFreeSpace(1, 8, 0, 5).has_value());
+}
+
+TEST(RowSpacingTest, nearest_match_linear_scan)
+{
+  std::mt19937 gen(7);
+  const int row_end = 400;
+  const int site_width = 4;
+  for (int round = 0; round < 50; ++round) {
+    RowSpacing row(0, row_end);
+    vector<bool> used(row_end, false);
+    std::uniform_int_distribution<int> begin_dist(0, row_end - 1);
+    std::uniform_int_distribution<int> length_dist(1, 40);
+    for (int i = 0; i < 8; ++i) {
+      int begin = begin_dist(gen);
+      int end = std::min(row_end, begin + length_dist(gen));
+      row.addUsedSpace(begin, end);
+      for (int x = begin; x < end; ++x) {
+        used[x] = true;
+      }
+    }
+    ASSERT_EQ(row.get_free_space_list(), freeSegments(used, row_end));
+
+    for (int i = 0; i < 20; ++i) {
+      int begin = begin_dist(gen);
+      int length = length_dist(gen) * 2;
+      long long expect_dist = nearestDistance(used, row_end, begin, length, 0, site_width);
+      auto place = row.findNearestFreeSpace(begin, length, 0, site_width);
+      if (expect_dist < 0) {
+        EXPECT_FALSE(place.has_value());
+        continue;
+      }
+      ASSERT_TRUE(place.has_value());
+      EXPECT_EQ(place->begin() % site_width, 0);
+      EXPECT_EQ(place->length(), length);
+      EXPECT_EQ(std::abs((long long) place->begin() - begin), expect_dist);
+      for (int x = place->begin(); x < place->end(); ++x) {
+        EXPECT_FALSE(used[x]);
+      }
+    }
+  }
+}
+
+TEST(RowSpacingTest, used_space_list_threads)
+{
+  const int row_end = 10000;
+  const int thread_num = 8;
+  RowSpacing row(0, row_end);
+  vector<bool> used(row_end, false);
+
+  // each thread carves every thread_num-th block, the blocks of different threads overlap
+  vector<vector<pair<int, int>>> used_lists(thread_num);
+  for (int begin = 0, index = 0; begin < row_end; begin += 50, ++index) {
+    int end = std::min(row_end, begin + 20 + index % 5 * 10);
+    used_lists[index % thread_num].emplace_back(begin, end);
+    for (int x = begin; x < end; ++x) {
+      used[x] = true;
+    }
+  }
+
+  vector<std::thread> threads;
+  for (auto& used_list : used_lists) {
+    threads.emplace_back([&row, &used_list]() { row.addUsedSpaceList(used_list); });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(row.get_free_space_list(), freeSegments(used, row_end));
+}
+
+}  // namespace ito
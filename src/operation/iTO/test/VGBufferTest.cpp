@@ -0,0 +1,133 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "BufferedOption.h"
+#include "Utility.h"
+#include "VGBuffer.h"
+#include "gtest/gtest.h"
+
+namespace ito {
+
+class VGBufferTest : public testing::Test
+{
+ protected:
+  /**
+   * @brief the pruned sink options with random cap and required time.
+   */
+  BufferedOptionSeq makeOptions(std::mt19937& gen, int option_num)
+  {
+    std::uniform_real_distribution<float> cap_dist(0.001, 0.1);
+    std::uniform_real_distribution<double> req_dist(0.0, 2.0);
+    BufferedOptionSeq options;
+    for (int i = 0; i < option_num; ++i) {
+      BufferedOption* option = _arena.create(BufferedOptionType::kSink);
+      option->set_cap(cap_dist(gen));
+      option->set_req(req_dist(gen));
+      options.push_back(option);
+    }
+    _vg_buffer.pruneOptions(options);
+    return options;
+  }
+
+  BufferedOptionSeq mergeBranch(const BufferedOptionSeq& left, const BufferedOptionSeq& right)
+  {
+    return _vg_buffer.mergeBranch(&_arena, left, right, Point(0, 0));
+  }
+
+  /**
+   * @brief the cross product merge as the reference, keep the merged option that is not dominated by another one,
+   * which has no more cap and no less required time.
+   */
+  BufferedOptionSeq crossMergeBranch(const BufferedOptionSeq& left, const BufferedOptionSeq& right)
+  {
+    BufferedOptionSeq cross_options;
+    for (auto* left_opt : left) {
+      for (auto* right_opt : right) {
+        cross_options.push_back(_vg_buffer.createBranch(&_arena, left_opt, right_opt, Point(0, 0)));
+      }
+    }
+
+    auto is_dominated = [](BufferedOption* opt, BufferedOption* other) {
+      float cap = opt->get_cap();
+      float other_cap = other->get_cap();
+      TORequired req = opt->get_required_arrival_time();
+      TORequired other_req = other->get_required_arrival_time();
+      return approximatelyLessEqual(other_cap, cap) && approximatelyGreaterEqual(other_req, req)
+             && (approximatelyLess(other_cap, cap) || approximatelyGreater(other_req, req));
+    };
+
+    BufferedOptionSeq buf_opt_merger;
+    for (auto* opt : cross_options) {
+      if (std::none_of(cross_options.begin(), cross_options.end(),
+                       [opt, &is_dominated](BufferedOption* other) { return is_dominated(opt, other); })) {
+        buf_opt_merger.push_back(opt);
+      }
+    }
+    return buf_opt_merger;
+  }
+
+  static std::vector<std::pair<float, double>> capAndRequired(BufferedOptionSeq options)
+  {
+    std::vector<std::pair<float, double>> cap_and_reqs;
+    for (auto* option : options) {
+      cap_and_reqs.emplace_back(option->get_cap(), option->get_required_arrival_time());
+    }
+    std::sort(cap_and_reqs.begin(), cap_and_reqs.end());
+    return cap_and_reqs;
+  }
+
+  VGBuffer _vg_buffer;
+  BufferedOptionArena _arena;
+};
+
+TEST_F(VGBufferTest, linear_merge_match_cross_merge)
+{
+  std::mt19937 gen(20240918);
+  std::uniform_int_distribution<int> num_dist(1, 40);
+  for (int round = 0; round < 200; ++round) {
+    BufferedOptionSeq left = makeOptions(gen, num_dist(gen));
+    BufferedOptionSeq right = makeOptions(gen, num_dist(gen));
+
+    BufferedOptionSeq linear_merger = mergeBranch(left, right);
+    BufferedOptionSeq cross_merger = crossMergeBranch(left, right);
+    EXPECT_LE(linear_merger.size(), left.size() + right.size());
+
+    auto linear_options = capAndRequired(linear_merger);
+    auto cross_options = capAndRequired(cross_merger);
+    ASSERT_EQ(linear_options.size(), cross_options.size());
+    for (size_t i = 0; i < linear_options.size(); ++i) {
+      EXPECT_FLOAT_EQ(linear_options[i].first, cross_options[i].first);
+      EXPECT_DOUBLE_EQ(linear_options[i].second, cross_options[i].second);
+    }
+  }
+}
+
+TEST_F(VGBufferTest, pruned_options_sorted)
+{
+  std::mt19937 gen(7);
+  BufferedOptionSeq options = makeOptions(gen, 100);
+  for (size_t i = 1; i < options.size(); ++i) {
+    EXPECT_LT(options[i - 1]->get_cap(), options[i]->get_cap());
+    EXPECT_LT(options[i - 1]->get_required_arrival_time(), options[i]->get_required_arrival_time());
+  }
+}
+
+}  // namespace ito
@@ -87,7 +87,7 @@ class DataManager
   bool save(string name, string def_path = "");
   bool saveDef(string def_path);
   void saveVerilog(string verilog_path, std::set<std::string>&& exclude_cell_names = {}, bool is_add_space_for_escape_name = false);
-  bool saveGDSII(string path);
+  bool saveGDSII(string path, bool is_stream = false);
   bool saveJSON(string path, string options);
   ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
   ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
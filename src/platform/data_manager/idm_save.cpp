@@ -74,12 +74,12 @@ void DataManager::saveVerilog(string verilog_path, std::set<std::string>&& exclu
   return _idb_builder->saveVerilog(verilog_path, exclude_cell_names, is_add_space_for_escape_name);
 }
 
-bool DataManager::saveGDSII(string path)
+bool DataManager::saveGDSII(string path, bool is_stream)
 {
   if (_idb_builder == nullptr || _idb_lef_service == nullptr || _layout == nullptr) {
     return false;
   }
-  return _idb_builder->saveGDSII(path);
+  return _idb_builder->saveGDSII(path, is_stream);
 }
 bool DataManager::saveJSON(string path, string options)
 {
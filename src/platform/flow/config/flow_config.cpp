@@ -63,6 +63,15 @@ bool PLFConfig::initConfig(string path)
     _config_path.irt_path = ieda::getJsonData(json, {"ConfigPath", "irt_path"});
     _config_path.idrc_path = ieda::getJsonData(json, {"ConfigPath", "idrc_path"});
     _config_path.ito_path = ieda::getJsonData(json, {"ConfigPath", "ito_path"});
+
+    /// read pipeline, the section is optional
+    if (json.contains("Pipeline")) {
+      auto& pipeline = json["Pipeline"];
+      _pipeline_config.keep_timing_engine = pipeline.value("keep_timing_engine", "OFF");
+      _pipeline_config.checkpoint_dir = pipeline.value("checkpoint_dir", "");
+      _pipeline_config.checkpoint_stages = pipeline.value("checkpoint_stages", vector<string>{});
+      _pipeline_config.report_path = pipeline.value("report_path", "");
+    }
   }
 
   ieda::closeFileStream(config_stream);
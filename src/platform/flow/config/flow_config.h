@@ -19,6 +19,7 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
 #include <mutex>
 
 #include "Str.hh"
@@ -60,6 +61,15 @@ struct ConfigPath
   string ito_path;
 };
 
+/// optional "Pipeline" section of the flow config
+struct PipelineConfig
+{
+  string keep_timing_engine = "OFF";  /// ON : the timing engine is kept between stages and synced with the changed design
+  string checkpoint_dir;              /// directory of the checkpoint def files
+  vector<string> checkpoint_stages;   /// stages after which a checkpoint is written, e.g. "place", "cts", "route"
+  string report_path;                 /// per-stage runtime report, printed only if empty
+};
+
 struct EnvironmentInfo
 {
   string software_version = "V23.03-OS-01";
@@ -116,6 +126,15 @@ class PLFConfig
   string get_idrc_path() { return _config_path.idrc_path; }
   string get_ito_path() { return _config_path.ito_path; }
 
+  bool is_pipeline_keep_timing_engine() { return is_flow_running(_pipeline_config.keep_timing_engine); }
+  string get_checkpoint_dir() { return _pipeline_config.checkpoint_dir; }
+  bool is_checkpoint_stage(const string& stage)
+  {
+    return std::find(_pipeline_config.checkpoint_stages.begin(), _pipeline_config.checkpoint_stages.end(), stage)
+           != _pipeline_config.checkpoint_stages.end();
+  }
+  string get_pipeline_report_path() { return _pipeline_config.report_path; }
+
   FlowStatus& get_status() { return _status; }
   string get_status_stage() { return _status.stage; }
   double get_status_runtime() { return _status.runtime; }
@@ -134,6 +153,10 @@ class PLFConfig
   void set_status_memmory(double value) { _status.memmory = value; }
   void add_status_runtime(double value) { _status.runtime += value; }
 
+  void set_pipeline_keep_timing_engine(bool value) { _pipeline_config.keep_timing_engine = value ? "ON" : "OFF"; }
+  void set_checkpoint_dir(string value) { _pipeline_config.checkpoint_dir = value; }
+  void set_checkpoint_stages(vector<string> value) { _pipeline_config.checkpoint_stages = value; }
+
   void set_env_info_version(string value) { _env_info.software_version = value; }
   void set_env_info_user(string value) { _env_info.user = value; }
   void set_env_info_system(string value) { _env_info.system = value; }
@@ -149,6 +172,7 @@ class PLFConfig
   ToolsConfig _tools_config;
   FlowConfig _flow_config;
   ConfigPath _config_path;
+  PipelineConfig _pipeline_config;
   FlowStatus _status;
   EnvironmentInfo _env_info;
 
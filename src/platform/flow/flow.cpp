@@ -29,7 +29,14 @@
 
 #include "flow.h"
 
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include "idm.h"
 #include "tcl_main.h"
+#include "usage/usage.hh"
 
 namespace iplf {
 Flow* Flow::_instance = nullptr;
@@ -68,9 +75,11 @@ void Flow::runTcl(int argc, char** argv)
 
 void Flow::runFlow()
 {
+  auto* config = PLFConfig::getInstance();
+  clearStageRecords();
+
   /// init DB
-  if (tmInst->idbStart(PLFConfig::getInstance()->get_idb_path())) {
-  }
+  runStage("idb", [config]() { return tmInst->idbStart(config->get_idb_path()); });
 
   /// run fp
   /// fp autorun depends on fp_config, which has to be verified
@@ -78,46 +87,113 @@ void Flow::runFlow()
   //   if (tmInst->autoRunFloorplan(PLFConfig::getInstance()->get_ifp_path())) { }
   // }
 
+  /// all the stages below work on the same idb design, nothing is written between stages unless a checkpoint is
+  /// asked for. With the timing engine kept, iTO syncs its netlist and graph with the changes of the former stages.
   /// run placer
-  if (PLFConfig::getInstance()->is_run_placer()) {
-    if (tmInst->autoRunPlacer(PLFConfig::getInstance()->get_ipl_path())) {
-    }
+  if (config->is_run_placer()) {
+    runStage("place", [config]() { return tmInst->autoRunPlacer(config->get_ipl_path()); });
   }
 
   /// run TO
-  if (PLFConfig::getInstance()->is_run_to()) {
-    if (tmInst->autoRunTO(PLFConfig::getInstance()->get_ito_path())) {
-    }
+  if (config->is_run_to()) {
+    runStage("to", [config]() { return tmInst->autoRunTO(config->get_ito_path()); });
   }
 
   /// run cts
-  if (PLFConfig::getInstance()->is_run_cts()) {
-    if (tmInst->autoRunCTS(PLFConfig::getInstance()->get_icts_path())) {
-    }
+  if (config->is_run_cts()) {
+    runStage("cts", [config]() { return tmInst->autoRunCTS(config->get_icts_path()); });
   }
 
   /// run router
-  if (PLFConfig::getInstance()->is_run_router()) {
-    if (tmInst->autoRunRouter(PLFConfig::getInstance()->get_irt_path())) {
-    }
+  if (config->is_run_router()) {
+    runStage("route", [config]() { return tmInst->autoRunRouter(config->get_irt_path()); });
   }
 
   /// run filler
-  if (PLFConfig::getInstance()->is_run_placer()) {
-    if (tmInst->runPlacerFiller(PLFConfig::getInstance()->get_ipl_path())) {
-    }
+  if (config->is_run_placer()) {
+    runStage("filler", [config]() { return tmInst->runPlacerFiller(config->get_ipl_path()); });
   }
 
   /// run DRC
-  if (PLFConfig::getInstance()->is_run_drc()) {
-    if (tmInst->autoRunDRC(PLFConfig::getInstance()->get_idrc_path())) {
-    }
+  if (config->is_run_drc()) {
+    runStage("drc", [config]() { return tmInst->autoRunDRC(config->get_idrc_path()); });
   }
 
+  reportStages();
+
   /// run gui
-  if (PLFConfig::getInstance()->is_run_gui()) {
+  if (config->is_run_gui()) {
     tmInst->guiStart();
   }
 }
 
+bool Flow::runStage(const string& name, std::function<bool()> stage)
+{
+  FlowStageRecord record;
+  record.name = name;
+
+  ieda::Stats stats;
+  record.success = stage();
+  record.runtime = stats.elapsedRunTime();
+  record.memory = stats.memoryDelta();
+
+  if (PLFConfig::getInstance()->is_checkpoint_stage(name)) {
+    record.checkpoint = saveCheckpoint(name);
+  }
+
+  _stage_records.push_back(record);
+  return record.success;
+}
+
+/**
+ * @brief write the design to <checkpoint_dir>/<stage>.def
+ * @return the time spent on writing, in s
+ */
+double Flow::saveCheckpoint(const string& name)
+{
+  ieda::Stats stats;
+
+  string checkpoint_dir = PLFConfig::getInstance()->get_checkpoint_dir();
+  if (checkpoint_dir.empty()) {
+    checkpoint_dir = "./checkpoint";
+  }
+  std::filesystem::create_directories(checkpoint_dir);
+
+  string def_path = checkpoint_dir + "/" + name + ".def";
+  if (!dmInst->saveDef(def_path)) {
+    std::cout << "Save checkpoint failed, path = " << def_path << std::endl;
+  }
+
+  return stats.elapsedRunTime();
+}
+
+void Flow::reportStages()
+{
+  std::stringstream report;
+  report << std::left << std::setw(12) << "stage" << std::setw(10) << "status" << std::right << std::setw(14) << "runtime(s)"
+         << std::setw(14) << "memory(MB)" << std::setw(16) << "checkpoint(s)" << std::endl;
+
+  double total_runtime = 0;
+  double total_checkpoint = 0;
+  for (auto& record : _stage_records) {
+    report << std::left << std::setw(12) << record.name << std::setw(10) << (record.success ? "success" : "failed") << std::right
+           << std::fixed << std::setprecision(3) << std::setw(14) << record.runtime << std::setw(14) << record.memory << std::setw(16)
+           << record.checkpoint << std::endl;
+    total_runtime += record.runtime + record.checkpoint;
+    total_checkpoint += record.checkpoint;
+  }
+  report << std::left << std::setw(22) << "total" << std::right << std::setw(14) << total_runtime << std::setw(14) << "" << std::setw(16)
+         << total_checkpoint << std::endl;
+
+  std::cout << std::endl << "Flow stages" << (PLFConfig::getInstance()->is_pipeline_keep_timing_engine() ? " (timing engine kept)" : "") << std::endl
+            << report.str() << std::endl;
+
+  string report_path = PLFConfig::getInstance()->get_pipeline_report_path();
+  if (!report_path.empty()) {
+    std::ofstream report_file(report_path);
+    report_file << report.str();
+    report_file.close();
+  }
+}
+
 }  // namespace iplf
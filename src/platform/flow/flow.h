@@ -26,7 +26,9 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#include <functional>
 #include <string>
+#include <vector>
 
 #include "config/flow_config.h"
 #include "tool_manager.h"
@@ -37,6 +39,15 @@ using std::vector;
 namespace iplf {
 #define plfInst Flow::getInstance()
 
+struct FlowStageRecord
+{
+  string name;
+  bool success = false;
+  double runtime = 0;     /// s
+  double memory = 0;      /// MB
+  double checkpoint = 0;  /// s, time to write the checkpoint
+};
+
 class Flow
 {
  public:
@@ -53,8 +64,17 @@ class Flow
   void runFlow();
   void runTcl(int argc, char** argv);
 
+  /// run one stage on the design in memory, the def checkpoint is written only if the stage is a checkpoint stage
+  bool runStage(const string& name, std::function<bool()> stage);
+  const vector<FlowStageRecord>& get_stage_records() { return _stage_records; }
+  void clearStageRecords() { _stage_records.clear(); }
+  void reportStages();
+
  private:
   static Flow* _instance;
+  vector<FlowStageRecord> _stage_records;
+
+  double saveCheckpoint(const string& name);
 
   Flow() {}
   ~Flow() = default;
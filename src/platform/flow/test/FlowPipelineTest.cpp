@@ -0,0 +1,205 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+#include <array>
+#include <cstdlib>
+#include <filesystem>
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "IdbDesign.h"
+#include "IdbInstance.h"
+#include "api/TimingEngine.hh"
+#include "api/TimingIDBAdapter.hh"
+#include "flow.h"
+#include "gtest/gtest.h"
+#include "idm.h"
+#include "tool_manager.h"
+
+namespace iplf {
+
+/**
+ * @brief the max and min slack of the vertexes by name, and the vertex and arc number of the graph.
+ */
+struct TimingDump
+{
+  std::size_t vertex_num = 0;
+  std::size_t arc_num = 0;
+  std::map<std::string, std::array<std::optional<double>, 2>> slacks;
+};
+
+TimingDump dumpTiming(ista::TimingEngine* timing_engine)
+{
+  TimingDump dump;
+  auto& the_graph = timing_engine->get_ista()->get_graph();
+  dump.vertex_num = the_graph.numVertex();
+  dump.arc_num = the_graph.numArc();
+
+  ista::StaVertex* the_vertex;
+  FOREACH_VERTEX(&the_graph, the_vertex)
+  {
+    dump.slacks[the_vertex->getName()]
+        = {the_vertex->getWorstSlackNs(ista::AnalysisMode::kMax), the_vertex->getWorstSlackNs(ista::AnalysisMode::kMin)};
+  }
+  return dump;
+}
+
+/**
+ * @brief The stages run on the design of the flow config IPLF_TEST_FLOW_CONFIG, the test is skipped when it is unset.
+ * The design should have drv violations to be fixed by iTO.
+ */
+class FlowPipelineTest : public testing::Test
+{
+ protected:
+  void SetUp() override
+  {
+    const char* flow_config = std::getenv("IPLF_TEST_FLOW_CONFIG");
+    if (!flow_config) {
+      GTEST_SKIP() << "IPLF_TEST_FLOW_CONFIG is not set.";
+    }
+
+    static bool is_init = false;
+    if (!is_init) {
+      ASSERT_TRUE(flowConfigInst->initConfig(flow_config));
+      ASSERT_TRUE(tmInst->idbStart(flowConfigInst->get_idb_path()));
+      is_init = true;
+    }
+
+    _checkpoint_dir = testing::TempDir() + "flow_pipeline_checkpoint";
+    std::filesystem::remove_all(_checkpoint_dir);
+    flowConfigInst->set_checkpoint_dir(_checkpoint_dir);
+    plfInst->clearStageRecords();
+  }
+
+  void TearDown() override
+  {
+    flowConfigInst->set_checkpoint_stages({});
+    std::filesystem::remove_all(_checkpoint_dir);
+  }
+
+  std::string _checkpoint_dir;
+};
+
+TEST_F(FlowPipelineTest, stages_share_design_and_sync_timing)
+{
+  flowConfigInst->set_checkpoint_stages({});
+  flowConfigInst->set_pipeline_keep_timing_engine(true);
+
+  idb::IdbDesign* design = dmInst->get_idb_design();
+  ASSERT_NE(design, nullptr);
+  std::set<std::string> origin_inst_names;
+  for (auto* idb_inst : design->get_instance_list()->get_instance_list()) {
+    origin_inst_names.insert(idb_inst->get_name());
+  }
+
+  // iTO inserts the buffers into the idb design, and keeps its timing engine.
+  ASSERT_TRUE(plfInst->runStage("to", []() { return tmInst->RunTODrv(flowConfigInst->get_ito_path()); }));
+  std::vector<idb::IdbInstance*> inserted_insts;
+  for (auto* idb_inst : design->get_instance_list()->get_instance_list()) {
+    if (!origin_inst_names.contains(idb_inst->get_name())) {
+      inserted_insts.push_back(idb_inst);
+    }
+  }
+  ASSERT_FALSE(inserted_insts.empty()) << "no buffer is inserted by iTO.";
+
+  // iPL legalizes the buffers on the same design, nothing is written or read between the stages.
+  ASSERT_TRUE(plfInst->runStage("legalization", []() { return tmInst->runPlacerIncrementalLegalization(); }));
+  EXPECT_EQ(dmInst->get_idb_design(), design);
+  for (auto* inserted_inst : inserted_insts) {
+    EXPECT_EQ(design->get_instance_list()->find_instance(inserted_inst->get_name()), inserted_inst);
+  }
+  EXPECT_TRUE(tmInst->checkLegality());
+
+  for (auto& record : plfInst->get_stage_records()) {
+    EXPECT_TRUE(record.success) << record.name;
+    EXPECT_EQ(record.checkpoint, 0) << record.name;
+  }
+  EXPECT_FALSE(std::filesystem::exists(_checkpoint_dir));
+
+  // the timing engine of iTO is synced with the legalized design as the refresh of the next iTO stage.
+  auto& db_config = dmInst->get_config();
+  auto* timing_engine = ista::TimingEngine::getOrCreateTimingEngine();
+  auto* idb_adapter = dynamic_cast<ista::TimingIDBAdapter*>(timing_engine->get_db_adapter());
+  ASSERT_NE(idb_adapter, nullptr);
+  ASSERT_TRUE(idb_adapter->incrConvertDBToTimingNetlist());
+
+  double dbu = design->get_units()->get_micron_dbu();
+  auto* design_netlist = timing_engine->get_netlist();
+  for (auto* inserted_inst : inserted_insts) {
+    auto* sta_inst = design_netlist->findInstance(inserted_inst->get_name().c_str());
+    ASSERT_NE(sta_inst, nullptr) << inserted_inst->get_name();
+    EXPECT_DOUBLE_EQ(sta_inst->get_coordinate()->first, inserted_inst->get_coordinate()->get_x() / dbu);
+    EXPECT_DOUBLE_EQ(sta_inst->get_coordinate()->second, inserted_inst->get_coordinate()->get_y() / dbu);
+  }
+
+  timing_engine->readSdc(db_config.get_sdc_path().c_str());
+  timing_engine->updateTiming();
+  auto synced_dump = dumpTiming(timing_engine);
+
+  // build the timing engine from scratch on the same design.
+  ista::TimingEngine::destroyTimingEngine();
+  timing_engine = ista::TimingEngine::getOrCreateTimingEngine();
+  timing_engine->readLiberty(db_config.get_lib_paths());
+  auto new_idb_adapter = std::make_unique<ista::TimingIDBAdapter>(timing_engine->get_ista());
+  new_idb_adapter->set_idb(dmInst->get_idb_builder());
+  new_idb_adapter->convertDBToTimingNetlist(true);
+  timing_engine->set_db_adapter(std::move(new_idb_adapter));
+  timing_engine->readSdc(db_config.get_sdc_path().c_str());
+  timing_engine->buildGraph();
+  timing_engine->updateTiming();
+  auto full_dump = dumpTiming(timing_engine);
+
+  EXPECT_EQ(synced_dump.vertex_num, full_dump.vertex_num);
+  EXPECT_EQ(synced_dump.arc_num, full_dump.arc_num);
+  ASSERT_EQ(synced_dump.slacks.size(), full_dump.slacks.size());
+  for (auto& [vertex_name, full_slacks] : full_dump.slacks) {
+    auto it = synced_dump.slacks.find(vertex_name);
+    ASSERT_NE(it, synced_dump.slacks.end()) << vertex_name;
+    for (std::size_t index = 0; index < full_slacks.size(); ++index) {
+      ASSERT_EQ(it->second[index].has_value(), full_slacks[index].has_value()) << vertex_name;
+      if (full_slacks[index]) {
+        EXPECT_NEAR(*(it->second[index]), *full_slacks[index], 1e-6) << vertex_name;
+      }
+    }
+  }
+
+  flowConfigInst->set_pipeline_keep_timing_engine(false);
+}
+
+TEST_F(FlowPipelineTest, checkpoint_only_asked_stage)
+{
+  flowConfigInst->set_checkpoint_stages({"legalization"});
+
+  EXPECT_TRUE(plfInst->runStage("legalization", []() { return tmInst->runPlacerIncrementalLegalization(); }));
+  EXPECT_TRUE(plfInst->runStage("legality", []() { return tmInst->checkLegality(); }));
+
+  auto& records = plfInst->get_stage_records();
+  ASSERT_EQ(records.size(), 2);
+  EXPECT_TRUE(records[0].success);
+  EXPECT_TRUE(records[1].success);
+  EXPECT_EQ(records[1].checkpoint, 0);
+
+  std::vector<std::string> def_files;
+  for (auto& entry : std::filesystem::directory_iterator(_checkpoint_dir)) {
+    def_files.push_back(entry.path().filename().string());
+  }
+  EXPECT_EQ(def_files, std::vector<std::string>({"legalization.def"}));
+}
+
+}  // namespace iplf
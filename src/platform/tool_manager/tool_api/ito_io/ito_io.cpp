@@ -211,6 +211,9 @@ void ToIO::resetConfig()
   if (!db_config.get_sdc_path().empty()) {
     ToApiInst.resetConfigSdc(db_config.get_sdc_path());
   }
+
+  /// the flow keeps the timing engine between stages, iTO syncs it with the changed design
+  ToApiInst.resetConfigReuseTimingEngine(flowConfigInst->is_pipeline_keep_timing_engine());
 }
 
 }  // namespace iplf
@@ -0,0 +1,102 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+/**
+ * @file NamePool.cc
+ * @brief The global interned name pool shared by the database and the tools.
+ */
+
+#include "NamePool.hh"
+
+#include <mutex>
+
+namespace ieda {
+
+const std::string& Name::emptyStr()
+{
+  static const std::string empty_str;
+  return empty_str;
+}
+
+/**
+ * @brief Get the global name pool, the pool live until the program exit.
+ *
+ */
+NamePool& NamePool::getInstance()
+{
+  static NamePool* name_pool = new NamePool();
+  return *name_pool;
+}
+
+/**
+ * @brief Intern the name, the empty name is the null handle.
+ *
+ * @param name
+ * @return Name
+ */
+Name NamePool::intern(std::string_view name)
+{
+  if (name.empty()) {
+    return Name();
+  }
+
+  auto& shard = _shards[shardIndex(StrHash()(name))];
+  {
+    std::shared_lock lock(shard._mutex);
+    if (auto found = shard._names.find(name); found != shard._names.end()) {
+      return Name(&(*found));
+    }
+  }
+
+  std::unique_lock lock(shard._mutex);
+  auto [it, is_inserted] = shard._names.emplace(name);
+  return Name(&(*it));
+}
+
+/**
+ * @brief Find the interned name, return the null handle if the name is not
+ * interned, which means no object is named by it.
+ *
+ * @param name
+ * @return Name
+ */
+Name NamePool::find(std::string_view name) const
+{
+  if (name.empty()) {
+    return Name();
+  }
+
+  auto& shard = _shards[shardIndex(StrHash()(name))];
+  std::shared_lock lock(shard._mutex);
+  auto found = shard._names.find(name);
+  return found != shard._names.end() ? Name(&(*found)) : Name();
+}
+
+/**
+ * @brief The num of the interned names.
+ *
+ */
+size_t NamePool::size() const
+{
+  size_t num = 0;
+  for (auto& shard : _shards) {
+    std::shared_lock lock(shard._mutex);
+    num += shard._names.size();
+  }
+  return num;
+}
+
+}  // namespace ieda
@@ -0,0 +1,117 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+/**
+ * @file NamePool.hh
+ * @brief The global interned name pool shared by the database and the tools.
+ */
+
+#pragma once
+
+#include <array>
+#include <functional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+namespace ieda {
+
+/**
+ * @brief The handle of the interned name. The same name is interned only once,
+ * so two handles are compared and hashed by the pointer of the name.
+ *
+ */
+class Name
+{
+ public:
+  Name() = default;
+  ~Name() = default;
+
+  [[nodiscard]] const std::string& str() const { return _str ? *_str : emptyStr(); }
+  [[nodiscard]] const char* c_str() const { return str().c_str(); }
+  [[nodiscard]] bool empty() const { return _str == nullptr; }
+
+  bool operator==(const Name& rhs) const { return _str == rhs._str; }
+  bool operator!=(const Name& rhs) const { return _str != rhs._str; }
+
+  /**
+   * @brief The hash of the name handle, no string is hashed.
+   *
+   */
+  struct Hash
+  {
+    size_t operator()(const Name& name) const { return std::hash<const std::string*>()(name._str); }
+  };
+
+ private:
+  friend class NamePool;
+  explicit Name(const std::string* str) : _str(str) {}
+  static const std::string& emptyStr();
+
+  const std::string* _str = nullptr;  //!< The interned string, nullptr is the empty name.
+};
+
+/**
+ * @brief The thread-safe pool of the interned names, the pool is divided into
+ * shards by the name hash, each shard has its own lock, so the netlist can be
+ * built in parallel. The interned names are never released.
+ *
+ */
+class NamePool
+{
+ public:
+  static NamePool& getInstance();
+
+  Name intern(std::string_view name);
+  [[nodiscard]] Name find(std::string_view name) const;
+  [[nodiscard]] size_t size() const;
+
+ private:
+  NamePool() = default;
+  ~NamePool() = default;
+  NamePool(const NamePool&) = delete;
+  NamePool& operator=(const NamePool&) = delete;
+
+  static constexpr size_t kShardNum = 64;
+
+  struct StrHash
+  {
+    using is_transparent = void;
+    size_t operator()(std::string_view str) const { return std::hash<std::string_view>()(str); }
+  };
+
+  struct Shard
+  {
+    mutable std::shared_mutex _mutex;
+    std::unordered_set<std::string, StrHash, std::equal_to<>> _names;  //!< The node based set keep the string address stable.
+  };
+
+  static size_t shardIndex(size_t hash) { return (hash >> 16) % kShardNum; }
+
+  std::array<Shard, kShardNum> _shards;
+};
+
+/**
+ * @brief Intern the name in the global name pool.
+ *
+ */
+inline Name internName(std::string_view name)
+{
+  return NamePool::getInstance().intern(name);
+}
+
+}  // namespace ieda
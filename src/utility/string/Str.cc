@@ -612,10 +612,12 @@ std::pair<std::string, std::optional<int>> Str::matchBusName(const char* str)
 
   char* copy_str = Str::copy(str);
 
-  char* token = strtok(copy_str, "[");
+  // strtok_r keeps the match reentrant, the bus names are matched by the parallel netlist build.
+  char* save_ptr = nullptr;
+  char* token = strtok_r(copy_str, "[", &save_ptr);
   std::string base_name = token;
   if (token) {
-    token = strtok(nullptr, "]");
+    token = strtok_r(nullptr, "]", &save_ptr);
     if (token) {
       int index = Str::toInt(token);
       return {base_name, index};
@@ -0,0 +1,77 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "string/NamePool.hh"
+
+using ieda::Name;
+using ieda::NamePool;
+
+namespace {
+
+TEST(NamePoolTest, intern) {
+  Name name1 = ieda::internName("u0/u1/A");
+  std::string str = "u0/u1/A";
+  Name name2 = ieda::internName(str);
+
+  EXPECT_EQ(name1, name2);
+  EXPECT_EQ(name1.c_str(), name2.c_str());
+  EXPECT_EQ(name1.str(), "u0/u1/A");
+  EXPECT_NE(name1, ieda::internName("u0/u1/B"));
+}
+
+TEST(NamePoolTest, empty) {
+  Name name;
+  EXPECT_TRUE(name.empty());
+  EXPECT_EQ(name.str(), "");
+  EXPECT_EQ(ieda::internName(""), name);
+}
+
+TEST(NamePoolTest, find) {
+  auto& name_pool = NamePool::getInstance();
+  EXPECT_TRUE(name_pool.find("name_pool_test_not_interned").empty());
+
+  Name name = ieda::internName("name_pool_test_interned");
+  EXPECT_EQ(name_pool.find("name_pool_test_interned"), name);
+}
+
+TEST(NamePoolTest, parallel) {
+  const int thread_num = 8;
+  const int name_num = 10000;
+  std::vector<std::vector<Name>> thread_names(thread_num);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < thread_num; ++i) {
+    threads.emplace_back([i, &thread_names]() {
+      for (int j = 0; j < name_num; ++j) {
+        thread_names[i].push_back(ieda::internName("parallel_net_" + std::to_string(j)));
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (int i = 1; i < thread_num; ++i) {
+    EXPECT_EQ(thread_names[i], thread_names[0]);
+  }
+}
+
+}  // namespace